@@ -4,10 +4,13 @@
 #include "../micro_benchmark_basic_fixture.hpp"
 #include "benchmark/benchmark.h"
 #include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/aggregate_sort.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "synthetic_table_generator.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -30,6 +33,38 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_AggregateHash)(benchmark::State& stat
   }
 }
 
+// GROUP BY with a million groups on ten million rows, aggregated with the number of workers given by the benchmark's
+// argument. This shows how the parallel aggregation of AggregateHash scales with the number of cores.
+void BM_AggregateHashHighCardinality(benchmark::State& state) {
+  const auto worker_count = static_cast<uint32_t>(state.range(0));
+  constexpr auto ROW_COUNT = size_t{10'000'000};
+  constexpr auto GROUP_COUNT = 1'000'000.0;
+
+  const auto column_specifications = std::vector<ColumnSpecification>{
+      ColumnSpecification(ColumnDataDistribution::make_uniform_config(0.0, GROUP_COUNT), DataType::Int),
+      ColumnSpecification(ColumnDataDistribution::make_uniform_config(0.0, 1'000.0), DataType::Int)};
+  const auto table_wrapper = std::make_shared<TableWrapper>(
+      SyntheticTableGenerator::generate_table(column_specifications, ROW_COUNT, Chunk::DEFAULT_SIZE));
+  table_wrapper->execute();
+
+  Hyrise::get().topology.use_non_numa_topology(worker_count);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      sum_(pqp_column_(ColumnID{1}, DataType::Int, false, "b")),
+      max_(pqp_column_(ColumnID{1}, DataType::Int, false, "b"))};
+  const auto groupby = std::vector<ColumnID>{ColumnID{0}};
+
+  for (auto _ : state) {
+    const auto aggregate = std::make_shared<AggregateHash>(table_wrapper, aggregates, groupby);
+    aggregate->execute();
+  }
+
+  Hyrise::reset();
+}
+
+BENCHMARK(BM_AggregateHashHighCardinality)->RangeMultiplier(2)->Range(1, 32)->UseRealTime();
+
 BENCHMARK_F(MicroBenchmarkBasicFixture, BM_AggregateSortNotSortedNoGroupBy)(benchmark::State& state) {
   _clear_cache();
 
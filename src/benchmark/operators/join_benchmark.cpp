@@ -1,14 +1,18 @@
+#include <algorithm>
 #include <memory>
 
 #include "benchmark/benchmark.h"
 #include "hyrise.hpp"
+#include "operators/join_array.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_hash/join_hash_bloom_filter.hpp"
 #include "operators/join_index.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk.hpp"
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/value_segment.hpp"
 #include "synthetic_table_generator.hpp"
 #include "types.hpp"
 
@@ -58,6 +62,29 @@ std::shared_ptr<TableWrapper> generate_table(const size_t number_of_rows) {
   return table_wrapper;
 }
 
+// Generates a table of keys from 1 to key_count. If row_count equals key_count, each key is contained once (as for a
+// primary key), otherwise the keys are repeated (as for a foreign key). The keys are shuffled by a constant stride.
+std::shared_ptr<TableWrapper> generate_dense_key_table(const size_t row_count, const size_t key_count) {
+  constexpr auto STRIDE = size_t{7'919};
+
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"key", DataType::Int, false}}, TableType::Data);
+
+  const auto chunk_size = row_count / NUMBER_OF_CHUNKS;
+  for (auto chunk_begin = size_t{0}; chunk_begin < row_count; chunk_begin += chunk_size) {
+    const auto chunk_end = std::min(chunk_begin + chunk_size, row_count);
+    auto values = pmr_vector<int32_t>(chunk_end - chunk_begin);
+    for (auto row_idx = chunk_begin; row_idx < chunk_end; ++row_idx) {
+      values[row_idx - chunk_begin] = static_cast<int32_t>((row_idx * STRIDE) % key_count + 1);
+    }
+    table->append_chunk(Segments{std::make_shared<ValueSegment<int32_t>>(std::move(values))});
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  return table_wrapper;
+}
+
 template <class C>
 void bm_join_impl(benchmark::State& state, std::shared_ptr<TableWrapper> table_wrapper_left,
                   std::shared_ptr<TableWrapper> table_wrapper_right) {
@@ -99,6 +126,56 @@ void BM_Join_MediumAndMedium(benchmark::State& state) {  // NOLINT 100,000 x 100
   bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right);
 }
 
+template <class C>
+void BM_Join_DenseKeys(benchmark::State& state) {  // NOLINT 10,000,000 x 100,000
+  auto table_wrapper_left = generate_dense_key_table(TABLE_SIZE_BIG, TABLE_SIZE_MEDIUM);
+  auto table_wrapper_right = generate_dense_key_table(TABLE_SIZE_MEDIUM, TABLE_SIZE_MEDIUM);
+
+  bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right);
+}
+
+// Builds a bloom filter as the first materialization step of the JoinHash does, i.e., sized for the number of values
+void BM_JoinHash_BloomFilterBuild(benchmark::State& state) {  // NOLINT
+  const auto value_count = static_cast<size_t>(state.range(0));
+  const auto hash_function = std::hash<int32_t>{};
+
+  for (auto _ : state) {
+    auto bloom_filter = BloomFilter(value_count);
+    for (auto value = int32_t{0}; value < static_cast<int32_t>(value_count); ++value) {
+      bloom_filter.insert(hash_function(value));
+    }
+    benchmark::DoNotOptimize(bloom_filter);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * value_count));
+}
+
+// Probes a bloom filter with ten times as many values as it contains, one tenth of which were inserted
+void BM_JoinHash_BloomFilterProbe(benchmark::State& state) {  // NOLINT
+  const auto value_count = static_cast<size_t>(state.range(0));
+  const auto probe_count = value_count * 10;
+  const auto hash_function = std::hash<int32_t>{};
+
+  auto bloom_filter = BloomFilter(value_count);
+  for (auto value = int32_t{0}; value < static_cast<int32_t>(probe_count); value += 10) {
+    bloom_filter.insert(hash_function(value));
+  }
+
+  for (auto _ : state) {
+    auto hit_count = size_t{0};
+    for (auto value = int32_t{0}; value < static_cast<int32_t>(probe_count); ++value) {
+      hit_count += bloom_filter.contains(hash_function(value));
+    }
+    benchmark::DoNotOptimize(hit_count);
+  }
+
+  state.counters["false_positive_rate"] = bloom_filter.estimated_false_positive_rate();
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * probe_count));
+}
+
+BENCHMARK(BM_JoinHash_BloomFilterBuild)->RangeMultiplier(100)->Range(1'000, 10'000'000);
+BENCHMARK(BM_JoinHash_BloomFilterProbe)->RangeMultiplier(100)->Range(1'000, 10'000'000);
+
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinNestedLoop);
 
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinIndex);
@@ -108,6 +185,9 @@ BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinIndex);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinHash);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndBig, JoinHash);
 BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinHash);
+BENCHMARK_TEMPLATE(BM_Join_DenseKeys, JoinHash);
+
+BENCHMARK_TEMPLATE(BM_Join_DenseKeys, JoinArray);
 
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinSortMerge);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndBig, JoinSortMerge);
@@ -0,0 +1,36 @@
+#include <memory>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_basic_fixture.hpp"
+#include "operators/set_operation_hash.hpp"
+#include "operators/table_wrapper.hpp"
+
+namespace opossum {
+
+void bm_set_operation_hash(benchmark::State& state, const std::shared_ptr<TableWrapper>& table_wrapper_a,
+                           const std::shared_ptr<TableWrapper>& table_wrapper_b, const SetOperation set_operation) {
+  auto warm_up = std::make_shared<SetOperationHash>(table_wrapper_a, table_wrapper_b, set_operation);
+  warm_up->execute();
+  for (auto _ : state) {
+    auto set_operation_hash = std::make_shared<SetOperationHash>(table_wrapper_a, table_wrapper_b, set_operation);
+    set_operation_hash->execute();
+  }
+}
+
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_SetOperationHashExcept)(benchmark::State& state) {
+  _clear_cache();
+  bm_set_operation_hash(state, _table_wrapper_a, _table_wrapper_b, SetOperation::Except);
+}
+
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_SetOperationHashIntersect)(benchmark::State& state) {
+  _clear_cache();
+  bm_set_operation_hash(state, _table_wrapper_a, _table_wrapper_b, SetOperation::Intersect);
+}
+
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_SetOperationHashUnion)(benchmark::State& state) {
+  _clear_cache();
+  bm_set_operation_hash(state, _table_wrapper_a, _table_wrapper_b, SetOperation::Union);
+}
+
+}  // namespace opossum
@@ -7,6 +7,7 @@
 
 #include "expression/abstract_expression.hpp"
 #include "expression/aggregate_expression.hpp"
+#include "expression/window_function_expression.hpp"
 #include "storage/vector_compression/vector_compression.hpp"
 #include "utils/make_bimap.hpp"
 
@@ -20,10 +21,15 @@ const boost::bimap<AggregateFunction, std::string> aggregate_function_to_string
         {AggregateFunction::Avg, "AVG"},
         {AggregateFunction::Count, "COUNT"},
         {AggregateFunction::CountDistinct, "COUNT DISTINCT"},
+        {AggregateFunction::ApproxCountDistinct, "APPROX_COUNT_DISTINCT"},
         {AggregateFunction::StandardDeviationSample, "STDDEV_SAMP"},
         {AggregateFunction::Any, "ANY"},
     });
 
+const boost::bimap<WindowFunction, std::string> window_function_to_string =
+    make_bimap<WindowFunction, std::string>(
+        {{WindowFunction::RowNumber, "ROW_NUMBER"}, {WindowFunction::Rank, "RANK"}, {WindowFunction::Sum, "SUM"}});
+
 const boost::bimap<FunctionType, std::string> function_type_to_string =
     make_bimap<FunctionType, std::string>({{FunctionType::Substring, "SUBSTR"}, {FunctionType::Concatenate, "CONCAT"}});
 
@@ -58,6 +64,10 @@ std::ostream& operator<<(std::ostream& stream, const AggregateFunction aggregate
   return stream << aggregate_function_to_string.left.at(aggregate_function);
 }
 
+std::ostream& operator<<(std::ostream& stream, const WindowFunction window_function) {
+  return stream << window_function_to_string.left.at(window_function);
+}
+
 std::ostream& operator<<(std::ostream& stream, const FunctionType function_type) {
   return stream << function_type_to_string.left.at(function_type);
 }
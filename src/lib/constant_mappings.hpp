@@ -19,10 +19,12 @@ namespace opossum {
 enum class EncodingType : uint8_t;
 enum class VectorCompressionType : uint8_t;
 enum class AggregateFunction;
+enum class WindowFunction;
 enum class ExpressionType;
 enum class FileType;
 
 extern const boost::bimap<AggregateFunction, std::string> aggregate_function_to_string;
+extern const boost::bimap<WindowFunction, std::string> window_function_to_string;
 extern const boost::bimap<FunctionType, std::string> function_type_to_string;
 extern const boost::bimap<DataType, std::string> data_type_to_string;
 extern const boost::bimap<EncodingType, std::string> encoding_type_to_string;
@@ -31,6 +33,7 @@ extern const boost::bimap<LogLevel, std::string> log_level_to_string;
 extern const boost::bimap<VectorCompressionType, std::string> vector_compression_type_to_string;
 
 std::ostream& operator<<(std::ostream& stream, const AggregateFunction aggregate_function);
+std::ostream& operator<<(std::ostream& stream, const WindowFunction window_function);
 std::ostream& operator<<(std::ostream& stream, const FunctionType function_type);
 std::ostream& operator<<(std::ostream& stream, const DataType data_type);
 std::ostream& operator<<(std::ostream& stream, const EncodingType encoding_type);
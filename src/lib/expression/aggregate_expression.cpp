@@ -14,15 +14,21 @@
 namespace opossum {
 
 AggregateExpression::AggregateExpression(const AggregateFunction init_aggregate_function,
-                                         const std::shared_ptr<AbstractExpression>& argument)
-    : AbstractExpression(ExpressionType::Aggregate, {argument}), aggregate_function(init_aggregate_function) {}
+                                         const std::shared_ptr<AbstractExpression>& argument,
+                                         const uint8_t init_sketch_precision)
+    : AbstractExpression(ExpressionType::Aggregate, {argument}),
+      aggregate_function(init_aggregate_function),
+      sketch_precision(init_sketch_precision) {
+  Assert(sketch_precision >= HyperLogLog::MIN_PRECISION && sketch_precision <= HyperLogLog::MAX_PRECISION,
+         "Invalid precision for APPROX_COUNT_DISTINCT");
+}
 
 std::shared_ptr<AbstractExpression> AggregateExpression::argument() const {
   return arguments.empty() ? nullptr : arguments[0];
 }
 
 std::shared_ptr<AbstractExpression> AggregateExpression::deep_copy() const {
-  return std::make_shared<AggregateExpression>(aggregate_function, argument()->deep_copy());
+  return std::make_shared<AggregateExpression>(aggregate_function, argument()->deep_copy(), sketch_precision);
 }
 
 std::string AggregateExpression::description(const DescriptionMode mode) const {
@@ -31,6 +37,11 @@ std::string AggregateExpression::description(const DescriptionMode mode) const {
   if (aggregate_function == AggregateFunction::CountDistinct) {
     Assert(argument(), "COUNT(DISTINCT ...) requires an argument");
     stream << "COUNT(DISTINCT " << argument()->description(mode) << ")";
+  } else if (aggregate_function == AggregateFunction::ApproxCountDistinct) {
+    Assert(argument(), "APPROX_COUNT_DISTINCT(...) requires an argument");
+    stream << "APPROX_COUNT_DISTINCT(" << argument()->description(mode);
+    if (sketch_precision != HyperLogLog::DEFAULT_PRECISION) stream << ", " << static_cast<int>(sketch_precision);
+    stream << ")";
   } else if (is_count_star(*this)) {
     if (mode == DescriptionMode::ColumnName) {
       stream << "COUNT(*)";
@@ -59,6 +70,10 @@ DataType AggregateExpression::data_type() const {
     return AggregateTraits<NullValue, AggregateFunction::CountDistinct>::AGGREGATE_DATA_TYPE;
   }
 
+  if (aggregate_function == AggregateFunction::ApproxCountDistinct) {
+    return AggregateTraits<NullValue, AggregateFunction::ApproxCountDistinct>::AGGREGATE_DATA_TYPE;
+  }
+
   const auto argument_data_type = argument()->data_type();
   auto aggregate_data_type = DataType::Null;
 
@@ -76,6 +91,7 @@ DataType AggregateExpression::data_type() const {
         break;
       case AggregateFunction::Count:
       case AggregateFunction::CountDistinct:
+      case AggregateFunction::ApproxCountDistinct:
         break;  // These are handled above
       case AggregateFunction::Sum:
         aggregate_data_type = AggregateTraits<AggregateDataType, AggregateFunction::Sum>::AGGREGATE_DATA_TYPE;
@@ -110,15 +126,22 @@ bool AggregateExpression::is_count_star(const AbstractExpression& expression) {
 bool AggregateExpression::_shallow_equals(const AbstractExpression& expression) const {
   DebugAssert(dynamic_cast<const AggregateExpression*>(&expression),
               "Different expression type should have been caught by AbstractExpression::operator==");
-  return aggregate_function == static_cast<const AggregateExpression&>(expression).aggregate_function;
+  const auto& aggregate_expression = static_cast<const AggregateExpression&>(expression);
+  return aggregate_function == aggregate_expression.aggregate_function &&
+         sketch_precision == aggregate_expression.sketch_precision;
 }
 
-size_t AggregateExpression::_shallow_hash() const { return boost::hash_value(static_cast<size_t>(aggregate_function)); }
+size_t AggregateExpression::_shallow_hash() const {
+  auto hash = boost::hash_value(static_cast<size_t>(aggregate_function));
+  boost::hash_combine(hash, sketch_precision);
+  return hash;
+}
 
 bool AggregateExpression::_on_is_nullable_on_lqp(const AbstractLQPNode& lqp) const {
-  // Aggregates (except COUNT and COUNT DISTINCT) will return NULL when executed on an
+  // Aggregates (except COUNT, COUNT DISTINCT, and APPROX_COUNT_DISTINCT) will return NULL when executed on an
   // empty group - thus they are always nullable
-  return aggregate_function != AggregateFunction::Count && aggregate_function != AggregateFunction::CountDistinct;
+  return aggregate_function != AggregateFunction::Count && aggregate_function != AggregateFunction::CountDistinct &&
+         aggregate_function != AggregateFunction::ApproxCountDistinct;
 }
 
 }  // namespace opossum
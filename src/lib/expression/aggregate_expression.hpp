@@ -1,6 +1,7 @@
 #pragma once
 
 #include "abstract_expression.hpp"
+#include "operators/aggregate/hyper_log_log.hpp"
 
 namespace opossum {
 
@@ -9,13 +10,27 @@ namespace opossum {
  * the ANY() function, which expects all values in the group to be equal and returns that value. In SQL terms, this
  * would be an additional, but unnecessary GROUP BY column. This function is only used by the optimizer in case that
  * all values of the group are known to be equal (see DependentGroupByReductionRule).
+ *
+ * APPROX_COUNT_DISTINCT() estimates the number of distinct values with a HyperLogLog sketch. Other than the exact
+ * COUNT(DISTINCT), it needs a fixed amount of memory per group, and the sketches of partial aggregates can be merged.
  */
-enum class AggregateFunction { Min, Max, Sum, Avg, Count, CountDistinct, StandardDeviationSample, Any };
+enum class AggregateFunction {
+  Min,
+  Max,
+  Sum,
+  Avg,
+  Count,
+  CountDistinct,
+  ApproxCountDistinct,
+  StandardDeviationSample,
+  Any
+};
 
 class AggregateExpression : public AbstractExpression {
  public:
   AggregateExpression(const AggregateFunction init_aggregate_function,
-                      const std::shared_ptr<AbstractExpression>& argument);
+                      const std::shared_ptr<AbstractExpression>& argument,
+                      const uint8_t init_sketch_precision = HyperLogLog::DEFAULT_PRECISION);
 
   std::shared_ptr<AbstractExpression> argument() const;
 
@@ -25,6 +40,9 @@ class AggregateExpression : public AbstractExpression {
 
   const AggregateFunction aggregate_function;
 
+  // Precision of the HyperLogLog sketch of APPROX_COUNT_DISTINCT, ignored by all other functions
+  const uint8_t sketch_precision;
+
   static bool is_count_star(const AbstractExpression& expression);
 
  protected:
@@ -0,0 +1,166 @@
+#include "window_function_expression.hpp"
+
+#include <sstream>
+
+#include "boost/functional/hash.hpp"
+
+#include "aggregate_expression.hpp"
+#include "constant_mappings.hpp"
+#include "expression_utils.hpp"
+#include "operators/aggregate/aggregate_traits.hpp"
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::vector<std::shared_ptr<AbstractExpression>> window_function_arguments(
+    const std::shared_ptr<AbstractExpression>& argument,
+    const std::vector<std::shared_ptr<AbstractExpression>>& partition_by_expressions,
+    const std::vector<std::shared_ptr<AbstractExpression>>& order_by_expressions) {
+  auto arguments = std::vector<std::shared_ptr<AbstractExpression>>{};
+  arguments.reserve((argument ? 1 : 0) + partition_by_expressions.size() + order_by_expressions.size());
+  if (argument) arguments.emplace_back(argument);
+  arguments.insert(arguments.end(), partition_by_expressions.begin(), partition_by_expressions.end());
+  arguments.insert(arguments.end(), order_by_expressions.begin(), order_by_expressions.end());
+  return arguments;
+}
+
+void print_frame_bound(std::ostream& stream, const std::optional<uint64_t>& offset, const std::string& direction) {
+  if (!offset) {
+    stream << "UNBOUNDED " << direction;
+  } else if (*offset == 0) {
+    stream << "CURRENT ROW";
+  } else {
+    stream << *offset << " " << direction;
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+bool operator==(const WindowFrame& lhs, const WindowFrame& rhs) {
+  return lhs.type == rhs.type && lhs.preceding == rhs.preceding && lhs.following == rhs.following;
+}
+
+std::ostream& operator<<(std::ostream& stream, const WindowFrame& frame) {
+  stream << (frame.type == WindowFrameType::Rows ? "ROWS" : "RANGE") << " BETWEEN ";
+  print_frame_bound(stream, frame.preceding, "PRECEDING");
+  stream << " AND ";
+  print_frame_bound(stream, frame.following, "FOLLOWING");
+  return stream;
+}
+
+WindowFunctionExpression::WindowFunctionExpression(
+    const WindowFunction init_window_function, const std::shared_ptr<AbstractExpression>& argument,
+    const std::vector<std::shared_ptr<AbstractExpression>>& partition_by_expressions,
+    const std::vector<std::shared_ptr<AbstractExpression>>& order_by_expressions,
+    const std::vector<SortMode>& init_sort_modes, const WindowFrame& init_frame)
+    : AbstractExpression(ExpressionType::WindowFunction,
+                         window_function_arguments(argument, partition_by_expressions, order_by_expressions)),
+      window_function(init_window_function),
+      sort_modes(init_sort_modes),
+      frame(init_frame),
+      _partition_by_begin_idx(argument ? 1 : 0),
+      _order_by_begin_idx(_partition_by_begin_idx + partition_by_expressions.size()) {
+  Assert((window_function == WindowFunction::Sum) == static_cast<bool>(argument),
+         "Expected an argument for SUM() and none for the ranking functions");
+  Assert(order_by_expressions.size() == sort_modes.size(), "Expected as many ORDER BY expressions as SortModes");
+  Assert(frame.type == WindowFrameType::Rows || ((!frame.preceding || *frame.preceding == 0) &&
+                                                 (!frame.following || *frame.following == 0)),
+         "RANGE frames only support UNBOUNDED and CURRENT ROW bounds");
+}
+
+std::shared_ptr<AbstractExpression> WindowFunctionExpression::argument() const {
+  return _partition_by_begin_idx > 0 ? arguments[0] : nullptr;
+}
+
+std::vector<std::shared_ptr<AbstractExpression>> WindowFunctionExpression::partition_by_expressions() const {
+  return {arguments.begin() + _partition_by_begin_idx, arguments.begin() + _order_by_begin_idx};
+}
+
+std::vector<std::shared_ptr<AbstractExpression>> WindowFunctionExpression::order_by_expressions() const {
+  return {arguments.begin() + _order_by_begin_idx, arguments.end()};
+}
+
+std::shared_ptr<AbstractExpression> WindowFunctionExpression::deep_copy() const {
+  return std::make_shared<WindowFunctionExpression>(window_function, argument() ? argument()->deep_copy() : nullptr,
+                                                    expressions_deep_copy(partition_by_expressions()),
+                                                    expressions_deep_copy(order_by_expressions()), sort_modes, frame);
+}
+
+std::string WindowFunctionExpression::description(const DescriptionMode mode) const {
+  std::stringstream stream;
+
+  stream << window_function << "(";
+  if (argument()) stream << argument()->description(mode);
+  stream << ") OVER (";
+
+  const auto partition_by_expressions = this->partition_by_expressions();
+  if (!partition_by_expressions.empty()) {
+    stream << "PARTITION BY " << expression_descriptions(partition_by_expressions, mode);
+  }
+
+  const auto order_by_expressions = this->order_by_expressions();
+  if (!order_by_expressions.empty()) {
+    if (!partition_by_expressions.empty()) stream << " ";
+    stream << "ORDER BY ";
+    for (auto expression_idx = size_t{0}; expression_idx < order_by_expressions.size(); ++expression_idx) {
+      stream << order_by_expressions[expression_idx]->description(mode) << " " << sort_modes[expression_idx];
+      if (expression_idx + 1 < order_by_expressions.size()) stream << ", ";
+    }
+  }
+
+  // The frame is only relevant for SUM(), and only printed if it is not the default frame
+  if (window_function == WindowFunction::Sum && !(frame == WindowFrame{})) {
+    if (!partition_by_expressions.empty() || !order_by_expressions.empty()) stream << " ";
+    stream << frame;
+  }
+  stream << ")";
+
+  return stream.str();
+}
+
+DataType WindowFunctionExpression::data_type() const {
+  if (window_function != WindowFunction::Sum) return DataType::Long;
+
+  auto sum_data_type = DataType::Null;
+  resolve_data_type(argument()->data_type(), [&](const auto data_type_t) {
+    using ArgumentDataType = typename decltype(data_type_t)::type;
+    if constexpr (std::is_arithmetic_v<ArgumentDataType>) {
+      sum_data_type = AggregateTraits<ArgumentDataType, AggregateFunction::Sum>::AGGREGATE_DATA_TYPE;
+    } else {
+      Fail("SUM() can only be computed on numeric arguments");
+    }
+  });
+
+  return sum_data_type;
+}
+
+bool WindowFunctionExpression::_shallow_equals(const AbstractExpression& expression) const {
+  DebugAssert(dynamic_cast<const WindowFunctionExpression*>(&expression),
+              "Different expression type should have been caught by AbstractExpression::operator==");
+  const auto& window_function_expression = static_cast<const WindowFunctionExpression&>(expression);
+  return window_function == window_function_expression.window_function &&
+         sort_modes == window_function_expression.sort_modes && frame == window_function_expression.frame &&
+         _partition_by_begin_idx == window_function_expression._partition_by_begin_idx &&
+         _order_by_begin_idx == window_function_expression._order_by_begin_idx;
+}
+
+size_t WindowFunctionExpression::_shallow_hash() const {
+  auto hash = boost::hash_value(static_cast<size_t>(window_function));
+  for (const auto sort_mode : sort_modes) {
+    boost::hash_combine(hash, static_cast<size_t>(sort_mode));
+  }
+  boost::hash_combine(hash, _order_by_begin_idx);
+  return hash;
+}
+
+bool WindowFunctionExpression::_on_is_nullable_on_lqp(const AbstractLQPNode& lqp) const {
+  // As each frame contains at least the current row, SUM() is only NULL if its argument is
+  return window_function == WindowFunction::Sum && argument()->is_nullable_on_lqp(lqp);
+}
+
+}  // namespace opossum
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <optional>
+#include <ostream>
+#include <vector>
+
+#include "abstract_expression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Supported window functions, i.e., functions that are computed for each row from the rows of its partition (see
+ * WindowFunctionExpression):
+ *  - ROW_NUMBER() numbers the rows of a partition in the order given by ORDER BY, starting at 1.
+ *  - RANK() is the row number of the first row with the same ORDER BY values (the row's peers). Thus, peers share a
+ *    rank, and the following ranks are skipped.
+ *  - SUM() sums up its argument over the rows of the window frame.
+ */
+enum class WindowFunction { RowNumber, Rank, Sum };
+
+enum class WindowFrameType { Rows, Range };
+
+/**
+ * The rows of a partition that SUM() aggregates for a row. For ROWS frames, the bounds are given in rows before and
+ * after the current row. RANGE frames only support the bounds UNBOUNDED and CURRENT ROW, where CURRENT ROW includes
+ * all peers of the row.
+ *
+ * The default frame is the one SQL uses if no frame is given: RANGE BETWEEN UNBOUNDED PRECEDING AND CURRENT ROW. That
+ * is, a running sum if ORDER BY is given, and the sum of the entire partition otherwise (as all rows are peers).
+ */
+struct WindowFrame {
+  WindowFrameType type{WindowFrameType::Range};
+
+  // std::nullopt means UNBOUNDED PRECEDING or UNBOUNDED FOLLOWING, respectively. 0 means CURRENT ROW.
+  std::optional<uint64_t> preceding{std::nullopt};
+  std::optional<uint64_t> following{0};
+};
+
+bool operator==(const WindowFrame& lhs, const WindowFrame& rhs);
+std::ostream& operator<<(std::ostream& stream, const WindowFrame& frame);
+
+/**
+ * A window function with its OVER clause, e.g., SUM(b) OVER (PARTITION BY a ORDER BY c). The expression is computed by
+ * a WindowNode (and, after translation, by the Window operator), not by the ExpressionEvaluator.
+ *
+ * The arguments are the function's argument (only for SUM()), followed by the PARTITION BY and the ORDER BY
+ * expressions.
+ */
+class WindowFunctionExpression : public AbstractExpression {
+ public:
+  WindowFunctionExpression(const WindowFunction init_window_function,
+                           const std::shared_ptr<AbstractExpression>& argument,
+                           const std::vector<std::shared_ptr<AbstractExpression>>& partition_by_expressions,
+                           const std::vector<std::shared_ptr<AbstractExpression>>& order_by_expressions,
+                           const std::vector<SortMode>& init_sort_modes, const WindowFrame& init_frame = {});
+
+  // nullptr for ROW_NUMBER() and RANK()
+  std::shared_ptr<AbstractExpression> argument() const;
+  std::vector<std::shared_ptr<AbstractExpression>> partition_by_expressions() const;
+  std::vector<std::shared_ptr<AbstractExpression>> order_by_expressions() const;
+
+  std::shared_ptr<AbstractExpression> deep_copy() const override;
+  std::string description(const DescriptionMode mode) const override;
+  DataType data_type() const override;
+
+  const WindowFunction window_function;
+  const std::vector<SortMode> sort_modes;
+  const WindowFrame frame;
+
+ protected:
+  bool _shallow_equals(const AbstractExpression& expression) const override;
+  size_t _shallow_hash() const override;
+  bool _on_is_nullable_on_lqp(const AbstractLQPNode& lqp) const override;
+
+ private:
+  // Positions of the PARTITION BY and the ORDER BY expressions in the arguments
+  const size_t _partition_by_begin_idx;
+  const size_t _order_by_begin_idx;
+};
+
+}  // namespace opossum
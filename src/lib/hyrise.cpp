@@ -1,5 +1,7 @@
 #include "hyrise.hpp"
 
+#include "utils/settings/operator_memory_budget_setting.hpp"
+
 namespace opossum {
 
 Hyrise::Hyrise() {
@@ -21,6 +23,10 @@ Hyrise::Hyrise() {
   log_manager = LogManager{};
   topology = Topology{};
   _scheduler = std::make_shared<ImmediateExecutionScheduler>();
+
+  // Settings of src/lib components. They are added directly, as register_at_settings_manager() would access the Hyrise
+  // instance that is being replaced (see reset()) or constructed.
+  settings_manager._add(std::make_shared<OperatorMemoryBudgetSetting>());
 }
 
 void Hyrise::reset() {
@@ -39,6 +39,7 @@ enum class LQPNodeType {
   Update,
   Union,
   Validate,
+  Window,
   Mock
 };
 
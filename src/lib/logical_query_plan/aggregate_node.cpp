@@ -7,6 +7,8 @@
 #include <string>
 #include <vector>
 
+#include "boost/functional/hash.hpp"
+
 #include "expression/aggregate_expression.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/lqp_column_expression.hpp"
@@ -39,6 +41,7 @@ std::string AggregateNode::description(const DescriptionMode mode) const {
   std::stringstream stream;
 
   stream << "[Aggregate] ";
+  if (is_group_join) stream << "(GroupJoin) ";
 
   stream << "GroupBy: [";
   for (auto expression_idx = size_t{0}; expression_idx < aggregate_expressions_begin_idx; ++expression_idx) {
@@ -158,7 +161,11 @@ std::vector<FunctionalDependency> AggregateNode::non_trivial_functional_dependen
   return non_trivial_fds;
 }
 
-size_t AggregateNode::_on_shallow_hash() const { return aggregate_expressions_begin_idx; }
+size_t AggregateNode::_on_shallow_hash() const {
+  auto hash = boost::hash_value(aggregate_expressions_begin_idx);
+  boost::hash_combine(hash, is_group_join);
+  return hash;
+}
 
 std::shared_ptr<AbstractLQPNode> AggregateNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
   const auto group_by_expressions = std::vector<std::shared_ptr<AbstractExpression>>{
@@ -167,9 +174,11 @@ std::shared_ptr<AbstractLQPNode> AggregateNode::_on_shallow_copy(LQPNodeMapping&
   const auto aggregate_expressions = std::vector<std::shared_ptr<AbstractExpression>>{
       node_expressions.begin() + aggregate_expressions_begin_idx, node_expressions.end()};
 
-  return std::make_shared<AggregateNode>(
+  const auto copy = std::make_shared<AggregateNode>(
       expressions_copy_and_adapt_to_different_lqp(group_by_expressions, node_mapping),
       expressions_copy_and_adapt_to_different_lqp(aggregate_expressions, node_mapping));
+  copy->is_group_join = is_group_join;
+  return copy;
 }
 
 bool AggregateNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
@@ -177,6 +186,7 @@ bool AggregateNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNode
 
   return expressions_equal_to_expressions_in_different_lqp(node_expressions, aggregate_node.node_expressions,
                                                            node_mapping) &&
-         aggregate_expressions_begin_idx == aggregate_node.aggregate_expressions_begin_idx;
+         aggregate_expressions_begin_idx == aggregate_node.aggregate_expressions_begin_idx &&
+         is_group_join == aggregate_node.is_group_join;
 }
 }  // namespace opossum
@@ -38,6 +38,10 @@ class AggregateNode : public EnableMakeForLQPNode<AggregateNode>, public Abstrac
   // node_expression contains both the group_by- and the aggregate_expressions in that order.
   size_t aggregate_expressions_begin_idx;
 
+  // Set by the GroupJoinRule if the input is a JoinNode that can be fused with this node into a GroupJoin. The JoinNode
+  // remains in the LQP, but is not translated into an operator of its own.
+  bool is_group_join{false};
+
  protected:
   size_t _on_shallow_hash() const override;
   std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
@@ -54,6 +54,15 @@ class JoinNode : public EnableMakeForLQPNode<JoinNode>, public AbstractLQPNode {
 
   JoinMode join_mode;
 
+  // Set by the RuntimeJoinFilterRule on Semi Joins that are translated into a RuntimeJoinFilter. As the filter might
+  // emit rows without a join partner, such a node is not equivalent to a regular Semi Join.
+  bool is_runtime_join_filter{false};
+
+  // Set by the JoinOrderingRule on the Inner Joins of a cyclic join graph that are executed together by a single
+  // multi-way join operator (see JoinLeapfrogTriejoin). The flagged nodes form a left-deep tree, the LQPTranslator
+  // translates the topmost flagged node and all flagged nodes below it into one operator.
+  bool is_multiway_join{false};
+
  protected:
   /**
    * @return A subset of the given LQPUniqueConstraints @param left_unique_constraints and @param
@@ -3,6 +3,8 @@
 #include <sstream>
 #include <string>
 
+#include "boost/functional/hash.hpp"
+
 #include "expression/abstract_expression.hpp"
 #include "expression/expression_utils.hpp"
 #include "utils/assert.hpp"
@@ -16,7 +18,9 @@ std::string LimitNode::description(const DescriptionMode mode) const {
   const auto expression_mode = _expression_description_mode(mode);
 
   std::stringstream stream;
-  stream << "[Limit] " << num_rows_expression()->description(expression_mode);
+  stream << "[Limit] ";
+  if (is_top_k) stream << "(TopK) ";
+  stream << num_rows_expression()->description(expression_mode);
   return stream.str();
 }
 
@@ -26,14 +30,19 @@ std::shared_ptr<LQPUniqueConstraints> LimitNode::unique_constraints() const {
 
 std::shared_ptr<AbstractExpression> LimitNode::num_rows_expression() const { return node_expressions[0]; }
 
+size_t LimitNode::_on_shallow_hash() const { return boost::hash_value(is_top_k); }
+
 std::shared_ptr<AbstractLQPNode> LimitNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
-  return LimitNode::make(expression_copy_and_adapt_to_different_lqp(*num_rows_expression(), node_mapping));
+  const auto copy = LimitNode::make(expression_copy_and_adapt_to_different_lqp(*num_rows_expression(), node_mapping));
+  copy->is_top_k = is_top_k;
+  return copy;
 }
 
 bool LimitNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
   const auto& limit_node = static_cast<const LimitNode&>(rhs);
   return expression_equal_to_expression_in_different_lqp(*num_rows_expression(), *limit_node.num_rows_expression(),
-                                                         node_mapping);
+                                                         node_mapping) &&
+         is_top_k == limit_node.is_top_k;
 }
 
 }  // namespace opossum
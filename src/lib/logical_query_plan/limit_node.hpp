@@ -20,7 +20,12 @@ class LimitNode : public EnableMakeForLQPNode<LimitNode>, public AbstractLQPNode
 
   std::shared_ptr<AbstractExpression> num_rows_expression() const;
 
+  // Set by the TopKRule if the input is a SortNode that can be fused with this node into a TopK. The SortNode remains
+  // in the LQP, but is not translated into an operator of its own.
+  bool is_top_k{false};
+
  protected:
+  size_t _on_shallow_hash() const override;
   std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
   bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
 };
@@ -1,6 +1,8 @@
 #include "lqp_translator.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -21,28 +23,36 @@
 #include "export_node.hpp"
 #include "expression/abstract_expression.hpp"
 #include "expression/abstract_predicate_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/logical_expression.hpp"
 #include "expression/lqp_column_expression.hpp"
 #include "expression/lqp_subquery_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/pqp_subquery_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "expression/window_function_expression.hpp"
 #include "hyrise.hpp"
 #include "import_node.hpp"
 #include "insert_node.hpp"
 #include "intersect_node.hpp"
 #include "join_node.hpp"
 #include "limit_node.hpp"
+#include "lossless_cast.hpp"
+#include "lqp_utils.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/alias_operator.hpp"
 #include "operators/change_meta_table.hpp"
 #include "operators/delete.hpp"
 #include "operators/export.hpp"
 #include "operators/get_table.hpp"
+#include "operators/group_join.hpp"
 #include "operators/import.hpp"
 #include "operators/index_scan.hpp"
 #include "operators/insert.hpp"
+#include "operators/join_array.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_leapfrog_triejoin.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
@@ -55,23 +65,149 @@
 #include "operators/operator_scan_predicate.hpp"
 #include "operators/product.hpp"
 #include "operators/projection.hpp"
+#include "operators/runtime_join_filter.hpp"
+#include "operators/set_operation_hash.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
+#include "operators/unique_index_scan.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
+#include "operators/window.hpp"
 #include "predicate_node.hpp"
 #include "projection_node.hpp"
+#include "resolve_type.hpp"
 #include "sort_node.hpp"
 #include "static_table_node.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "statistics/table_statistics.hpp"
 #include "stored_table_node.hpp"
 #include "union_node.hpp"
 #include "update_node.hpp"
+#include "utils/settings/operator_memory_budget_setting.hpp"
+#include "window_node.hpp"
 
 using namespace std::string_literals;  // NOLINT
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Returns the memory budget for the operators that can spill to disk (see OperatorMemoryBudgetSetting).
+std::optional<size_t> operator_memory_budget() {
+  const auto& settings_manager = Hyrise::get().settings_manager;
+  // Some tests replace the SettingsManager and, with it, the setting
+  if (!settings_manager.has_setting(OperatorMemoryBudgetSetting::NAME)) return std::nullopt;
+
+  const auto setting = std::dynamic_pointer_cast<OperatorMemoryBudgetSetting>(
+      settings_manager.get_setting(OperatorMemoryBudgetSetting::NAME));
+  Assert(setting, "Unexpected setting registered as " + OperatorMemoryBudgetSetting::NAME);
+  return setting->budget();
+}
+
+// Returns whether the statistics of `node` indicate that the integer values in the column `column_id` form a range
+// dense enough for a JoinArray to address them directly.
+bool has_dense_value_range(const std::shared_ptr<AbstractLQPNode>& node, const ColumnID column_id) {
+  // Not all StaticTableNodes (e.g., those created for INSERT ... VALUES) have statistics.
+  auto statistics_available = true;
+  visit_lqp(node, [&](const auto& sub_node) {
+    if (sub_node->type == LQPNodeType::StaticTable &&
+        !static_cast<const StaticTableNode&>(*sub_node).table->table_statistics()) {
+      statistics_available = false;
+      return LQPVisitation::DoNotVisitInputs;
+    }
+    return LQPVisitation::VisitInputs;
+  });
+  if (!statistics_available) return false;
+
+  const auto table_statistics = CardinalityEstimator{}.estimate_statistics(node);
+  const auto& column_statistics = table_statistics->column_statistics[column_id];
+
+  auto is_dense = false;
+  resolve_data_type(column_statistics->data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    if constexpr (std::is_integral_v<ColumnDataType>) {
+      const auto attribute_statistics =
+          std::dynamic_pointer_cast<AttributeStatistics<ColumnDataType>>(column_statistics);
+      if (!attribute_statistics || !attribute_statistics->histogram) return;
+
+      const auto& histogram = *attribute_statistics->histogram;
+      const auto bin_count = histogram.bin_count();
+      if (bin_count == 0) return;
+
+      is_dense = JoinArray::is_dense(histogram.bin_minimum(BinID{0}), histogram.bin_maximum(BinID{bin_count - 1}),
+                                     static_cast<size_t>(histogram.total_count()));
+    }
+  });
+
+  return is_dense;
+}
+
+// Returns whether all chunks that the operator translated from `node` emits are sorted by `column_expression` (see
+// Chunk::individually_sorted_by). This holds for the output of a Sort and for stored tables whose chunks are sorted,
+// which TableScans and Validates keep sorted (see TableScan::_on_execute for when a TableScan does not forward the
+// sort order of a chunk). The check is conservative and only follows the nodes listed below.
+bool is_sorted_by(const std::shared_ptr<AbstractLQPNode>& node, const AbstractExpression& column_expression,
+                  const bool is_join_input = true) {
+  switch (node->type) {
+    case LQPNodeType::Sort:
+      // The TableScan does not keep the sort order of chunks that reference multiple input chunks, so we only accept
+      // Sorts directly below the join.
+      return is_join_input && *node->node_expressions.front() == column_expression;
+
+    case LQPNodeType::Predicate:
+      if (static_cast<const PredicateNode&>(*node).scan_type != ScanType::TableScan) return false;
+      return is_sorted_by(node->left_input(), column_expression, false);
+
+    case LQPNodeType::Validate:
+      return is_sorted_by(node->left_input(), column_expression, false);
+
+    case LQPNodeType::Join:
+      // Runtime join filters forward the chunks of their left input (see RuntimeJoinFilterRule)
+      if (!static_cast<const JoinNode&>(*node).is_runtime_join_filter) return false;
+      return is_sorted_by(node->left_input(), column_expression, false);
+
+    case LQPNodeType::StoredTable: {
+      if (column_expression.type != ExpressionType::LQPColumn) return false;
+      const auto& column_reference = static_cast<const LQPColumnExpression&>(column_expression);
+      if (column_reference.original_node.lock() != node) return false;
+
+      const auto table = Hyrise::get().storage_manager.get_table(static_cast<const StoredTableNode&>(*node).table_name);
+      const auto chunk_count = table->chunk_count();
+      if (chunk_count == 0) return false;
+
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto chunk = table->get_chunk(chunk_id);
+        if (!chunk) continue;
+
+        const auto& sorted_by = chunk->individually_sorted_by();
+        if (std::none_of(sorted_by.begin(), sorted_by.end(), [&](const auto& sort_definition) {
+              return sort_definition.column == column_reference.original_column_id;
+            })) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    default:
+      return false;
+  }
+}
+
+// Returns whether `op` neither adds nor removes rows, so that its input needs to produce as many rows as `op` itself.
+// Used to pass the output row budget of a Limit down to the operators below (see AbstractOperator).
+bool forwards_all_input_rows(const AbstractOperator& op) {
+  return op.type() == OperatorType::Projection || op.type() == OperatorType::Alias;
+}
+
+}  // namespace
+
 namespace opossum {
 
 std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::shared_ptr<AbstractLQPNode>& node) const {
@@ -94,6 +230,9 @@ std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::share
 
   const auto operator_iter = _operator_by_lqp_node.find(node);
   if (operator_iter != _operator_by_lqp_node.end()) {
+    // The operator has another consumer now, which might need all of its rows
+    _operators_with_multiple_consumers.emplace(operator_iter->second);
+    _remove_output_row_budgets(operator_iter->second);
     return operator_iter->second;
   }
 
@@ -126,6 +265,7 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_by_node_type(
     case LQPNodeType::StaticTable:        return _translate_static_table_node(node);
     case LQPNodeType::Update:             return _translate_update_node(node);
     case LQPNodeType::Validate:           return _translate_validate_node(node);
+    case LQPNodeType::Window:             return _translate_window_node(node);
     case LQPNodeType::Union:              return _translate_union_node(node);
     case LQPNodeType::Intersect:          return _translate_intersect_node(node);
     case LQPNodeType::Except:             return _translate_except_node(node);
@@ -165,6 +305,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node(
       return _translate_predicate_node_to_table_scan(predicate_node, input_operator);
     case ScanType::IndexScan:
       return _translate_predicate_node_to_index_scan(predicate_node, input_operator);
+    case ScanType::UniqueIndexScan:
+      return _translate_predicate_node_to_unique_index_scan(predicate_node, input_operator);
   }
 
   Fail("Invalid enum value");
@@ -253,6 +395,30 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   return std::make_shared<UnionAll>(index_scan, table_scan);
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_unique_index_scan(
+    const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const {
+  // The UniqueIndexScanRule creates a conjunction of `column = value` predicates on the key columns directly on top of
+  // the StoredTableNode.
+  Assert(node->left_input()->type == LQPNodeType::StoredTable, "UniqueIndexScan must follow a StoredTableNode.");
+
+  auto column_ids = std::vector<ColumnID>{};
+  auto values = std::vector<AllTypeVariant>{};
+  for (const auto& predicate : flatten_logical_expressions(node->predicate(), LogicalOperator::And)) {
+    const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate);
+    Assert(binary_predicate && binary_predicate->predicate_condition == PredicateCondition::Equals,
+           "Expected equality predicates for UniqueIndexScan");
+
+    const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(binary_predicate->left_operand());
+    const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(binary_predicate->right_operand());
+    Assert(column_expression && value_expression, "Expected column = value predicates for UniqueIndexScan");
+
+    column_ids.emplace_back(column_expression->original_column_id);
+    values.emplace_back(value_expression->value);
+  }
+
+  return std::make_shared<UniqueIndexScan>(input_operator, column_ids, values);
+}
+
 std::shared_ptr<TableScan> LQPTranslator::_translate_predicate_node_to_table_scan(
     const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const {
   return std::make_shared<TableScan>(input_operator, _translate_expression(node->predicate(), node->left_input()));
@@ -286,10 +452,14 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_projection_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto sort_node = std::dynamic_pointer_cast<SortNode>(node);
   auto input_operator = translate_node(node->left_input());
+  return std::make_shared<Sort>(input_operator, _translate_sort_column_definitions(node), Chunk::DEFAULT_SIZE,
+                                Sort::ForceMaterialization::No, operator_memory_budget());
+}
 
-  std::shared_ptr<AbstractOperator> current_pqp = input_operator;
+std::vector<SortColumnDefinition> LQPTranslator::_translate_sort_column_definitions(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto sort_node = std::dynamic_pointer_cast<SortNode>(node);
   const auto& pqp_expressions = _translate_expressions(sort_node->node_expressions, node->left_input());
 
   auto pqp_expression_iter = pqp_expressions.begin();
@@ -305,18 +475,23 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
 
     column_definitions.emplace_back(SortColumnDefinition{pqp_column_expression->column_id, *sort_mode_iter});
   }
-  current_pqp = std::make_shared<Sort>(current_pqp, column_definitions);
 
-  return current_pqp;
+  return column_definitions;
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
+  auto join_node = std::dynamic_pointer_cast<JoinNode>(node);
+
+  if (join_node->is_multiway_join) {
+    // See JoinOrderingRule. The flagged joins below this node are translated as well, so that their inputs are not.
+    const auto multiway_join_operator = _translate_multiway_join_node(join_node);
+    if (multiway_join_operator) return multiway_join_operator;
+  }
+
   const auto left_input_operator = translate_node(node->left_input());
   const auto right_input_operator = translate_node(node->right_input());
 
-  auto join_node = std::dynamic_pointer_cast<JoinNode>(node);
-
   if (join_node->join_mode == JoinMode::Cross) {
     PerformanceWarning("CROSS join used");
     return std::make_shared<Product>(left_input_operator, right_input_operator);
@@ -339,11 +514,40 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   const auto& primary_join_predicate = join_predicates.front();
   std::vector<OperatorJoinPredicate> secondary_join_predicates(join_predicates.cbegin() + 1, join_predicates.cend());
 
+  if (join_node->is_runtime_join_filter) {
+    // See RuntimeJoinFilterRule. The left input is the probe side, the right input is the build side of the join.
+    Assert(join_node->join_mode == JoinMode::Semi && secondary_join_predicates.empty() &&
+               primary_join_predicate.predicate_condition == PredicateCondition::Equals,
+           "Runtime join filters require a single equi predicate");
+    return std::make_shared<RuntimeJoinFilter>(left_input_operator, right_input_operator,
+                                               primary_join_predicate.column_ids);
+  }
+
   auto join_operator = std::shared_ptr<AbstractOperator>{};
 
   const auto left_data_type = join_node->join_predicates().front()->arguments[0]->data_type();
   const auto right_data_type = join_node->join_predicates().front()->arguments[1]->data_type();
 
+  // For integer join keys that form a dense range on the build side (i.e., the right input), a direct-addressed array
+  // replaces the hash table. The JoinArray falls back to a JoinHash if the statistics turn out to be wrong.
+  if (JoinArray::supports({join_node->join_mode, primary_join_predicate.predicate_condition, left_data_type,
+                           right_data_type, !secondary_join_predicates.empty()}) &&
+      has_dense_value_range(node->right_input(), primary_join_predicate.column_ids.second)) {
+    return std::make_shared<JoinArray>(left_input_operator, right_input_operator, join_node->join_mode,
+                                       primary_join_predicate);
+  }
+
+  // If both inputs are already sorted by the join columns, the JoinSortMerge does not need to sort them and can merge
+  // the sorted chunks instead (see radix_cluster_sort.hpp).
+  const auto left_join_column = node->left_input()->output_expressions()[primary_join_predicate.column_ids.first];
+  const auto right_join_column = node->right_input()->output_expressions()[primary_join_predicate.column_ids.second];
+  if (JoinSortMerge::supports({join_node->join_mode, primary_join_predicate.predicate_condition, left_data_type,
+                               right_data_type, !secondary_join_predicates.empty()}) &&
+      is_sorted_by(node->left_input(), *left_join_column) && is_sorted_by(node->right_input(), *right_join_column)) {
+    return std::make_shared<JoinSortMerge>(left_input_operator, right_input_operator, join_node->join_mode,
+                                           primary_join_predicate, std::move(secondary_join_predicates));
+  }
+
   // Lacking a proper cost model, we assume JoinHash is always faster than JoinSortMerge, which is faster than
   // JoinNestedLoop and thus check for an operator compatible with the JoinNode in that order
   constexpr auto JOIN_OPERATOR_PREFERENCE_ORDER =
@@ -356,8 +560,16 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
 
     if (JoinOperator::supports({join_node->join_mode, primary_join_predicate.predicate_condition, left_data_type,
                                 right_data_type, !secondary_join_predicates.empty()})) {
-      join_operator = std::make_shared<JoinOperator>(left_input_operator, right_input_operator, join_node->join_mode,
-                                                     primary_join_predicate, std::move(secondary_join_predicates));
+      if constexpr (std::is_same_v<JoinOperator, JoinHash>) {
+        // Only the JoinHash spills to disk if its inputs exceed the memory budget
+        join_operator = std::make_shared<JoinHash>(left_input_operator, right_input_operator, join_node->join_mode,
+                                                   primary_join_predicate, std::move(secondary_join_predicates),
+                                                   std::nullopt, operator_memory_budget());
+      } else {
+        join_operator = std::make_shared<JoinOperator>(left_input_operator, right_input_operator,
+                                                       join_node->join_mode, primary_join_predicate,
+                                                       std::move(secondary_join_predicates));
+      }
     }
   });
   Assert(join_operator, "No operator implementation available for join '"s + join_node->description() + "'");
@@ -365,12 +577,64 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   return join_operator;
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_multiway_join_node(
+    const std::shared_ptr<JoinNode>& join_node) const {
+  // Collect the inputs of the tree of flagged Inner Joins from left to right, which is the order of their columns in
+  // the join result, and the predicates of all of these joins
+  auto input_nodes = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  auto predicate_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  const auto collect_inputs = [&](const auto& self, const std::shared_ptr<AbstractLQPNode>& node) -> void {
+    const auto multiway_join_node = std::dynamic_pointer_cast<JoinNode>(node);
+    if (!multiway_join_node || !multiway_join_node->is_multiway_join ||
+        multiway_join_node->join_mode != JoinMode::Inner) {
+      input_nodes.emplace_back(node);
+      return;
+    }
+
+    self(self, node->left_input());
+    self(self, node->right_input());
+    const auto& join_predicates = multiway_join_node->join_predicates();
+    predicate_expressions.insert(predicate_expressions.end(), join_predicates.cbegin(), join_predicates.cend());
+  };
+  collect_inputs(collect_inputs, join_node);
+
+  const auto find_input_column = [&](const AbstractExpression& expression) {
+    for (auto input_idx = size_t{0}; input_idx < input_nodes.size(); ++input_idx) {
+      const auto column_id = input_nodes[input_idx]->find_column_id(expression);
+      if (column_id) return std::optional<JoinLeapfrogTriejoin::InputColumn>{{input_idx, *column_id}};
+    }
+    return std::optional<JoinLeapfrogTriejoin::InputColumn>{};
+  };
+
+  // Only equality predicates between columns of the same data type are supported. Otherwise, we translate the joins
+  // into binary joins.
+  auto predicates = std::vector<JoinLeapfrogTriejoin::Predicate>{};
+  for (const auto& predicate_expression : predicate_expressions) {
+    const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate_expression);
+    if (!binary_predicate || binary_predicate->predicate_condition != PredicateCondition::Equals ||
+        binary_predicate->left_operand()->data_type() != binary_predicate->right_operand()->data_type()) {
+      return nullptr;
+    }
+
+    const auto left_column = find_input_column(*binary_predicate->left_operand());
+    const auto right_column = find_input_column(*binary_predicate->right_operand());
+    if (!left_column || !right_column) return nullptr;
+    predicates.emplace_back(*left_column, *right_column);
+  }
+
+  auto input_operators = std::vector<std::shared_ptr<const AbstractOperator>>{};
+  input_operators.reserve(input_nodes.size());
+  for (const auto& input_node : input_nodes) {
+    input_operators.emplace_back(translate_node(input_node));
+  }
+
+  return std::make_shared<JoinLeapfrogTriejoin>(input_operators, predicates);
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto aggregate_node = std::dynamic_pointer_cast<AggregateNode>(node);
 
-  const auto input_operator = translate_node(node->left_input());
-
   std::vector<std::shared_ptr<AggregateExpression>> pqp_aggregate_expressions;
   pqp_aggregate_expressions.reserve(aggregate_node->node_expressions.size() -
                                     aggregate_node->aggregate_expressions_begin_idx);
@@ -401,15 +665,70 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
     group_by_column_ids.emplace_back(*column_id);
   }
 
-  return std::make_shared<AggregateHash>(input_operator, pqp_aggregate_expressions, group_by_column_ids);
+  if (aggregate_node->is_group_join) {
+    // See GroupJoinRule. The JoinNode is not translated, the GroupJoin reads the join's inputs instead. Its column ids
+    // refer to the output of the JoinNode, like those of an AggregateHash on top of the join would.
+    const auto join_node = std::static_pointer_cast<JoinNode>(node->left_input());
+    Assert(join_node->join_predicates().size() == 1, "GroupJoin requires a single join predicate");
+    const auto join_predicate = OperatorJoinPredicate::from_expression(
+        *join_node->join_predicates().front(), *join_node->left_input(), *join_node->right_input());
+    Assert(join_predicate, "Could not translate join predicate for GroupJoin");
+
+    const auto left_input_operator = translate_node(join_node->left_input());
+    const auto right_input_operator = translate_node(join_node->right_input());
+    return std::make_shared<GroupJoin>(left_input_operator, right_input_operator, join_node->join_mode, *join_predicate,
+                                       group_by_column_ids, pqp_aggregate_expressions);
+  }
+
+  const auto input_operator = translate_node(node->left_input());
+  return std::make_shared<AggregateHash>(input_operator, pqp_aggregate_expressions, group_by_column_ids,
+                                         operator_memory_budget());
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_limit_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto input_operator = translate_node(node->left_input());
   auto limit_node = std::dynamic_pointer_cast<LimitNode>(node);
-  return std::make_shared<Limit>(
-      input_operator, _translate_expressions({limit_node->num_rows_expression()}, node->left_input()).front());
+  const auto row_count_expression =
+      _translate_expressions({limit_node->num_rows_expression()}, node->left_input()).front();
+
+  if (limit_node->is_top_k) {
+    // See TopKRule. The SortNode is not translated, the TopK reads the sort's input instead.
+    const auto& sort_node = node->left_input();
+    const auto input_operator = translate_node(sort_node->left_input());
+    return std::make_shared<TopK>(input_operator, _translate_sort_column_definitions(sort_node), row_count_expression);
+  }
+
+  const auto input_operator = translate_node(node->left_input());
+  _set_output_row_budgets(input_operator, limit_node->num_rows_expression());
+  return std::make_shared<Limit>(input_operator, row_count_expression);
+}
+
+void LQPTranslator::_set_output_row_budgets(const std::shared_ptr<AbstractOperator>& input_operator,
+                                            const std::shared_ptr<AbstractExpression>& row_count_expression) const {
+  // Only constant row counts are known upfront, but not, e.g., the parameters of prepared statements
+  if (row_count_expression->type != ExpressionType::Value) return;
+  const auto data_type = row_count_expression->data_type();
+  if (data_type != DataType::Int && data_type != DataType::Long) return;
+  const auto row_count =
+      lossless_variant_cast<int64_t>(static_cast<const ValueExpression&>(*row_count_expression).value);
+  if (!row_count || *row_count < 0) return;
+
+  auto op = input_operator;
+  while (!_operators_with_multiple_consumers.contains(op)) {
+    op->set_output_row_budget(static_cast<size_t>(*row_count));
+    if (!forwards_all_input_rows(*op)) break;
+    op = op->mutable_left_input();
+  }
+}
+
+void LQPTranslator::_remove_output_row_budgets(const std::shared_ptr<AbstractOperator>& op) const {
+  // Operators below `op` were only given a budget because of `op`'s budget (see _set_output_row_budgets)
+  auto budgeted_op = op;
+  while (budgeted_op->output_row_budget()) {
+    budgeted_op->set_output_row_budget(std::nullopt);
+    if (!forwards_all_input_rows(*budgeted_op)) break;
+    budgeted_op = budgeted_op->mutable_left_input();
+  }
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_insert_node(
@@ -445,7 +764,7 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_union_node(
 
   switch (union_node->set_operation_mode) {
     case SetOperationMode::Unique:
-      Fail("Currently, only the All and Positions modes are implemented for the union operation");
+      return std::make_shared<SetOperationHash>(input_operator_left, input_operator_right, SetOperation::Union);
     case SetOperationMode::All:
       return std::make_shared<UnionAll>(input_operator_left, input_operator_right);
     case SetOperationMode::Positions:
@@ -454,16 +773,25 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_union_node(
   Fail("Invalid enum value.");
 }
 
-// NOLINTNEXTLINE - while this particular method could be made static, others cannot.
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_intersect_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  FailInput("Hyrise does not yet support set operations");
+  const auto intersect_node = std::dynamic_pointer_cast<IntersectNode>(node);
+  AssertInput(intersect_node->set_operation_mode == SetOperationMode::Unique,
+              "Hyrise does not yet support INTERSECT ALL");
+
+  const auto input_operator_left = translate_node(node->left_input());
+  const auto input_operator_right = translate_node(node->right_input());
+  return std::make_shared<SetOperationHash>(input_operator_left, input_operator_right, SetOperation::Intersect);
 }
 
-// NOLINTNEXTLINE - while this particular method could be made static, others cannot.
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_except_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  FailInput("Hyrise does not yet support set operations");
+  const auto except_node = std::dynamic_pointer_cast<ExceptNode>(node);
+  AssertInput(except_node->set_operation_mode == SetOperationMode::Unique, "Hyrise does not yet support EXCEPT ALL");
+
+  const auto input_operator_left = translate_node(node->left_input());
+  const auto input_operator_right = translate_node(node->right_input());
+  return std::make_shared<SetOperationHash>(input_operator_left, input_operator_right, SetOperation::Except);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_validate_node(
@@ -472,6 +800,16 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_validate_node(
   return std::make_shared<Validate>(input_operator);
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_window_node(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto window_node = std::dynamic_pointer_cast<WindowNode>(node);
+  const auto input_operator = translate_node(node->left_input());
+
+  // As for the AggregateNode, the arguments of the window function are expected to be columns of the input
+  const auto pqp_expression = _translate_expression(window_node->window_function_expression(), node->left_input());
+  return std::make_shared<Window>(input_operator, std::static_pointer_cast<WindowFunctionExpression>(pqp_expression));
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_change_meta_table_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto input_operator_left = translate_node(node->left_input());
@@ -2,6 +2,8 @@
 
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "abstract_lqp_node.hpp"
 #include "all_type_variant.hpp"
@@ -12,6 +14,7 @@ namespace opossum {
 class AbstractOperator;
 class TransactionContext;
 class AbstractExpression;
+class JoinNode;
 class PredicateNode;
 class TableScan;
 struct OperatorScanPredicate;
@@ -35,14 +38,22 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_predicate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_predicate_node_to_index_scan(
       const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const;
+  std::shared_ptr<AbstractOperator> _translate_predicate_node_to_unique_index_scan(
+      const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const;
   std::shared_ptr<TableScan> _translate_predicate_node_to_table_scan(
       const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const;
   std::shared_ptr<AbstractOperator> _translate_alias_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_projection_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_sort_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::vector<SortColumnDefinition> _translate_sort_column_definitions(
+      const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_join_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_multiway_join_node(const std::shared_ptr<JoinNode>& join_node) const;
   std::shared_ptr<AbstractOperator> _translate_aggregate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_limit_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  void _set_output_row_budgets(const std::shared_ptr<AbstractOperator>& input_operator,
+                               const std::shared_ptr<AbstractExpression>& row_count_expression) const;
+  void _remove_output_row_budgets(const std::shared_ptr<AbstractOperator>& op) const;
   std::shared_ptr<AbstractOperator> _translate_insert_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_delete_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_dummy_table_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -54,6 +65,7 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_change_meta_table_node(
       const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_validate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_window_node(const std::shared_ptr<AbstractLQPNode>& node) const;
 
   // Maintenance operators
   std::shared_ptr<AbstractOperator> _translate_show_tables_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -78,6 +90,10 @@ class LQPTranslator {
   //   - identical operators (operators below a diamond shape)
   //   - equal but not identical operators
   mutable LQPNodeUnorderedMap<std::shared_ptr<AbstractOperator>> _operator_by_lqp_node;
+
+  // Operators that are returned from the cache above have more than one consumer. A downstream Limit must not give them
+  // an output row budget, as the other consumers might need all of their rows.
+  mutable std::unordered_set<std::shared_ptr<AbstractOperator>> _operators_with_multiple_consumers;
 };
 
 }  // namespace opossum
@@ -233,6 +233,7 @@ std::set<std::string> lqp_find_modified_tables(const std::shared_ptr<AbstractLQP
       case LQPNodeType::Union:
       case LQPNodeType::Intersect:
       case LQPNodeType::Except:
+      case LQPNodeType::Window:
       case LQPNodeType::Mock:
         return LQPVisitation::VisitInputs;
     }
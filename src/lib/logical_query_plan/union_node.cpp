@@ -54,8 +54,13 @@ std::shared_ptr<LQPUniqueConstraints> UnionNode::unique_constraints() const {
        */
       return std::make_shared<LQPUniqueConstraints>();
     }
-    case SetOperationMode::Unique:
-      Fail("ToDo, see discussion https://github.com/hyrise/hyrise/pull/2156#discussion_r452803825");
+    case SetOperationMode::Unique: {
+      /**
+       * UnionUnique removes duplicate rows across both inputs, but the rows of the right input might violate the
+       * unique constraints of the left input and vice versa. As with UnionAll, we discard all unique constraints.
+       */
+      return std::make_shared<LQPUniqueConstraints>();
+    }
   }
   Fail("Unhandled UnionMode");
 }
@@ -86,6 +91,12 @@ std::vector<FunctionalDependency> UnionNode::non_trivial_functional_dependencies
                   "Expected both input nodes to pass the same non-trivial FDs.");
       return non_trivial_fds;
     }
+    case SetOperationMode::Unique: {
+      // Same as for UnionAll, only the FDs that are valid for both input nodes remain valid.
+      const auto& fds_left = left_input()->functional_dependencies();
+      const auto& fds_right = right_input()->functional_dependencies();
+      return intersect_fds(fds_left, fds_right);
+    }
     default: {
       Fail("Unhandled UnionMode");
     }
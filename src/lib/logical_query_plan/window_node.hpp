@@ -0,0 +1,37 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_lqp_node.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class WindowFunctionExpression;
+
+/**
+ * This node type computes a window function, e.g., ROW_NUMBER() OVER (PARTITION BY a ORDER BY b), for each row of its
+ * input. Other than an AggregateNode, it does not change the number of rows. The output columns are the input columns,
+ * followed by the window function's result.
+ */
+class WindowNode : public EnableMakeForLQPNode<WindowNode>, public AbstractLQPNode {
+ public:
+  explicit WindowNode(const std::shared_ptr<AbstractExpression>& window_function_expression);
+
+  std::string description(const DescriptionMode mode = DescriptionMode::Short) const override;
+  std::vector<std::shared_ptr<AbstractExpression>> output_expressions() const override;
+  bool is_column_nullable(const ColumnID column_id) const override;
+
+  // Forwards unique constraints from the left input node
+  std::shared_ptr<LQPUniqueConstraints> unique_constraints() const override;
+
+  std::shared_ptr<WindowFunctionExpression> window_function_expression() const;
+
+ protected:
+  std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
+  bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
+};
+
+}  // namespace opossum
@@ -144,6 +144,14 @@ class AggregateFunctionBuilder<ColumnDataType, AggregateType, AggregateFunction:
   }
 };
 
+template <typename ColumnDataType, typename AggregateType>
+class AggregateFunctionBuilder<ColumnDataType, AggregateType, AggregateFunction::ApproxCountDistinct> {
+ public:
+  auto get_aggregate_function() {
+    return [](const ColumnDataType&, std::optional<AggregateType>& current_primary_aggregate) {};
+  }
+};
+
 class AbstractAggregateOperator : public AbstractReadOnlyOperator {
  public:
   AbstractAggregateOperator(const std::shared_ptr<AbstractOperator>& in,
@@ -1,5 +1,6 @@
 #include "abstract_operator.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
 #include <string>
@@ -32,6 +33,9 @@ void AbstractOperator::execute() {
   DTRACE_PROBE1(HYRISE, OPERATOR_STARTED, name().c_str());
   DebugAssert(!_left_input || _left_input->get_output(), "Left input has not yet been executed");
   DebugAssert(!_right_input || _right_input->get_output(), "Right input has not yet been executed");
+  DebugAssert(std::all_of(_additional_inputs.cbegin(), _additional_inputs.cend(),
+                          [](const auto& input) { return input->get_output(); }),
+              "Additional input has not yet been executed");
   DebugAssert(!performance_data->executed, "Operator has already been executed");
 
   Timer performance_timer;
@@ -154,6 +158,9 @@ void AbstractOperator::set_transaction_context_recursively(
 
   if (_left_input) mutable_left_input()->set_transaction_context_recursively(transaction_context);
   if (_right_input) mutable_right_input()->set_transaction_context_recursively(transaction_context);
+  for (const auto& input : mutable_additional_inputs()) {
+    input->set_transaction_context_recursively(transaction_context);
+  }
 }
 
 std::shared_ptr<AbstractOperator> AbstractOperator::mutable_left_input() const {
@@ -168,12 +175,34 @@ std::shared_ptr<const AbstractOperator> AbstractOperator::left_input() const { r
 
 std::shared_ptr<const AbstractOperator> AbstractOperator::right_input() const { return _right_input; }
 
+const std::vector<std::shared_ptr<const AbstractOperator>>& AbstractOperator::additional_inputs() const {
+  return _additional_inputs;
+}
+
+std::vector<std::shared_ptr<AbstractOperator>> AbstractOperator::mutable_additional_inputs() const {
+  auto inputs = std::vector<std::shared_ptr<AbstractOperator>>{};
+  inputs.reserve(_additional_inputs.size());
+  for (const auto& input : _additional_inputs) {
+    inputs.emplace_back(std::const_pointer_cast<AbstractOperator>(input));
+  }
+  return inputs;
+}
+
 void AbstractOperator::set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
   _on_set_parameters(parameters);
   if (left_input()) mutable_left_input()->set_parameters(parameters);
   if (right_input()) mutable_right_input()->set_parameters(parameters);
+  for (const auto& input : mutable_additional_inputs()) {
+    input->set_parameters(parameters);
+  }
+}
+
+void AbstractOperator::set_output_row_budget(const std::optional<size_t>& row_count) {
+  _output_row_budget = row_count;
 }
 
+const std::optional<size_t>& AbstractOperator::output_row_budget() const { return _output_row_budget; }
+
 void AbstractOperator::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {}
 
 void AbstractOperator::_on_cleanup() {}
@@ -189,7 +218,13 @@ std::shared_ptr<AbstractOperator> AbstractOperator::_deep_copy_impl(
       right_input() ? right_input()->_deep_copy_impl(copied_ops) : std::shared_ptr<AbstractOperator>{};
 
   auto copied_op = _on_deep_copy(copied_left_input, copied_right_input);
+  DebugAssert(copied_op->_additional_inputs.size() == _additional_inputs.size(),
+              "Copied operator has a different number of additional inputs");
+  for (auto input_idx = size_t{0}; input_idx < _additional_inputs.size(); ++input_idx) {
+    copied_op->_additional_inputs[input_idx] = _additional_inputs[input_idx]->_deep_copy_impl(copied_ops);
+  }
   if (_transaction_context) copied_op->set_transaction_context(*_transaction_context);
+  copied_op->_output_row_budget = _output_row_budget;
 
   copied_ops.emplace(this, copied_op);
 
@@ -201,6 +236,8 @@ std::ostream& operator<<(std::ostream& stream, const AbstractOperator& abstract_
     std::vector<std::shared_ptr<const AbstractOperator>> children;
     if (op->left_input()) children.emplace_back(op->left_input());
     if (op->right_input()) children.emplace_back(op->right_input());
+    const auto& additional_inputs = op->additional_inputs();
+    children.insert(children.end(), additional_inputs.cbegin(), additional_inputs.cend());
     return children;
   };
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -25,14 +26,16 @@ enum class OperatorType {
   DropTable,
   DropView,
   Delete,
-  Difference,
   Export,
   GetTable,
+  GroupJoin,
   Import,
   IndexScan,
   Insert,
+  JoinArray,
   JoinHash,
   JoinIndex,
+  JoinLeapfrogTriejoin,
   JoinNestedLoop,
   JoinSortMerge,
   JoinVerification,
@@ -40,18 +43,25 @@ enum class OperatorType {
   Print,
   Product,
   Projection,
+  RuntimeJoinFilter,
+  SetOperationHash,
   Sort,
   TableScan,
   TableWrapper,
+  TopK,
   UnionAll,
   UnionPositions,
+  UniqueIndexScan,
   Update,
   Validate,
+  Window,
   Mock  // for Tests that need to Mock operators
 };
 
 // AbstractOperator is the abstract super class for all operators.
-// All operators have up to two input tables and one output table.
+// All operators have up to two input tables and one output table. Multi-way operators (e.g., JoinLeapfrogTriejoin)
+// have further inputs, which are stored as additional inputs and handled like the left and right input by the
+// scheduler, deep_copy(), and the recursive setters.
 // Their lifecycle has three phases:
 // 1. The operator is constructed. Previous operators are not guaranteed to have already executed, so operators must not
 // call get_output in their execute method
@@ -116,9 +126,20 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   std::shared_ptr<const Table> left_input_table() const;
   std::shared_ptr<const Table> right_input_table() const;
 
+  // Get the inputs beyond the left and right input of operators with more than two inputs. Empty for all others.
+  const std::vector<std::shared_ptr<const AbstractOperator>>& additional_inputs() const;
+  std::vector<std::shared_ptr<AbstractOperator>> mutable_additional_inputs() const;
+
   // Set parameters (AllParameterVariants or CorrelatedParameterExpressions) to their respective values
   void set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters);
 
+  // Number of output rows that suffice for the consumer of this operator. Set by the LQPTranslator if the only consumer
+  // is a Limit, either directly or via operators that neither add nor remove rows. Operators that produce their output
+  // chunk by chunk (GetTable, TableScan, Validate, Projection) stop processing further chunks once they have produced
+  // that many rows (see RowBudget). All other operators ignore it.
+  void set_output_row_budget(const std::optional<size_t>& row_count);
+  const std::optional<size_t>& output_row_budget() const;
+
   // LQP node with which this operator has been created. Might be uninitialized.
   std::shared_ptr<const AbstractLQPNode> lqp_node;
 
@@ -158,11 +179,19 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   std::shared_ptr<const AbstractOperator> _left_input;
   std::shared_ptr<const AbstractOperator> _right_input;
 
+  // Inputs beyond the left and right input, set by the constructors of operators with more than two inputs. When deep
+  // copying such an operator, _on_deep_copy() can pass any operators here, as they are replaced by the copies of the
+  // original additional inputs afterwards.
+  std::vector<std::shared_ptr<const AbstractOperator>> _additional_inputs;
+
   // Is nullptr until the operator is executed
   std::shared_ptr<const Table> _output;
 
   // Weak pointer breaks cyclical dependency between operators and context
   std::optional<std::weak_ptr<TransactionContext>> _transaction_context;
+
+  // See set_output_row_budget()
+  std::optional<size_t> _output_row_budget;
 };
 
 std::ostream& operator<<(std::ostream& stream, const AbstractOperator& abstract_operator);
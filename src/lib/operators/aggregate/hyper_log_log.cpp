@@ -0,0 +1,184 @@
+#include "hyper_log_log.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <istream>
+#include <ostream>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+// Finalizer of SplitMix64, which spreads the entropy of the input over all bits of the hash
+uint64_t mix_hash(uint64_t hash) {
+  hash ^= hash >> 30;
+  hash *= uint64_t{0xbf58476d1ce4e5b9};
+  hash ^= hash >> 27;
+  hash *= uint64_t{0x94d049bb133111eb};
+  hash ^= hash >> 31;
+  return hash;
+}
+
+constexpr auto RANK_BITS = uint32_t{8};
+constexpr auto RANK_MASK = (uint32_t{1} << RANK_BITS) - 1;
+
+}  // namespace
+
+namespace opossum {
+
+HyperLogLog::HyperLogLog(const uint8_t precision) : _precision(precision) {
+  Assert(precision >= MIN_PRECISION && precision <= MAX_PRECISION, "Invalid precision for HyperLogLog");
+}
+
+void HyperLogLog::add(const size_t hash) {
+  const auto mixed_hash = mix_hash(hash);
+  const auto register_idx = static_cast<uint32_t>(mixed_hash >> (64 - _precision));
+
+  // The rank of the remaining bits is at most 64 - precision + 1 (if all of them are zero)
+  const auto remaining_bits = mixed_hash << _precision;
+  const auto max_rank = 64 - _precision + 1;
+  const auto rank = static_cast<uint8_t>(std::min(std::countl_zero(remaining_bits) + 1, max_rank));
+
+  _update_register(register_idx, rank);
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+  Assert(_precision == other._precision, "Cannot merge HyperLogLog sketches of different precisions");
+
+  if (!other.is_dense()) {
+    for (const auto entry : other._sparse_registers) {
+      _update_register(entry >> RANK_BITS, static_cast<uint8_t>(entry & RANK_MASK));
+    }
+    return;
+  }
+
+  if (!is_dense()) _convert_to_dense();
+  for (auto register_idx = size_t{0}; register_idx < _registers.size(); ++register_idx) {
+    _registers[register_idx] = std::max(_registers[register_idx], other._registers[register_idx]);
+  }
+}
+
+uint64_t HyperLogLog::estimate() const {
+  const auto register_count = size_t{1} << _precision;
+
+  // Harmonic mean of 2^rank over all registers. Registers of rank zero contribute 2^0 each.
+  auto zero_register_count = register_count;
+  auto inverse_sum = 0.0;
+  const auto add_rank = [&](const uint8_t rank) {
+    if (rank == 0) return;
+    inverse_sum += std::ldexp(1.0, -rank);
+    --zero_register_count;
+  };
+
+  if (is_dense()) {
+    for (const auto rank : _registers) {
+      add_rank(rank);
+    }
+  } else {
+    for (const auto entry : _sparse_registers) {
+      add_rank(static_cast<uint8_t>(entry & RANK_MASK));
+    }
+  }
+  inverse_sum += static_cast<double>(zero_register_count);
+
+  const auto m = static_cast<double>(register_count);
+  auto alpha = 0.7213 / (1.0 + 1.079 / m);
+  if (register_count == 16) {
+    alpha = 0.673;
+  } else if (register_count == 32) {
+    alpha = 0.697;
+  } else if (register_count == 64) {
+    alpha = 0.709;
+  }
+
+  auto estimate = alpha * m * m / inverse_sum;
+
+  // Small range correction: Linear counting is more accurate as long as some registers are still zero. With 64-bit
+  // hashes, no large range correction is needed.
+  if (estimate <= 2.5 * m && zero_register_count > 0) {
+    estimate = m * std::log(m / static_cast<double>(zero_register_count));
+  }
+
+  return static_cast<uint64_t>(std::llround(estimate));
+}
+
+void HyperLogLog::clear() {
+  _sparse_registers.clear();
+  _registers = std::vector<uint8_t>{};
+}
+
+uint8_t HyperLogLog::precision() const { return _precision; }
+
+bool HyperLogLog::is_dense() const { return !_registers.empty(); }
+
+size_t HyperLogLog::memory_usage() const {
+  return sizeof(*this) + _sparse_registers.capacity() * sizeof(uint32_t) + _registers.capacity() * sizeof(uint8_t);
+}
+
+void HyperLogLog::write(std::ostream& stream) const {
+  stream.write(reinterpret_cast<const char*>(&_precision), sizeof(_precision));
+
+  const auto dense = static_cast<char>(is_dense());
+  stream.write(&dense, sizeof(dense));
+  if (dense) {
+    stream.write(reinterpret_cast<const char*>(_registers.data()), static_cast<std::streamsize>(_registers.size()));
+  } else {
+    const auto size = _sparse_registers.size();
+    stream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    stream.write(reinterpret_cast<const char*>(_sparse_registers.data()),
+                 static_cast<std::streamsize>(size * sizeof(uint32_t)));
+  }
+}
+
+HyperLogLog HyperLogLog::read(std::istream& stream) {
+  auto precision = uint8_t{0};
+  stream.read(reinterpret_cast<char*>(&precision), sizeof(precision));
+  auto sketch = HyperLogLog{precision};
+
+  auto dense = char{0};
+  stream.read(&dense, sizeof(dense));
+  if (dense) {
+    sketch._registers.resize(size_t{1} << precision);
+    stream.read(reinterpret_cast<char*>(sketch._registers.data()),
+                static_cast<std::streamsize>(sketch._registers.size()));
+  } else {
+    auto size = size_t{0};
+    stream.read(reinterpret_cast<char*>(&size), sizeof(size));
+    sketch._sparse_registers.resize(size);
+    stream.read(reinterpret_cast<char*>(sketch._sparse_registers.data()),
+                static_cast<std::streamsize>(size * sizeof(uint32_t)));
+  }
+
+  return sketch;
+}
+
+void HyperLogLog::_update_register(const uint32_t register_idx, const uint8_t rank) {
+  if (is_dense()) {
+    _registers[register_idx] = std::max(_registers[register_idx], rank);
+    return;
+  }
+
+  // The entries of a register are ordered by their index, which occupies the upper bits
+  const auto entry = (register_idx << RANK_BITS) | rank;
+  const auto iter = std::lower_bound(_sparse_registers.begin(), _sparse_registers.end(), register_idx << RANK_BITS);
+  if (iter != _sparse_registers.end() && (*iter >> RANK_BITS) == register_idx) {
+    *iter = std::max(*iter, entry);
+    return;
+  }
+
+  _sparse_registers.insert(iter, entry);
+  if (_sparse_registers.size() * sizeof(uint32_t) > (size_t{1} << _precision) / 4) {
+    _convert_to_dense();
+  }
+}
+
+void HyperLogLog::_convert_to_dense() {
+  _registers.resize(size_t{1} << _precision);
+  for (const auto entry : _sparse_registers) {
+    _registers[entry >> RANK_BITS] = static_cast<uint8_t>(entry & RANK_MASK);
+  }
+  _sparse_registers = std::vector<uint32_t>{};
+}
+
+}  // namespace opossum
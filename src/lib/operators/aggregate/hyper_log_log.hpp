@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * HyperLogLog sketch (Flajolet et al., "HyperLogLog: the analysis of a near-optimal cardinality estimation algorithm",
+ * AofA 2007) that estimates the number of distinct values for APPROX_COUNT_DISTINCT. The first `precision` bits of a
+ * value's hash select one of 2^precision registers, which keeps the maximum rank (number of leading zeros plus one) of
+ * the remaining bits of all hashes that selected it. The relative standard error of the estimate is about
+ * 1.04 / sqrt(2^precision), e.g., 0.8% for the default precision, independent of the number of distinct values.
+ *
+ * Two sketches of the same precision are merged by taking the maximum of each register. The result is the sketch of
+ * the union of both inputs, so that partial sketches of different threads or chunks can be combined without losing
+ * accuracy.
+ *
+ * Most groups of a GROUP BY only see a few distinct values. Thus, a sketch starts with a sparse representation that
+ * only stores the non-zero registers and switches to the dense array of 2^precision registers once the sparse one
+ * would use more than a quarter of its memory. Both representations yield the same estimates.
+ */
+class HyperLogLog {
+ public:
+  static constexpr uint8_t MIN_PRECISION = 4;
+  static constexpr uint8_t MAX_PRECISION = 18;
+  static constexpr uint8_t DEFAULT_PRECISION = 14;
+
+  explicit HyperLogLog(const uint8_t precision = DEFAULT_PRECISION);
+
+  // Adds a value, given by its hash. The hash is mixed before it is used, so that std::hash, which is the identity for
+  // integers, can be passed.
+  void add(const size_t hash);
+
+  // Merges a sketch of the same precision into this one
+  void merge(const HyperLogLog& other);
+
+  uint64_t estimate() const;
+
+  // Removes all values, the sketch becomes sparse again
+  void clear();
+
+  uint8_t precision() const;
+  bool is_dense() const;
+
+  size_t memory_usage() const;
+
+  // Binary serialization, e.g., for spilling partial results to disk
+  void write(std::ostream& stream) const;
+  static HyperLogLog read(std::istream& stream);
+
+ protected:
+  void _update_register(const uint32_t register_idx, const uint8_t rank);
+  void _convert_to_dense();
+
+  uint8_t _precision;
+
+  // Sparse representation: The non-zero registers, encoded as (register index << 8 | rank) and sorted by their index.
+  // Empty once the sketch is dense.
+  std::vector<uint32_t> _sparse_registers;
+
+  // Dense representation: The rank of every register. Empty while the sketch is sparse.
+  std::vector<uint8_t> _registers;
+};
+
+}  // namespace opossum
@@ -1,8 +1,12 @@
 #include "aggregate_hash.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <fstream>
+#include <limits>
 #include <memory>
 #include <optional>
+#include <sstream>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -17,11 +21,15 @@
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
+#include "storage/base_dictionary_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "utils/aligned_size.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
+#include "utils/spill_file.hpp"
 #include "utils/timer.hpp"
 
 namespace {
@@ -58,6 +66,24 @@ typename Results::reference get_or_add_result(ResultIds& result_ids, Results& re
   }
 }
 
+// The partial results of COUNT(DISTINCT) and STDDEV_SAMP would have to merge sets of values or Welford states, so
+// that they cannot be aggregated in parallel (or on dictionary codes).
+bool has_mergeable_partial_results(const std::vector<std::shared_ptr<AggregateExpression>>& aggregates) {
+  return std::none_of(aggregates.cbegin(), aggregates.cend(), [](const auto& aggregate) {
+    return aggregate->aggregate_function == AggregateFunction::CountDistinct ||
+           aggregate->aggregate_function == AggregateFunction::StandardDeviationSample;
+  });
+}
+
+// Upper bound for the number of jobs that pre-aggregate the input in the parallel aggregation
+constexpr auto MAX_PARALLEL_AGGREGATION_JOB_COUNT = size_t{64};
+
+// Marks the codes without a slot in the aggregation on dictionary codes
+constexpr auto INVALID_SLOT_ID = std::numeric_limits<uint32_t>::max();
+
+// Upper bound for the radix bits that are added to keep the partitions within the memory budget (see JoinHash)
+constexpr auto MAX_SPILLING_RADIX_BITS = size_t{10};
+
 template <typename AggregateKey>
 const AggregateKey& get_aggregate_key([[maybe_unused]] const KeysPerChunk<AggregateKey>& keys_per_chunk,
                                       [[maybe_unused]] const ChunkID chunk_id,
@@ -80,9 +106,10 @@ namespace opossum {
 
 AggregateHash::AggregateHash(const std::shared_ptr<AbstractOperator>& in,
                              const std::vector<std::shared_ptr<AggregateExpression>>& aggregates,
-                             const std::vector<ColumnID>& groupby_column_ids)
-    : AbstractAggregateOperator(in, aggregates, groupby_column_ids,
-                                std::make_unique<OperatorPerformanceData<OperatorSteps>>()) {
+                             const std::vector<ColumnID>& groupby_column_ids,
+                             const std::optional<size_t>& memory_budget)
+    : AbstractAggregateOperator(in, aggregates, groupby_column_ids, std::make_unique<PerformanceData>()),
+      _memory_budget(memory_budget) {
   _has_aggregate_functions =
       !_aggregates.empty() && !std::all_of(_aggregates.begin(), _aggregates.end(), [](const auto aggregate_expression) {
         return aggregate_expression->aggregate_function == AggregateFunction::Any;
@@ -94,16 +121,46 @@ const std::string& AggregateHash::name() const {
   return name;
 }
 
+std::string AggregateHash::description(DescriptionMode description_mode) const {
+  auto stream = std::stringstream{};
+  stream << AbstractAggregateOperator::description(description_mode);
+  if (_memory_budget) {
+    stream << " Memory budget: " << *_memory_budget << " bytes";
+  }
+
+  return stream.str();
+}
+
 std::shared_ptr<AbstractOperator> AggregateHash::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& copied_right_input) const {
-  return std::make_shared<AggregateHash>(copied_left_input, _aggregates, _groupby_column_ids);
+  return std::make_shared<AggregateHash>(copied_left_input, _aggregates, _groupby_column_ids, _memory_budget);
 }
 
 void AggregateHash::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
 void AggregateHash::_on_cleanup() { _contexts_per_column.clear(); }
 
+void AggregateHash::PerformanceData::output_to_stream(std::ostream& stream, DescriptionMode description_mode) const {
+  OperatorPerformanceData<OperatorSteps>::output_to_stream(stream, description_mode);
+
+  const auto separator = description_mode == DescriptionMode::SingleLine ? " " : "\n";
+  if (spill_file_count > 0) {
+    stream << separator << "Spilled " << spilled_partial_result_count << " partial result"
+           << (spilled_partial_result_count > 1 ? "s" : "") << " to " << spill_file_count << " file"
+           << (spill_file_count > 1 ? "s" : "") << " (" << spilled_bytes << " bytes).";
+  }
+
+  if (aggregated_on_dictionary_codes) {
+    stream << separator << "Grouped on dictionary codes.";
+  }
+
+  if (merge_batch_count > 0) {
+    stream << separator << "Merged partitions in " << merge_batch_count << " batch"
+           << (merge_batch_count > 1 ? "es" : "") << ".";
+  }
+}
+
 /*
 Visitor context for the AggregateVisitor. The AggregateResultContext can be used without knowing the
 AggregateKey, the AggregateContext is the "full" version.
@@ -132,6 +189,334 @@ struct AggregateContext : public AggregateResultContext<ColumnDataType, Aggregat
   std::unique_ptr<AggregateResultIdMap<AggregateKey>> result_ids;
 };
 
+namespace {
+
+// Writes a value to a spill file of the parallel aggregation. Strings and AggregateKeySmallVectors are written as their
+// size followed by their elements, all other types as raw bytes.
+template <typename T>
+void write_spilled_value(std::ostream& stream, const T& value) {
+  if constexpr (std::is_same_v<T, pmr_string> || std::is_same_v<T, AggregateKeySmallVector>) {
+    const auto size = value.size();
+    stream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    stream.write(reinterpret_cast<const char*>(value.data()),
+                 static_cast<std::streamsize>(size * sizeof(typename T::value_type)));
+  } else {
+    static_assert(std::is_trivially_copyable_v<T>, "Value cannot be written as raw bytes");
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
+}
+
+// Reads a value that has been written by write_spilled_value().
+template <typename T>
+void read_spilled_value(std::istream& stream, T& value) {
+  if constexpr (std::is_same_v<T, pmr_string> || std::is_same_v<T, AggregateKeySmallVector>) {
+    auto size = size_t{0};
+    stream.read(reinterpret_cast<char*>(&size), sizeof(size));
+    value.resize(size);
+    stream.read(reinterpret_cast<char*>(value.data()),
+                static_cast<std::streamsize>(size * sizeof(typename T::value_type)));
+  } else {
+    stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+  }
+}
+
+/**
+ * Aggregates one aggregate column in the two-phase parallel aggregation (see AggregateHash::_aggregate_in_parallel).
+ * In the first phase, each job aggregates its rows into the partial results of a fixed number of local slots, one
+ * slot per group, and moves them into the radix partitions of their groups once all slots are taken. In the second
+ * phase, the partial results of each partition are merged into the final results of the partition's groups.
+ */
+class BasePartialAggregator {
+ public:
+  virtual ~BasePartialAggregator() = default;
+
+  // Allocates the radix partitions, has to be called before the first phase
+  virtual void set_partition_count(const size_t partition_count) = 0;
+
+  // First phase: Loads the values of a chunk of the job
+  virtual void load_chunk(const size_t job_idx, const Chunk& chunk) = 0;
+
+  // First phase: Aggregates the rows [begin, end) of the loaded chunk into the slots given by slot_ids
+  virtual void aggregate_rows(const size_t job_idx, const ChunkOffset begin, const ChunkOffset end,
+                              const std::vector<uint32_t>& slot_ids) = 0;
+
+  // First phase: Moves the partial results of the first slot_partitions.size() slots into the given partitions
+  virtual void flush(const size_t job_idx, const std::vector<size_t>& slot_partitions) = 0;
+
+  // First phase: Writes the partial results of a partition of the job to a spill file and frees their memory
+  virtual void spill(const size_t job_idx, const size_t partition_idx, std::ostream& stream) = 0;
+
+  // Second phase: Reads one spilled partial result per entry of group_ids from the stream and merges them into the
+  // groups given by group_ids
+  virtual void merge_spilled(const size_t partition_idx, std::istream& stream, const std::vector<size_t>& group_ids,
+                             const size_t group_count) = 0;
+
+  // Second phase: Merges the in-memory partial results of a partition, in the order in which the jobs flushed them,
+  // into the groups given by group_ids
+  virtual void merge_partition(const size_t partition_idx, const std::vector<size_t>& group_ids,
+                               const size_t group_count) = 0;
+
+  // Appends the merged results of all partitions to the context. The i-th group of a partition was first seen in the
+  // i-th row of its partition_row_ids.
+  virtual void write_results(SegmentVisitorContext& context,
+                             const std::vector<std::vector<RowID>>& partition_row_ids) = 0;
+
+  // Size of a partial result, used to estimate the memory usage of the partitions
+  virtual size_t partial_result_size() const = 0;
+};
+
+template <typename ColumnDataType, AggregateFunction function>
+class PartialAggregator : public BasePartialAggregator {
+ public:
+  using AggregateType = typename AggregateTraits<ColumnDataType, function>::AggregateType;
+  using Result = AggregateResult<ColumnDataType, AggregateType>;
+
+  // column_id is INVALID_COLUMN_ID for COUNT(*). ANY is used for the DISTINCT implementation, which only collects the
+  // groups. sketch_precision is only used by APPROX_COUNT_DISTINCT.
+  PartialAggregator(const ColumnID column_id, const size_t job_count, const size_t slot_count,
+                    const uint8_t sketch_precision = HyperLogLog::DEFAULT_PRECISION)
+      : _column_id{column_id}, _sketch_precision{sketch_precision}, _jobs(job_count) {
+    for (auto& job : _jobs) {
+      job.slots.resize(slot_count);
+    }
+  }
+
+  void set_partition_count(const size_t partition_count) override {
+    for (auto& job : _jobs) {
+      job.partitions.resize(partition_count);
+    }
+    _merged_results.resize(partition_count);
+  }
+
+  void load_chunk(const size_t job_idx, const Chunk& chunk) override {
+    if constexpr (function != AggregateFunction::Any) {
+      if (_column_id == INVALID_COLUMN_ID) return;
+
+      auto& job = _jobs[job_idx];
+      const auto chunk_size = chunk.size();
+      job.values.resize(chunk_size);
+      job.null_values.resize(chunk_size);
+
+      auto chunk_offset = ChunkOffset{0};
+      segment_iterate<ColumnDataType>(*chunk.get_segment(_column_id), [&](const auto& position) {
+        job.null_values[chunk_offset] = position.is_null();
+        if (!position.is_null()) job.values[chunk_offset] = position.value();
+        ++chunk_offset;
+      });
+    }
+  }
+
+  void aggregate_rows(const size_t job_idx, const ChunkOffset begin, const ChunkOffset end,
+                      const std::vector<uint32_t>& slot_ids) override {
+    if constexpr (function != AggregateFunction::Any) {
+      auto& job = _jobs[job_idx];
+
+      if (_column_id == INVALID_COLUMN_ID) {
+        // COUNT(*)
+        for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+          ++job.slots[slot_ids[chunk_offset]].aggregate_count;
+        }
+        return;
+      }
+
+      auto aggregator = AggregateFunctionBuilder<ColumnDataType, AggregateType, function>().get_aggregate_function();
+      for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+        if (job.null_values[chunk_offset]) continue;
+
+        auto& result = job.slots[slot_ids[chunk_offset]];
+        if constexpr (function == AggregateFunction::ApproxCountDistinct) {
+          result.ensure_sketch_initialized(_sketch_precision);
+          result.sketch().add(std::hash<ColumnDataType>{}(job.values[chunk_offset]));
+        } else {
+          aggregator(job.values[chunk_offset], result.current_primary_aggregate);
+        }
+        if constexpr (function == AggregateFunction::Avg || function == AggregateFunction::Count) {
+          ++result.aggregate_count;
+        }
+      }
+    }
+  }
+
+  void flush(const size_t job_idx, const std::vector<size_t>& slot_partitions) override {
+    if constexpr (function != AggregateFunction::Any) {
+      auto& job = _jobs[job_idx];
+      for (auto slot_id = size_t{0}; slot_id < slot_partitions.size(); ++slot_id) {
+        job.partitions[slot_partitions[slot_id]].emplace_back(std::move(job.slots[slot_id]));
+        job.slots[slot_id] = Result{};
+      }
+    }
+  }
+
+  void spill(const size_t job_idx, const size_t partition_idx, std::ostream& stream) override {
+    if constexpr (function != AggregateFunction::Any) {
+      auto& partition = _jobs[job_idx].partitions[partition_idx];
+      for (const auto& partial_result : partition) {
+        const auto& aggregate = partial_result.current_primary_aggregate;
+        write_spilled_value(stream, static_cast<char>(aggregate.has_value()));
+        if (aggregate) write_spilled_value(stream, *aggregate);
+        write_spilled_value(stream, partial_result.aggregate_count);
+        if constexpr (function == AggregateFunction::ApproxCountDistinct) {
+          write_spilled_value(stream, static_cast<char>(partial_result.has_details()));
+          if (partial_result.has_details()) partial_result.sketch().write(stream);
+        }
+      }
+      partition = std::vector<Result>{};
+    }
+  }
+
+  void merge_spilled(const size_t partition_idx, std::istream& stream, const std::vector<size_t>& group_ids,
+                     const size_t group_count) override {
+    auto& merged_results = _merged_results[partition_idx];
+    merged_results.resize(group_count);
+
+    if constexpr (function != AggregateFunction::Any) {
+      for (const auto group_id : group_ids) {
+        auto partial_result = Result{};
+        auto has_aggregate = char{0};
+        read_spilled_value(stream, has_aggregate);
+        if (has_aggregate) {
+          auto aggregate = AggregateType{};
+          read_spilled_value(stream, aggregate);
+          partial_result.current_primary_aggregate = std::move(aggregate);
+        }
+        read_spilled_value(stream, partial_result.aggregate_count);
+        if constexpr (function == AggregateFunction::ApproxCountDistinct) {
+          auto has_sketch = char{0};
+          read_spilled_value(stream, has_sketch);
+          if (has_sketch) {
+            auto sketch = HyperLogLog::read(stream);
+            partial_result.ensure_sketch_initialized(sketch.precision());
+            partial_result.sketch() = std::move(sketch);
+          }
+        }
+        _merge(merged_results[group_id], partial_result);
+      }
+    }
+  }
+
+  void merge_partition(const size_t partition_idx, const std::vector<size_t>& group_ids,
+                       const size_t group_count) override {
+    auto& merged_results = _merged_results[partition_idx];
+    merged_results.resize(group_count);
+
+    if constexpr (function != AggregateFunction::Any) {
+      auto entry_idx = size_t{0};
+      for (auto& job : _jobs) {
+        for (auto& partial_result : job.partitions[partition_idx]) {
+          _merge(merged_results[group_ids[entry_idx]], partial_result);
+          ++entry_idx;
+        }
+        job.partitions[partition_idx] = std::vector<Result>{};
+      }
+    }
+  }
+
+  void write_results(SegmentVisitorContext& context,
+                     const std::vector<std::vector<RowID>>& partition_row_ids) override {
+    auto& results = static_cast<AggregateResultContext<ColumnDataType, AggregateType>&>(context).results;
+    for (auto partition_idx = size_t{0}; partition_idx < _merged_results.size(); ++partition_idx) {
+      auto& merged_results = _merged_results[partition_idx];
+      const auto& row_ids = partition_row_ids[partition_idx];
+      for (auto group_idx = size_t{0}; group_idx < merged_results.size(); ++group_idx) {
+        results.emplace_back(std::move(merged_results[group_idx]));
+        results.back().row_id = row_ids[group_idx];
+      }
+    }
+  }
+
+  size_t partial_result_size() const override {
+    if constexpr (function == AggregateFunction::Any) return 0;
+
+    // Only the sketch itself is accounted for. Its registers are sparse (and small) for most groups.
+    if constexpr (function == AggregateFunction::ApproxCountDistinct) return sizeof(Result) + sizeof(HyperLogLog);
+
+    return sizeof(Result);
+  }
+
+ protected:
+  static void _merge(Result& result, Result& partial_result) {
+    auto& aggregate = result.current_primary_aggregate;
+    auto& partial_aggregate = partial_result.current_primary_aggregate;
+
+    if (partial_aggregate) {
+      if constexpr (function == AggregateFunction::Min) {
+        if (!aggregate || value_smaller(*partial_aggregate, *aggregate)) aggregate = std::move(partial_aggregate);
+      } else if constexpr (function == AggregateFunction::Max) {
+        if (!aggregate || value_greater(*partial_aggregate, *aggregate)) aggregate = std::move(partial_aggregate);
+      } else if constexpr (function == AggregateFunction::Sum || function == AggregateFunction::Avg) {
+        if (aggregate) {
+          *aggregate += *partial_aggregate;
+        } else {
+          aggregate = std::move(partial_aggregate);
+        }
+      }
+    }
+
+    if constexpr (function == AggregateFunction::ApproxCountDistinct) {
+      if (partial_result.has_details()) {
+        result.ensure_sketch_initialized(partial_result.sketch().precision());
+        result.sketch().merge(partial_result.sketch());
+      }
+    }
+
+    result.aggregate_count += partial_result.aggregate_count;
+  }
+
+  struct JobState {
+    // The values of the current chunk
+    std::vector<ColumnDataType> values;
+    std::vector<bool> null_values;
+
+    std::vector<Result> slots;
+    std::vector<std::vector<Result>> partitions;
+  };
+
+  const ColumnID _column_id;
+  const uint8_t _sketch_precision;
+  std::vector<JobState> _jobs;
+  std::vector<std::vector<Result>> _merged_results;
+};
+
+template <typename ColumnDataType>
+std::unique_ptr<BasePartialAggregator> create_partial_aggregator(const AggregateExpression& aggregate,
+                                                                 const ColumnID column_id, const size_t job_count,
+                                                                 const size_t slot_count) {
+  const auto function = aggregate.aggregate_function;
+  switch (function) {
+    case AggregateFunction::Min:
+      return std::make_unique<PartialAggregator<ColumnDataType, AggregateFunction::Min>>(column_id, job_count,
+                                                                                         slot_count);
+    case AggregateFunction::Max:
+      return std::make_unique<PartialAggregator<ColumnDataType, AggregateFunction::Max>>(column_id, job_count,
+                                                                                         slot_count);
+    case AggregateFunction::Sum:
+      return std::make_unique<PartialAggregator<ColumnDataType, AggregateFunction::Sum>>(column_id, job_count,
+                                                                                         slot_count);
+    case AggregateFunction::Avg:
+      return std::make_unique<PartialAggregator<ColumnDataType, AggregateFunction::Avg>>(column_id, job_count,
+                                                                                         slot_count);
+    case AggregateFunction::Count:
+      return std::make_unique<PartialAggregator<ColumnDataType, AggregateFunction::Count>>(column_id, job_count,
+                                                                                           slot_count);
+    case AggregateFunction::ApproxCountDistinct:
+      return std::make_unique<PartialAggregator<ColumnDataType, AggregateFunction::ApproxCountDistinct>>(
+          column_id, job_count, slot_count, aggregate.sketch_precision);
+    case AggregateFunction::CountDistinct:
+    case AggregateFunction::StandardDeviationSample:
+    case AggregateFunction::Any:
+      break;
+  }
+  Fail("Aggregate function cannot be aggregated in parallel");
+}
+
+// The radix partition of a group. The hash is scrambled (Fibonacci hashing) as std::hash is the identity for integers.
+size_t radix_partition(const size_t hash, const size_t radix_bits) {
+  if (radix_bits == 0) return 0;
+  return (hash * size_t{11'400'714'819'323'198'485ul}) >> (64 - radix_bits);
+}
+
+}  // namespace
+
 template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
 __attribute__((hot)) void AggregateHash::_aggregate_segment(ChunkID chunk_id, ColumnID column_index,
                                                             const AbstractSegment& abstract_segment,
@@ -146,6 +531,8 @@ __attribute__((hot)) void AggregateHash::_aggregate_segment(ChunkID chunk_id, Co
   auto& result_ids = *context.result_ids;
   auto& results = context.results;
 
+  [[maybe_unused]] const auto sketch_precision = _aggregates[column_index]->sketch_precision;
+
   ChunkOffset chunk_offset{0};
 
   segment_iterate<ColumnDataType>(abstract_segment, [&](const auto& position) {
@@ -161,6 +548,9 @@ __attribute__((hot)) void AggregateHash::_aggregate_segment(ChunkID chunk_id, Co
         // For the case of CountDistinct, insert the current value into the set to keep track of distinct values
         result.ensure_distinct_values_initialized(context.buffer);
         result.distinct_values().emplace(position.value());
+      } else if constexpr (function == AggregateFunction::ApproxCountDistinct) {  // NOLINT
+        result.ensure_sketch_initialized(sketch_precision);
+        result.sketch().add(std::hash<ColumnDataType>{}(position.value()));
       } else if constexpr (function == AggregateFunction::StandardDeviationSample) {  // NOLINT
         result.ensure_secondary_aggregates_initialized(context.buffer);
         aggregator(position.value(), result.current_primary_aggregate, result.current_secondary_aggregates());
@@ -418,8 +808,15 @@ void AggregateHash::_aggregate() {
 
   /**
    * PARTITIONING STEP
+   *
+   * If the input can be grouped on dictionary codes, the AggregateKeys of the rows are not needed.
    */
-  const auto keys_per_chunk = _partition_by_groupby_keys<AggregateKey>();
+  auto dictionary_group_columns = std::optional<DictionaryGroupColumns>{};
+  if constexpr (!std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+    dictionary_group_columns = _dictionary_group_columns();
+  }
+  const auto keys_per_chunk =
+      dictionary_group_columns ? KeysPerChunk<AggregateKey>{} : _partition_by_groupby_keys<AggregateKey>();
   step_performance_data.set_step_runtime(OperatorSteps::GroupByKeyPartitioning, timer.lap());
 
   /**
@@ -462,6 +859,18 @@ void AggregateHash::_aggregate() {
         _create_aggregate_context<AggregateKey>(data_type, aggregate->aggregate_function);
   }
 
+  if constexpr (!std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+    if (dictionary_group_columns || _use_parallel_aggregation()) {
+      _aggregate_in_parallel<AggregateKey>(keys_per_chunk, dictionary_group_columns);
+      step_performance_data.set_step_runtime(OperatorSteps::Aggregating, timer.lap());
+      return;
+    }
+
+    if (_memory_budget) {
+      PerformanceWarning("Memory budget of AggregateHash ignored as COUNT(DISTINCT) and STDDEV_SAMP cannot be spilled");
+    }
+  }
+
   // Process Chunks and perform aggregations
   const auto chunk_count = input_table->chunk_count();
   for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
@@ -580,6 +989,10 @@ void AggregateHash::_aggregate() {
               _aggregate_segment<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(
                   chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
               break;
+            case AggregateFunction::ApproxCountDistinct:
+              _aggregate_segment<ColumnDataType, AggregateFunction::ApproxCountDistinct, AggregateKey>(
+                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
+              break;
             case AggregateFunction::StandardDeviationSample:
               _aggregate_segment<ColumnDataType, AggregateFunction::StandardDeviationSample, AggregateKey>(
                   chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
@@ -597,6 +1010,512 @@ void AggregateHash::_aggregate() {
   step_performance_data.set_step_runtime(OperatorSteps::Aggregating, timer.lap());
 }  // NOLINT(readability/fn_size)
 
+bool AggregateHash::_use_parallel_aggregation() const {
+  // Spilling is only implemented for the parallel aggregation, which is thus also used for small inputs if a memory
+  // budget is given.
+  const auto& input_table = left_input_table();
+  if (!_memory_budget &&
+      (input_table->chunk_count() < 2 || input_table->row_count() < PARALLEL_AGGREGATION_MIN_ROW_COUNT)) {
+    return false;
+  }
+
+  return has_mergeable_partial_results(_aggregates);
+}
+
+/**
+ * Checks whether the input can be grouped on dictionary codes, i.e., whether every GROUP BY column is a dictionary
+ * segment (or a ReferenceSegment referencing dictionary segments of a single chunk) in every chunk, and whether the
+ * number of combinations of ValueIDs in each chunk is small enough to be aggregated into a dense array. The
+ * dictionaries are mapped to AggregateKeyEntries so that equal values of different chunks end up in the same group.
+ * This costs a hash lookup per dictionary entry instead of one per row.
+ */
+std::optional<AggregateHash::DictionaryGroupColumns> AggregateHash::_dictionary_group_columns() const {
+  if (_groupby_column_ids.empty() || !has_mergeable_partial_results(_aggregates)) return std::nullopt;
+
+  const auto& input_table = left_input_table();
+  const auto chunk_count = input_table->chunk_count();
+  auto dictionary_group_columns = DictionaryGroupColumns(chunk_count);
+  auto code_counts = std::vector<size_t>(chunk_count, 1);
+
+  for (const auto groupby_column_id : _groupby_column_ids) {
+    auto is_dictionary_encoded = true;
+    resolve_data_type(input_table->column_data_type(groupby_column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      // The AggregateKeyEntry 0 is reserved for NULL
+      auto key_entries_by_value = ska::bytell_hash_map<ColumnDataType, AggregateKeyEntry, std::hash<ColumnDataType>>{};
+
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto chunk = input_table->get_chunk(chunk_id);
+        if (!chunk || chunk->size() == 0) continue;
+
+        auto group_column = DictionaryGroupColumn{};
+        const auto segment = chunk->get_segment(groupby_column_id);
+        if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+          const auto& pos_list = reference_segment->pos_list();
+          if (!pos_list->references_single_chunk()) {
+            is_dictionary_encoded = false;
+            return;
+          }
+
+          const auto referenced_chunk = reference_segment->referenced_table()->get_chunk(pos_list->common_chunk_id());
+          group_column.segment = std::dynamic_pointer_cast<const BaseDictionarySegment>(
+              referenced_chunk->get_segment(reference_segment->referenced_column_id()));
+          group_column.positions = pos_list;
+        } else {
+          group_column.segment = std::dynamic_pointer_cast<const BaseDictionarySegment>(segment);
+        }
+
+        if (!group_column.segment) {
+          is_dictionary_encoded = false;
+          return;
+        }
+
+        const auto unique_values_count = group_column.segment->unique_values_count();
+        code_counts[chunk_id] *= unique_values_count + size_t{1};
+        if (code_counts[chunk_id] > DICTIONARY_AGGREGATION_MAX_CODE_COUNT) {
+          is_dictionary_encoded = false;
+          return;
+        }
+
+        DebugAssert(group_column.segment->null_value_id() == unique_values_count,
+                    "Expected the NULL ValueID to follow the dictionary");
+        group_column.key_entries.resize(unique_values_count + size_t{1}, AggregateKeyEntry{0});
+        for (auto value_id = ValueID::base_type{0}; value_id < unique_values_count; ++value_id) {
+          const auto value = boost::get<ColumnDataType>(group_column.segment->value_of_value_id(ValueID{value_id}));
+          group_column.key_entries[value_id] =
+              key_entries_by_value.try_emplace(value, key_entries_by_value.size() + 1).first->second;
+        }
+
+        dictionary_group_columns[chunk_id].emplace_back(std::move(group_column));
+      }
+    });
+
+    if (!is_dictionary_encoded) return std::nullopt;
+  }
+
+  return dictionary_group_columns;
+}
+
+/**
+ * Two-phase parallel aggregation. The chunks are split into ranges, one per job. Each job pre-aggregates its rows into
+ * a local hash table of LOCAL_GROUP_CAPACITY groups, which is small enough to stay in the cache. Whenever the table is
+ * full, the keys and partial results of its groups are moved into radix partitions by the hash of their keys, and the
+ * table is cleared. Groups with many rows are thus mostly aggregated locally. In the second phase, one job per
+ * partition merges the partial results of all jobs. As each group belongs to exactly one partition, the partitions are
+ * merged independently and without synchronization. The results are written to the contexts partition by partition,
+ * so that the groups are in the same order for all aggregate columns.
+ *
+ * With a memory budget, each job may keep its share of the budget in partitioned partial results. If it exceeds its
+ * share, it writes all of its partitions to a new spill file (a run) and continues with empty partitions. The number of
+ * partitions is raised so that the partitions can be merged in batches that fit into the budget. A partition's spilled
+ * entries are read and merged run by run before its in-memory entries, so that at most one run of a partition is
+ * loaded at a time.
+ *
+ * When grouping on dictionary codes, the slot of a row is not looked up by its AggregateKey, but in an array indexed by
+ * the code of the row. As the codes are only valid within a chunk, the slots are flushed after each chunk.
+ */
+template <typename AggregateKey>
+void AggregateHash::_aggregate_in_parallel(const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                                           const std::optional<DictionaryGroupColumns>& dictionary_group_columns) {
+  const auto& input_table = left_input_table();
+  const auto chunk_count = input_table->chunk_count();
+  auto& operator_performance_data = static_cast<PerformanceData&>(*performance_data);
+  operator_performance_data.aggregated_on_dictionary_codes = dictionary_group_columns.has_value();
+
+  // With a memory budget, the parallel aggregation is also used for inputs with fewer than two chunks
+  const auto job_count =
+      std::max(size_t{1}, std::min(static_cast<size_t>(chunk_count), MAX_PARALLEL_AGGREGATION_JOB_COUNT));
+
+  // One partial aggregator per context that the single-threaded aggregation fills. ANY is written from the RowIDs of
+  // the groups and has no results, unless it is used for the DISTINCT implementation.
+  auto aggregators = std::vector<std::pair<ColumnID, std::unique_ptr<BasePartialAggregator>>>{};
+  if (!_has_aggregate_functions) {
+    aggregators.emplace_back(
+        ColumnID{0}, std::make_unique<PartialAggregator<DistinctColumnType, AggregateFunction::Any>>(
+                         INVALID_COLUMN_ID, job_count, LOCAL_GROUP_CAPACITY));
+  }
+  for (auto aggregate_idx = ColumnID{0}; aggregate_idx < _aggregates.size(); ++aggregate_idx) {
+    const auto& aggregate = _aggregates[aggregate_idx];
+    if (aggregate->aggregate_function == AggregateFunction::Any) continue;
+
+    const auto input_column_id = static_cast<const PQPColumnExpression&>(*aggregate->argument()).column_id;
+    if (input_column_id == INVALID_COLUMN_ID) {
+      // COUNT(*)
+      aggregators.emplace_back(aggregate_idx,
+                               create_partial_aggregator<CountColumnType>(*aggregate, INVALID_COLUMN_ID, job_count,
+                                                                          LOCAL_GROUP_CAPACITY));
+      continue;
+    }
+
+    resolve_data_type(input_table->column_data_type(input_column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      aggregators.emplace_back(aggregate_idx,
+                               create_partial_aggregator<ColumnDataType>(*aggregate, input_column_id, job_count,
+                                                                         LOCAL_GROUP_CAPACITY));
+    });
+  }
+
+  // Estimated memory usage of a partitioned entry, i.e., the key, the RowID, and the partial results of a group
+  auto entry_size = sizeof(AggregateKey) + sizeof(RowID);
+  for (const auto& [context_idx, aggregator] : aggregators) {
+    entry_size += aggregator->partial_result_size();
+  }
+
+  auto radix_bits = size_t{0};
+  while ((size_t{1} << radix_bits) < job_count) ++radix_bits;
+  if (_memory_budget) {
+    // As in the JoinHash, choose enough partitions so that a partition is expected to take an eighth of the budget,
+    // assuming that every row forms a group of its own. This way, multiple partitions can be merged in parallel.
+    const auto expected_memory_usage = static_cast<double>(input_table->row_count() * entry_size);
+    const auto partition_budget = std::max(1.0, static_cast<double>(*_memory_budget) / 8.0);
+    const auto budget_partition_count = std::max(1.0, expected_memory_usage / partition_budget);
+    const auto spilling_radix_bits =
+        std::min(MAX_SPILLING_RADIX_BITS, static_cast<size_t>(std::ceil(std::log2(budget_partition_count))));
+    radix_bits = std::max(radix_bits, spilling_radix_bits);
+  }
+  const auto partition_count = size_t{1} << radix_bits;
+
+  for (auto& [context_idx, aggregator] : aggregators) {
+    aggregator->set_partition_count(partition_count);
+  }
+
+  // For each job and partition, the keys of the flushed groups and the first row in which they were seen
+  struct PartitionBuffer {
+    std::vector<AggregateKey> keys;
+    std::vector<RowID> row_ids;
+  };
+  auto partition_buffers =
+      std::vector<std::vector<PartitionBuffer>>(job_count, std::vector<PartitionBuffer>(partition_count));
+
+  // The partitions of a job that were written to a spill file. The entries of partition i start at partition_offsets[i]
+  // and consist of the entry count, the keys, the RowIDs, and the partial results of each aggregator.
+  struct SpillRun {
+    std::unique_ptr<SpillFile> file;
+    std::vector<size_t> partition_offsets;
+  };
+  auto spill_runs = std::vector<std::vector<SpillRun>>(job_count);
+  auto spilled_entry_counts = std::vector<std::vector<size_t>>(job_count, std::vector<size_t>(partition_count));
+  auto spilled_bytes = std::vector<size_t>(job_count);
+  auto spilling_runtimes = std::vector<std::chrono::nanoseconds>(job_count);
+  const auto job_memory_budget = _memory_budget ? *_memory_budget / job_count : std::numeric_limits<size_t>::max();
+
+  // Combines the ValueIDs of the GROUP BY columns of each row of a chunk into a code. The ValueIDs of the first column
+  // are the least significant digits.
+  const auto compute_dictionary_codes = [](const std::vector<DictionaryGroupColumn>& group_columns,
+                                           const ChunkOffset chunk_size, std::vector<uint32_t>& codes) {
+    codes.assign(chunk_size, 0);
+    auto code_factor = uint32_t{1};
+    for (const auto& group_column : group_columns) {
+      resolve_compressed_vector_type(*group_column.segment->attribute_vector(), [&](const auto& attribute_vector) {
+        if (!group_column.positions) {
+          auto chunk_offset = ChunkOffset{0};
+          for (const auto value_id : attribute_vector) {
+            codes[chunk_offset] += static_cast<uint32_t>(value_id) * code_factor;
+            ++chunk_offset;
+          }
+          return;
+        }
+
+        auto decompressor = attribute_vector.create_decompressor();
+        resolve_pos_list_type(group_column.positions, [&](const auto& pos_list) {
+          auto chunk_offset = ChunkOffset{0};
+          for (const auto& row_id : *pos_list) {
+            codes[chunk_offset] += static_cast<uint32_t>(decompressor.get(row_id.chunk_offset)) * code_factor;
+            ++chunk_offset;
+          }
+        });
+      });
+      code_factor *= static_cast<uint32_t>(group_column.key_entries.size());
+    }
+  };
+
+  // Builds the AggregateKey of a code from the AggregateKeyEntries of its ValueIDs
+  const auto dictionary_aggregate_key = [](const std::vector<DictionaryGroupColumn>& group_columns, uint32_t code) {
+    auto key = AggregateKey{};
+    if constexpr (std::is_same_v<AggregateKey, AggregateKeySmallVector>) {
+      key.resize(group_columns.size());
+    }
+
+    for (auto group_column_idx = size_t{0}; group_column_idx < group_columns.size(); ++group_column_idx) {
+      const auto& key_entries = group_columns[group_column_idx].key_entries;
+      const auto key_entry = key_entries[code % key_entries.size()];
+      code /= key_entries.size();
+
+      if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+        key = key_entry;
+      } else {
+        key[group_column_idx] = key_entry;
+      }
+    }
+    return key;
+  };
+
+  /**
+   * PRE-AGGREGATION PHASE
+   */
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(job_count);
+  for (auto job_idx = size_t{0}; job_idx < job_count; ++job_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, job_idx]() {
+      const auto chunk_begin = static_cast<ChunkID::base_type>(job_idx * chunk_count / job_count);
+      const auto chunk_end = static_cast<ChunkID::base_type>((job_idx + 1) * chunk_count / job_count);
+
+      auto slot_ids_by_key = ska::bytell_hash_map<AggregateKey, uint32_t, std::hash<AggregateKey>>{};
+      slot_ids_by_key.reserve(LOCAL_GROUP_CAPACITY);
+      auto slot_keys = std::vector<AggregateKey>{};
+      auto slot_row_ids = std::vector<RowID>{};
+      auto slot_partitions = std::vector<size_t>{};
+      auto slot_ids = std::vector<uint32_t>{};
+      auto& job_partition_buffers = partition_buffers[job_idx];
+      auto buffered_entry_count = size_t{0};
+
+      // For the aggregation on dictionary codes: The code of each row of the current chunk, the slot of each code, and
+      // the codes that have a slot
+      auto codes = std::vector<uint32_t>{};
+      auto slot_ids_by_code = std::vector<uint32_t>{};
+      auto slot_codes = std::vector<uint32_t>{};
+      if (dictionary_group_columns) slot_ids_by_code.resize(DICTIONARY_AGGREGATION_MAX_CODE_COUNT, INVALID_SLOT_ID);
+
+      const auto spill = [&]() {
+        Timer spill_timer;
+        auto& spill_run = spill_runs[job_idx].emplace_back(
+            SpillRun{std::make_unique<SpillFile>("hyrise_aggregate_hash"), std::vector<size_t>(partition_count)});
+        auto stream = std::ofstream{spill_run.file->path(), std::ios::binary | std::ios::trunc};
+        Assert(stream.is_open(), "Could not open spill file " + spill_run.file->path());
+
+        for (auto partition_idx = size_t{0}; partition_idx < partition_count; ++partition_idx) {
+          auto& partition_buffer = job_partition_buffers[partition_idx];
+          spill_run.partition_offsets[partition_idx] = static_cast<size_t>(stream.tellp());
+
+          write_spilled_value(stream, partition_buffer.keys.size());
+          for (const auto& key : partition_buffer.keys) {
+            write_spilled_value(stream, key);
+          }
+          stream.write(reinterpret_cast<const char*>(partition_buffer.row_ids.data()),
+                       static_cast<std::streamsize>(partition_buffer.row_ids.size() * sizeof(RowID)));
+          for (auto& [context_idx, aggregator] : aggregators) {
+            aggregator->spill(job_idx, partition_idx, stream);
+          }
+
+          spilled_entry_counts[job_idx][partition_idx] += partition_buffer.keys.size();
+          partition_buffer = PartitionBuffer{};
+        }
+
+        Assert(stream.good(), "Could not write spill file " + spill_run.file->path());
+        spilled_bytes[job_idx] += static_cast<size_t>(stream.tellp());
+        buffered_entry_count = 0;
+        spilling_runtimes[job_idx] += spill_timer.lap();
+      };
+
+      const auto flush = [&]() {
+        for (auto slot_id = size_t{0}; slot_id < slot_keys.size(); ++slot_id) {
+          auto& partition_buffer = job_partition_buffers[slot_partitions[slot_id]];
+          partition_buffer.keys.emplace_back(std::move(slot_keys[slot_id]));
+          partition_buffer.row_ids.emplace_back(slot_row_ids[slot_id]);
+        }
+        for (auto& [context_idx, aggregator] : aggregators) {
+          aggregator->flush(job_idx, slot_partitions);
+        }
+        buffered_entry_count += slot_keys.size();
+
+        slot_ids_by_key.clear();
+        slot_keys.clear();
+        slot_row_ids.clear();
+        slot_partitions.clear();
+        for (const auto code : slot_codes) {
+          slot_ids_by_code[code] = INVALID_SLOT_ID;
+        }
+        slot_codes.clear();
+
+        if (buffered_entry_count * entry_size > job_memory_budget) spill();
+      };
+
+      for (auto chunk_id = ChunkID{chunk_begin}; chunk_id < chunk_end; ++chunk_id) {
+        const auto chunk = input_table->get_chunk(chunk_id);
+        if (!chunk) continue;
+
+        for (auto& [context_idx, aggregator] : aggregators) {
+          aggregator->load_chunk(job_idx, *chunk);
+        }
+
+        const auto chunk_size = chunk->size();
+        slot_ids.resize(chunk_size);
+        auto aggregated_until = ChunkOffset{0};
+
+        // Assigns the next slot to a new group. If all slots are taken, the rows up to here are aggregated and their
+        // partial results are moved to the partitions first.
+        const auto add_slot = [&](const AggregateKey& key, const ChunkOffset chunk_offset) {
+          if (slot_keys.size() == LOCAL_GROUP_CAPACITY) {
+            for (auto& [context_idx, aggregator] : aggregators) {
+              aggregator->aggregate_rows(job_idx, aggregated_until, chunk_offset, slot_ids);
+            }
+            aggregated_until = chunk_offset;
+            flush();
+          }
+
+          const auto slot_id = static_cast<uint32_t>(slot_keys.size());
+          slot_keys.emplace_back(key);
+          slot_row_ids.emplace_back(chunk_id, chunk_offset);
+          slot_partitions.emplace_back(radix_partition(std::hash<AggregateKey>{}(key), radix_bits));
+          return slot_id;
+        };
+
+        if (dictionary_group_columns) {
+          const auto& group_columns = (*dictionary_group_columns)[chunk_id];
+          compute_dictionary_codes(group_columns, chunk_size, codes);
+
+          for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+            const auto code = codes[chunk_offset];
+            if (slot_ids_by_code[code] == INVALID_SLOT_ID) {
+              // The key is built from the dictionaries once per code, not once per row
+              const auto slot_id = add_slot(dictionary_aggregate_key(group_columns, code), chunk_offset);
+              slot_ids_by_code[code] = slot_id;
+              slot_codes.emplace_back(code);
+            }
+            slot_ids[chunk_offset] = slot_ids_by_code[code];
+          }
+        } else {
+          for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+            const auto& key = get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset);
+            auto slot_iter = slot_ids_by_key.find(key);
+            if (slot_iter == slot_ids_by_key.end()) {
+              slot_iter = slot_ids_by_key.emplace(key, add_slot(key, chunk_offset)).first;
+            }
+            slot_ids[chunk_offset] = slot_iter->second;
+          }
+        }
+
+        for (auto& [context_idx, aggregator] : aggregators) {
+          aggregator->aggregate_rows(job_idx, aggregated_until, chunk_size, slot_ids);
+        }
+
+        // The codes are only valid within the chunk
+        if (dictionary_group_columns) flush();
+      }
+
+      flush();
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  /**
+   * MERGE PHASE
+   */
+  auto partition_row_ids = std::vector<std::vector<RowID>>(partition_count);
+  auto merge_spilling_runtimes = std::vector<std::chrono::nanoseconds>(partition_count);
+
+  const auto merge_partition = [&](const size_t partition_idx) {
+    auto group_ids_by_key = ska::bytell_hash_map<AggregateKey, size_t, std::hash<AggregateKey>>{};
+    auto group_ids = std::vector<size_t>{};
+    auto& row_ids = partition_row_ids[partition_idx];
+
+    const auto add_entries = [&](const std::vector<AggregateKey>& keys, const std::vector<RowID>& entry_row_ids) {
+      const auto entry_count = keys.size();
+      for (auto entry_idx = size_t{0}; entry_idx < entry_count; ++entry_idx) {
+        const auto [group_iter, inserted] = group_ids_by_key.emplace(keys[entry_idx], row_ids.size());
+        if (inserted) row_ids.emplace_back(entry_row_ids[entry_idx]);
+        group_ids.emplace_back(group_iter->second);
+      }
+    };
+
+    Timer spill_timer;
+    for (const auto& job_spill_runs : spill_runs) {
+      for (const auto& spill_run : job_spill_runs) {
+        auto stream = std::ifstream{spill_run.file->path(), std::ios::binary};
+        Assert(stream.is_open(), "Could not open spill file " + spill_run.file->path());
+        stream.seekg(static_cast<std::streamoff>(spill_run.partition_offsets[partition_idx]));
+
+        auto entry_count = size_t{0};
+        read_spilled_value(stream, entry_count);
+        auto keys = std::vector<AggregateKey>(entry_count);
+        for (auto& key : keys) {
+          read_spilled_value(stream, key);
+        }
+        auto entry_row_ids = std::vector<RowID>(entry_count);
+        stream.read(reinterpret_cast<char*>(entry_row_ids.data()),
+                    static_cast<std::streamsize>(entry_count * sizeof(RowID)));
+
+        group_ids.clear();
+        add_entries(keys, entry_row_ids);
+        for (auto& [context_idx, aggregator] : aggregators) {
+          aggregator->merge_spilled(partition_idx, stream, group_ids, row_ids.size());
+        }
+        Assert(stream.good(), "Could not read spill file " + spill_run.file->path());
+      }
+    }
+    merge_spilling_runtimes[partition_idx] = spill_timer.lap();
+
+    group_ids.clear();
+    for (auto& job_partition_buffers : partition_buffers) {
+      auto& partition_buffer = job_partition_buffers[partition_idx];
+      add_entries(partition_buffer.keys, partition_buffer.row_ids);
+      partition_buffer = PartitionBuffer{};
+    }
+
+    for (auto& [context_idx, aggregator] : aggregators) {
+      aggregator->merge_partition(partition_idx, group_ids, row_ids.size());
+    }
+  };
+
+  // Without a memory budget, all partitions are merged at once. Otherwise, they are merged in batches whose entries are
+  // expected to fit into the budget.
+  auto partition_memory_usages = std::vector<size_t>(partition_count);
+  for (auto job_idx = size_t{0}; job_idx < job_count; ++job_idx) {
+    for (auto partition_idx = size_t{0}; partition_idx < partition_count; ++partition_idx) {
+      const auto entry_count =
+          partition_buffers[job_idx][partition_idx].keys.size() + spilled_entry_counts[job_idx][partition_idx];
+      partition_memory_usages[partition_idx] += entry_count * entry_size;
+    }
+  }
+
+  auto batch_begin = size_t{0};
+  while (batch_begin < partition_count) {
+    auto batch_end = partition_count;
+    if (_memory_budget) {
+      batch_end = batch_begin + 1;
+      auto batch_memory_usage = partition_memory_usages[batch_begin];
+      while (batch_end < partition_count &&
+             batch_memory_usage + partition_memory_usages[batch_end] <= *_memory_budget) {
+        batch_memory_usage += partition_memory_usages[batch_end];
+        ++batch_end;
+      }
+      ++operator_performance_data.merge_batch_count;
+    }
+
+    jobs.clear();
+    jobs.reserve(batch_end - batch_begin);
+    for (auto partition_idx = batch_begin; partition_idx < batch_end; ++partition_idx) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, partition_idx]() { merge_partition(partition_idx); }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+    batch_begin = batch_end;
+  }
+
+  for (auto& [context_idx, aggregator] : aggregators) {
+    aggregator->write_results(*_contexts_per_column[context_idx], partition_row_ids);
+  }
+
+  auto spilling_runtime = std::chrono::nanoseconds{0};
+  for (auto job_idx = size_t{0}; job_idx < job_count; ++job_idx) {
+    operator_performance_data.spill_file_count += spill_runs[job_idx].size();
+    operator_performance_data.spilled_bytes += spilled_bytes[job_idx];
+    for (const auto spilled_entry_count : spilled_entry_counts[job_idx]) {
+      operator_performance_data.spilled_partial_result_count += spilled_entry_count;
+    }
+    spilling_runtime += spilling_runtimes[job_idx];
+  }
+
+  // The time spent writing and merging the spill files, accumulated over all jobs
+  if (operator_performance_data.spill_file_count > 0) {
+    for (const auto merge_spilling_runtime : merge_spilling_runtimes) {
+      spilling_runtime += merge_spilling_runtime;
+    }
+    operator_performance_data.set_step_runtime(OperatorSteps::Spilling, spilling_runtime);
+  }
+}
+
 std::shared_ptr<const Table> AggregateHash::_on_execute() {
   // We do not want the overhead of a vector with heap storage when we have a limited number of aggregate columns.
   // However, more specializations mean more compile time. We now have specializations for 0, 1, 2, and >2 GROUP BY
@@ -727,6 +1646,20 @@ std::enable_if_t<func == AggregateFunction::CountDistinct, void> write_aggregate
   }
 }
 
+// APPROX_COUNT_DISTINCT writes the estimated number of distinct values, zero if the group has no non-NULL values
+template <typename ColumnDataType, typename AggregateType, AggregateFunction func>
+std::enable_if_t<func == AggregateFunction::ApproxCountDistinct, void> write_aggregate_values(
+    pmr_vector<AggregateType>& values, pmr_vector<bool>& null_values,
+    const AggregateResults<ColumnDataType, AggregateType>& results) {
+  values.resize(results.size());
+
+  size_t output_offset = 0;
+  for (const auto& result : results) {
+    values[output_offset] = result.has_details() ? static_cast<AggregateType>(result.sketch().estimate()) : 0;
+    ++output_offset;
+  }
+}
+
 // AVG writes the calculated average from current aggregate and the aggregate counter
 template <typename ColumnDataType, typename AggregateType, AggregateFunction func>
 std::enable_if_t<func == AggregateFunction::Avg && std::is_arithmetic_v<AggregateType>, void> write_aggregate_values(
@@ -884,6 +1817,9 @@ void AggregateHash::_write_aggregate_output(boost::hana::basic_type<ColumnDataTy
     case AggregateFunction::CountDistinct:
       write_aggregate_output<ColumnDataType, AggregateFunction::CountDistinct>(column_index);
       break;
+    case AggregateFunction::ApproxCountDistinct:
+      write_aggregate_output<ColumnDataType, AggregateFunction::ApproxCountDistinct>(column_index);
+      break;
     case AggregateFunction::StandardDeviationSample:
       write_aggregate_output<ColumnDataType, AggregateFunction::StandardDeviationSample>(column_index);
       break;
@@ -931,7 +1867,8 @@ void AggregateHash::write_aggregate_output(ColumnID aggregate_index) {
   auto values = pmr_vector<decltype(aggregate_type)>{};
   auto null_values = pmr_vector<bool>{};
 
-  constexpr bool NEEDS_NULL = (function != AggregateFunction::Count && function != AggregateFunction::CountDistinct);
+  constexpr bool NEEDS_NULL = (function != AggregateFunction::Count && function != AggregateFunction::CountDistinct &&
+                               function != AggregateFunction::ApproxCountDistinct);
 
   if (!results.empty()) {
     write_aggregate_values<ColumnDataType, decltype(aggregate_type), function>(values, null_values, results);
@@ -995,6 +1932,12 @@ std::shared_ptr<SegmentVisitorContext> AggregateHash::_create_aggregate_context(
             ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::CountDistinct>::AggregateType,
             AggregateKey>>();
         break;
+      case AggregateFunction::ApproxCountDistinct:
+        context = std::make_shared<AggregateContext<
+            ColumnDataType,
+            typename AggregateTraits<ColumnDataType, AggregateFunction::ApproxCountDistinct>::AggregateType,
+            AggregateKey>>();
+        break;
       case AggregateFunction::StandardDeviationSample:
         context = std::make_shared<AggregateContext<
             ColumnDataType,
@@ -20,6 +20,7 @@
 
 #include "abstract_aggregate_operator.hpp"
 #include "abstract_read_only_operator.hpp"
+#include "aggregate/hyper_log_log.hpp"
 #include "bytell_hash_map.hpp"
 #include "expression/aggregate_expression.hpp"
 #include "resolve_type.hpp"
@@ -30,6 +31,9 @@
 
 namespace opossum {
 
+class AbstractPosList;
+class BaseDictionarySegment;
+
 // empty base class for AggregateResultContext
 class SegmentVisitorContext {};
 
@@ -42,6 +46,24 @@ Operator to aggregate columns by certain functions, such as min, max, sum, avera
  i.e. your sorting order.
 
 For implementation details, please check the wiki: https://github.com/hyrise/hyrise/wiki/Operators_Aggregate
+
+Large inputs with GROUP BY columns are aggregated in two parallel phases (see _aggregate_in_parallel): First, jobs
+pre-aggregate ranges of chunks into small thread-local hash tables and flush their partial results into radix
+partitions whenever the local table is full. Then, the partial results of each partition are merged by a separate job.
+COUNT(DISTINCT) and STDDEV_SAMP, whose partial results cannot be merged cheaply, are always aggregated by a single
+thread. The HyperLogLog sketches of APPROX_COUNT_DISTINCT are merged register-wise.
+
+If a memory budget (in bytes) is given, the two-phase aggregation is used for all inputs with GROUP BY columns. Jobs
+whose partitioned partial results exceed their share of the budget write them to temporary files, and the partitions
+are merged in batches that fit into the budget. This bounds the memory used for the partial results of inputs with
+many groups (e.g., near-unique keys). The AggregateKeys of the input rows and the merged results, which form the
+output, are still held in memory. The LQPTranslator takes the budget from the OperatorMemoryBudgetSetting.
+
+If all GROUP BY columns are dictionary-encoded in every chunk (directly or referenced by ReferenceSegments that point
+to a single chunk), the rows are not hashed at all (see _dictionary_group_columns). Instead, the ValueIDs of the GROUP
+BY columns are combined into a dense code per row, and each chunk is aggregated into an array indexed by these codes.
+The AggregateKeys are only built for the codes that occur in a chunk, from the dictionary values, and the per-chunk
+groups are merged by the two-phase aggregation. Low-cardinality GROUP BYs (e.g., TPC-H Q1) thus become array-indexed.
 */
 
 /*
@@ -57,6 +79,7 @@ This result contains:
 
 Optionally, the result may also contain:
 - a set of DISTINCT values OR
+- a HyperLogLog sketch of the values, used by APPROX_COUNT_DISTINCT OR
 - secondary aggregates, which are currently only used by STDDEV_SAMP
 */
 template <typename ColumnDataType, typename AggregateType>
@@ -69,16 +92,23 @@ class AggregateResult {
   using DistinctValues = tsl::robin_set<ColumnDataType, std::hash<ColumnDataType>, std::equal_to<ColumnDataType>,
                                         PolymorphicAllocator<ColumnDataType>>;
 
-  // SecondaryAggregates and DistinctValues are unused in most cases. We store them in a separate variant that is
-  // initialized as needed. This saves us a lot of memory in this critical data structure. Before using this variant
-  // the corresponding ensure_*_initialized method has to be called.
-  using Details = std::variant<SecondaryAggregates<AggregateType>, DistinctValues>;
+  // SecondaryAggregates, DistinctValues, and the sketch are unused in most cases. We store them in a separate variant
+  // that is initialized as needed. This saves us a lot of memory in this critical data structure. Before using this
+  // variant the corresponding ensure_*_initialized method has to be called.
+  using Details = std::variant<SecondaryAggregates<AggregateType>, DistinctValues, HyperLogLog>;
 
   void ensure_distinct_values_initialized(boost::container::pmr::monotonic_buffer_resource& buffer) {
     if (_details) return;
     _details = std::make_unique<Details>(DistinctValues{&buffer});
   }
 
+  void ensure_sketch_initialized(const uint8_t precision) {
+    if (_details) return;
+    _details = std::make_unique<Details>(HyperLogLog{precision});
+  }
+
+  bool has_details() const { return _details != nullptr; }
+
   void ensure_secondary_aggregates_initialized(boost::container::pmr::monotonic_buffer_resource& buffer) {
     if (_details) return;
 
@@ -98,6 +128,16 @@ class AggregateResult {
     return std::get<DistinctValues>(*_details);
   }
 
+  HyperLogLog& sketch() {
+    DebugAssert(_details, "AggregateResult::_details has not been properly initialized for this aggregation function");
+    return std::get<HyperLogLog>(*_details);
+  }
+
+  const HyperLogLog& sketch() const {
+    DebugAssert(_details, "AggregateResult::_details has not been properly initialized for this aggregation function");
+    return std::get<HyperLogLog>(*_details);
+  }
+
   SecondaryAggregates<AggregateType>& current_secondary_aggregates() {
     DebugAssert(_details, "AggregateResult::_details has not been properly initialized for this aggregation function");
     return std::get<SecondaryAggregates<AggregateType>>(*_details);
@@ -162,20 +202,47 @@ class AggregateHash : public AbstractAggregateOperator {
  public:
   AggregateHash(const std::shared_ptr<AbstractOperator>& in,
                 const std::vector<std::shared_ptr<AggregateExpression>>& aggregates,
-                const std::vector<ColumnID>& groupby_column_ids);
+                const std::vector<ColumnID>& groupby_column_ids,
+                const std::optional<size_t>& memory_budget = std::nullopt);
 
   const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
 
   // write the aggregated output for a given aggregate column
   template <typename ColumnDataType, AggregateFunction function>
   void write_aggregate_output(ColumnID aggregate_index);
 
+  // Inputs with GROUP BY columns, more than one chunk, and at least this many rows are aggregated in parallel
+  static constexpr auto PARALLEL_AGGREGATION_MIN_ROW_COUNT = size_t{10'000};
+
+  // Number of groups that a job of the parallel aggregation pre-aggregates before flushing them into the partitions
+  static constexpr auto LOCAL_GROUP_CAPACITY = size_t{1'024};
+
+  // Upper bound for the number of combinations of ValueIDs of the GROUP BY columns in a chunk that are aggregated on
+  // dictionary codes
+  static constexpr auto DICTIONARY_AGGREGATION_MAX_CODE_COUNT = size_t{1} << 16;
+
   enum class OperatorSteps : uint8_t {
     GroupByKeyPartitioning,
     Aggregating,
     GroupByColumnsWriting,
     AggregateColumnsWriting,
-    OutputWriting
+    OutputWriting,
+    Spilling  // Writing the spill files and merging them, accumulated over all jobs
+  };
+
+  struct PerformanceData : public OperatorPerformanceData<OperatorSteps> {
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override;
+
+    // Partial results that were written to temporary files to stay within the memory budget
+    size_t spill_file_count{0};
+    size_t spilled_partial_result_count{0};
+    size_t spilled_bytes{0};
+
+    // Number of batches in which the partitions were merged, zero if no memory budget was given
+    size_t merge_batch_count{0};
+
+    bool aggregated_on_dictionary_codes{false};
   };
 
  protected:
@@ -187,6 +254,28 @@ class AggregateHash : public AbstractAggregateOperator {
   template <typename AggregateKey>
   void _aggregate();
 
+  bool _use_parallel_aggregation() const;
+
+  // A GROUP BY column of a chunk in the aggregation on dictionary codes
+  struct DictionaryGroupColumn {
+    std::shared_ptr<const BaseDictionarySegment> segment;
+
+    // For ReferenceSegments, the positions in the referenced segment. nullptr for data segments.
+    std::shared_ptr<const AbstractPosList> positions;
+
+    // The AggregateKeyEntry of the value of each ValueID of the segment (0 for the NULL ValueID), which is the same for
+    // equal values in all chunks
+    std::vector<AggregateKeyEntry> key_entries;
+  };
+
+  // For each chunk, its GROUP BY columns. std::nullopt if the aggregation on dictionary codes cannot be used.
+  using DictionaryGroupColumns = std::vector<std::vector<DictionaryGroupColumn>>;
+  std::optional<DictionaryGroupColumns> _dictionary_group_columns() const;
+
+  template <typename AggregateKey>
+  void _aggregate_in_parallel(const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                              const std::optional<DictionaryGroupColumns>& dictionary_group_columns);
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_left_input,
       const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
@@ -212,6 +301,7 @@ class AggregateHash : public AbstractAggregateOperator {
   std::vector<std::shared_ptr<BaseValueSegment>> _groupby_segments;
   std::vector<std::shared_ptr<SegmentVisitorContext>> _contexts_per_column;
   bool _has_aggregate_functions;
+  const std::optional<size_t> _memory_budget;
 };
 
 }  // namespace opossum
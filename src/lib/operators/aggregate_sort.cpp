@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "aggregate/aggregate_traits.hpp"
+#include "aggregate/hyper_log_log.hpp"
 #include "all_type_variant.hpp"
 #include "constant_mappings.hpp"
 #include "expression/pqp_column_expression.hpp"
@@ -89,6 +90,15 @@ void AggregateSort::_aggregate_values(const std::set<RowID>& group_boundaries, c
   // All unique values found. Needed for count distinct
   std::unordered_set<ColumnType> unique_values;
 
+  // Sketch of the values of the current group. Needed for approximate count distinct
+  auto sketch = HyperLogLog{_aggregates[aggregate_index]->sketch_precision};
+
+  // Number of distinct values of the current group, estimated for approximate count distinct
+  const auto distinct_value_count = [&]() -> uint64_t {
+    if constexpr (function == AggregateFunction::ApproxCountDistinct) return sketch.estimate();
+    return unique_values.size();
+  };
+
   // The number of the current group-by-combination. Used as offset when storing values
   uint64_t aggregate_group_index = 0u;
 
@@ -124,7 +134,7 @@ void AggregateSort::_aggregate_values(const std::set<RowID>& group_boundaries, c
       }
       _set_and_write_aggregate_value<AggregateType, function>(
           aggregate_results, aggregate_null_values, aggregate_group_index, aggregate_index, current_primary_aggregate,
-          current_secondary_aggregates, value_count, value_count_with_null, unique_values.size());
+          current_secondary_aggregates, value_count, value_count_with_null, distinct_value_count());
       current_group_begin_pointer = group_boundary;
       aggregate_group_index++;
     }
@@ -163,12 +173,13 @@ void AggregateSort::_aggregate_values(const std::set<RowID>& group_boundaries, c
           _set_and_write_aggregate_value<AggregateType, function>(
               aggregate_results, aggregate_null_values, aggregate_group_index, aggregate_index,
               current_primary_aggregate, current_secondary_aggregates, value_count, value_count_with_null,
-              unique_values.size());
+              distinct_value_count());
 
           // Reset helper variables
           current_primary_aggregate = std::optional<AggregateType>();
           current_secondary_aggregates = SecondaryAggregates<AggregateType>{};
           unique_values.clear();
+          sketch.clear();
           value_count = 0u;
           value_count_with_null = 0u;
 
@@ -187,6 +198,8 @@ void AggregateSort::_aggregate_values(const std::set<RowID>& group_boundaries, c
           value_count++;
           if constexpr (function == AggregateFunction::CountDistinct) {
             unique_values.insert(new_value);
+          } else if constexpr (function == AggregateFunction::ApproxCountDistinct) {  // NOLINT
+            sketch.add(std::hash<ColumnType>{}(new_value));
           } else if constexpr (function == AggregateFunction::Any) {
             // Gathering the group's first value for ANY() is sufficient
             return;
@@ -200,7 +213,7 @@ void AggregateSort::_aggregate_values(const std::set<RowID>& group_boundaries, c
   // Aggregate value for the last group was not written yet
   _set_and_write_aggregate_value<AggregateType, function>(
       aggregate_results, aggregate_null_values, aggregate_group_index, aggregate_index, current_primary_aggregate,
-      current_secondary_aggregates, value_count, value_count_with_null, unique_values.size());
+      current_secondary_aggregates, value_count, value_count_with_null, distinct_value_count());
 
   // Store the aggregate values in a value segment
   if (_output_column_definitions.at(aggregate_index + _groupby_column_ids.size()).nullable) {
@@ -279,7 +292,7 @@ void AggregateSort::_set_and_write_aggregate_value(
       current_secondary_aggregates = SecondaryAggregates<AggregateType>{};
     }
   }
-  if constexpr (function == AggregateFunction::CountDistinct) {
+  if constexpr (function == AggregateFunction::CountDistinct || function == AggregateFunction::ApproxCountDistinct) {
     current_primary_aggregate = unique_value_count;
   }
 
@@ -442,7 +455,8 @@ std::shared_ptr<const Table> AggregateSort::_on_execute() {
       std::vector<AllTypeVariant> default_values;
       for (const auto& aggregate : _aggregates) {
         if (aggregate->aggregate_function == AggregateFunction::Count ||
-            aggregate->aggregate_function == AggregateFunction::CountDistinct) {
+            aggregate->aggregate_function == AggregateFunction::CountDistinct ||
+            aggregate->aggregate_function == AggregateFunction::ApproxCountDistinct) {
           default_values.emplace_back(int64_t{0});
         } else {
           default_values.emplace_back(NULL_VALUE);
@@ -683,6 +697,13 @@ std::shared_ptr<const Table> AggregateSort::_on_execute() {
               group_boundaries, aggregate_index, sorted_table);
           break;
         }
+        case AggregateFunction::ApproxCountDistinct: {
+          using AggregateType =
+              typename AggregateTraits<ColumnDataType, AggregateFunction::ApproxCountDistinct>::AggregateType;
+          _aggregate_values<ColumnDataType, AggregateType, AggregateFunction::ApproxCountDistinct>(
+              group_boundaries, aggregate_index, sorted_table);
+          break;
+        }
         case AggregateFunction::StandardDeviationSample: {
           using AggregateType =
               typename AggregateTraits<ColumnDataType, AggregateFunction::StandardDeviationSample>::AggregateType;
@@ -749,6 +770,9 @@ void AggregateSort::_create_aggregate_column_definitions(boost::hana::basic_type
     case AggregateFunction::CountDistinct:
       create_aggregate_column_definitions<ColumnType, AggregateFunction::CountDistinct>(column_index);
       break;
+    case AggregateFunction::ApproxCountDistinct:
+      create_aggregate_column_definitions<ColumnType, AggregateFunction::ApproxCountDistinct>(column_index);
+      break;
     case AggregateFunction::StandardDeviationSample:
       create_aggregate_column_definitions<ColumnType, AggregateFunction::StandardDeviationSample>(column_index);
       break;
@@ -784,7 +808,7 @@ void AggregateSort::create_aggregate_column_definitions(ColumnID column_index) {
   }
 
   const auto nullable = (function != AggregateFunction::Count && function != AggregateFunction::CountDistinct &&
-                         function != AggregateFunction::Any) ||
+                         function != AggregateFunction::ApproxCountDistinct && function != AggregateFunction::Any) ||
                         (function == AggregateFunction::Any && left_input_table()->column_is_nullable(input_column_id));
   const auto column_name = aggregate->aggregate_function == AggregateFunction::Any ? pqp_column.as_column_name()
                                                                                    : aggregate->as_column_name();
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "hyrise.hpp"
+#include "operators/row_budget.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -164,7 +165,10 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
 
   auto excluded_chunk_ids_iter = excluded_chunk_ids.begin();
 
-  for (ChunkID stored_chunk_id{0}; stored_chunk_id < chunk_count; ++stored_chunk_id) {
+  // If a downstream Limit has enough rows, the remaining chunks are not included in the output
+  auto row_budget = RowBudget{_output_row_budget};
+
+  for (ChunkID stored_chunk_id{0}; stored_chunk_id < chunk_count && !row_budget.is_exhausted(); ++stored_chunk_id) {
     // Skip `stored_chunk_id` if it is in the sorted vector `excluded_chunk_ids`
     if (excluded_chunk_ids_iter != excluded_chunk_ids.end() && *excluded_chunk_ids_iter == stored_chunk_id) {
       ++excluded_chunk_ids_iter;
@@ -186,6 +190,15 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
       auto output_segments_iter = output_segments.begin();
       auto output_indexes = Indexes{};
 
+      // The pruning statistics of the remaining columns are forwarded, so that operators like the RuntimeJoinFilter
+      // can still skip the chunk based on them.
+      const auto& stored_pruning_statistics = stored_chunk->pruning_statistics();
+      auto output_pruning_statistics = std::optional<ChunkPruningStatistics>{};
+      if (stored_pruning_statistics) {
+        output_pruning_statistics.emplace();
+        output_pruning_statistics->reserve(output_segments.size());
+      }
+
       auto pruned_column_ids_iter = _pruned_column_ids.begin();
       for (auto stored_column_id = ColumnID{0}; stored_column_id < stored_table->column_count(); ++stored_column_id) {
         // Skip `stored_column_id` if it is in the sorted vector `_pruned_column_ids`
@@ -206,6 +219,9 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
         }
 
         *output_segments_iter = stored_chunk->get_segment(stored_column_id);
+        if (output_pruning_statistics) {
+          output_pruning_statistics->emplace_back((*stored_pruning_statistics)[stored_column_id]);
+        }
         auto indexes = stored_chunk->get_indexes({*output_segments_iter});
         if (!indexes.empty()) {
           output_indexes.insert(std::end(output_indexes), std::begin(indexes), std::end(indexes));
@@ -223,13 +239,21 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
         (*output_chunks_iter)->set_individually_sorted_by(*output_chunk_sorted_by);
       }
 
+      if (output_pruning_statistics) {
+        // Pruning statistics are only set for immutable chunks, so the output chunk can be finalized as well
+        if ((*output_chunks_iter)->is_mutable()) (*output_chunks_iter)->finalize();
+        (*output_chunks_iter)->set_pruning_statistics(output_pruning_statistics);
+      }
+
       // The output chunk contains all rows that are in the stored chunk, including invalid rows. We forward this
       // information so that following operators (currently, the Validate operator) can use it for optimizations.
       (*output_chunks_iter)->increase_invalid_row_count(stored_chunk->invalid_row_count());
     }
 
+    row_budget.consume((*output_chunks_iter)->size());
     ++output_chunks_iter;
   }
+  output_chunks.erase(output_chunks_iter, output_chunks.end());
 
   return std::make_shared<Table>(pruned_column_definitions, TableType::Data, std::move(output_chunks),
                                  stored_table->uses_mvcc());
@@ -0,0 +1,482 @@
+#include "group_join.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "bytell_hash_map.hpp"
+
+#include "aggregate/aggregate_traits.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "hyrise.hpp"
+#include "join_hash/join_hash_traits.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "type_comparison.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto NO_GROUP = std::numeric_limits<size_t>::max();
+
+struct GroupAssignment {
+  // The row of the group side that forms a group, indexed by the group's id
+  std::vector<RowID> group_rows;
+
+  // For each row of the probe side, the id of the group it matches or NO_GROUP, indexed by chunk and chunk offset. As
+  // in JoinHash, we use the offsets within the input chunks, not those of the positions (which might point to a
+  // referenced table).
+  std::vector<std::vector<size_t>> group_ids_by_probe_chunk;
+};
+
+template <typename HashedType, typename GroupColumnType>
+ska::bytell_hash_map<HashedType, size_t> build_hash_table(const Table& group_table, const ColumnID column_id,
+                                                          const bool keep_null_keys, GroupAssignment& assignment) {
+  auto hash_table = ska::bytell_hash_map<HashedType, size_t>{};
+  hash_table.reserve(group_table.row_count());
+  assignment.group_rows.reserve(group_table.row_count());
+
+  const auto chunk_count = group_table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = group_table.get_chunk(chunk_id);
+    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+    auto chunk_offset = ChunkOffset{0};
+    segment_iterate<GroupColumnType>(*chunk->get_segment(column_id), [&](const auto& position) {
+      const auto row_id = RowID{chunk_id, chunk_offset};
+      ++chunk_offset;
+
+      if (position.is_null()) {
+        if (keep_null_keys) assignment.group_rows.emplace_back(row_id);
+        return;
+      }
+
+      const auto inserted =
+          hash_table.try_emplace(static_cast<HashedType>(position.value()), assignment.group_rows.size()).second;
+      Assert(inserted, "GroupJoin requires unique join keys on the group side");
+      assignment.group_rows.emplace_back(row_id);
+    });
+  }
+
+  return hash_table;
+}
+
+template <typename HashedType, typename ProbeColumnType>
+void probe_hash_table(const ska::bytell_hash_map<HashedType, size_t>& hash_table, const Table& probe_table,
+                      const ColumnID column_id, GroupAssignment& assignment) {
+  const auto chunk_count = probe_table.chunk_count();
+  assignment.group_ids_by_probe_chunk.resize(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = probe_table.get_chunk(chunk_id);
+    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk, chunk_id]() {
+      auto& group_ids = assignment.group_ids_by_probe_chunk[chunk_id];
+      group_ids.resize(chunk->size(), NO_GROUP);
+
+      auto chunk_offset = ChunkOffset{0};
+      segment_iterate<ProbeColumnType>(*chunk->get_segment(column_id), [&](const auto& position) {
+        if (!position.is_null()) {
+          const auto iter = hash_table.find(static_cast<HashedType>(position.value()));
+          if (iter != hash_table.end()) group_ids[chunk_offset] = iter->second;
+        }
+        ++chunk_offset;
+      });
+    }));
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
+
+// Writes a column of the group side (a group by column or the argument of ANY()) for the output groups
+template <typename ColumnDataType>
+std::shared_ptr<AbstractSegment> write_group_side_column(const Table& group_table, const ColumnID column_id,
+                                                         const std::vector<RowID>& group_rows,
+                                                         const std::vector<size_t>& output_groups) {
+  const auto column_is_nullable = group_table.column_is_nullable(column_id);
+
+  auto values = pmr_vector<ColumnDataType>(output_groups.size());
+  auto null_values = pmr_vector<bool>(column_is_nullable ? output_groups.size() : 0);
+  auto accessors = std::vector<std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>>(group_table.chunk_count());
+
+  for (auto output_offset = size_t{0}; output_offset < output_groups.size(); ++output_offset) {
+    const auto& row_id = group_rows[output_groups[output_offset]];
+
+    auto& accessor = accessors[row_id.chunk_id];
+    if (!accessor) {
+      accessor =
+          create_segment_accessor<ColumnDataType>(group_table.get_chunk(row_id.chunk_id)->get_segment(column_id));
+    }
+
+    const auto& optional_value = accessor->access(row_id.chunk_offset);
+    DebugAssert(optional_value || column_is_nullable, "Only nullable columns should contain optional values");
+    if (!optional_value) {
+      null_values[output_offset] = true;
+    } else {
+      values[output_offset] = *optional_value;
+    }
+  }
+
+  if (column_is_nullable) {
+    return std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values));
+  }
+  return std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+}
+
+// Aggregates a column of the probe side into the groups that its rows match and writes the aggregates of the output
+// groups. Groups without a non-NULL value are NULL (or 0 for COUNT).
+template <typename ColumnDataType, AggregateFunction function>
+std::shared_ptr<AbstractSegment> aggregate_probe_side_column(const Table& probe_table, const ColumnID column_id,
+                                                             const GroupAssignment& assignment,
+                                                             const std::vector<size_t>& output_groups) {
+  using AggregateType = typename AggregateTraits<ColumnDataType, function>::AggregateType;
+
+  const auto group_count = assignment.group_rows.size();
+  auto aggregates = std::vector<AggregateType>(function == AggregateFunction::Count ? 0 : group_count);
+  auto value_counts = std::vector<int64_t>(group_count);
+
+  const auto chunk_count = probe_table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& group_ids = assignment.group_ids_by_probe_chunk[chunk_id];
+
+    const auto& segment = *probe_table.get_chunk(chunk_id)->get_segment(column_id);
+
+    auto chunk_offset = ChunkOffset{0};
+    segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+      const auto group_id = group_ids[chunk_offset];
+      ++chunk_offset;
+      if (group_id == NO_GROUP || position.is_null()) return;
+
+      if constexpr (function == AggregateFunction::Min) {
+        if (value_counts[group_id] == 0 || value_smaller(position.value(), aggregates[group_id])) {
+          aggregates[group_id] = position.value();
+        }
+      } else if constexpr (function == AggregateFunction::Max) {
+        if (value_counts[group_id] == 0 || value_greater(position.value(), aggregates[group_id])) {
+          aggregates[group_id] = position.value();
+        }
+      } else if constexpr (function == AggregateFunction::Sum || function == AggregateFunction::Avg) {
+        // As in AggregateHash, AVG is computed from the sum and the number of values.
+        aggregates[group_id] += static_cast<AggregateType>(position.value());
+      }
+      ++value_counts[group_id];
+    });
+  }
+
+  auto values = pmr_vector<AggregateType>(output_groups.size());
+  if constexpr (function == AggregateFunction::Count) {
+    for (auto output_offset = size_t{0}; output_offset < output_groups.size(); ++output_offset) {
+      values[output_offset] = value_counts[output_groups[output_offset]];
+    }
+    return std::make_shared<ValueSegment<AggregateType>>(std::move(values));
+  } else {
+    auto null_values = pmr_vector<bool>(output_groups.size());
+    for (auto output_offset = size_t{0}; output_offset < output_groups.size(); ++output_offset) {
+      const auto group_id = output_groups[output_offset];
+      if (value_counts[group_id] == 0) {
+        null_values[output_offset] = true;
+      } else if constexpr (function == AggregateFunction::Avg) {
+        values[output_offset] = aggregates[group_id] / static_cast<AggregateType>(value_counts[group_id]);
+      } else {
+        values[output_offset] = std::move(aggregates[group_id]);
+      }
+    }
+    return std::make_shared<ValueSegment<AggregateType>>(std::move(values), std::move(null_values));
+  }
+}
+
+template <typename ColumnDataType>
+std::shared_ptr<AbstractSegment> aggregate_probe_side_column(const AggregateFunction function,
+                                                             const Table& probe_table, const ColumnID column_id,
+                                                             const GroupAssignment& assignment,
+                                                             const std::vector<size_t>& output_groups) {
+  switch (function) {
+    case AggregateFunction::Count:
+      return aggregate_probe_side_column<ColumnDataType, AggregateFunction::Count>(probe_table, column_id, assignment,
+                                                                                    output_groups);
+    case AggregateFunction::Min:
+      return aggregate_probe_side_column<ColumnDataType, AggregateFunction::Min>(probe_table, column_id, assignment,
+                                                                                  output_groups);
+    case AggregateFunction::Max:
+      return aggregate_probe_side_column<ColumnDataType, AggregateFunction::Max>(probe_table, column_id, assignment,
+                                                                                  output_groups);
+    case AggregateFunction::Sum:
+    case AggregateFunction::Avg:
+      if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+        if (function == AggregateFunction::Sum) {
+          return aggregate_probe_side_column<ColumnDataType, AggregateFunction::Sum>(probe_table, column_id,
+                                                                                      assignment, output_groups);
+        }
+        return aggregate_probe_side_column<ColumnDataType, AggregateFunction::Avg>(probe_table, column_id, assignment,
+                                                                                    output_groups);
+      } else {
+        Fail("Invalid aggregate SUM or AVG on non-arithmetic column");
+      }
+    default:
+      Fail("GroupJoin does not support this aggregate function");
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+GroupJoin::GroupJoin(const std::shared_ptr<const AbstractOperator>& left,
+                     const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                     const OperatorJoinPredicate& primary_predicate, const std::vector<ColumnID>& groupby_column_ids,
+                     const std::vector<std::shared_ptr<AggregateExpression>>& aggregates)
+    : AbstractJoinOperator(OperatorType::GroupJoin, left, right, mode, primary_predicate, {},
+                           std::make_unique<PerformanceData>()),
+      _groupby_column_ids(groupby_column_ids),
+      _aggregates(aggregates) {
+  Assert(mode == JoinMode::Inner || mode == JoinMode::Left || mode == JoinMode::Right,
+         "GroupJoin only supports Inner, Left, and Right joins");
+  Assert(primary_predicate.predicate_condition == PredicateCondition::Equals, "GroupJoin requires an equi join");
+  Assert(!groupby_column_ids.empty(), "GroupJoin requires at least one group by column");
+}
+
+const std::string& GroupJoin::name() const {
+  static const auto name = std::string{"GroupJoin"};
+  return name;
+}
+
+std::string GroupJoin::description(DescriptionMode description_mode) const {
+  const auto* const separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+  stream << AbstractJoinOperator::description(description_mode) << separator << "GroupBy ColumnIDs: ";
+  for (auto groupby_column_idx = size_t{0}; groupby_column_idx < _groupby_column_ids.size(); ++groupby_column_idx) {
+    stream << _groupby_column_ids[groupby_column_idx];
+    if (groupby_column_idx + 1 < _groupby_column_ids.size()) stream << ", ";
+  }
+
+  stream << " Aggregates: ";
+  for (auto aggregate_idx = size_t{0}; aggregate_idx < _aggregates.size(); ++aggregate_idx) {
+    stream << _aggregates[aggregate_idx]->as_column_name();
+    if (aggregate_idx + 1 < _aggregates.size()) stream << ", ";
+  }
+  return stream.str();
+}
+
+const std::vector<ColumnID>& GroupJoin::groupby_column_ids() const { return _groupby_column_ids; }
+
+const std::vector<std::shared_ptr<AggregateExpression>>& GroupJoin::aggregates() const { return _aggregates; }
+
+void GroupJoin::PerformanceData::output_to_stream(std::ostream& stream, DescriptionMode description_mode) const {
+  OperatorPerformanceData<OperatorSteps>::output_to_stream(stream, description_mode);
+
+  const auto* const separator = description_mode == DescriptionMode::SingleLine ? " " : "\n";
+  stream << separator << group_count << " groups on the " << (group_side_is_left ? "left" : "right") << " side.";
+}
+
+std::shared_ptr<AbstractOperator> GroupJoin::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  return std::make_shared<GroupJoin>(copied_left_input, copied_right_input, _mode, _primary_predicate,
+                                     _groupby_column_ids, _aggregates);
+}
+
+std::shared_ptr<const Table> GroupJoin::_on_execute() {
+  const auto& left_table = left_input_table();
+  const auto& right_table = right_input_table();
+  const auto left_column_count = static_cast<ColumnID>(left_table->column_count());
+
+  // Group by and aggregate columns refer to the join result, in which the right columns follow the left ones.
+  const auto group_side_is_left =
+      _mode == JoinMode::Left || (_mode == JoinMode::Inner && _groupby_column_ids.front() < left_column_count);
+  const auto& group_table = group_side_is_left ? left_table : right_table;
+  const auto& probe_table = group_side_is_left ? right_table : left_table;
+  const auto group_column_offset = group_side_is_left ? ColumnID{0} : left_column_count;
+  const auto probe_column_offset = group_side_is_left ? left_column_count : ColumnID{0};
+  const auto group_key_column_id =
+      group_side_is_left ? _primary_predicate.column_ids.first : _primary_predicate.column_ids.second;
+  const auto probe_key_column_id =
+      group_side_is_left ? _primary_predicate.column_ids.second : _primary_predicate.column_ids.first;
+
+  const auto is_group_side_column = [&](const ColumnID column_id) {
+    return column_id >= group_column_offset && column_id < group_column_offset + group_table->column_count();
+  };
+  const auto is_probe_side_column = [&](const ColumnID column_id) {
+    return column_id >= probe_column_offset && column_id < probe_column_offset + probe_table->column_count();
+  };
+
+  Assert(std::all_of(_groupby_column_ids.begin(), _groupby_column_ids.end(), is_group_side_column),
+         "GroupJoin requires all group by columns to be on the group side");
+  Assert(std::find(_groupby_column_ids.begin(), _groupby_column_ids.end(),
+                   static_cast<ColumnID>(group_column_offset + group_key_column_id)) != _groupby_column_ids.end(),
+         "GroupJoin requires the join column of the group side to be a group by column");
+
+  auto& step_performance_data = static_cast<PerformanceData&>(*performance_data);
+  step_performance_data.group_side_is_left = group_side_is_left;
+  auto timer = Timer{};
+
+  /**
+   * 1. Build a hash table over the join keys of the group side and probe it with the join keys of the probe side. The
+   *    keys are hashed and compared as in JoinHash, i.e., after casting them to a common type.
+   */
+  auto assignment = GroupAssignment{};
+  resolve_data_type(group_table->column_data_type(group_key_column_id), [&](const auto group_data_type_t) {
+    using GroupColumnDataType = typename decltype(group_data_type_t)::type;
+    resolve_data_type(probe_table->column_data_type(probe_key_column_id), [&](const auto probe_data_type_t) {
+      using ProbeColumnDataType = typename decltype(probe_data_type_t)::type;
+
+      constexpr auto NEITHER_IS_STRING =
+          !std::is_same_v<pmr_string, GroupColumnDataType> && !std::is_same_v<pmr_string, ProbeColumnDataType>;
+      constexpr auto BOTH_ARE_STRING =
+          std::is_same_v<pmr_string, GroupColumnDataType> && std::is_same_v<pmr_string, ProbeColumnDataType>;
+
+      if constexpr (NEITHER_IS_STRING || BOTH_ARE_STRING) {
+        using HashedType = typename JoinHashTraits<GroupColumnDataType, ProbeColumnDataType>::HashType;
+
+        const auto hash_table = build_hash_table<HashedType, GroupColumnDataType>(
+            *group_table, group_key_column_id, _mode != JoinMode::Inner, assignment);
+        step_performance_data.set_step_runtime(OperatorSteps::Building, timer.lap());
+
+        probe_hash_table<HashedType, ProbeColumnDataType>(hash_table, *probe_table, probe_key_column_id, assignment);
+        step_performance_data.set_step_runtime(OperatorSteps::Probing, timer.lap());
+      } else {
+        Fail("Cannot join String with non-String column");
+      }
+    });
+  });
+
+  /**
+   * 2. Determine the groups to emit. Groups without a match are only emitted by outer joins. In this case, the join
+   *    would have emitted a single row for them.
+   */
+  const auto group_count = assignment.group_rows.size();
+  auto match_counts = std::vector<int64_t>(group_count);
+  for (const auto& group_ids : assignment.group_ids_by_probe_chunk) {
+    for (const auto group_id : group_ids) {
+      if (group_id != NO_GROUP) ++match_counts[group_id];
+    }
+  }
+
+  auto output_groups = std::vector<size_t>{};
+  output_groups.reserve(group_count);
+  for (auto group_id = size_t{0}; group_id < group_count; ++group_id) {
+    if (_mode != JoinMode::Inner || match_counts[group_id] > 0) output_groups.emplace_back(group_id);
+  }
+  step_performance_data.group_count = output_groups.size();
+
+  /**
+   * 3. Write the group by columns and aggregate the probe side into the groups, one job per output column. The layout
+   *    and the names of the output columns are those of an AggregateHash.
+   */
+  const auto output_column_count = _groupby_column_ids.size() + _aggregates.size();
+  auto output_column_definitions = TableColumnDefinitions{};
+  output_column_definitions.reserve(output_column_count);
+  auto output_segments = Segments(output_column_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(output_column_count);
+
+  const auto add_group_side_column = [&](const ColumnID join_column_id) {
+    const auto column_id = static_cast<ColumnID>(join_column_id - group_column_offset);
+    const auto data_type = group_table->column_data_type(column_id);
+    output_column_definitions.emplace_back(group_table->column_name(column_id), data_type,
+                                           group_table->column_is_nullable(column_id));
+
+    const auto output_column_id = output_column_definitions.size() - 1;
+    jobs.emplace_back(std::make_shared<JobTask>([&, column_id, data_type, output_column_id]() {
+      resolve_data_type(data_type, [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        output_segments[output_column_id] = write_group_side_column<ColumnDataType>(
+            *group_table, column_id, assignment.group_rows, output_groups);
+      });
+    }));
+  };
+
+  for (const auto groupby_column_id : _groupby_column_ids) {
+    add_group_side_column(groupby_column_id);
+  }
+
+  for (const auto& aggregate : _aggregates) {
+    const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
+    const auto join_column_id = pqp_column.column_id;
+    const auto function = aggregate->aggregate_function;
+
+    if (function == AggregateFunction::Any) {
+      Assert(is_group_side_column(join_column_id), "GroupJoin requires ANY() to refer to the group side");
+      add_group_side_column(join_column_id);
+      continue;
+    }
+
+    const auto output_column_id = output_column_definitions.size();
+    if (AggregateExpression::is_count_star(*aggregate)) {
+      output_column_definitions.emplace_back(aggregate->as_column_name(), DataType::Long, false);
+      jobs.emplace_back(std::make_shared<JobTask>([&, output_column_id]() {
+        auto values = pmr_vector<int64_t>(output_groups.size());
+        for (auto output_offset = size_t{0}; output_offset < output_groups.size(); ++output_offset) {
+          values[output_offset] = std::max(match_counts[output_groups[output_offset]], int64_t{1});
+        }
+        output_segments[output_column_id] = std::make_shared<ValueSegment<int64_t>>(std::move(values));
+      }));
+      continue;
+    }
+
+    Assert(is_probe_side_column(join_column_id), "GroupJoin requires aggregates other than ANY() on the probe side");
+    const auto column_id = static_cast<ColumnID>(join_column_id - probe_column_offset);
+
+    resolve_data_type(probe_table->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      auto aggregate_data_type = DataType::Null;
+      switch (function) {
+        case AggregateFunction::Count:
+          aggregate_data_type = AggregateTraits<ColumnDataType, AggregateFunction::Count>::AGGREGATE_DATA_TYPE;
+          break;
+        case AggregateFunction::Min:
+          aggregate_data_type = AggregateTraits<ColumnDataType, AggregateFunction::Min>::AGGREGATE_DATA_TYPE;
+          break;
+        case AggregateFunction::Max:
+          aggregate_data_type = AggregateTraits<ColumnDataType, AggregateFunction::Max>::AGGREGATE_DATA_TYPE;
+          break;
+        case AggregateFunction::Sum:
+          aggregate_data_type = AggregateTraits<ColumnDataType, AggregateFunction::Sum>::AGGREGATE_DATA_TYPE;
+          break;
+        case AggregateFunction::Avg:
+          aggregate_data_type = AggregateTraits<ColumnDataType, AggregateFunction::Avg>::AGGREGATE_DATA_TYPE;
+          break;
+        default:
+          Fail("GroupJoin does not support this aggregate function");
+      }
+      Assert(aggregate_data_type != DataType::Null, "Invalid aggregate SUM or AVG on non-arithmetic column");
+
+      output_column_definitions.emplace_back(aggregate->as_column_name(), aggregate_data_type,
+                                             function != AggregateFunction::Count);
+    });
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, function, column_id, output_column_id]() {
+      resolve_data_type(probe_table->column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        output_segments[output_column_id] = aggregate_probe_side_column<ColumnDataType>(
+            function, *probe_table, column_id, assignment, output_groups);
+      });
+    }));
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  step_performance_data.set_step_runtime(OperatorSteps::Aggregating, timer.lap());
+
+  const auto output_table = std::make_shared<Table>(output_column_definitions, TableType::Data);
+  if (!output_groups.empty()) output_table->append_chunk(output_segments);
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_join_operator.hpp"
+#include "expression/aggregate_expression.hpp"
+#include "operator_join_predicate.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Fuses an equi join and an aggregation that groups by the join key of one of its inputs (e.g., customers joined with
+ * their orders, grouped by the customer key). This input, the group side, has unique join keys, so that each of its
+ * rows forms exactly one group. The GroupJoin builds a hash table over the group side's join keys and aggregates the
+ * matching rows of the other input, the probe side, directly into the group of their hash table entry. Neither is the
+ * join result materialized nor is a second hash table built for the aggregation, as it would be for an AggregateHash
+ * on top of a JoinHash.
+ *
+ * The group by columns and the arguments of the aggregates refer to the columns of the join result, i.e., the columns
+ * of the left input followed by those of the right input. All group by columns have to be on the group side, and one
+ * of them has to be its join column. Supported aggregates are ANY() on group side columns (as created by the
+ * DependentGroupByReductionRule), COUNT(*), and COUNT, SUM, AVG, MIN, and MAX on probe side columns. The output has
+ * the same layout as the output of an AggregateHash on top of the join.
+ *
+ * For Inner joins, the group side is the input of the group by columns, and groups without a matching probe side row
+ * are not emitted. For Left (Right) outer joins, the group side has to be the left (right) input. Groups without a
+ * matching row are emitted as if the join had padded them with NULLs, i.e., COUNT(*) is 1, COUNT is 0, and the other
+ * aggregates are NULL. Group side rows with a NULL join key do not find a match, but in outer joins, each of them forms
+ * a group of its own.
+ *
+ * The GroupJoinRule only creates GroupJoins if a unique constraint guarantees unique join keys on the group side.
+ * Duplicate keys are not supported and lead to an error.
+ */
+class GroupJoin : public AbstractJoinOperator {
+ public:
+  GroupJoin(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
+            const JoinMode mode, const OperatorJoinPredicate& primary_predicate,
+            const std::vector<ColumnID>& groupby_column_ids,
+            const std::vector<std::shared_ptr<AggregateExpression>>& aggregates);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  const std::vector<ColumnID>& groupby_column_ids() const;
+  const std::vector<std::shared_ptr<AggregateExpression>>& aggregates() const;
+
+  enum class OperatorSteps : uint8_t { Building, Probing, Aggregating };
+
+  struct PerformanceData : public OperatorPerformanceData<OperatorSteps> {
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override;
+
+    size_t group_count{0};
+    bool group_side_is_left{false};
+  };
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+
+  const std::vector<ColumnID> _groupby_column_ids;
+  const std::vector<std::shared_ptr<AggregateExpression>> _aggregates;
+};
+
+}  // namespace opossum
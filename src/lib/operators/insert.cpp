@@ -9,6 +9,7 @@
 #include "hyrise.hpp"
 #include "resolve_type.hpp"
 #include "storage/abstract_encoded_segment.hpp"
+#include "storage/index/unique_key_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
@@ -213,6 +214,24 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
     }
   }
 
+  /**
+   * 3. Register the new rows in the indexes that enforce the key constraints of the target Table. If a row violates a
+   *    constraint (or might do so, depending on the outcome of a concurrent transaction), the transaction fails. The
+   *    rows that have been registered so far are removed from the indexes on rollback.
+   */
+  for (const auto& unique_key_index : _target_table->unique_key_indexes()) {
+    for (const auto& target_chunk_range : _target_chunk_ranges) {
+      for (auto chunk_offset = target_chunk_range.begin_chunk_offset;
+           chunk_offset < target_chunk_range.end_chunk_offset; ++chunk_offset) {
+        if (!unique_key_index->try_insert(RowID{target_chunk_range.chunk_id, chunk_offset},
+                                          context->transaction_id())) {
+          _mark_as_failed();
+          return nullptr;
+        }
+      }
+    }
+  }
+
   return nullptr;
 }
 
@@ -271,6 +290,17 @@ void Insert::_on_rollback_records() {
     // This fence ensures that the changes to TID (which are not sequentially consistent) are visible to other threads.
     std::atomic_thread_fence(std::memory_order_release);
   }
+
+  // The rolled-back rows are invisible for everyone now. Remove them from the key constraint indexes so that they do
+  // not have to be checked by future inserts.
+  for (const auto& unique_key_index : _target_table->unique_key_indexes()) {
+    for (const auto& target_chunk_range : _target_chunk_ranges) {
+      for (auto chunk_offset = target_chunk_range.begin_chunk_offset;
+           chunk_offset < target_chunk_range.end_chunk_offset; ++chunk_offset) {
+        unique_key_index->erase(RowID{target_chunk_range.chunk_id, chunk_offset});
+      }
+    }
+  }
 }
 
 std::shared_ptr<AbstractOperator> Insert::_on_deep_copy(
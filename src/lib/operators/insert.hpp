@@ -18,6 +18,9 @@ class TransactionContext;
  * the values to insert in a separate table using the same column layout.
  *
  * Assumption: The input has been validated before.
+ *
+ * If the target table enforces key constraints (see Table::enforce_key_constraint), the operator fails for rows that
+ * violate them.
  */
 class Insert : public AbstractReadWriteOperator {
  public:
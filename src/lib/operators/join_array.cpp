@@ -0,0 +1,327 @@
+#include "join_array.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "join_hash.hpp"
+#include "join_hash/join_hash_steps.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Non-NULL values of the join column of a single build side chunk
+struct MaterializedBuildChunk {
+  std::vector<std::pair<int64_t, ChunkOffset>> values;
+  int64_t min{std::numeric_limits<int64_t>::max()};
+  int64_t max{std::numeric_limits<int64_t>::min()};
+  bool has_null{false};
+};
+
+template <typename BuildColumnType>
+std::vector<MaterializedBuildChunk> materialize_build_side(const Table& build_table, const ColumnID column_id) {
+  const auto chunk_count = build_table.chunk_count();
+  auto materialized_chunks = std::vector<MaterializedBuildChunk>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = build_table.get_chunk(chunk_id);
+    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk, chunk_id]() {
+      auto& materialized_chunk = materialized_chunks[chunk_id];
+      materialized_chunk.values.reserve(chunk->size());
+
+      // As in JoinHash, we do not use the chunk offsets of the positions (which might point to the referenced table),
+      // but the offsets within the input chunk. These are resolved when the output is written.
+      auto chunk_offset = ChunkOffset{0};
+      segment_iterate<BuildColumnType>(*chunk->get_segment(column_id), [&](const auto& position) {
+        if (position.is_null()) {
+          materialized_chunk.has_null = true;
+        } else {
+          const auto value = static_cast<int64_t>(position.value());
+          materialized_chunk.values.emplace_back(value, chunk_offset);
+          materialized_chunk.min = std::min(materialized_chunk.min, value);
+          materialized_chunk.max = std::max(materialized_chunk.max, value);
+        }
+        ++chunk_offset;
+      });
+    }));
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  return materialized_chunks;
+}
+
+}  // namespace
+
+namespace opossum {
+
+bool JoinArray::supports(const JoinConfiguration config) {
+  const auto is_integer_type = [](const auto data_type) {
+    return data_type == DataType::Int || data_type == DataType::Long;
+  };
+
+  return config.predicate_condition == PredicateCondition::Equals && !config.secondary_predicates &&
+         (config.join_mode == JoinMode::Inner || config.join_mode == JoinMode::Semi ||
+          config.join_mode == JoinMode::AntiNullAsTrue || config.join_mode == JoinMode::AntiNullAsFalse) &&
+         is_integer_type(config.left_data_type) && is_integer_type(config.right_data_type);
+}
+
+bool JoinArray::is_dense(const int64_t min, const int64_t max, const size_t row_count) {
+  DebugAssert(min <= max, "Invalid value range");
+
+  // Calculated on unsigned values, as max - min might overflow int64_t.
+  const auto slot_count_minus_one = static_cast<uint64_t>(max) - static_cast<uint64_t>(min);
+  if (slot_count_minus_one >= MAX_SLOT_COUNT) return false;
+
+  return slot_count_minus_one + 1 <= std::max(MIN_SLOT_COUNT, row_count * MAX_SLOTS_PER_ROW);
+}
+
+JoinArray::JoinArray(const std::shared_ptr<const AbstractOperator>& left,
+                     const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                     const OperatorJoinPredicate& primary_predicate,
+                     const std::vector<OperatorJoinPredicate>& secondary_predicates)
+    : AbstractJoinOperator(OperatorType::JoinArray, left, right, mode, primary_predicate, secondary_predicates,
+                           std::make_unique<PerformanceData>()) {}
+
+const std::string& JoinArray::name() const {
+  static const auto name = std::string{"JoinArray"};
+  return name;
+}
+
+std::shared_ptr<AbstractOperator> JoinArray::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  return std::make_shared<JoinArray>(copied_left_input, copied_right_input, _mode, _primary_predicate,
+                                     _secondary_predicates);
+}
+
+void JoinArray::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+void JoinArray::PerformanceData::output_to_stream(std::ostream& stream, DescriptionMode description_mode) const {
+  OperatorPerformanceData<OperatorSteps>::output_to_stream(stream, description_mode);
+
+  const auto* const separator = description_mode == DescriptionMode::SingleLine ? " " : "\n";
+  if (fell_back_to_join_hash) {
+    stream << separator << "Build side is not dense, fell back to JoinHash.";
+  } else {
+    stream << separator << "Array with " << slot_count << " slots.";
+  }
+}
+
+std::shared_ptr<const Table> JoinArray::_on_execute() {
+  Assert(supports({_mode, _primary_predicate.predicate_condition,
+                   left_input_table()->column_data_type(_primary_predicate.column_ids.first),
+                   right_input_table()->column_data_type(_primary_predicate.column_ids.second),
+                   !_secondary_predicates.empty()}),
+         "JoinArray doesn't support these parameters");
+
+  const auto probe_data_type = left_input_table()->column_data_type(_primary_predicate.column_ids.first);
+  const auto build_data_type = right_input_table()->column_data_type(_primary_predicate.column_ids.second);
+
+  auto output_table = std::shared_ptr<const Table>{};
+
+  resolve_data_type(probe_data_type, [&](const auto probe_data_type_t) {
+    using ProbeColumnDataType = typename decltype(probe_data_type_t)::type;
+    resolve_data_type(build_data_type, [&](const auto build_data_type_t) {
+      using BuildColumnDataType = typename decltype(build_data_type_t)::type;
+
+      if constexpr (std::is_integral_v<ProbeColumnDataType> && std::is_integral_v<BuildColumnDataType>) {
+        output_table = _join<ProbeColumnDataType, BuildColumnDataType>();
+      } else {
+        Fail("JoinArray only supports integer columns");
+      }
+    });
+  });
+
+  return output_table;
+}
+
+template <typename ProbeColumnType, typename BuildColumnType>
+std::shared_ptr<const Table> JoinArray::_join() {
+  auto& join_array_performance_data = static_cast<PerformanceData&>(*performance_data);
+
+  const auto& probe_table = left_input_table();
+  const auto& build_table = right_input_table();
+  const auto probe_column_id = _primary_predicate.column_ids.first;
+  const auto build_column_id = _primary_predicate.column_ids.second;
+
+  auto timer = Timer{};
+
+  auto materialized_build_chunks = materialize_build_side<BuildColumnType>(*build_table, build_column_id);
+
+  auto min = std::numeric_limits<int64_t>::max();
+  auto max = std::numeric_limits<int64_t>::min();
+  auto build_row_count = size_t{0};
+  auto build_side_has_null = false;
+  for (const auto& materialized_chunk : materialized_build_chunks) {
+    min = std::min(min, materialized_chunk.min);
+    max = std::max(max, materialized_chunk.max);
+    build_row_count += materialized_chunk.values.size();
+    build_side_has_null |= materialized_chunk.has_null;
+  }
+
+  join_array_performance_data.set_step_runtime(OperatorSteps::BuildSideMaterializing, timer.lap());
+
+  // For AntiNullAsTrue (i.e., NOT IN), a single NULL on the build side means that no probe side row qualifies.
+  if (_mode == JoinMode::AntiNullAsTrue && build_side_has_null) {
+    return _build_output_table({});
+  }
+
+  if (build_row_count > 0 && !is_dense(min, max, build_row_count)) {
+    // The statistics that made the LQPTranslator choose this join were off. We accept having materialized the build
+    // side in vain, as the JoinHash materializes its inputs anyway.
+    join_array_performance_data.fell_back_to_join_hash = true;
+    const auto join_hash = std::make_shared<JoinHash>(_left_input, _right_input, _mode, _primary_predicate);
+    join_hash->execute();
+    return join_hash->get_output();
+  }
+
+  /**
+   * Build the array. offsets[slot] is the index of the first build side row with the value `min + slot` in positions,
+   * offsets[slot + 1] is the index after its last row. For Semi and Anti* joins, we only need to know whether a slot is
+   * empty and skip filling positions.
+   */
+  const auto unsigned_min = static_cast<uint64_t>(min);
+  const auto slot_count = build_row_count > 0 ? static_cast<size_t>(static_cast<uint64_t>(max) - unsigned_min + 1) : 0;
+  join_array_performance_data.slot_count = slot_count;
+
+  auto offsets = std::vector<size_t>(slot_count + 1);
+  for (const auto& materialized_chunk : materialized_build_chunks) {
+    for (const auto& value_and_offset : materialized_chunk.values) {
+      ++offsets[static_cast<uint64_t>(value_and_offset.first) - unsigned_min + 1];
+    }
+  }
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+  auto positions = std::vector<RowID>{};
+  if (_mode == JoinMode::Inner) {
+    positions.resize(build_row_count);
+
+    // Filling the positions moves each offset to the start of the next slot. We shift them back afterwards.
+    const auto build_chunk_count = static_cast<ChunkID::base_type>(materialized_build_chunks.size());
+    for (auto chunk_id = ChunkID{0}; chunk_id < build_chunk_count; ++chunk_id) {
+      for (const auto& [value, chunk_offset] : materialized_build_chunks[chunk_id].values) {
+        positions[offsets[static_cast<uint64_t>(value) - unsigned_min]++] = RowID{chunk_id, chunk_offset};
+      }
+    }
+    std::copy_backward(offsets.begin(), offsets.end() - 1, offsets.end());
+    offsets[0] = 0;
+  }
+  materialized_build_chunks = {};
+
+  join_array_performance_data.set_step_runtime(OperatorSteps::Building, timer.lap());
+
+  /**
+   * Probe the array, one job per probe side chunk. For NULL values on the probe side, see probe_semi_anti in
+   * join_hash_steps.hpp: They are emitted by AntiNullAsFalse joins and by AntiNullAsTrue joins with an empty build
+   * side.
+   */
+  const auto emit_probe_side_nulls =
+      _mode == JoinMode::AntiNullAsFalse || (_mode == JoinMode::AntiNullAsTrue && build_table->row_count() == 0);
+
+  const auto probe_chunk_count = probe_table->chunk_count();
+  auto probe_pos_lists = std::vector<std::shared_ptr<RowIDPosList>>(probe_chunk_count);
+  auto build_pos_lists = std::vector<std::shared_ptr<RowIDPosList>>(probe_chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(probe_chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < probe_chunk_count; ++chunk_id) {
+    const auto chunk = probe_table->get_chunk(chunk_id);
+    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk, chunk_id]() {
+      auto probe_pos_list = std::make_shared<RowIDPosList>();
+      auto build_pos_list = std::make_shared<RowIDPosList>();
+      if (_mode == JoinMode::Inner) {
+        // Assume that every probe side row finds a single join partner, as it is the case for foreign key joins.
+        probe_pos_list->reserve(chunk->size());
+        build_pos_list->reserve(chunk->size());
+      }
+
+      auto chunk_offset = ChunkOffset{0};
+      segment_iterate<ProbeColumnType>(*chunk->get_segment(probe_column_id), [&](const auto& position) {
+        const auto probe_row_id = RowID{chunk_id, chunk_offset};
+        ++chunk_offset;
+
+        if (position.is_null()) {
+          if (emit_probe_side_nulls) probe_pos_list->emplace_back(probe_row_id);
+          return;
+        }
+
+        const auto value = static_cast<int64_t>(position.value());
+        auto match_begin = size_t{0};
+        auto match_end = size_t{0};
+        if (value >= min && value <= max) {
+          const auto slot = static_cast<uint64_t>(value) - unsigned_min;
+          match_begin = offsets[slot];
+          match_end = offsets[slot + 1];
+        }
+
+        switch (_mode) {
+          case JoinMode::Inner:
+            for (auto match_idx = match_begin; match_idx < match_end; ++match_idx) {
+              probe_pos_list->emplace_back(probe_row_id);
+              build_pos_list->emplace_back(positions[match_idx]);
+            }
+            break;
+          case JoinMode::Semi:
+            if (match_begin != match_end) probe_pos_list->emplace_back(probe_row_id);
+            break;
+          default:
+            if (match_begin == match_end) probe_pos_list->emplace_back(probe_row_id);
+        }
+      });
+
+      probe_pos_lists[chunk_id] = std::move(probe_pos_list);
+      build_pos_lists[chunk_id] = std::move(build_pos_list);
+    }));
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  join_array_performance_data.set_step_runtime(OperatorSteps::Probing, timer.lap());
+
+  // Write one output chunk per probe side chunk, resolving reference inputs as the JoinHash does.
+  const auto probe_pos_lists_by_chunk = probe_table->type() == TableType::References
+                                            ? setup_pos_lists_by_chunk(probe_table)
+                                            : PosListsByChunk{};
+  const auto build_pos_lists_by_chunk = _mode == JoinMode::Inner && build_table->type() == TableType::References
+                                            ? setup_pos_lists_by_chunk(build_table)
+                                            : PosListsByChunk{};
+
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  output_chunks.reserve(probe_chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < probe_chunk_count; ++chunk_id) {
+    if (probe_pos_lists[chunk_id]->empty()) continue;
+
+    auto output_segments = Segments{};
+    write_output_segments(output_segments, probe_table, probe_pos_lists_by_chunk, probe_pos_lists[chunk_id]);
+    if (_mode == JoinMode::Inner) {
+      write_output_segments(output_segments, build_table, build_pos_lists_by_chunk, build_pos_lists[chunk_id]);
+    }
+
+    output_chunks.emplace_back(std::make_shared<Chunk>(std::move(output_segments)));
+  }
+
+  join_array_performance_data.set_step_runtime(OperatorSteps::OutputWriting, timer.lap());
+
+  return _build_output_table(std::move(output_chunks));
+}
+
+}  // namespace opossum
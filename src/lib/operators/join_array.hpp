@@ -0,0 +1,68 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_join_operator.hpp"
+#include "operator_join_predicate.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Equi join for integer join keys that form a dense range, e.g., surrogate keys from 1 to N. Instead of partitioning
+ * the inputs and building hash tables (as JoinHash does), the JoinArray builds a direct-addressed array over the
+ * values of the build side's (i.e., the right input's) join column: The slot of a value is `value - min`, where min is
+ * the smallest value of the build side. Each slot points to the RowIDs of the build side rows with that value, which
+ * are stored consecutively (as in a compressed sparse row layout). Probing a value thus requires a range check and a
+ * single array access. The probe side (left input) is processed by one job per chunk.
+ *
+ * The array needs one slot per value in the range of the build side, not per distinct value. The LQPTranslator only
+ * chooses this join if the statistics indicate a dense range. As statistics can be outdated or inaccurate for
+ * intermediate results, the JoinArray checks the actual range after materializing the build side and falls back to a
+ * JoinHash if the array would become too large (see MAX_SLOTS_PER_ROW and MAX_SLOT_COUNT).
+ *
+ * Supported are Inner, Semi, and Anti* joins with a single equals predicate on Int or Long columns.
+ */
+class JoinArray : public AbstractJoinOperator {
+ public:
+  // The array may have at most this many slots per non-NULL build side row before we fall back to a JoinHash. Small
+  // arrays (up to MIN_SLOT_COUNT slots) are always accepted. The largest array is 2 GB.
+  static constexpr auto MAX_SLOTS_PER_ROW = size_t{4};
+  static constexpr auto MIN_SLOT_COUNT = size_t{1} << 10;
+  static constexpr auto MAX_SLOT_COUNT = size_t{1} << 28;
+
+  static bool supports(const JoinConfiguration config);
+
+  // Returns whether an array for the given range of build side values and number of non-NULL build side rows is small
+  // enough. Also used by the LQPTranslator to decide on the join implementation based on statistics.
+  static bool is_dense(const int64_t min, const int64_t max, const size_t row_count);
+
+  JoinArray(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
+            const JoinMode mode, const OperatorJoinPredicate& primary_predicate,
+            const std::vector<OperatorJoinPredicate>& secondary_predicates = {});
+
+  const std::string& name() const override;
+
+  enum class OperatorSteps : uint8_t { BuildSideMaterializing, Building, Probing, OutputWriting };
+
+  struct PerformanceData : public OperatorPerformanceData<OperatorSteps> {
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override;
+
+    size_t slot_count{0};
+    bool fell_back_to_join_hash{false};
+  };
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  template <typename ProbeColumnType, typename BuildColumnType>
+  std::shared_ptr<const Table> _join();
+};
+
+}  // namespace opossum
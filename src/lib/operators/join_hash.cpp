@@ -1,6 +1,8 @@
 #include "join_hash.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <iterator>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -28,6 +30,12 @@ namespace {
 // Semi/Anti* Joins only emit tuples from the probe table
 enum class OutputColumnOrder { BuildFirstProbeSecond, ProbeFirstBuildSecond, ProbeOnly };
 
+// Upper bound for the radix bits chosen for a memory budget, see JoinHash::_on_execute
+constexpr auto MAX_SPILLING_RADIX_BITS = size_t{10};
+
+// Number of probe side rows per heavy hitter partition, see JoinHashImpl::_on_execute
+constexpr auto HEAVY_HITTER_ROWS_PER_PARTITION = size_t{16'384};
+
 }  // namespace
 
 namespace opossum {
@@ -44,10 +52,11 @@ JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator>& left,
                    const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
                    const OperatorJoinPredicate& primary_predicate,
                    const std::vector<OperatorJoinPredicate>& secondary_predicates,
-                   const std::optional<size_t>& radix_bits)
+                   const std::optional<size_t>& radix_bits, const std::optional<size_t>& memory_budget)
     : AbstractJoinOperator(OperatorType::JoinHash, left, right, mode, primary_predicate, secondary_predicates,
-                           std::make_unique<OperatorPerformanceData<OperatorSteps>>()),
-      _radix_bits(radix_bits) {}
+                           std::make_unique<PerformanceData>()),
+      _radix_bits(radix_bits),
+      _memory_budget(memory_budget) {}
 
 const std::string& JoinHash::name() const {
   static const auto name = std::string{"JoinHash"};
@@ -58,6 +67,9 @@ std::string JoinHash::description(DescriptionMode description_mode) const {
   std::ostringstream stream;
   stream << AbstractJoinOperator::description(description_mode);
   stream << " Radix bits: " << (_radix_bits ? std::to_string(*_radix_bits) : "Unspecified");
+  if (_memory_budget) {
+    stream << " Memory budget: " << *_memory_budget << " bytes";
+  }
 
   return stream.str();
 }
@@ -66,7 +78,7 @@ std::shared_ptr<AbstractOperator> JoinHash::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& copied_right_input) const {
   return std::make_shared<JoinHash>(copied_left_input, copied_right_input, _mode, _primary_predicate,
-                                    _secondary_predicates, _radix_bits);
+                                    _secondary_predicates, _radix_bits, _memory_budget);
 }
 
 void JoinHash::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -194,6 +206,24 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
               calculate_radix_bits<BuildColumnDataType>(build_input_table->row_count(), probe_input_table->row_count());
         }
 
+        if (_memory_budget) {
+          // Spilling works on the granularity of radix partitions. Choose enough partitions so that a partition (both
+          // sides and the hash table) is expected to take an eighth of the budget. This way, multiple spilled
+          // partitions can be joined in parallel. The number of partitions is capped so that tiny budgets do not
+          // result in an excessive number of spill files.
+          using HashedType = typename JoinHashTraits<BuildColumnDataType, ProbeColumnDataType>::HashType;
+          const auto build_row_count = build_input_table->row_count();
+          const auto probe_row_count = probe_input_table->row_count();
+          const auto expected_memory_usage = build_row_count * sizeof(PartitionedElement<BuildColumnDataType>) +
+                                             probe_row_count * sizeof(PartitionedElement<ProbeColumnDataType>) +
+                                             PosHashTable<HashedType>::estimate_memory_usage(build_row_count);
+          const auto partition_budget = std::max(1.0, static_cast<double>(*_memory_budget) / 8.0);
+          const auto partition_count = std::max(1.0, static_cast<double>(expected_memory_usage) / partition_budget);
+          const auto spilling_radix_bits =
+              std::min(MAX_SPILLING_RADIX_BITS, static_cast<size_t>(std::ceil(std::log2(partition_count))));
+          _radix_bits = std::max(*_radix_bits, spilling_radix_bits);
+        }
+
         // It needs to be ensured that the build partition does not get too large, because the
         // used offsets in the hash map might otherwise overflow. Since radix partitioning aims
         // to avoid large build partitions, this should never happen. Nonetheless, we better
@@ -206,8 +236,8 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
         _impl = std::make_unique<JoinHashImpl<BuildColumnDataType, ProbeColumnDataType>>(
             *this, build_input_table, probe_input_table, _mode, adjusted_column_ids,
             _primary_predicate.predicate_condition, output_column_order, *_radix_bits,
-            dynamic_cast<OperatorPerformanceData<JoinHash::OperatorSteps>&>(*performance_data),
-            std::move(adjusted_secondary_predicates));
+            dynamic_cast<PerformanceData&>(*performance_data), std::move(adjusted_secondary_predicates),
+            _memory_budget);
       } else {
         Fail("Cannot join String with non-String column");
       }
@@ -219,6 +249,22 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
 
 void JoinHash::_on_cleanup() { _impl.reset(); }
 
+void JoinHash::PerformanceData::output_to_stream(std::ostream& stream, DescriptionMode description_mode) const {
+  OperatorPerformanceData<OperatorSteps>::output_to_stream(stream, description_mode);
+
+  const auto separator = description_mode == DescriptionMode::SingleLine ? " " : "\n";
+  if (heavy_hitter_count > 0) {
+    stream << separator << "Joined " << heavy_hitter_count << " heavy hitter" << (heavy_hitter_count > 1 ? "s" : "")
+           << " in " << heavy_hitter_partition_count << " dedicated partition"
+           << (heavy_hitter_partition_count > 1 ? "s" : "") << ".";
+  }
+
+  if (spilled_partition_count > 0) {
+    stream << separator << "Spilled " << spilled_partition_count << " partition"
+           << (spilled_partition_count > 1 ? "s" : "") << " (" << spilled_bytes << " bytes).";
+  }
+}
+
 template <typename BuildColumnType, typename ProbeColumnType>
 class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
  public:
@@ -226,8 +272,9 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
                const std::shared_ptr<const Table>& probe_input_table, const JoinMode mode,
                const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
                const OutputColumnOrder output_column_order, const size_t radix_bits,
-               OperatorPerformanceData<JoinHash::OperatorSteps>& performance_data,
-               std::vector<OperatorJoinPredicate> secondary_predicates = {})
+               JoinHash::PerformanceData& performance_data,
+               std::vector<OperatorJoinPredicate> secondary_predicates = {},
+               const std::optional<size_t>& memory_budget = std::nullopt)
       : _join_hash(join_hash),
         _build_input_table(build_input_table),
         _probe_input_table(probe_input_table),
@@ -237,7 +284,8 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
         _performance(performance_data),
         _output_column_order(output_column_order),
         _secondary_predicates(std::move(secondary_predicates)),
-        _radix_bits(radix_bits) {}
+        _radix_bits(radix_bits),
+        _memory_budget(memory_budget) {}
 
  protected:
   const JoinHash& _join_hash;
@@ -245,7 +293,7 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
   const JoinMode _mode;
   const ColumnIDPair _column_ids;
   const PredicateCondition _predicate_condition;
-  OperatorPerformanceData<JoinHash::OperatorSteps>& _performance;
+  JoinHash::PerformanceData& _performance;
 
   OutputColumnOrder _output_column_order;
 
@@ -254,6 +302,7 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
   std::shared_ptr<Table> _output_table;
 
   const size_t _radix_bits;
+  const std::optional<size_t> _memory_budget;
 
   // Determine correct type for hashing
   using HashedType = typename JoinHashTraits<BuildColumnType, ProbeColumnType>::HashType;
@@ -306,6 +355,8 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
      *                 |                                    |
      *        materialize_input()                  materialize_input()
      *                 |                                    |
+     *     ( detect_heavy_hitters() )          ( detect_heavy_hitters() )
+     *                 |                                    |
      *      ( partition_by_radix() )            ( partition_by_radix() )
      *                 |                                    |
      *               build()                                |
@@ -373,19 +424,54 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
      *    could use them on the build side to exclude them for values that are not seen on the probe side. That would
      *    reduce the size of the intermediary results, but would require an adapted calculation of the output offsets
      *    within partition_by_radix.
+     *
+     *    Values that alone make up at least the expected size of a radix partition on either side (heavy hitters) are
+     *    not radix partitioned. Instead, their build side rows are written to a single additional partition and their
+     *    probe side rows are spread across as many additional partitions as needed to keep them small. The heavy
+     *    hitter partitions of the probe side all probe the same hash table (see step 4.2), so that skewed inputs are
+     *    still joined by many jobs of similar size.
      */
+    Timer timer_clustering;
+    auto heavy_hitters = std::vector<Hash>{};
+    auto heavy_hitter_probe_partition_count = size_t{0};
+    if (_radix_bits > 0) {
+      const auto min_heavy_hitter_share = 1.0 / static_cast<double>(size_t{1} << _radix_bits);
+      const auto build_heavy_hitters =
+          detect_heavy_hitters<BuildColumnType, HashedType>(materialized_build_column, min_heavy_hitter_share);
+      const auto probe_heavy_hitters =
+          detect_heavy_hitters<ProbeColumnType, HashedType>(materialized_probe_column, min_heavy_hitter_share);
+
+      auto heavy_hitter_probe_row_count = size_t{0};
+      for (const auto& [hash, row_count] : build_heavy_hitters) {
+        heavy_hitters.emplace_back(hash);
+      }
+      for (const auto& [hash, row_count] : probe_heavy_hitters) {
+        heavy_hitters.emplace_back(hash);
+        heavy_hitter_probe_row_count += row_count;
+      }
+      std::sort(heavy_hitters.begin(), heavy_hitters.end());
+      heavy_hitters.erase(std::unique(heavy_hitters.begin(), heavy_hitters.end()), heavy_hitters.end());
+
+      if (!heavy_hitters.empty()) {
+        heavy_hitter_probe_partition_count =
+            std::max(size_t{1}, heavy_hitter_probe_row_count / HEAVY_HITTER_ROWS_PER_PARTITION);
+      }
+    }
+    const auto heavy_hitter_build_partition_count = heavy_hitters.empty() ? size_t{0} : size_t{1};
+
     if (_radix_bits > 0) {
-      Timer timer_clustering;
       auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
 
       jobs.emplace_back(std::make_shared<JobTask>([&]() {
         // radix partition the build table
         if (keep_nulls_build_column) {
           radix_build_column = partition_by_radix<BuildColumnType, HashedType, true>(
-              materialized_build_column, histograms_build_column, _radix_bits);
+              materialized_build_column, histograms_build_column, _radix_bits, ALL_TRUE_BLOOM_FILTER, heavy_hitters,
+              heavy_hitter_build_partition_count);
         } else {
           radix_build_column = partition_by_radix<BuildColumnType, HashedType, false>(
-              materialized_build_column, histograms_build_column, _radix_bits);
+              materialized_build_column, histograms_build_column, _radix_bits, ALL_TRUE_BLOOM_FILTER, heavy_hitters,
+              heavy_hitter_build_partition_count);
         }
 
         // After the data in materialized_build_column has been partitioned, it is not needed anymore.
@@ -396,10 +482,12 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
         // radix partition the probe column.
         if (keep_nulls_probe_column) {
           radix_probe_column = partition_by_radix<ProbeColumnType, HashedType, true>(
-              materialized_probe_column, histograms_probe_column, _radix_bits);
+              materialized_probe_column, histograms_probe_column, _radix_bits, ALL_TRUE_BLOOM_FILTER, heavy_hitters,
+              heavy_hitter_probe_partition_count);
         } else {
           radix_probe_column = partition_by_radix<ProbeColumnType, HashedType, false>(
-              materialized_probe_column, histograms_probe_column, _radix_bits);
+              materialized_probe_column, histograms_probe_column, _radix_bits, ALL_TRUE_BLOOM_FILTER, heavy_hitters,
+              heavy_hitter_probe_partition_count);
         }
 
         // After the data in materialized_probe_column has been partitioned, it is not needed anymore.
@@ -410,39 +498,18 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
 
       histograms_build_column.clear();
       histograms_probe_column.clear();
-
-      _performance.set_step_runtime(OperatorSteps::Clustering, timer_clustering.lap());
     } else {
       // short cut: skip radix partitioning and use materialized data directly
       radix_build_column = std::move(materialized_build_column);
       radix_probe_column = std::move(materialized_probe_column);
     }
 
-    /**
-     * 3. Build hash tables.
-     *    In the case of semi or anti joins, we do not need to track all rows on the hashed side, just one per value.
-     *    value. However, if we have secondary predicates, those might fail on that single row. In that case, we DO need
-     *    all rows.
-     *    We use the probe side's bloom filter to exclude values from the hash table that will not be accessed in the
-     *    probe step.
-     */
-    Timer timer_hash_map_building;
-    if (_secondary_predicates.empty() &&
-        (_mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsTrue || _mode == JoinMode::AntiNullAsFalse)) {
-      hash_tables = build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::SinglePosition,
-                                                       _radix_bits, probe_side_bloom_filter);
-    } else {
-      hash_tables = build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::AllPositions, _radix_bits,
-                                                       probe_side_bloom_filter);
-    }
-    _performance.set_step_runtime(OperatorSteps::Building, timer_hash_map_building.lap());
-
     /**
      * Short cut for AntiNullAsTrue:
-     *   If there is any NULL value on the build side, do not bother probing as no tuples can be emitted anyway (as
-     *   long as JoinHash/AntiNullAsTrue doesn't support secondary predicates). Doing this early out right here is
-     *   hacky, but during probing we assume NULL values on the build side do not matter, so we'd have no chance
-     *   detecting a NULL value on the build side there.
+     *   If there is any NULL value on the build side, do not bother building and probing as no tuples can be emitted
+     *   anyway (as long as JoinHash/AntiNullAsTrue doesn't support secondary predicates). Doing this early out right
+     *   here is hacky, but during probing we assume NULL values on the build side do not matter, so we'd have no
+     *   chance detecting a NULL value on the build side there.
      */
     if (_mode == JoinMode::AntiNullAsTrue) {
       for (const auto& build_side_partition : radix_build_column) {
@@ -457,6 +524,74 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
       }
     }
 
+    /**
+     * 2.1. Separate the heavy hitter partitions from the radix partitions. From here on, both radix containers hold
+     *      1 << _radix_bits partitions again.
+     */
+    auto heavy_hitter_build_column = RadixContainer<BuildColumnType>{};
+    auto heavy_hitter_probe_column = RadixContainer<ProbeColumnType>{};
+    if (!heavy_hitters.empty()) {
+      const auto radix_partition_count = size_t{1} << _radix_bits;
+      heavy_hitter_build_column.assign(std::make_move_iterator(radix_build_column.begin() + radix_partition_count),
+                                       std::make_move_iterator(radix_build_column.end()));
+      radix_build_column.resize(radix_partition_count);
+      heavy_hitter_probe_column.assign(std::make_move_iterator(radix_probe_column.begin() + radix_partition_count),
+                                       std::make_move_iterator(radix_probe_column.end()));
+      radix_probe_column.resize(radix_partition_count);
+
+      _performance.heavy_hitter_count = heavy_hitters.size();
+      _performance.heavy_hitter_partition_count = heavy_hitter_probe_column.size();
+    }
+
+    /**
+     * 2.2. If a memory budget is given and the radix partitions (together with their hash tables) exceed it, write
+     *      partitions to disk until the remaining ones fit into the budget. Spilled partitions are joined after the
+     *      in-memory partitions (see step 4.1).
+     */
+    auto spilled_partitions = std::vector<SpilledPartition>{};
+    if (_memory_budget && _radix_bits > 0) {
+      spilled_partitions = spill_partitions<BuildColumnType, ProbeColumnType, HashedType>(
+          radix_build_column, radix_probe_column, *_memory_budget);
+
+      _performance.spilled_partition_count = spilled_partitions.size();
+      for (const auto& spilled_partition : spilled_partitions) {
+        _performance.spilled_bytes += spilled_partition.spilled_bytes;
+      }
+    }
+
+    if (_radix_bits > 0) {
+      _performance.set_step_runtime(OperatorSteps::Clustering, timer_clustering.lap());
+    }
+
+    /**
+     * 3. Build hash tables.
+     *    In the case of semi or anti joins, we do not need to track all rows on the hashed side, just one per value.
+     *    value. However, if we have secondary predicates, those might fail on that single row. In that case, we DO need
+     *    all rows.
+     *    We use the probe side's bloom filter to exclude values from the hash table that will not be accessed in the
+     *    probe step.
+     */
+    const auto build_mode =
+        _secondary_predicates.empty() &&
+                (_mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsTrue || _mode == JoinMode::AntiNullAsFalse)
+            ? JoinHashBuildMode::SinglePosition
+            : JoinHashBuildMode::AllPositions;
+
+    Timer timer_hash_map_building;
+    hash_tables = build<BuildColumnType, HashedType>(radix_build_column, build_mode, _radix_bits,
+                                                     probe_side_bloom_filter);
+
+    // All heavy hitters share a single hash table, which is probed by all heavy hitter partitions of the probe side.
+    // As there are only few distinct values, building it is cheap even if the heavy hitters are frequent on the build
+    // side.
+    auto heavy_hitter_hash_tables = std::vector<std::optional<PosHashTable<HashedType>>>{};
+    if (!heavy_hitter_build_column.empty()) {
+      heavy_hitter_hash_tables =
+          build<BuildColumnType, HashedType>(heavy_hitter_build_column, build_mode, 0, probe_side_bloom_filter);
+      heavy_hitter_build_column.clear();
+    }
+    auto building_runtime = timer_hash_map_building.lap();
+
     /**
      * 4. Probe step
      */
@@ -474,47 +609,130 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
       probe_side_pos_lists[i].reserve(result_rows_per_partition);
     }
 
+    const auto probe_partitions = [&](const RadixContainer<ProbeColumnType>& probe_column,
+                                      const std::vector<std::optional<PosHashTable<HashedType>>>& partition_hash_tables,
+                                      std::vector<RowIDPosList>& build_pos_lists,
+                                      std::vector<RowIDPosList>& probe_pos_lists) {
+      switch (_mode) {
+        case JoinMode::Inner:
+          probe<ProbeColumnType, HashedType, false>(probe_column, partition_hash_tables, build_pos_lists,
+                                                    probe_pos_lists, _mode, *_build_input_table, *_probe_input_table,
+                                                    _secondary_predicates);
+          break;
+
+        case JoinMode::Left:
+        case JoinMode::Right:
+          probe<ProbeColumnType, HashedType, true>(probe_column, partition_hash_tables, build_pos_lists,
+                                                   probe_pos_lists, _mode, *_build_input_table, *_probe_input_table,
+                                                   _secondary_predicates);
+          break;
+
+        case JoinMode::Semi:
+          probe_semi_anti<ProbeColumnType, HashedType, JoinMode::Semi>(probe_column, partition_hash_tables,
+                                                                       probe_pos_lists, *_build_input_table,
+                                                                       *_probe_input_table, _secondary_predicates);
+          break;
+
+        case JoinMode::AntiNullAsTrue:
+          probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsTrue>(
+              probe_column, partition_hash_tables, probe_pos_lists, *_build_input_table, *_probe_input_table,
+              _secondary_predicates);
+          break;
+
+        case JoinMode::AntiNullAsFalse:
+          probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsFalse>(
+              probe_column, partition_hash_tables, probe_pos_lists, *_build_input_table, *_probe_input_table,
+              _secondary_predicates);
+          break;
+
+        default:
+          Fail("JoinMode not supported by JoinHash");
+      }
+    };
+
     Timer timer_probing;
-    switch (_mode) {
-      case JoinMode::Inner:
-        probe<ProbeColumnType, HashedType, false>(radix_probe_column, hash_tables, build_side_pos_lists,
-                                                  probe_side_pos_lists, _mode, *_build_input_table, *_probe_input_table,
-                                                  _secondary_predicates);
-        break;
-
-      case JoinMode::Left:
-      case JoinMode::Right:
-        probe<ProbeColumnType, HashedType, true>(radix_probe_column, hash_tables, build_side_pos_lists,
-                                                 probe_side_pos_lists, _mode, *_build_input_table, *_probe_input_table,
-                                                 _secondary_predicates);
-        break;
-
-      case JoinMode::Semi:
-        probe_semi_anti<ProbeColumnType, HashedType, JoinMode::Semi>(radix_probe_column, hash_tables,
-                                                                     probe_side_pos_lists, *_build_input_table,
-                                                                     *_probe_input_table, _secondary_predicates);
-        break;
-
-      case JoinMode::AntiNullAsTrue:
-        probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsTrue>(
-            radix_probe_column, hash_tables, probe_side_pos_lists, *_build_input_table, *_probe_input_table,
-            _secondary_predicates);
-        break;
-
-      case JoinMode::AntiNullAsFalse:
-        probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsFalse>(
-            radix_probe_column, hash_tables, probe_side_pos_lists, *_build_input_table, *_probe_input_table,
-            _secondary_predicates);
-        break;
-
-      default:
-        Fail("JoinMode not supported by JoinHash");
-    }
-    _performance.set_step_runtime(OperatorSteps::Probing, timer_probing.lap());
+    probe_partitions(radix_probe_column, hash_tables, build_side_pos_lists, probe_side_pos_lists);
+    auto probing_runtime = timer_probing.lap();
 
-    // After probing, the partitioned columns are not needed anymore.
+    // After probing, the partitioned columns and the hash tables are not needed anymore.
     radix_build_column.clear();
     radix_probe_column.clear();
+    hash_tables.clear();
+
+    /**
+     * 4.2. Probe the heavy hitter partitions. As there is only a single hash table, probe() broadcasts it to all
+     *      partitions. The results are appended to those of the radix partitions.
+     */
+    if (!heavy_hitter_probe_column.empty()) {
+      const auto heavy_hitter_partition_count = heavy_hitter_probe_column.size();
+      auto heavy_hitter_build_side_pos_lists = std::vector<RowIDPosList>(heavy_hitter_partition_count);
+      auto heavy_hitter_probe_side_pos_lists = std::vector<RowIDPosList>(heavy_hitter_partition_count);
+      probe_partitions(heavy_hitter_probe_column, heavy_hitter_hash_tables, heavy_hitter_build_side_pos_lists,
+                       heavy_hitter_probe_side_pos_lists);
+
+      build_side_pos_lists.insert(build_side_pos_lists.end(),
+                                  std::make_move_iterator(heavy_hitter_build_side_pos_lists.begin()),
+                                  std::make_move_iterator(heavy_hitter_build_side_pos_lists.end()));
+      probe_side_pos_lists.insert(probe_side_pos_lists.end(),
+                                  std::make_move_iterator(heavy_hitter_probe_side_pos_lists.begin()),
+                                  std::make_move_iterator(heavy_hitter_probe_side_pos_lists.end()));
+
+      heavy_hitter_probe_column.clear();
+      heavy_hitter_hash_tables.clear();
+      probing_runtime += timer_probing.lap();
+    }
+
+    /**
+     * 4.1. Join the spilled partitions. They are loaded in batches that fit into the memory budget and are built and
+     *      probed like the in-memory partitions. The results are stored at the original positions of the partitions.
+     */
+    auto batch_begin = size_t{0};
+    while (batch_begin < spilled_partitions.size()) {
+      auto batch_end = batch_begin + 1;
+      auto batch_memory_usage = spilled_partitions[batch_begin].memory_usage;
+      while (batch_end < spilled_partitions.size() &&
+             batch_memory_usage + spilled_partitions[batch_end].memory_usage <= *_memory_budget) {
+        batch_memory_usage += spilled_partitions[batch_end].memory_usage;
+        ++batch_end;
+      }
+      const auto batch_size = batch_end - batch_begin;
+
+      Timer timer_batch;
+      auto batch_build_column = RadixContainer<BuildColumnType>(batch_size);
+      auto batch_probe_column = RadixContainer<ProbeColumnType>(batch_size);
+      auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+      jobs.reserve(batch_size);
+      for (auto batch_idx = size_t{0}; batch_idx < batch_size; ++batch_idx) {
+        jobs.emplace_back(std::make_shared<JobTask>([&, batch_idx]() {
+          const auto& spilled_partition = spilled_partitions[batch_begin + batch_idx];
+          batch_build_column[batch_idx] = load_spilled_partition<BuildColumnType>(*spilled_partition.build_side_file);
+          batch_probe_column[batch_idx] = load_spilled_partition<ProbeColumnType>(*spilled_partition.probe_side_file);
+        }));
+      }
+      Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+      const auto batch_hash_tables = build<BuildColumnType, HashedType>(batch_build_column, build_mode, _radix_bits,
+                                                                        probe_side_bloom_filter);
+      batch_build_column.clear();
+      building_runtime += timer_batch.lap();
+
+      auto batch_build_side_pos_lists = std::vector<RowIDPosList>(batch_size);
+      auto batch_probe_side_pos_lists = std::vector<RowIDPosList>(batch_size);
+      probe_partitions(batch_probe_column, batch_hash_tables, batch_build_side_pos_lists, batch_probe_side_pos_lists);
+
+      for (auto batch_idx = size_t{0}; batch_idx < batch_size; ++batch_idx) {
+        const auto partition_idx = spilled_partitions[batch_begin + batch_idx].partition_idx;
+        build_side_pos_lists[partition_idx] = std::move(batch_build_side_pos_lists[batch_idx]);
+        probe_side_pos_lists[partition_idx] = std::move(batch_probe_side_pos_lists[batch_idx]);
+      }
+      probing_runtime += timer_batch.lap();
+
+      batch_begin = batch_end;
+    }
+    spilled_partitions.clear();
+
+    _performance.set_step_runtime(OperatorSteps::Building, building_runtime);
+    _performance.set_step_runtime(OperatorSteps::Probing, probing_runtime);
 
     /**
      * 5. Write output Table
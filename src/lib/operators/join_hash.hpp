@@ -17,6 +17,15 @@ namespace opossum {
  * i.e., your sorting order might be disturbed.
  *
  * Find more information in our Wiki: https://github.com/hyrise/hyrise/wiki/Hash-Join-Operator
+ *
+ * Values that are so frequent that they would overload their radix partition (heavy hitters) are detected by sampling
+ * the materialized inputs. They are joined in dedicated partitions that share a single hash table, see
+ * JoinHashImpl::_on_execute.
+ *
+ * If a memory budget (in bytes, see OperatorMemoryBudgetSetting) is given, the radix partitions that do not fit into
+ * the budget are written to temporary files and joined batch by batch after the in-memory partitions (Grace hash
+ * join). The budget covers the partitioned inputs and the hash tables, but not the materialization that precedes the
+ * partitioning or the output.
  */
 class JoinHash : public AbstractJoinOperator {
  public:
@@ -25,7 +34,8 @@ class JoinHash : public AbstractJoinOperator {
   JoinHash(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
            const JoinMode mode, const OperatorJoinPredicate& primary_predicate,
            const std::vector<OperatorJoinPredicate>& secondary_predicates = {},
-           const std::optional<size_t>& radix_bits = std::nullopt);
+           const std::optional<size_t>& radix_bits = std::nullopt,
+           const std::optional<size_t>& memory_budget = std::nullopt);
 
   const std::string& name() const override;
   std::string description(DescriptionMode description_mode) const override;
@@ -42,6 +52,17 @@ class JoinHash : public AbstractJoinOperator {
     OutputWriting
   };
 
+  struct PerformanceData : public OperatorPerformanceData<OperatorSteps> {
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override;
+
+    // Values that were joined in dedicated partitions instead of their radix partitions due to their frequency
+    size_t heavy_hitter_count{0};
+    size_t heavy_hitter_partition_count{0};
+
+    size_t spilled_partition_count{0};
+    size_t spilled_bytes{0};
+  };
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
@@ -52,6 +73,7 @@ class JoinHash : public AbstractJoinOperator {
 
   std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
   std::optional<size_t> _radix_bits;
+  const std::optional<size_t> _memory_budget;
 
   template <typename LeftType, typename RightType>
   class JoinHashImpl;
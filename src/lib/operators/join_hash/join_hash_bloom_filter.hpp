@@ -0,0 +1,140 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Register-blocked bloom filter used by the JoinHash (and the RuntimeJoinFilter) to skip values that cannot find a join
+ * partner. All BITS_PER_VALUE_IN_BLOCK bits of a value are placed within a single 64-bit block, so that inserting or
+ * looking up a value touches exactly one word (and thus one cache line) and needs no loop over the hash functions.
+ * The filter is sized from the estimated number of values (e.g., the row count of the input that creates it) and is
+ * thus much smaller than a fixed-size filter for small inputs while still being effective for large ones.
+ *
+ * The filter can be filled concurrently, either with thread-local filters of the same size that are merged later on
+ * (see merge(), which is vectorized) or with insert_concurrently(), which uses atomic operations and does not need a
+ * merge. Once a filter has been filled, disable_if_ineffective() estimates its false positive rate from the share of
+ * set bits. If the filter would let most values pass anyway, it is replaced with a filter that contains every value
+ * (see below) and costs neither memory nor cache misses.
+ *
+ * A default-constructed BloomFilter contains every value. It consists of a single block with all bits set, so that
+ * operators can always probe a filter without branching on whether one exists.
+ */
+class BloomFilter {
+ public:
+  static constexpr auto BITS_PER_VALUE = size_t{16};
+  static constexpr auto BITS_PER_VALUE_IN_BLOCK = size_t{4};
+
+  // Bounds of the filter size in blocks of 64 bits. The maximum corresponds to 16 MB.
+  static constexpr auto MIN_BLOCK_COUNT = size_t{1} << 6;
+  static constexpr auto MAX_BLOCK_COUNT = size_t{1} << 21;
+
+  // If more values than this pass the filter even though they were never inserted, the filter is not worth probing.
+  static constexpr auto MAX_FALSE_POSITIVE_RATE = 0.3;
+
+  BloomFilter() : _blocks(1, ~uint64_t{0}), _block_mask(0) {}
+
+  explicit BloomFilter(const size_t estimated_value_count) {
+    const auto requested_block_count = (estimated_value_count * BITS_PER_VALUE + 63) / 64;
+    const auto block_count = std::clamp(std::bit_ceil(requested_block_count), MIN_BLOCK_COUNT, MAX_BLOCK_COUNT);
+    _blocks.resize(block_count);
+    _block_mask = block_count - 1;
+  }
+
+  void insert(const size_t hash) {
+    const auto [block_idx, mask] = _block_and_mask(hash);
+    _blocks[block_idx] |= mask;
+  }
+
+  // Can be called by multiple threads at the same time, but not concurrently with insert() or merge().
+  void insert_concurrently(const size_t hash) {
+    const auto [block_idx, mask] = _block_and_mask(hash);
+    std::atomic_ref<uint64_t>{_blocks[block_idx]}.fetch_or(mask, std::memory_order_relaxed);
+  }
+
+  bool contains(const size_t hash) const {
+    const auto [block_idx, mask] = _block_and_mask(hash);
+    return (_blocks[block_idx] & mask) == mask;
+  }
+
+  // Merges the blocks [begin_block_idx, end_block_idx) of a filter of the same size into this filter. Merging disjoint
+  // block ranges can be done in parallel.
+  void merge(const BloomFilter& other, const size_t begin_block_idx, const size_t end_block_idx) {
+    DebugAssert(block_count() == other.block_count(), "Can only merge bloom filters of the same size");
+    DebugAssert(begin_block_idx <= end_block_idx && end_block_idx <= block_count(), "Invalid block range");
+
+    auto* const __restrict blocks = _blocks.data();
+    const auto* const __restrict other_blocks = other._blocks.data();
+
+    // The OpenMP pragma makes the compiler vectorize the loop (see AbstractTableScanImpl for details on -fopenmp-simd).
+    // NOLINTNEXTLINE
+    {}  // clang-format off
+    #pragma omp simd
+    // clang-format on
+    for (auto block_idx = begin_block_idx; block_idx < end_block_idx; ++block_idx) {
+      blocks[block_idx] |= other_blocks[block_idx];
+    }
+  }
+
+  void merge(const BloomFilter& other) { merge(other, 0, block_count()); }
+
+  // For a register-blocked filter, a value that was not inserted passes if all of its bits are set in its block. We
+  // approximate this using the share of set bits in the entire filter.
+  double estimated_false_positive_rate() const {
+    auto set_bit_count = size_t{0};
+    for (const auto block : _blocks) {
+      set_bit_count += std::popcount(block);
+    }
+
+    const auto set_bit_share = static_cast<double>(set_bit_count) / static_cast<double>(_blocks.size() * 64);
+    return std::pow(set_bit_share, BITS_PER_VALUE_IN_BLOCK);
+  }
+
+  // Returns true if the filter was replaced with a filter that contains every value.
+  bool disable_if_ineffective() {
+    if (is_disabled() || estimated_false_positive_rate() <= MAX_FALSE_POSITIVE_RATE) return false;
+
+    *this = BloomFilter{};
+    return true;
+  }
+
+  // Whether the filter contains every value, i.e., whether it was default-constructed or disabled
+  bool is_disabled() const { return _blocks.size() == 1 && _blocks[0] == ~uint64_t{0}; }
+
+  size_t block_count() const { return _blocks.size(); }
+
+  bool operator==(const BloomFilter& other) const { return _blocks == other._blocks; }
+
+ protected:
+  std::pair<size_t, uint64_t> _block_and_mask(const size_t hash) const {
+    // Hashes of integral values are usually the values themselves (see std::hash). Thus, we mix all bits of the hash
+    // (using the finalizer of MurmurHash3) before selecting the block from the lower and the bits within the block from
+    // the upper bits.
+    auto mixed_hash = static_cast<uint64_t>(hash);
+    mixed_hash ^= mixed_hash >> 33;
+    mixed_hash *= 0xff51afd7ed558ccdULL;
+    mixed_hash ^= mixed_hash >> 33;
+    mixed_hash *= 0xc4ceb9fe1a85ec53ULL;
+    mixed_hash ^= mixed_hash >> 33;
+
+    auto mask = uint64_t{0};
+    for (auto bit_idx = size_t{0}; bit_idx < BITS_PER_VALUE_IN_BLOCK; ++bit_idx) {
+      mask |= uint64_t{1} << ((mixed_hash >> (40 + bit_idx * 6)) & 63);
+    }
+
+    return {mixed_hash & _block_mask, mask};
+  }
+
+  std::vector<uint64_t> _blocks;
+  size_t _block_mask;
+};
+
+}  // namespace opossum
@@ -1,12 +1,18 @@
 #pragma once
 
+#include <algorithm>
+#include <fstream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include <boost/container/small_vector.hpp>
-#include <boost/dynamic_bitset.hpp>
 #include <boost/lexical_cast.hpp>
 #include <uninitialized_vector.hpp>
 
 #include "bytell_hash_map.hpp"
 #include "hyrise.hpp"
+#include "operators/join_hash/join_hash_bloom_filter.hpp"
 #include "operators/multi_predicate_join/multi_predicate_join_evaluator.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
@@ -14,6 +20,7 @@
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
+#include "utils/spill_file.hpp"
 
 /*
   This file includes the functions that cover the main steps of our hash join implementation
@@ -117,6 +124,14 @@ class PosHashTable {
     }
   }
 
+  // Upper bound for the memory used by a hash table that is built from row_count rows. Used to decide which radix
+  // partitions have to be spilled to disk (see spill_partitions()).
+  static size_t estimate_memory_usage(const size_t row_count) {
+    // See calculate_radix_bits in join_hash.cpp for the assumed fill level of the bytell hash map.
+    return static_cast<size_t>(static_cast<double>(row_count) * (sizeof(HashedType) + sizeof(Offset) + 1) / 0.8) +
+           (row_count + 1) * sizeof(SmallPosList);
+  }
+
   void shrink_to_fit() {
     _pos_lists.resize(_hash_table.size());
     _pos_lists.shrink_to_fit();
@@ -183,41 +198,54 @@ class PosHashTable {
   std::optional<std::vector<std::pair<HashedType, Offset>>> _values{std::nullopt};
 };
 
-// The bloom filter (with k=1) is used during the materialization and build phases. It contains `true` for each
-// `hash_function(value) % BLOOM_FILTER_SIZE`. Much of how the bloom filter is used in the hash join could be improved:
-// (1) Dynamically check whether bloom filters are worth the memory and computational costs This could be based on the
-//     input table sizes, the expected cardinalities, the hardware characteristics, or other factors.
-// (2) Choosing an appropriate filter size. 2^20 was experimentally found to be good for TPC-H SF 10, but is certainly
-//     not optimal in every situation.
-// (3) Check whether using multiple hash functions (k>1) brings any improvement.
-// (4) Use the probe side bloom filter when partitioning the build side. By doing that, we reduce the size of the
-//     intermediary results. When a bloom filter-supported partitioning has been done (i.e., partitioning has not
-//     been skipped), we do not need to use a bloom filter in the build phase anymore.
-// Some of these points could be addressed with relatively low effort and should bring additional, significant benefits.
-// We did not yet work on this because the bloom filter was a byproduct of a research project and we have not had the
-// resources to optimize it at the time.
-static constexpr auto BLOOM_FILTER_SIZE = 1 << 20;
-static constexpr auto BLOOM_FILTER_MASK = BLOOM_FILTER_SIZE - 1;
-
-// Using dynamic_bitset because, different from vector<bool>, it has an efficient operator| implementation, which is
-// needed for merging partial bloom filters created by different threads. Note that the dynamic_bitset(n, value)
-// constructor does not do what you would expect it to, so try to avoid it.
-using BloomFilter = boost::dynamic_bitset<>;
-
-// ALL_TRUE_BLOOM_FILTER is initialized by creating a BloomFilter with every value being false and using bitwise
-// negation (~x). As the negation is surprisingly expensive, we create a static empty bloom filter and reference
-// it where needed. Having a bloom filter that always returns true avoids a branch in the hot loop.
-static const auto ALL_TRUE_BLOOM_FILTER = ~BloomFilter(BLOOM_FILTER_SIZE);
+// The bloom filters (see join_hash_bloom_filter.hpp) are used during the materialization and build phases. The side
+// that is materialized first creates a filter, which is used to skip values of the other side. That side in turn
+// creates a filter that is used to skip values when building the hash tables. Future work could use the probe side's
+// bloom filter when partitioning the build side. By doing that, we would reduce the size of the intermediary results.
+
+// Having a bloom filter that always returns true avoids a branch in the hot loop.
+static const auto ALL_TRUE_BLOOM_FILTER = BloomFilter{};
+
+// Merges thread-local bloom filters into output_bloom_filter. Each job merges a range of blocks from all filters, so
+// that no synchronization is needed.
+inline void merge_bloom_filters(BloomFilter& output_bloom_filter,
+                                const std::vector<std::optional<BloomFilter>>& local_bloom_filters) {
+  constexpr auto BLOCKS_PER_JOB = size_t{1} << 14;
+
+  const auto block_count = output_bloom_filter.block_count();
+  const auto merge_blocks = [&](const size_t begin_block_idx, const size_t end_block_idx) {
+    for (const auto& local_bloom_filter : local_bloom_filters) {
+      if (!local_bloom_filter) continue;
+      output_bloom_filter.merge(*local_bloom_filter, begin_block_idx, end_block_idx);
+    }
+  };
+
+  if (block_count <= BLOCKS_PER_JOB) {
+    merge_blocks(0, block_count);
+    return;
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(block_count / BLOCKS_PER_JOB + 1);
+  for (auto begin_block_idx = size_t{0}; begin_block_idx < block_count; begin_block_idx += BLOCKS_PER_JOB) {
+    const auto end_block_idx = std::min(begin_block_idx + BLOCKS_PER_JOB, block_count);
+    jobs.emplace_back(std::make_shared<JobTask>([&, begin_block_idx, end_block_idx]() {
+      merge_blocks(begin_block_idx, end_block_idx);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
 
 // @param in_table             Table to materialize
 // @param column_id            Column within that table to materialize
 // @param histograms           Out: If radix_bits > 0, contains one histogram per chunk where each histogram contains
 //                             1 << radix_bits slots
 // @param radix_bits           Number of radix_bits, needed only for histogram calculation
-// @param output_bloom_filter  Out: A filled BloomFilter where `value & BLOOM_FILTER_MASK == true` for each value
-//                             encountered in the input column
-// @param input_bloom_filter   Optional: Materialization is skipped for each value where the corresponding slot in the
-//                             bloom filter is false
+// @param output_bloom_filter  Out: A BloomFilter sized for the input table that contains each value encountered in
+//                             the input column. If it turns out to be ineffective, a filter that contains every value
+//                             is returned instead.
+// @param input_bloom_filter   Optional: Materialization is skipped for each value that is not contained in the bloom
+//                             filter
 template <typename T, typename HashedType, bool keep_null_values>
 RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
                                     std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
@@ -238,11 +266,15 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
   const auto pass = size_t{0};
   const auto radix_mask = static_cast<size_t>(pow(2, radix_bits * (pass + 1)) - 1);
 
-  Assert(output_bloom_filter.empty(), "output_bloom_filter should be empty");
-  output_bloom_filter.resize(BLOOM_FILTER_SIZE);
-  std::mutex output_bloom_filter_mutex;
+  // The row count is an upper bound of the number of distinct values and thus of the number of set filter blocks.
+  const auto estimated_value_count = in_table->row_count();
+  output_bloom_filter = BloomFilter(estimated_value_count);
 
-  Assert(input_bloom_filter.size() == BLOOM_FILTER_SIZE, "Invalid input_bloom_filter");
+  // Filters that are written by multiple jobs are built lock-free: Either, each job fills a local filter, which are
+  // merged afterwards, or, if the filter is large compared to the chunks, each job writes to the output filter with
+  // atomic operations.
+  const auto is_multi_threaded = Hyrise::get().is_multi_threaded();
+  auto local_bloom_filters = std::vector<std::optional<BloomFilter>>(chunk_count);
 
   // Create histograms per chunk
   histograms.resize(chunk_count);
@@ -253,19 +285,19 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
     if (!in_table->get_chunk(chunk_id)) continue;
 
     jobs.emplace_back(std::make_shared<JobTask>([&, in_table, chunk_id]() {
-      auto local_output_bloom_filter = BloomFilter{};
-      std::reference_wrapper<BloomFilter> used_output_bloom_filter = output_bloom_filter;
-      if (Hyrise::get().is_multi_threaded()) {
-        // We cannot write to BloomFilter concurrently, so we build a local one first.
-        local_output_bloom_filter = BloomFilter(BLOOM_FILTER_SIZE, false);
-        used_output_bloom_filter = local_output_bloom_filter;
-      }
-
       const auto chunk_in = in_table->get_chunk(chunk_id);
 
       // Skip chunks that were physically deleted
       if (!chunk_in) return;
 
+      const auto use_local_bloom_filter =
+          is_multi_threaded && output_bloom_filter.block_count() <= static_cast<size_t>(chunk_in->size());
+      if (use_local_bloom_filter) {
+        local_bloom_filters[chunk_id] = BloomFilter(estimated_value_count);
+      }
+      auto& used_output_bloom_filter = use_local_bloom_filter ? *local_bloom_filters[chunk_id] : output_bloom_filter;
+      const auto insert_concurrently = is_multi_threaded && !use_local_bloom_filter;
+
       auto& elements = radix_container[chunk_id].elements;
       auto& null_values = radix_container[chunk_id].null_values;
 
@@ -307,14 +339,18 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
             const Hash hashed_value = hash_function(static_cast<HashedType>(value.value()));
 
             auto skip = false;
-            if (!value.is_null() && !input_bloom_filter[hashed_value & BLOOM_FILTER_MASK] && !keep_null_values) {
+            if (!value.is_null() && !input_bloom_filter.contains(hashed_value) && !keep_null_values) {
               // Value in not present in input bloom filter and can be skipped
               skip = true;
             }
 
             if (!skip) {
-              // Fill the corresponding slot in the bloom filter
-              used_output_bloom_filter.get()[hashed_value & BLOOM_FILTER_MASK] = true;
+              // Fill the corresponding block in the bloom filter
+              if (insert_concurrently) {
+                used_output_bloom_filter.insert_concurrently(hashed_value);
+              } else {
+                used_output_bloom_filter.insert(hashed_value);
+              }
 
               /*
               For ReferenceSegments we do not use the RowIDs from the referenced tables.
@@ -358,16 +394,13 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
       null_values.resize(std::distance(null_values.begin(), null_values_iter));
 
       histograms[chunk_id] = std::move(histogram);
-
-      if (Hyrise::get().is_multi_threaded()) {
-        // Merge the local_output_bloom_filter into output_bloom_filter
-        std::lock_guard<std::mutex> lock{output_bloom_filter_mutex};
-        output_bloom_filter |= local_output_bloom_filter;
-      }
     }));
   }
   Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
 
+  merge_bloom_filters(output_bloom_filter, local_bloom_filters);
+  output_bloom_filter.disable_if_ineffective();
+
   return radix_container;
 }
 
@@ -379,8 +412,6 @@ template <typename BuildColumnType, typename HashedType>
 std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<BuildColumnType>& radix_container,
                                                            const JoinHashBuildMode mode, const size_t radix_bits,
                                                            const BloomFilter& input_bloom_filter) {
-  Assert(input_bloom_filter.size() == BLOOM_FILTER_SIZE, "invalid input_bloom_filter");
-
   if (radix_container.empty()) return {};
 
   /*
@@ -422,7 +453,7 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
         DebugAssert(!(element.row_id == NULL_ROW_ID), "No NULL_ROW_IDs should make it to this point");
 
         const Hash hashed_value = hash_function(static_cast<HashedType>(element.value));
-        if (!input_bloom_filter[hashed_value & BLOOM_FILTER_MASK]) {
+        if (!input_bloom_filter.contains(hashed_value)) {
           continue;
         }
 
@@ -451,12 +482,78 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
   return hash_tables;
 }
 
+// Heavy hitters are detected on a sample of (at most) this many materialized elements.
+constexpr auto HEAVY_HITTER_SAMPLE_SIZE = size_t{4'096};
+
+// A value has to occur at least this often in the sample to be a heavy hitter, so that its frequency can be estimated
+// reasonably well.
+constexpr auto HEAVY_HITTER_MIN_SAMPLE_COUNT = size_t{8};
+
+/*
+  Radix partitioning balances the partitions only if no single value makes up a large share of the input. The rows of
+  such a heavy hitter all end up in the same partition, so that a single job has to build or probe a partition that is
+  much larger than the others. To detect heavy hitters, the materialized elements are sampled at regular intervals.
+  Returns the (sorted) hashes of the values that make up at least `min_share` of the sample, each with the estimated
+  number of rows that have this value.
+*/
+template <typename T, typename HashedType>
+std::vector<std::pair<Hash, size_t>> detect_heavy_hitters(const RadixContainer<T>& radix_container,
+                                                          const double min_share) {
+  auto element_count = size_t{0};
+  for (const auto& partition : radix_container) {
+    element_count += partition.elements.size();
+  }
+  if (element_count == 0) return {};
+
+  const std::hash<HashedType> hash_function;
+  const auto sample_interval = std::max(size_t{1}, element_count / HEAVY_HITTER_SAMPLE_SIZE);
+
+  auto sample_counts = std::unordered_map<Hash, size_t>{};
+  auto sample_size = size_t{0};
+
+  // The sample offset is carried over from one partition to the next, so that the sample interval is independent of
+  // the partition sizes.
+  auto sample_offset = size_t{0};
+  for (const auto& partition : radix_container) {
+    const auto& elements = partition.elements;
+    for (; sample_offset < elements.size(); sample_offset += sample_interval) {
+      ++sample_counts[hash_function(static_cast<HashedType>(elements[sample_offset].value))];
+      ++sample_size;
+    }
+    sample_offset -= elements.size();
+  }
+
+  const auto min_sample_count = std::max(HEAVY_HITTER_MIN_SAMPLE_COUNT,
+                                         static_cast<size_t>(std::ceil(min_share * static_cast<double>(sample_size))));
+
+  auto heavy_hitters = std::vector<std::pair<Hash, size_t>>{};
+  for (const auto& [hash, sample_count] : sample_counts) {
+    if (sample_count < min_sample_count) continue;
+
+    const auto share = static_cast<double>(sample_count) / static_cast<double>(sample_size);
+    heavy_hitters.emplace_back(hash, static_cast<size_t>(share * static_cast<double>(element_count)));
+  }
+  std::sort(heavy_hitters.begin(), heavy_hitters.end());
+
+  return heavy_hitters;
+}
+
+// @param heavy_hitters                 Optional: Sorted hashes of heavy hitters (see detect_heavy_hitters()). Their
+//                                      rows are not written to their radix partition, but distributed round-robin to
+//                                      heavy_hitter_partition_count additional partitions that follow the
+//                                      1 << radix_bits radix partitions in the output.
+// @param heavy_hitter_partition_count  Number of partitions for the heavy hitters, required if heavy hitters are given
 template <typename T, typename HashedType, bool keep_null_values>
 RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
                                      std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
-                                     const BloomFilter& input_bloom_filter = ALL_TRUE_BLOOM_FILTER) {
+                                     const BloomFilter& input_bloom_filter = ALL_TRUE_BLOOM_FILTER,
+                                     const std::vector<Hash>& heavy_hitters = {},
+                                     const size_t heavy_hitter_partition_count = 0) {
   if (radix_container.empty()) return radix_container;
 
+  Assert(heavy_hitters.empty() == (heavy_hitter_partition_count == 0),
+         "Heavy hitters require heavy hitter partitions and vice versa");
+
   if constexpr (keep_null_values) {
     Assert(radix_container[0].elements.size() == radix_container[0].null_values.size(),
            "partition_by_radix() called with NULL consideration but radix container does not store any NULL "
@@ -466,7 +563,8 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
   const std::hash<HashedType> hash_function;
 
   const auto input_partition_count = radix_container.size();
-  const auto output_partition_count = size_t{1} << radix_bits;
+  const auto radix_partition_count = size_t{1} << radix_bits;
+  const auto output_partition_count = radix_partition_count + heavy_hitter_partition_count;
 
   // currently, we just do one pass
   const size_t pass = 0;
@@ -476,7 +574,42 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
   auto output = RadixContainer<T>(output_partition_count);
 
   Assert(histograms.size() == input_partition_count, "Expected one histogram per input partition");
-  Assert(histograms[0].size() == output_partition_count, "Expected one histogram bucket per output partition");
+  Assert(histograms[0].size() == radix_partition_count, "Expected one histogram bucket per radix partition");
+
+  const auto is_heavy_hitter = [&](const Hash hash) {
+    return std::binary_search(heavy_hitters.begin(), heavy_hitters.end(), hash);
+  };
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(input_partition_count);
+
+  // The histograms created during materialization count the rows of the heavy hitters for their radix partitions. Move
+  // these rows to the buckets of the heavy hitter partitions.
+  if (heavy_hitter_partition_count > 0) {
+    for (auto input_partition_idx = size_t{0}; input_partition_idx < input_partition_count; ++input_partition_idx) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, input_partition_idx]() {
+        auto& histogram = histograms[input_partition_idx];
+        auto heavy_hitter_row_count = size_t{0};
+        for (const auto& element : radix_container[input_partition_idx].elements) {
+          const auto hash = hash_function(static_cast<HashedType>(element.value));
+          if (is_heavy_hitter(hash)) {
+            --histogram[hash & radix_mask];
+            ++heavy_hitter_row_count;
+          }
+        }
+
+        histogram.resize(output_partition_count);
+        for (auto heavy_hitter_partition_idx = size_t{0}; heavy_hitter_partition_idx < heavy_hitter_partition_count;
+             ++heavy_hitter_partition_idx) {
+          histogram[radix_partition_count + heavy_hitter_partition_idx] =
+              heavy_hitter_row_count / heavy_hitter_partition_count +
+              (heavy_hitter_partition_idx < heavy_hitter_row_count % heavy_hitter_partition_count ? 1 : 0);
+        }
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+    jobs.clear();
+  }
 
   // Writing to std::vector<bool> is not thread-safe if the same byte is being written to. For now, we temporarily
   // use a std::vector<char> and compress it into an std::vector<bool> later.
@@ -500,12 +633,10 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
     }
   }
 
-  std::vector<std::shared_ptr<AbstractTask>> jobs;
-  jobs.reserve(input_partition_count);
-
   for (ChunkID input_partition_idx{0}; input_partition_idx < input_partition_count; ++input_partition_idx) {
     jobs.emplace_back(std::make_shared<JobTask>([&, input_partition_idx]() {
       const auto& input_partition = radix_container[input_partition_idx];
+      auto heavy_hitter_row_idx = size_t{0};
       for (auto input_idx = size_t{0}; input_idx < input_partition.elements.size(); ++input_idx) {
         const auto& element = input_partition.elements[input_idx];
 
@@ -513,7 +644,12 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
           DebugAssert(!(element.row_id == NULL_ROW_ID), "NULL_ROW_ID should not have made it this far");
         }
 
-        const size_t radix = hash_function(static_cast<HashedType>(element.value)) & radix_mask;
+        const auto hash = hash_function(static_cast<HashedType>(element.value));
+        auto radix = hash & radix_mask;
+        if (heavy_hitter_partition_count > 0 && is_heavy_hitter(hash)) {
+          radix = radix_partition_count + heavy_hitter_row_idx % heavy_hitter_partition_count;
+          ++heavy_hitter_row_idx;
+        }
 
         auto& output_idx = output_offsets_by_input_partition[input_partition_idx][radix];
         DebugAssert(output_idx < output[radix].elements.size(), "output_idx is completely out-of-bounds");
@@ -554,6 +690,157 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
   return output;
 }
 
+// Estimates the number of bytes a materialized partition occupies in memory, including the characters of strings that
+// do not fit into the string object itself.
+template <typename T>
+size_t estimate_memory_usage(const Partition<T>& partition) {
+  auto memory_usage = partition.elements.size() * sizeof(PartitionedElement<T>) + partition.null_values.size() / 8;
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    for (const auto& element : partition.elements) {
+      if (element.value.capacity() > sizeof(pmr_string)) memory_usage += element.value.capacity();
+    }
+  }
+  return memory_usage;
+}
+
+// Writes the partition to the file and frees its memory. Returns the number of bytes written.
+template <typename T>
+size_t spill_partition(Partition<T>& partition, const SpillFile& file) {
+  auto stream = std::ofstream{file.path(), std::ios::binary | std::ios::trunc};
+  Assert(stream.is_open(), "Could not open spill file " + file.path());
+
+  const auto write_value = [&](const auto& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+  };
+
+  write_value(partition.elements.size());
+  write_value(partition.null_values.size());
+
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    for (const auto& element : partition.elements) {
+      write_value(element.row_id);
+      write_value(element.value.size());
+      stream.write(element.value.data(), static_cast<std::streamsize>(element.value.size()));
+    }
+  } else {
+    static_assert(std::is_trivially_copyable_v<PartitionedElement<T>>, "Elements cannot be written as raw bytes");
+    stream.write(reinterpret_cast<const char*>(partition.elements.data()),
+                 static_cast<std::streamsize>(partition.elements.size() * sizeof(PartitionedElement<T>)));
+  }
+
+  // std::vector<bool> does not expose its storage, so the NULL flags are written as one byte each.
+  const auto null_values_as_char = std::vector<char>(partition.null_values.cbegin(), partition.null_values.cend());
+  stream.write(null_values_as_char.data(), static_cast<std::streamsize>(null_values_as_char.size()));
+
+  Assert(stream.good(), "Could not write spill file " + file.path());
+  const auto spilled_bytes = static_cast<size_t>(stream.tellp());
+
+  partition = Partition<T>();
+  return spilled_bytes;
+}
+
+// Reads a partition that has been written by spill_partition().
+template <typename T>
+Partition<T> load_spilled_partition(const SpillFile& file) {
+  auto stream = std::ifstream{file.path(), std::ios::binary};
+  Assert(stream.is_open(), "Could not open spill file " + file.path());
+
+  const auto read_value = [&](auto& value) { stream.read(reinterpret_cast<char*>(&value), sizeof(value)); };
+
+  auto element_count = size_t{0};
+  auto null_value_count = size_t{0};
+  read_value(element_count);
+  read_value(null_value_count);
+
+  auto partition = Partition<T>();
+  partition.elements.resize(element_count);
+
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    for (auto& element : partition.elements) {
+      auto value_size = size_t{0};
+      read_value(element.row_id);
+      read_value(value_size);
+      element.value.resize(value_size);
+      stream.read(element.value.data(), static_cast<std::streamsize>(value_size));
+    }
+  } else {
+    stream.read(reinterpret_cast<char*>(partition.elements.data()),
+                static_cast<std::streamsize>(element_count * sizeof(PartitionedElement<T>)));
+  }
+
+  auto null_values_as_char = std::vector<char>(null_value_count);
+  stream.read(null_values_as_char.data(), static_cast<std::streamsize>(null_value_count));
+  partition.null_values = std::vector<bool>(null_values_as_char.cbegin(), null_values_as_char.cend());
+
+  Assert(stream.good(), "Could not read spill file " + file.path());
+  return partition;
+}
+
+// The build and probe side of a radix partition that has been written to disk by spill_partitions().
+struct SpilledPartition {
+  size_t partition_idx;
+
+  // Estimated memory usage of both sides and the hash table once the partition is loaded again
+  size_t memory_usage;
+
+  size_t spilled_bytes;
+  std::unique_ptr<SpillFile> build_side_file;
+  std::unique_ptr<SpillFile> probe_side_file;
+};
+
+/*
+  Spilling (Grace hash join): If the radix partitions of both sides, together with the hash tables that are built from
+  them, exceed the memory budget, partitions are written to temporary files until the remaining ones fit into the
+  budget. Each spilled partition is cleared on both sides, so that build() and probe() skip it. The spilled partitions
+  can then be loaded and joined in batches that fit into the budget once the in-memory partitions have been processed.
+
+  As partitions are not repartitioned recursively, a single partition that exceeds the budget is still processed in
+  memory. The same holds for the partitions of heavy hitters (see detect_heavy_hitters()), which are never spilled.
+*/
+template <typename BuildColumnType, typename ProbeColumnType, typename HashedType>
+std::vector<SpilledPartition> spill_partitions(RadixContainer<BuildColumnType>& build_radix_container,
+                                               RadixContainer<ProbeColumnType>& probe_radix_container,
+                                               const size_t memory_budget) {
+  Assert(build_radix_container.size() == probe_radix_container.size(),
+         "Spilling requires radix partitioned build and probe sides");
+
+  auto spilled_partitions = std::vector<SpilledPartition>{};
+
+  // Partitions are kept in memory as long as they fit into the budget, all others are spilled.
+  auto in_memory_usage = size_t{0};
+  for (auto partition_idx = size_t{0}; partition_idx < build_radix_container.size(); ++partition_idx) {
+    const auto& build_partition = build_radix_container[partition_idx];
+    const auto& probe_partition = probe_radix_container[partition_idx];
+    if (build_partition.elements.empty() && probe_partition.elements.empty()) continue;
+
+    const auto memory_usage = estimate_memory_usage(build_partition) + estimate_memory_usage(probe_partition) +
+                              PosHashTable<HashedType>::estimate_memory_usage(build_partition.elements.size());
+    if (in_memory_usage + memory_usage <= memory_budget) {
+      in_memory_usage += memory_usage;
+      continue;
+    }
+
+    spilled_partitions.emplace_back(SpilledPartition{partition_idx, memory_usage, 0,
+                                                     std::make_unique<SpillFile>("hyrise_join_hash"),
+                                                     std::make_unique<SpillFile>("hyrise_join_hash")});
+  }
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(spilled_partitions.size());
+  for (auto spilled_partition_idx = size_t{0}; spilled_partition_idx < spilled_partitions.size();
+       ++spilled_partition_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, spilled_partition_idx]() {
+      auto& spilled_partition = spilled_partitions[spilled_partition_idx];
+      spilled_partition.spilled_bytes =
+          spill_partition(build_radix_container[spilled_partition.partition_idx], *spilled_partition.build_side_file) +
+          spill_partition(probe_radix_container[spilled_partition.partition_idx], *spilled_partition.probe_side_file);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  return spilled_partitions;
+}
+
 /*
   In the probe phase we take all partitions from the probe partition, iterate over them and compare each join candidate
   with the values in the hash table. Since build and probe are hashed using the same hash function, we can reduce the
@@ -612,6 +899,44 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
         pos_list_build_side_local.reserve(static_cast<size_t>(expected_output_size));
         pos_list_probe_side_local.reserve(static_cast<size_t>(expected_output_size));
 
+        // The candidates for the secondary predicates, i.e., the pairs that satisfy the primary predicate, are
+        // collected for several probe rows and evaluated in batches. For the i-th probe row of the batch, its
+        // candidates end at candidate_ends[i].
+        auto batch_probe_row_ids = std::vector<RowID>{};
+        auto candidate_ends = std::vector<size_t>{};
+        auto candidate_build_row_ids = std::vector<RowID>{};
+        auto candidate_probe_row_ids = std::vector<RowID>{};
+        auto candidate_matches = std::vector<bool>{};
+
+        const auto evaluate_candidates = [&]() {
+          multi_predicate_join_evaluator->satisfies_all_predicates(candidate_build_row_ids, candidate_probe_row_ids,
+                                                                   candidate_matches);
+
+          auto candidate_idx = size_t{0};
+          for (auto batch_row_idx = size_t{0}; batch_row_idx < batch_probe_row_ids.size(); ++batch_row_idx) {
+            auto match_found = false;
+            for (; candidate_idx < candidate_ends[batch_row_idx]; ++candidate_idx) {
+              if (!candidate_matches[candidate_idx]) continue;
+              pos_list_build_side_local.emplace_back(candidate_build_row_ids[candidate_idx]);
+              pos_list_probe_side_local.emplace_back(batch_probe_row_ids[batch_row_idx]);
+              match_found = true;
+            }
+
+            // We have not found matching items for all predicates.
+            if constexpr (keep_null_values) {
+              if (!match_found) {
+                pos_list_build_side_local.emplace_back(NULL_ROW_ID);
+                pos_list_probe_side_local.emplace_back(batch_probe_row_ids[batch_row_idx]);
+              }
+            }
+          }
+
+          batch_probe_row_ids.clear();
+          candidate_ends.clear();
+          candidate_build_row_ids.clear();
+          candidate_probe_row_ids.clear();
+        };
+
         for (auto partition_offset = size_t{0}; partition_offset < elements.size(); ++partition_offset) {
           const auto& probe_column_element = elements[partition_offset];
 
@@ -650,22 +975,14 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
                 pos_list_probe_side_local.emplace_back(probe_column_element.row_id);
               }
             } else {
-              auto match_found = false;
+              batch_probe_row_ids.emplace_back(probe_column_element.row_id);
               for (const auto& row_id : *primary_predicate_matching_rows) {
-                if (multi_predicate_join_evaluator->satisfies_all_predicates(row_id, probe_column_element.row_id)) {
-                  pos_list_build_side_local.emplace_back(row_id);
-                  pos_list_probe_side_local.emplace_back(probe_column_element.row_id);
-                  match_found = true;
-                }
+                candidate_build_row_ids.emplace_back(row_id);
+                candidate_probe_row_ids.emplace_back(probe_column_element.row_id);
               }
+              candidate_ends.emplace_back(candidate_build_row_ids.size());
 
-              // We have not found matching items for all predicates.
-              if constexpr (keep_null_values) {
-                if (!match_found) {
-                  pos_list_build_side_local.emplace_back(NULL_ROW_ID);
-                  pos_list_probe_side_local.emplace_back(probe_column_element.row_id);
-                }
-              }
+              if (candidate_build_row_ids.size() >= MultiPredicateJoinEvaluator::BATCH_SIZE) evaluate_candidates();
             }
 
           } else {
@@ -679,6 +996,8 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
             }
           }
         }
+
+        if (!batch_probe_row_ids.empty()) evaluate_candidates();
       } else {
         // When there is no hash table, we might still need to handle the values of the probe side for LEFT
         // and RIGHT joins. We use constexpr to prune this conditional for the equi-join implementation.
@@ -738,6 +1057,34 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& probe_radix_containe
         MultiPredicateJoinEvaluator multi_predicate_join_evaluator(build_table, probe_table, mode,
                                                                    secondary_join_predicates);
 
+        // As in probe(), the candidates for the secondary predicates are evaluated in batches. A probe row is emitted
+        // if any (Semi) or none (Anti*) of its candidates satisfies all secondary predicates.
+        auto batch_probe_row_ids = std::vector<RowID>{};
+        auto candidate_ends = std::vector<size_t>{};
+        auto candidate_build_row_ids = std::vector<RowID>{};
+        auto candidate_probe_row_ids = std::vector<RowID>{};
+        auto candidate_matches = std::vector<bool>{};
+
+        const auto evaluate_candidates = [&]() {
+          multi_predicate_join_evaluator.satisfies_all_predicates(candidate_build_row_ids, candidate_probe_row_ids,
+                                                                  candidate_matches);
+
+          auto candidate_begin = size_t{0};
+          for (auto batch_row_idx = size_t{0}; batch_row_idx < batch_probe_row_ids.size(); ++batch_row_idx) {
+            const auto candidate_end = candidate_ends[batch_row_idx];
+            const auto any_match = std::find(candidate_matches.cbegin() + candidate_begin,
+                                             candidate_matches.cbegin() + candidate_end,
+                                             true) != candidate_matches.cbegin() + candidate_end;
+            if (any_match == (mode == JoinMode::Semi)) pos_list_local.emplace_back(batch_probe_row_ids[batch_row_idx]);
+            candidate_begin = candidate_end;
+          }
+
+          batch_probe_row_ids.clear();
+          candidate_ends.clear();
+          candidate_build_row_ids.clear();
+          candidate_probe_row_ids.clear();
+        };
+
         for (auto partition_offset = size_t{0}; partition_offset < elements.size(); ++partition_offset) {
           const auto& probe_column_element = elements[partition_offset];
 
@@ -771,12 +1118,16 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& probe_radix_containe
                 hash_table.find(static_cast<HashedType>(probe_column_element.value));
 
             if (primary_predicate_matching_rows != hash_table.end()) {
+              // The probe row is emitted (or not) once its candidates have been evaluated
+              batch_probe_row_ids.emplace_back(probe_column_element.row_id);
               for (const auto& row_id : *primary_predicate_matching_rows) {
-                if (multi_predicate_join_evaluator.satisfies_all_predicates(row_id, probe_column_element.row_id)) {
-                  any_build_column_value_matches = true;
-                  break;
-                }
+                candidate_build_row_ids.emplace_back(row_id);
+                candidate_probe_row_ids.emplace_back(probe_column_element.row_id);
               }
+              candidate_ends.emplace_back(candidate_build_row_ids.size());
+
+              if (candidate_build_row_ids.size() >= MultiPredicateJoinEvaluator::BATCH_SIZE) evaluate_candidates();
+              continue;
             }
           }
 
@@ -786,6 +1137,8 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& probe_radix_containe
             pos_list_local.emplace_back(probe_column_element.row_id);
           }
         }
+
+        if (!batch_probe_row_ids.empty()) evaluate_candidates();
       } else if constexpr (mode == JoinMode::AntiNullAsFalse) {  // NOLINT - doesn't like `else if`
         // no hash table on other side, but we are in AntiNullAsFalse mode which means all tuples from the probing side
         // get emitted.
@@ -5,22 +5,42 @@
 #include <numeric>
 #include <set>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <magic_enum.hpp>
 
 #include "all_type_variant.hpp"
+#include "get_table.hpp"
+#include "hyrise.hpp"
 #include "join_nested_loop.hpp"
 #include "multi_predicate_join/multi_predicate_join_evaluator.hpp"
 #include "resolve_type.hpp"
 #include "storage/index/abstract_index.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
 #include "utils/timer.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Number of probe side values that are looked up in the index at once
+constexpr auto LOOKUP_BATCH_SIZE = size_t{32};
+
+// The iterators of chunk indexes point to ChunkOffsets in the index chunk, those of a TableIndex to RowIDs
+RowID index_row_id(const ChunkOffset index_chunk_offset, const ChunkID index_chunk_id) {
+  return RowID{index_chunk_id, index_chunk_offset};
+}
+
+RowID index_row_id(const RowID& row_id, const ChunkID /*index_chunk_id*/) { return row_id; }
+
+}  // namespace
+
 namespace opossum {
 
 /*
@@ -202,9 +222,28 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
       }
     }
   } else {  // DATA JOIN since only inner joins are supported for a reference table on the index side
-    // Scan all chunks for index input
+    // Join the chunks covered by a TableIndex at once. As the TableIndex is looked up with the typed values of the
+    // probe side, the data types of the join columns have to match.
+    auto first_chunk_without_table_index = ChunkID{0};
+    const auto& index_column_id = _adjusted_primary_predicate.column_ids.second;
+    const auto [table_index, table_index_chunk_count] = _resolve_table_index();
+    const auto index_data_type = _index_input_table->column_data_type(index_column_id);
+    if (table_index &&
+        index_data_type == _probe_input_table->column_data_type(_adjusted_primary_predicate.column_ids.first)) {
+      resolve_data_type(index_data_type, [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        _data_join_using_table_index(static_cast<const TableIndex<ColumnDataType>&>(*table_index));
+      });
+      first_chunk_without_table_index = table_index_chunk_count;
+      index_joining_duration += timer.lap();
+      join_index_performance_data.chunks_scanned_with_index += first_chunk_without_table_index;
+      join_index_performance_data.table_index_used = true;
+    }
+
+    // Scan all remaining chunks for index input
     const auto chunk_count_index_input_table = _index_input_table->chunk_count();
-    for (ChunkID index_chunk_id{0}; index_chunk_id < chunk_count_index_input_table; ++index_chunk_id) {
+    for (auto index_chunk_id = first_chunk_without_table_index; index_chunk_id < chunk_count_index_input_table;
+         ++index_chunk_id) {
       const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
       Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
@@ -224,7 +263,7 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
 
           const auto& probe_segment = chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
           segment_with_iterators(*probe_segment, [&](auto probe_iter, const auto probe_end) {
-            _data_join_two_segments_using_index(probe_iter, probe_end, probe_chunk_id, index_chunk_id, index);
+            _data_join_two_segments_using_index(probe_iter, probe_end, probe_chunk_id, index_chunk_id, *index);
           });
         }
         index_joining_duration += timer.lap();
@@ -311,12 +350,110 @@ void JoinIndex::_fallback_nested_loop(const ChunkID index_chunk_id, const bool t
   join_index_performance_data.chunks_scanned_without_index++;
 }
 
+std::pair<std::shared_ptr<const BaseTableIndex>, ChunkID> JoinIndex::_resolve_table_index() {
+  _table_index_chunk_ids.clear();
+  const auto index_column_id = _adjusted_primary_predicate.column_ids.second;
+
+  // TableIndexes are created on stored tables. GetTable outputs a new table without them, which might also lack some
+  // of the chunks and columns of the stored table. Thus, the index is looked up through the stored table.
+  auto indexed_table = _index_input_table;
+  auto indexed_column_id = index_column_id;
+  const auto& index_input_operator = _index_side == IndexSide::Left ? left_input() : right_input();
+  if (const auto get_table = std::dynamic_pointer_cast<const GetTable>(index_input_operator)) {
+    indexed_table = Hyrise::get().storage_manager.get_table(get_table->table_name());
+    for (const auto pruned_column_id : get_table->pruned_column_ids()) {
+      if (pruned_column_id > indexed_column_id) break;
+      ++indexed_column_id;
+    }
+  }
+
+  const auto table_index = indexed_table->table_index(indexed_column_id);
+  if (!table_index) return {nullptr, ChunkID{0}};
+
+  // The RowIDs of the index refer to the chunks of the indexed table. Map these chunks to the chunks of the index input
+  // table. As GetTable forwards the segments of the stored chunks in their original order, the chunks are matched by
+  // their join segments. Indexed chunks that are not part of the index input table (e.g., because they were pruned,
+  // excluded by GetTable, or physically deleted) are mapped to INVALID_CHUNK_ID, so that their rows are skipped.
+  const auto indexed_chunk_count = table_index->indexed_chunk_count();
+  const auto input_chunk_count = _index_input_table->chunk_count();
+  _table_index_chunk_ids.resize(indexed_chunk_count, INVALID_CHUNK_ID);
+  auto input_chunk_id = ChunkID{0};
+  for (auto indexed_chunk_id = ChunkID{0}; indexed_chunk_id < indexed_chunk_count && input_chunk_id < input_chunk_count;
+       ++indexed_chunk_id) {
+    const auto indexed_chunk = indexed_table->get_chunk(indexed_chunk_id);
+    if (!indexed_chunk) continue;
+
+    const auto input_chunk = _index_input_table->get_chunk(input_chunk_id);
+    Assert(input_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+    if (indexed_chunk->get_segment(indexed_column_id) != input_chunk->get_segment(index_column_id)) continue;
+
+    _table_index_chunk_ids[indexed_chunk_id] = input_chunk_id;
+    ++input_chunk_id;
+  }
+
+  // If all indexed chunks are part of the index input table, the RowIDs of the index can be used as they are
+  if (input_chunk_id == indexed_chunk_count) _table_index_chunk_ids.clear();
+
+  // The index covers the input chunks [0, input_chunk_id). The remaining chunks are joined using their chunk indexes.
+  return {table_index, input_chunk_id};
+}
+
+template <typename ColumnDataType>
+void JoinIndex::_data_join_using_table_index(const TableIndex<ColumnDataType>& table_index) {
+  const auto chunk_count_probe_input_table = _probe_input_table->chunk_count();
+  for (ChunkID probe_chunk_id{0}; probe_chunk_id < chunk_count_probe_input_table; ++probe_chunk_id) {
+    const auto chunk = _probe_input_table->get_chunk(probe_chunk_id);
+    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+    const auto& probe_segment = chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
+    segment_with_iterators<ColumnDataType>(*probe_segment, [&](auto probe_iter, const auto probe_end) {
+      _data_join_two_segments_using_index(probe_iter, probe_end, probe_chunk_id, INVALID_CHUNK_ID, table_index);
+    });
+  }
+}
+
 // join loop that joins two segments of two columns using an iterator for the probe side,
 // and an index for the index side
-template <typename ProbeIterator>
+template <typename ProbeIterator, typename Index>
 void JoinIndex::_data_join_two_segments_using_index(ProbeIterator probe_iter, ProbeIterator probe_end,
                                                     const ChunkID probe_chunk_id, const ChunkID index_chunk_id,
-                                                    const std::shared_ptr<AbstractIndex>& index) {
+                                                    const Index& index) {
+  // Equality lookups are batched, so that the index can interleave them. AntiNullAsTrue joins need the NULL handling
+  // of _index_ranges_for_value().
+  if (_adjusted_primary_predicate.predicate_condition == PredicateCondition::Equals &&
+      _mode != JoinMode::AntiNullAsTrue) {
+    // Chunk indexes are looked up with AllTypeVariants, a TableIndex with values of its data type
+    using ProbeValue = std::decay_t<decltype((*probe_iter).value())>;
+    using LookupValue = std::conditional_t<std::is_same_v<Index, AbstractIndex>, AllTypeVariant, ProbeValue>;
+
+    auto lookup_values = std::vector<LookupValue>{};
+    auto lookup_chunk_offsets = std::vector<ChunkOffset>{};
+    auto index_ranges = std::vector<std::pair<typename Index::Iterator, typename Index::Iterator>>{};
+    lookup_values.reserve(LOOKUP_BATCH_SIZE);
+    lookup_chunk_offsets.reserve(LOOKUP_BATCH_SIZE);
+
+    const auto lookup_batch = [&]() {
+      index.equal_ranges(lookup_values, index_ranges);
+      for (auto lookup_idx = size_t{0}; lookup_idx < lookup_values.size(); ++lookup_idx) {
+        const auto& [index_begin, index_end] = index_ranges[lookup_idx];
+        _append_matches(index_begin, index_end, lookup_chunk_offsets[lookup_idx], probe_chunk_id, index_chunk_id);
+      }
+      lookup_values.clear();
+      lookup_chunk_offsets.clear();
+    };
+
+    for (; probe_iter != probe_end; ++probe_iter) {
+      const auto probe_side_position = *probe_iter;
+      if (probe_side_position.is_null()) continue;
+
+      lookup_values.emplace_back(probe_side_position.value());
+      lookup_chunk_offsets.emplace_back(probe_side_position.chunk_offset());
+      if (lookup_values.size() == LOOKUP_BATCH_SIZE) lookup_batch();
+    }
+    if (!lookup_values.empty()) lookup_batch();
+    return;
+  }
+
   for (; probe_iter != probe_end; ++probe_iter) {
     const auto probe_side_position = *probe_iter;
     const auto index_ranges = _index_ranges_for_value(probe_side_position, index);
@@ -334,7 +471,7 @@ void JoinIndex::_reference_join_two_segments_using_index(
   for (; probe_iter != probe_end; ++probe_iter) {
     RowIDPosList index_scan_pos_list;
     const auto probe_side_position = *probe_iter;
-    const auto index_ranges = _index_ranges_for_value(probe_side_position, index);
+    const auto index_ranges = _index_ranges_for_value(probe_side_position, *index);
     for (const auto& [index_begin, index_end] : index_ranges) {
       std::transform(index_begin, index_end, std::back_inserter(index_scan_pos_list),
                      [index_chunk_id](ChunkOffset index_chunk_offset) {
@@ -354,77 +491,110 @@ void JoinIndex::_reference_join_two_segments_using_index(
   }
 }
 
-template <typename SegmentPosition>
-std::vector<IndexRange> JoinIndex::_index_ranges_for_value(const SegmentPosition probe_side_position,
-                                                           const std::shared_ptr<AbstractIndex>& index) const {
-  std::vector<IndexRange> index_ranges{};
+template <typename SegmentPosition, typename Index>
+std::vector<std::pair<typename Index::Iterator, typename Index::Iterator>> JoinIndex::_index_ranges_for_value(
+    const SegmentPosition probe_side_position, const Index& index) const {
+  using IndexIterator = typename Index::Iterator;
+  std::vector<std::pair<IndexIterator, IndexIterator>> index_ranges{};
   index_ranges.reserve(2);
 
   // AntiNullAsTrue is the only join mode in which comparisons with null-values are evaluated as "true".
   // If the probe side value is null or at least one null value exists in the indexed join segment, the probe value
   // has a match.
   if (_mode == JoinMode::AntiNullAsTrue) {
-    const auto indexed_null_values = index->null_cbegin() != index->null_cend();
+    const auto indexed_null_values = index.null_cbegin() != index.null_cend();
     if (probe_side_position.is_null() || indexed_null_values) {
-      index_ranges.emplace_back(IndexRange{index->cbegin(), index->cend()});
-      index_ranges.emplace_back(IndexRange{index->null_cbegin(), index->null_cend()});
+      index_ranges.emplace_back(index.cbegin(), index.cend());
+      index_ranges.emplace_back(index.null_cbegin(), index.null_cend());
       return index_ranges;
     }
   }
 
+  // Chunk indexes are looked up with a vector of AllTypeVariants, a TableIndex with a value of its data type
+  const auto lookup_value = [&]() {
+    if constexpr (std::is_same_v<Index, AbstractIndex>) {
+      return std::vector<AllTypeVariant>{probe_side_position.value()};
+    } else {
+      return probe_side_position.value();
+    }
+  };
+
   if (!probe_side_position.is_null()) {
-    auto range_begin = AbstractIndex::Iterator{};
-    auto range_end = AbstractIndex::Iterator{};
+    auto range_begin = IndexIterator{};
+    auto range_end = IndexIterator{};
 
     switch (_adjusted_primary_predicate.predicate_condition) {
       case PredicateCondition::Equals: {
-        range_begin = index->lower_bound({probe_side_position.value()});
-        range_end = index->upper_bound({probe_side_position.value()});
+        range_begin = index.lower_bound(lookup_value());
+        range_end = index.upper_bound(lookup_value());
         break;
       }
       case PredicateCondition::NotEquals: {
         // first, get all values less than the search value
-        range_begin = index->cbegin();
-        range_end = index->lower_bound({probe_side_position.value()});
-        index_ranges.emplace_back(IndexRange{range_begin, range_end});
+        range_begin = index.cbegin();
+        range_end = index.lower_bound(lookup_value());
+        index_ranges.emplace_back(range_begin, range_end);
 
         // set range for second half to all values greater than the search value
-        range_begin = index->upper_bound({probe_side_position.value()});
-        range_end = index->cend();
+        range_begin = index.upper_bound(lookup_value());
+        range_end = index.cend();
         break;
       }
       case PredicateCondition::GreaterThan: {
-        range_begin = index->cbegin();
-        range_end = index->lower_bound({probe_side_position.value()});
+        range_begin = index.cbegin();
+        range_end = index.lower_bound(lookup_value());
         break;
       }
       case PredicateCondition::GreaterThanEquals: {
-        range_begin = index->cbegin();
-        range_end = index->upper_bound({probe_side_position.value()});
+        range_begin = index.cbegin();
+        range_end = index.upper_bound(lookup_value());
         break;
       }
       case PredicateCondition::LessThan: {
-        range_begin = index->upper_bound({probe_side_position.value()});
-        range_end = index->cend();
+        range_begin = index.upper_bound(lookup_value());
+        range_end = index.cend();
         break;
       }
       case PredicateCondition::LessThanEquals: {
-        range_begin = index->lower_bound({probe_side_position.value()});
-        range_end = index->cend();
+        range_begin = index.lower_bound(lookup_value());
+        range_end = index.cend();
         break;
       }
       default: {
         Fail("Unsupported comparison type encountered");
       }
     }
-    index_ranges.emplace_back(IndexRange{range_begin, range_end});
+    index_ranges.emplace_back(range_begin, range_end);
   }
   return index_ranges;
 }
 
-void JoinIndex::_append_matches(const AbstractIndex::Iterator& range_begin, const AbstractIndex::Iterator& range_end,
+template <typename IndexIterator>
+void JoinIndex::_append_matches(const IndexIterator& range_begin, const IndexIterator& range_end,
                                 const ChunkOffset probe_chunk_offset, const ChunkID probe_chunk_id,
                                 const ChunkID index_chunk_id) {
+  // The RowIDs of a TableIndex have to be mapped to the chunks of the index input table (see _resolve_table_index())
+  if constexpr (std::is_same_v<IndexIterator, BaseTableIndex::Iterator>) {
+    if (!_table_index_chunk_ids.empty()) {
+      _mapped_table_index_row_ids.clear();
+      for (auto index_iter = range_begin; index_iter != range_end; ++index_iter) {
+        const auto chunk_id = _table_index_chunk_ids[index_iter->chunk_id];
+        if (chunk_id == INVALID_CHUNK_ID) continue;
+        _mapped_table_index_row_ids.emplace_back(RowID{chunk_id, index_iter->chunk_offset});
+      }
+      _append_mapped_matches(_mapped_table_index_row_ids.cbegin(), _mapped_table_index_row_ids.cend(),
+                             probe_chunk_offset, probe_chunk_id, index_chunk_id);
+      return;
+    }
+  }
+
+  _append_mapped_matches(range_begin, range_end, probe_chunk_offset, probe_chunk_id, index_chunk_id);
+}
+
+template <typename IndexIterator>
+void JoinIndex::_append_mapped_matches(const IndexIterator& range_begin, const IndexIterator& range_end,
+                                       const ChunkOffset probe_chunk_offset, const ChunkID probe_chunk_id,
+                                       const ChunkID index_chunk_id) {
   const auto num_index_matches = std::distance(range_begin, range_end);
 
   if (num_index_matches == 0) {
@@ -444,17 +614,17 @@ void JoinIndex::_append_matches(const AbstractIndex::Iterator& range_begin, cons
     // we replicate the probe side value for each index side value
     std::fill_n(std::back_inserter(*_probe_pos_list), num_index_matches, RowID{probe_chunk_id, probe_chunk_offset});
 
-    std::transform(range_begin, range_end, std::back_inserter(*_index_pos_list),
-                   [index_chunk_id](ChunkOffset index_chunk_offset) {
-                     return RowID{index_chunk_id, index_chunk_offset};
-                   });
+    std::transform(
+        range_begin, range_end, std::back_inserter(*_index_pos_list),
+        [index_chunk_id](const auto index_position) { return index_row_id(index_position, index_chunk_id); });
   }
 
   if ((_mode == JoinMode::Left && _index_side == IndexSide::Left) ||
       (_mode == JoinMode::Right && _index_side == IndexSide::Right) || _mode == JoinMode::FullOuter ||
       (is_semi_or_anti_join && _index_side == IndexSide::Left)) {
-    std::for_each(range_begin, range_end, [this, index_chunk_id](ChunkOffset index_chunk_offset) {
-      _index_matches[index_chunk_id][index_chunk_offset] = true;
+    std::for_each(range_begin, range_end, [this, index_chunk_id](const auto index_position) {
+      const auto row_id = index_row_id(index_position, index_chunk_id);
+      _index_matches[row_id.chunk_id][row_id.chunk_offset] = true;
     });
   }
 }
@@ -600,6 +770,8 @@ void JoinIndex::_on_cleanup() {
   _index_pos_list.reset();
   _probe_matches.clear();
   _index_matches.clear();
+  _table_index_chunk_ids.clear();
+  _mapped_table_index_row_ids.clear();
 }
 
 void JoinIndex::PerformanceData::output_to_stream(std::ostream& stream, DescriptionMode description_mode) const {
@@ -607,7 +779,8 @@ void JoinIndex::PerformanceData::output_to_stream(std::ostream& stream, Descript
 
   const auto chunk_count = chunks_scanned_with_index + chunks_scanned_without_index;
   stream << (description_mode == DescriptionMode::SingleLine ? " " : "\n") << "Indexes used for "
-         << chunks_scanned_with_index << " of " << chunk_count << " chunk" << (chunk_count > 1 ? "s" : "") << ".";
+         << chunks_scanned_with_index << " of " << chunk_count << " chunk" << (chunk_count > 1 ? "s" : "")
+         << (table_index_used ? " (using a table index)" : "") << ".";
 }
 
 }  // namespace opossum
@@ -13,7 +13,10 @@
 
 namespace opossum {
 
+class BaseTableIndex;
 class MultiPredicateJoinEvaluator;
+template <typename T>
+class TableIndex;
 using IndexRange = std::pair<AbstractIndex::Iterator, AbstractIndex::Iterator>;
 
 /**
@@ -27,6 +30,12 @@ using IndexRange = std::pair<AbstractIndex::Iterator, AbstractIndex::Iterator>;
    * scanned with index in the performance data.
    *
    * Note: An index needs to be present on the index side table in order to execute an index join.
+   *
+   * If the index side is a data table with a TableIndex on the join column (see Table::create_table_index()), the
+   * probe side is joined with all chunks covered by that index at once. Only the remaining chunks are joined one by
+   * one using their chunk indexes. If the index side is a GetTable, the TableIndex of the stored table is used and its
+   * RowIDs are mapped to the chunks that GetTable outputs. For equi joins, the values of the probe side are looked up
+   * in batches (see AbstractIndex::equal_ranges() and TableIndex::equal_ranges()).
    */
 class JoinIndex : public AbstractJoinOperator {
  public:
@@ -46,6 +55,7 @@ class JoinIndex : public AbstractJoinOperator {
 
     size_t chunks_scanned_with_index{0};
     size_t chunks_scanned_without_index{0};
+    bool table_index_used{false};
   };
 
   std::string description(DescriptionMode description_mode) const override;
@@ -61,10 +71,18 @@ class JoinIndex : public AbstractJoinOperator {
                              const bool track_index_matches, const bool is_semi_or_anti_join,
                              MultiPredicateJoinEvaluator& secondary_predicate_evaluator);
 
-  template <typename ProbeIterator>
+  // Returns the TableIndex on the index side join column (if any) and the number of index input chunks it covers. Fills
+  // _table_index_chunk_ids.
+  std::pair<std::shared_ptr<const BaseTableIndex>, ChunkID> _resolve_table_index();
+
+  template <typename ColumnDataType>
+  void _data_join_using_table_index(const TableIndex<ColumnDataType>& table_index);
+
+  // Index is either an AbstractIndex on the chunk `index_chunk_id` or a TableIndex
+  template <typename ProbeIterator, typename Index>
   void _data_join_two_segments_using_index(ProbeIterator probe_iter, ProbeIterator probe_end,
                                            const ChunkID probe_chunk_id, const ChunkID index_chunk_id,
-                                           const std::shared_ptr<AbstractIndex>& index);
+                                           const Index& index);
 
   template <typename ProbeIterator>
   void _reference_join_two_segments_using_index(
@@ -72,14 +90,21 @@ class JoinIndex : public AbstractJoinOperator {
       const std::shared_ptr<AbstractIndex>& index,
       const std::shared_ptr<const AbstractPosList>& reference_segment_pos_list);
 
-  template <typename SegmentPosition>
-  std::vector<IndexRange> _index_ranges_for_value(const SegmentPosition probe_side_position,
-                                                  const std::shared_ptr<AbstractIndex>& index) const;
+  template <typename SegmentPosition, typename Index>
+  std::vector<std::pair<typename Index::Iterator, typename Index::Iterator>> _index_ranges_for_value(
+      const SegmentPosition probe_side_position, const Index& index) const;
 
-  void _append_matches(const AbstractIndex::Iterator& range_begin, const AbstractIndex::Iterator& range_end,
+  // The iterators of a chunk index point to ChunkOffsets in the chunk `index_chunk_id`, those of a TableIndex to RowIDs
+  template <typename IndexIterator>
+  void _append_matches(const IndexIterator& range_begin, const IndexIterator& range_end,
                        const ChunkOffset probe_chunk_offset, const ChunkID probe_chunk_id,
                        const ChunkID index_chunk_id);
 
+  template <typename IndexIterator>
+  void _append_mapped_matches(const IndexIterator& range_begin, const IndexIterator& range_end,
+                              const ChunkOffset probe_chunk_offset, const ChunkID probe_chunk_id,
+                              const ChunkID index_chunk_id);
+
   void _append_matches_dereferenced(const ChunkID& probe_chunk_id, const ChunkOffset& probe_chunk_offset,
                                     const RowIDPosList& index_table_matches);
 
@@ -105,6 +130,11 @@ class JoinIndex : public AbstractJoinOperator {
   // The outer vector enumerates chunks, the inner enumerates chunk_offsets
   std::vector<std::vector<bool>> _probe_matches;
   std::vector<std::vector<bool>> _index_matches;
+
+  // Maps the ChunkIDs of the indexed table to those of the index input table if they differ (see
+  // _resolve_table_index()). _mapped_table_index_row_ids is reused for the mapped RowIDs of each lookup.
+  std::vector<ChunkID> _table_index_chunk_ids;
+  std::vector<RowID> _mapped_table_index_row_ids;
 };
 
 }  // namespace opossum
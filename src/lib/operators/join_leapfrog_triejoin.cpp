@@ -0,0 +1,540 @@
+#include "join_leapfrog_triejoin.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "join_hash/join_hash_steps.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+using Code = uint32_t;
+constexpr auto NULL_CODE = std::numeric_limits<Code>::max();
+
+// The code range of the first variable is split into at most this many jobs
+constexpr auto MAX_JOB_COUNT = size_t{64};
+
+using InputColumn = JoinLeapfrogTriejoin::InputColumn;
+
+/**
+ * An input materialized as rows of codes, one code per variable the input participates in, in the order of the
+ * variables. The codes of row i are stored at codes[i * width] to codes[(i + 1) * width]. After sorting, the rows form
+ * a trie over the codes. As in JoinHash, the RowIDs refer to the chunks and offsets within the input table, not to the
+ * positions in a referenced table.
+ */
+struct TrieInput {
+  size_t width{0};
+  std::vector<Code> codes;
+  std::vector<RowID> row_ids;
+
+  size_t row_count() const { return row_ids.size(); }
+
+  Code code(const size_t row_idx, const size_t code_idx) const { return codes[row_idx * width + code_idx]; }
+};
+
+// Row range [begin, end) within a TrieInput
+using RowRange = std::pair<size_t, size_t>;
+
+// Encodes the values of all columns of a variable into dense, order-preserving codes. The codes are stored per column,
+// in the order of the rows of the respective input.
+template <typename ColumnDataType>
+std::vector<std::vector<Code>> encode_variable(const std::vector<InputColumn>& columns,
+                                               const std::vector<std::shared_ptr<const Table>>& input_tables) {
+  auto column_values = std::vector<std::vector<ColumnDataType>>(columns.size());
+  auto column_nulls = std::vector<std::vector<bool>>(columns.size());
+  auto dictionary = std::vector<ColumnDataType>{};
+
+  for (auto column_idx = size_t{0}; column_idx < columns.size(); ++column_idx) {
+    const auto& table = *input_tables[columns[column_idx].input_idx];
+    auto& values = column_values[column_idx];
+    auto& nulls = column_nulls[column_idx];
+    values.reserve(table.row_count());
+    nulls.reserve(table.row_count());
+
+    const auto chunk_count = table.chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+      Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+      segment_iterate<ColumnDataType>(*chunk->get_segment(columns[column_idx].column_id), [&](const auto& position) {
+        values.emplace_back(position.is_null() ? ColumnDataType{} : position.value());
+        nulls.emplace_back(position.is_null());
+        if (!position.is_null()) dictionary.emplace_back(position.value());
+      });
+    }
+  }
+
+  std::sort(dictionary.begin(), dictionary.end());
+  dictionary.erase(std::unique(dictionary.begin(), dictionary.end()), dictionary.end());
+  Assert(dictionary.size() < NULL_CODE, "Too many distinct values for JoinLeapfrogTriejoin");
+
+  auto column_codes = std::vector<std::vector<Code>>(columns.size());
+  for (auto column_idx = size_t{0}; column_idx < columns.size(); ++column_idx) {
+    const auto& values = column_values[column_idx];
+    auto& codes = column_codes[column_idx];
+    codes.resize(values.size());
+    for (auto row_idx = size_t{0}; row_idx < values.size(); ++row_idx) {
+      if (column_nulls[column_idx][row_idx]) {
+        codes[row_idx] = NULL_CODE;
+      } else {
+        const auto dictionary_iter = std::lower_bound(dictionary.cbegin(), dictionary.cend(), values[row_idx]);
+        codes[row_idx] = static_cast<Code>(std::distance(dictionary.cbegin(), dictionary_iter));
+      }
+    }
+  }
+
+  return column_codes;
+}
+
+// Sorts the rows of a TrieInput lexicographically by their codes
+void sort_trie_input(TrieInput& input) {
+  const auto width = input.width;
+  auto permutation = std::vector<size_t>(input.row_count());
+  std::iota(permutation.begin(), permutation.end(), size_t{0});
+  std::sort(permutation.begin(), permutation.end(), [&](const auto lhs, const auto rhs) {
+    const auto* const lhs_codes = input.codes.data() + lhs * width;
+    const auto* const rhs_codes = input.codes.data() + rhs * width;
+    return std::lexicographical_compare(lhs_codes, lhs_codes + width, rhs_codes, rhs_codes + width);
+  });
+
+  auto sorted_codes = std::vector<Code>(input.codes.size());
+  auto sorted_row_ids = std::vector<RowID>(input.row_count());
+  for (auto row_idx = size_t{0}; row_idx < permutation.size(); ++row_idx) {
+    std::copy_n(input.codes.cbegin() + permutation[row_idx] * width, width, sorted_codes.begin() + row_idx * width);
+    sorted_row_ids[row_idx] = input.row_ids[permutation[row_idx]];
+  }
+  input.codes = std::move(sorted_codes);
+  input.row_ids = std::move(sorted_row_ids);
+}
+
+// Returns the first row in the range whose code at code_idx is not less than the given code. Within the range, the
+// rows are sorted by this code, as the preceding codes are fixed.
+size_t seek(const TrieInput& input, const RowRange& range, const size_t code_idx, const Code code) {
+  auto begin = range.first;
+  auto length = range.second - range.first;
+  while (length > 0) {
+    const auto half = length / 2;
+    if (input.code(begin + half, code_idx) < code) {
+      begin += half + 1;
+      length -= half + 1;
+    } else {
+      length = half;
+    }
+  }
+  return begin;
+}
+
+/**
+ * State of a single join job. For each variable, variable_inputs lists the inputs it occurs in together with the index
+ * of its code in their rows. ranges holds the current range of each input, i.e., the rows that match the variables
+ * bound so far.
+ */
+struct LeapfrogJob {
+  const std::vector<TrieInput>& trie_inputs;
+  const std::vector<std::vector<std::pair<size_t, size_t>>>& variable_inputs;
+  std::vector<RowRange> ranges;
+  std::vector<RowIDPosList> pos_lists;
+
+  void join(const size_t variable_idx) {
+    if (variable_idx == variable_inputs.size()) {
+      emit();
+      return;
+    }
+
+    const auto& participants = variable_inputs[variable_idx];
+    auto saved_ranges = std::vector<RowRange>(participants.size());
+    for (auto participant_idx = size_t{0}; participant_idx < participants.size(); ++participant_idx) {
+      saved_ranges[participant_idx] = ranges[participants[participant_idx].first];
+    }
+
+    // Leapfrog: Seek all participating inputs to the target code. If one of them is positioned at a larger code, that
+    // code becomes the new target. Once all of them are positioned at the target, the variable is bound to it.
+    auto target = Code{0};
+    while (true) {
+      auto all_at_target = true;
+      for (const auto& [input_idx, code_idx] : participants) {
+        auto& range = ranges[input_idx];
+        range.first = seek(trie_inputs[input_idx], range, code_idx, target);
+        if (range.first == range.second) {
+          // No further matches, restore the ranges for the caller
+          for (auto participant_idx = size_t{0}; participant_idx < participants.size(); ++participant_idx) {
+            ranges[participants[participant_idx].first] = saved_ranges[participant_idx];
+          }
+          return;
+        }
+
+        const auto code = trie_inputs[input_idx].code(range.first, code_idx);
+        if (code != target) {
+          target = code;
+          all_at_target = false;
+        }
+      }
+      if (!all_at_target) continue;
+
+      // Narrow the ranges to the rows with the target code, join the remaining variables, and continue behind them
+      auto next_begins = std::vector<size_t>(participants.size());
+      for (auto participant_idx = size_t{0}; participant_idx < participants.size(); ++participant_idx) {
+        const auto [input_idx, code_idx] = participants[participant_idx];
+        auto& range = ranges[input_idx];
+        next_begins[participant_idx] = seek(trie_inputs[input_idx], range, code_idx, target + 1);
+        range.second = next_begins[participant_idx];
+      }
+
+      join(variable_idx + 1);
+
+      for (auto participant_idx = size_t{0}; participant_idx < participants.size(); ++participant_idx) {
+        ranges[participants[participant_idx].first] = {next_begins[participant_idx],
+                                                       saved_ranges[participant_idx].second};
+      }
+    }
+  }
+
+  // All variables are bound, emit the cross product of the current ranges
+  void emit() {
+    const auto input_count = ranges.size();
+    auto current_rows = std::vector<size_t>(input_count);
+    for (auto input_idx = size_t{0}; input_idx < input_count; ++input_idx) {
+      if (ranges[input_idx].first == ranges[input_idx].second) return;
+      current_rows[input_idx] = ranges[input_idx].first;
+    }
+
+    while (true) {
+      for (auto input_idx = size_t{0}; input_idx < input_count; ++input_idx) {
+        pos_lists[input_idx].emplace_back(trie_inputs[input_idx].row_ids[current_rows[input_idx]]);
+      }
+
+      // Advance the last input first, as an odometer does
+      auto input_idx = input_count;
+      while (input_idx > 0) {
+        --input_idx;
+        if (++current_rows[input_idx] < ranges[input_idx].second) break;
+        current_rows[input_idx] = ranges[input_idx].first;
+        if (input_idx == 0) return;
+      }
+    }
+  }
+};
+
+}  // namespace
+
+namespace opossum {
+
+JoinLeapfrogTriejoin::JoinLeapfrogTriejoin(const std::vector<std::shared_ptr<const AbstractOperator>>& inputs,
+                                           const std::vector<Predicate>& predicates)
+    : AbstractReadOnlyOperator(OperatorType::JoinLeapfrogTriejoin, inputs.size() > 0 ? inputs[0] : nullptr,
+                               inputs.size() > 1 ? inputs[1] : nullptr, std::make_unique<PerformanceData>()),
+      _predicates(predicates) {
+  Assert(inputs.size() >= 2, "JoinLeapfrogTriejoin requires at least two inputs");
+  Assert(!predicates.empty(), "JoinLeapfrogTriejoin requires at least one predicate");
+  for (const auto& [first_column, second_column] : predicates) {
+    Assert(first_column.input_idx < inputs.size() && second_column.input_idx < inputs.size(),
+           "Predicate refers to an unknown input");
+  }
+
+  _additional_inputs.assign(inputs.cbegin() + 2, inputs.cend());
+}
+
+const std::string& JoinLeapfrogTriejoin::name() const {
+  static const auto name = std::string{"JoinLeapfrogTriejoin"};
+  return name;
+}
+
+std::string JoinLeapfrogTriejoin::description(DescriptionMode description_mode) const {
+  const auto all_inputs = inputs();
+  const auto column_name = [&](const InputColumn& column) {
+    const auto& input_table = all_inputs[column.input_idx]->get_output();
+    if (input_table) return input_table->column_name(column.column_id);
+    return "Column #" + std::to_string(column.column_id);
+  };
+
+  const auto* const separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+  stream << name() << separator << "(Inner Join of " << all_inputs.size() << " inputs where ";
+  for (auto predicate_idx = size_t{0}; predicate_idx < _predicates.size(); ++predicate_idx) {
+    const auto& [first_column, second_column] = _predicates[predicate_idx];
+    if (predicate_idx > 0) stream << " AND ";
+    stream << "#" << first_column.input_idx << "." << column_name(first_column) << " = #" << second_column.input_idx
+           << "." << column_name(second_column);
+  }
+  stream << ")";
+
+  return stream.str();
+}
+
+std::vector<std::shared_ptr<const AbstractOperator>> JoinLeapfrogTriejoin::inputs() const {
+  auto all_inputs = std::vector<std::shared_ptr<const AbstractOperator>>{_left_input, _right_input};
+  all_inputs.insert(all_inputs.end(), _additional_inputs.cbegin(), _additional_inputs.cend());
+  return all_inputs;
+}
+
+const std::vector<JoinLeapfrogTriejoin::Predicate>& JoinLeapfrogTriejoin::predicates() const { return _predicates; }
+
+std::shared_ptr<AbstractOperator> JoinLeapfrogTriejoin::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  // The additional inputs are replaced by their copies in AbstractOperator::_deep_copy_impl()
+  auto copied_inputs = std::vector<std::shared_ptr<const AbstractOperator>>{copied_left_input, copied_right_input};
+  copied_inputs.insert(copied_inputs.end(), _additional_inputs.cbegin(), _additional_inputs.cend());
+  return std::make_shared<JoinLeapfrogTriejoin>(copied_inputs, _predicates);
+}
+
+void JoinLeapfrogTriejoin::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+void JoinLeapfrogTriejoin::PerformanceData::output_to_stream(std::ostream& stream,
+                                                             DescriptionMode description_mode) const {
+  OperatorPerformanceData<OperatorSteps>::output_to_stream(stream, description_mode);
+
+  const auto* const separator = description_mode == DescriptionMode::SingleLine ? " " : "\n";
+  stream << separator << "Bound " << variable_count << " variable(s) in " << job_count << " job(s).";
+}
+
+std::shared_ptr<const Table> JoinLeapfrogTriejoin::_on_execute() {
+  auto& leapfrog_performance_data = static_cast<PerformanceData&>(*performance_data);
+  auto timer = Timer{};
+
+  const auto all_inputs = inputs();
+  const auto input_count = all_inputs.size();
+  auto input_tables = std::vector<std::shared_ptr<const Table>>(input_count);
+  auto column_offsets = std::vector<size_t>(input_count + 1);
+  for (auto input_idx = size_t{0}; input_idx < input_count; ++input_idx) {
+    input_tables[input_idx] = all_inputs[input_idx]->get_output();
+    column_offsets[input_idx + 1] = column_offsets[input_idx] + input_tables[input_idx]->column_count();
+  }
+
+  /**
+   * Group the join columns into variables: All columns that are (transitively) connected by predicates have to be
+   * equal and form a variable. The columns are identified by their position in the concatenated columns of all inputs.
+   */
+  auto parents = std::vector<size_t>(column_offsets.back());
+  std::iota(parents.begin(), parents.end(), size_t{0});
+  const auto find_root = [&](auto column) {
+    while (parents[column] != column) {
+      parents[column] = parents[parents[column]];
+      column = parents[column];
+    }
+    return column;
+  };
+
+  auto is_join_column = std::vector<bool>(column_offsets.back());
+  for (const auto& [first_column, second_column] : _predicates) {
+    const auto& first_table = *input_tables[first_column.input_idx];
+    const auto& second_table = *input_tables[second_column.input_idx];
+    Assert(first_table.column_data_type(first_column.column_id) ==
+               second_table.column_data_type(second_column.column_id),
+           "JoinLeapfrogTriejoin requires join columns of the same data type");
+
+    const auto first_position = column_offsets[first_column.input_idx] + first_column.column_id;
+    const auto second_position = column_offsets[second_column.input_idx] + second_column.column_id;
+    is_join_column[first_position] = true;
+    is_join_column[second_position] = true;
+    parents[find_root(first_position)] = find_root(second_position);
+  }
+
+  auto variable_columns = std::vector<std::vector<InputColumn>>{};
+  auto variable_by_root = std::unordered_map<size_t, size_t>{};
+  for (auto input_idx = size_t{0}; input_idx < input_count; ++input_idx) {
+    for (auto column_id = ColumnID{0}; column_id < input_tables[input_idx]->column_count(); ++column_id) {
+      const auto position = column_offsets[input_idx] + column_id;
+      if (!is_join_column[position]) continue;
+
+      const auto root = find_root(position);
+      const auto variable_idx = variable_by_root.try_emplace(root, variable_columns.size()).first->second;
+      if (variable_idx == variable_columns.size()) variable_columns.emplace_back();
+      variable_columns[variable_idx].push_back({input_idx, column_id});
+    }
+  }
+
+  // Bind the variables that occur in the most inputs first, as they restrict the result the most
+  const auto participating_input_count = [&](const auto& columns) {
+    auto participating_inputs = std::vector<size_t>{};
+    for (const auto& column : columns) participating_inputs.emplace_back(column.input_idx);
+    std::sort(participating_inputs.begin(), participating_inputs.end());
+    return std::unique(participating_inputs.begin(), participating_inputs.end()) - participating_inputs.begin();
+  };
+  std::stable_sort(variable_columns.begin(), variable_columns.end(), [&](const auto& lhs, const auto& rhs) {
+    return participating_input_count(lhs) > participating_input_count(rhs);
+  });
+
+  const auto variable_count = variable_columns.size();
+  leapfrog_performance_data.variable_count = variable_count;
+
+  // Encode the values of each variable, one job per variable
+  auto codes_by_variable = std::vector<std::vector<std::vector<Code>>>(variable_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(variable_count);
+  for (auto variable_idx = size_t{0}; variable_idx < variable_count; ++variable_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, variable_idx]() {
+      const auto& columns = variable_columns[variable_idx];
+      const auto data_type = input_tables[columns.front().input_idx]->column_data_type(columns.front().column_id);
+      resolve_data_type(data_type, [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        codes_by_variable[variable_idx] = encode_variable<ColumnDataType>(columns, input_tables);
+      });
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  /**
+   * Build the tries, one job per input. Each row holds the codes of the variables of its input in the order of the
+   * variables. Rows with a NULL value in a join column and rows whose join columns that form the same variable differ
+   * are dropped.
+   */
+  auto trie_inputs = std::vector<TrieInput>(input_count);
+  auto variable_inputs = std::vector<std::vector<std::pair<size_t, size_t>>>(variable_count);
+  for (auto variable_idx = size_t{0}; variable_idx < variable_count; ++variable_idx) {
+    for (const auto& column : variable_columns[variable_idx]) {
+      auto& participants = variable_inputs[variable_idx];
+      if (!participants.empty() && participants.back().first == column.input_idx) continue;
+      participants.emplace_back(column.input_idx, trie_inputs[column.input_idx].width++);
+    }
+  }
+
+  jobs.clear();
+  jobs.reserve(input_count);
+  for (auto input_idx = size_t{0}; input_idx < input_count; ++input_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, input_idx]() {
+      // For each code of the rows of this input, the code vectors of the columns that determine it
+      auto code_columns = std::vector<std::vector<const std::vector<Code>*>>(trie_inputs[input_idx].width);
+      for (auto variable_idx = size_t{0}; variable_idx < variable_count; ++variable_idx) {
+        const auto& participants = variable_inputs[variable_idx];
+        const auto participant_iter = std::find_if(participants.cbegin(), participants.cend(), [&](const auto& entry) {
+          return entry.first == input_idx;
+        });
+        if (participant_iter == participants.cend()) continue;
+
+        for (auto column_idx = size_t{0}; column_idx < variable_columns[variable_idx].size(); ++column_idx) {
+          if (variable_columns[variable_idx][column_idx].input_idx != input_idx) continue;
+          code_columns[participant_iter->second].emplace_back(&codes_by_variable[variable_idx][column_idx]);
+        }
+      }
+
+      const auto& table = *input_tables[input_idx];
+      auto& trie_input = trie_inputs[input_idx];
+      trie_input.codes.reserve(table.row_count() * trie_input.width);
+      trie_input.row_ids.reserve(table.row_count());
+
+      auto row_idx = size_t{0};
+      const auto chunk_count = table.chunk_count();
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto chunk = table.get_chunk(chunk_id);
+        Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+        const auto chunk_size = chunk->size();
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset, ++row_idx) {
+          const auto qualifies = std::all_of(code_columns.cbegin(), code_columns.cend(), [&](const auto& columns) {
+            const auto code = (*columns.front())[row_idx];
+            return code != NULL_CODE && std::all_of(columns.cbegin() + 1, columns.cend(),
+                                                    [&](const auto* codes) { return (*codes)[row_idx] == code; });
+          });
+          if (!qualifies) continue;
+
+          for (const auto& columns : code_columns) {
+            trie_input.codes.emplace_back((*columns.front())[row_idx]);
+          }
+          trie_input.row_ids.emplace_back(RowID{chunk_id, chunk_offset});
+        }
+      }
+
+      sort_trie_input(trie_input);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  codes_by_variable = {};
+
+  leapfrog_performance_data.set_step_runtime(OperatorSteps::Materializing, timer.lap());
+
+  /**
+   * Split the codes of the first variable into ranges of roughly the same number of rows of its first input and join
+   * each range in a separate job. The first variable is the first code of all inputs it occurs in, so that each job
+   * can restrict their ranges to its code range upfront.
+   */
+  auto split_codes = std::vector<Code>{0};
+  if (variable_count > 0) {
+    const auto& split_input = trie_inputs[variable_inputs[0].front().first];
+    const auto split_row_count = split_input.row_count();
+    const auto job_count = std::min(MAX_JOB_COUNT, split_row_count);
+    for (auto job_idx = size_t{1}; job_idx < job_count; ++job_idx) {
+      const auto code = split_input.code(job_idx * split_row_count / job_count, 0);
+      if (code > split_codes.back()) split_codes.emplace_back(code);
+    }
+  }
+  split_codes.emplace_back(NULL_CODE);
+
+  const auto job_count = split_codes.size() - 1;
+  leapfrog_performance_data.job_count = job_count;
+
+  auto pos_lists_by_job = std::vector<std::vector<RowIDPosList>>(job_count);
+  jobs.clear();
+  jobs.reserve(job_count);
+  for (auto job_idx = size_t{0}; job_idx < job_count; ++job_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, job_idx]() {
+      auto job = LeapfrogJob{trie_inputs, variable_inputs, std::vector<RowRange>(input_count),
+                             std::vector<RowIDPosList>(input_count)};
+      for (auto input_idx = size_t{0}; input_idx < input_count; ++input_idx) {
+        job.ranges[input_idx] = {0, trie_inputs[input_idx].row_count()};
+      }
+      if (variable_count > 0) {
+        for (const auto& [input_idx, code_idx] : variable_inputs[0]) {
+          auto& range = job.ranges[input_idx];
+          range = {seek(trie_inputs[input_idx], range, code_idx, split_codes[job_idx]),
+                   seek(trie_inputs[input_idx], range, code_idx, split_codes[job_idx + 1])};
+        }
+      }
+
+      job.join(0);
+      pos_lists_by_job[job_idx] = std::move(job.pos_lists);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  leapfrog_performance_data.set_step_runtime(OperatorSteps::Joining, timer.lap());
+
+  // Write one output chunk per job, resolving reference inputs as the JoinHash does
+  auto pos_lists_by_chunk_by_input = std::vector<PosListsByChunk>(input_count);
+  auto output_column_definitions = TableColumnDefinitions{};
+  for (auto input_idx = size_t{0}; input_idx < input_count; ++input_idx) {
+    const auto& input_table = input_tables[input_idx];
+    if (input_table->type() == TableType::References) {
+      pos_lists_by_chunk_by_input[input_idx] = setup_pos_lists_by_chunk(input_table);
+    }
+
+    const auto& column_definitions = input_table->column_definitions();
+    output_column_definitions.insert(output_column_definitions.end(), column_definitions.cbegin(),
+                                     column_definitions.cend());
+  }
+
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  output_chunks.reserve(job_count);
+  for (auto& pos_lists : pos_lists_by_job) {
+    if (pos_lists.front().empty()) continue;
+
+    auto output_segments = Segments{};
+    for (auto input_idx = size_t{0}; input_idx < input_count; ++input_idx) {
+      write_output_segments(output_segments, input_tables[input_idx], pos_lists_by_chunk_by_input[input_idx],
+                            std::make_shared<RowIDPosList>(std::move(pos_lists[input_idx])));
+    }
+    output_chunks.emplace_back(std::make_shared<Chunk>(std::move(output_segments)));
+  }
+
+  leapfrog_performance_data.set_step_runtime(OperatorSteps::OutputWriting, timer.lap());
+
+  return std::make_shared<Table>(output_column_definitions, TableType::References, std::move(output_chunks));
+}
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Worst-case optimal multi-way Inner Join of two or more inputs with equality predicates (Veldhuizen, "Leapfrog
+ * Triejoin: A Simple, Worst-Case Optimal Join Algorithm", ICDT 2014). Binary joins evaluate a cyclic query such as the
+ * triangle R(a, b), S(b, c), T(c, a) pairwise and can produce intermediate results that are far larger than both the
+ * inputs and the final result. The Leapfrog Triejoin instead binds one join attribute (variable) after the other for
+ * all inputs at once and never materializes intermediate results.
+ *
+ * Columns that are connected by predicates form a variable. The variables are ordered by the number of inputs they
+ * occur in, so that the most constraining variables are bound first. The values of each variable are encoded into
+ * dense, order-preserving codes. Every input is then materialized as rows of the codes of its variables (in variable
+ * order) and sorted lexicographically. A sorted input serves as a trie: The rows with a common prefix of codes form a
+ * contiguous range, and the rows of the next code within a range are found by a binary search. To bind a variable, the
+ * ranges of all inputs that contain it are intersected by leapfrogging: Each input seeks to the largest code that any
+ * input is currently positioned at until all of them agree. Once all variables are bound, the remaining ranges are
+ * combined into output rows. The code range of the first variable is split into one job per range.
+ *
+ * Rows with a NULL value in a join column never find a join partner. The output consists of the columns of all inputs
+ * in the order of the inputs.
+ *
+ * The first two inputs are stored as the left and right input, all further inputs as additional inputs (see
+ * AbstractOperator). The JoinOrderingRule marks the JoinNodes of cyclic join graphs with large intermediate results
+ * that are to be translated into this operator (see JoinNode::is_multiway_join).
+ */
+class JoinLeapfrogTriejoin : public AbstractReadOnlyOperator {
+ public:
+  // A column of one of the inputs, identified by the input's position in the inputs passed to the constructor
+  struct InputColumn {
+    size_t input_idx;
+    ColumnID column_id;
+  };
+
+  // Two columns that have to be equal
+  using Predicate = std::pair<InputColumn, InputColumn>;
+
+  JoinLeapfrogTriejoin(const std::vector<std::shared_ptr<const AbstractOperator>>& inputs,
+                       const std::vector<Predicate>& predicates);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  // All inputs, i.e., the left, the right, and the additional inputs
+  std::vector<std::shared_ptr<const AbstractOperator>> inputs() const;
+  const std::vector<Predicate>& predicates() const;
+
+  enum class OperatorSteps : uint8_t { Materializing, Joining, OutputWriting };
+
+  struct PerformanceData : public OperatorPerformanceData<OperatorSteps> {
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override;
+
+    size_t variable_count{0};
+    size_t job_count{0};
+  };
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  const std::vector<Predicate> _predicates;
+};
+
+}  // namespace opossum
@@ -43,6 +43,38 @@ void __attribute__((noinline))
 join_two_typed_segments(const BinaryFunctor& func, LeftIterator left_it, LeftIterator left_end,
                         RightIterator right_begin, RightIterator right_end, const ChunkID chunk_id_left,
                         const ChunkID chunk_id_right, const JoinNestedLoop::JoinParams& params) {
+  auto& secondary_predicate_evaluator = params.secondary_predicate_evaluator;
+  const auto has_secondary_predicates = secondary_predicate_evaluator.has_predicates();
+
+  // The pairs that satisfy the primary predicate are collected and the secondary predicates are evaluated for a batch
+  // of them at once (see MultiPredicateJoinEvaluator::BATCH_SIZE).
+  auto candidate_left_row_ids = std::vector<RowID>{};
+  auto candidate_right_row_ids = std::vector<RowID>{};
+  auto candidate_matches = std::vector<bool>{};
+
+  const auto evaluate_candidates = [&]() {
+    secondary_predicate_evaluator.satisfies_all_predicates(candidate_left_row_ids, candidate_right_row_ids,
+                                                           candidate_matches);
+    for (auto candidate_idx = size_t{0}; candidate_idx < candidate_left_row_ids.size(); ++candidate_idx) {
+      if (candidate_matches[candidate_idx]) {
+        process_match(candidate_left_row_ids[candidate_idx], candidate_right_row_ids[candidate_idx], params);
+      }
+    }
+    candidate_left_row_ids.clear();
+    candidate_right_row_ids.clear();
+  };
+
+  const auto process_primary_match = [&](const RowID left_row_id, const RowID right_row_id) {
+    if (!has_secondary_predicates) {
+      process_match(left_row_id, right_row_id, params);
+      return;
+    }
+
+    candidate_left_row_ids.emplace_back(left_row_id);
+    candidate_right_row_ids.emplace_back(right_row_id);
+    if (candidate_left_row_ids.size() >= MultiPredicateJoinEvaluator::BATCH_SIZE) evaluate_candidates();
+  };
+
   for (; left_it != left_end; ++left_it) {
     const auto left_value = *left_it;
 
@@ -55,18 +87,18 @@ join_two_typed_segments(const BinaryFunctor& func, LeftIterator left_it, LeftIte
       // AntiNullAsTrue is the only join mode where NULLs in any operand lead to a match. For all other
       // join modes, any NULL in the predicate results in a non-match.
       if (params.mode == JoinMode::AntiNullAsTrue) {
-        if ((left_value.is_null() || right_value.is_null() || func(left_value.value(), right_value.value())) &&
-            params.secondary_predicate_evaluator.satisfies_all_predicates(left_row_id, right_row_id)) {
-          process_match(left_row_id, right_row_id, params);
+        if (left_value.is_null() || right_value.is_null() || func(left_value.value(), right_value.value())) {
+          process_primary_match(left_row_id, right_row_id);
         }
       } else {
-        if ((!left_value.is_null() && !right_value.is_null() && func(left_value.value(), right_value.value())) &&
-            params.secondary_predicate_evaluator.satisfies_all_predicates(left_row_id, right_row_id)) {
-          process_match(left_row_id, right_row_id, params);
+        if (!left_value.is_null() && !right_value.is_null() && func(left_value.value(), right_value.value())) {
+          process_primary_match(left_row_id, right_row_id);
         }
       }
     }
   }
+
+  if (!candidate_left_row_ids.empty()) evaluate_candidates();
 }
 }  // namespace
 
@@ -43,7 +43,8 @@ JoinSortMerge::JoinSortMerge(const std::shared_ptr<const AbstractOperator>& left
                              const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
                              const OperatorJoinPredicate& primary_predicate,
                              const std::vector<OperatorJoinPredicate>& secondary_predicates)
-    : AbstractJoinOperator(OperatorType::JoinSortMerge, left, right, mode, primary_predicate, secondary_predicates) {}
+    : AbstractJoinOperator(OperatorType::JoinSortMerge, left, right, mode, primary_predicate, secondary_predicates,
+                           std::make_unique<JoinSortMerge::PerformanceData>()) {}
 
 std::shared_ptr<AbstractOperator> JoinSortMerge::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
@@ -315,6 +316,59 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
     }
   }
 
+  /**
+   * Evaluates the secondary predicates for all combinations of row ids from the outer and the inner table range, where
+   * the outer range is a range of the left table if outer_is_left is true and of the right table otherwise. Instead of
+   * evaluating one combination after the other, the combinations of several consecutive outer rows are evaluated as
+   * one batch (see MultiPredicateJoinEvaluator::BATCH_SIZE). For every outer row id, the consumer is called with the
+   * inner row ids of the combinations that satisfy all secondary predicates.
+   **/
+  template <typename Consumer>
+  void _for_every_qualified_combination(TableRange outer_range, TableRange inner_range, const bool outer_is_left,
+                                        MultiPredicateJoinEvaluator& multi_predicate_join_evaluator,
+                                        const Consumer& consumer) {
+    auto& outer_table = outer_is_left ? _sorted_left_table : _sorted_right_table;
+    auto& inner_table = outer_is_left ? _sorted_right_table : _sorted_left_table;
+
+    auto outer_row_ids = std::vector<RowID>{};
+    outer_range.for_every_row_id(outer_table, [&](RowID row_id) { outer_row_ids.emplace_back(row_id); });
+    auto inner_row_ids = std::vector<RowID>{};
+    inner_range.for_every_row_id(inner_table, [&](RowID row_id) { inner_row_ids.emplace_back(row_id); });
+
+    const auto inner_row_count = inner_row_ids.size();
+    const auto outer_rows_per_batch = std::max(size_t{1}, MultiPredicateJoinEvaluator::BATCH_SIZE /
+                                                              std::max(size_t{1}, inner_row_count));
+
+    auto left_row_ids = std::vector<RowID>{};
+    auto right_row_ids = std::vector<RowID>{};
+    auto matches = std::vector<bool>{};
+    auto matched_inner_row_ids = std::vector<RowID>{};
+
+    for (auto batch_begin = size_t{0}; batch_begin < outer_row_ids.size(); batch_begin += outer_rows_per_batch) {
+      const auto batch_end = std::min(batch_begin + outer_rows_per_batch, outer_row_ids.size());
+
+      left_row_ids.clear();
+      right_row_ids.clear();
+      for (auto outer_idx = batch_begin; outer_idx < batch_end; ++outer_idx) {
+        auto& outer_side_row_ids = outer_is_left ? left_row_ids : right_row_ids;
+        auto& inner_side_row_ids = outer_is_left ? right_row_ids : left_row_ids;
+        outer_side_row_ids.insert(outer_side_row_ids.end(), inner_row_count, outer_row_ids[outer_idx]);
+        inner_side_row_ids.insert(inner_side_row_ids.end(), inner_row_ids.cbegin(), inner_row_ids.cend());
+      }
+
+      multi_predicate_join_evaluator.satisfies_all_predicates(left_row_ids, right_row_ids, matches);
+
+      for (auto outer_idx = batch_begin; outer_idx < batch_end; ++outer_idx) {
+        const auto matches_offset = (outer_idx - batch_begin) * inner_row_count;
+        matched_inner_row_ids.clear();
+        for (auto inner_idx = size_t{0}; inner_idx < inner_row_count; ++inner_idx) {
+          if (matches[matches_offset + inner_idx]) matched_inner_row_ids.emplace_back(inner_row_ids[inner_idx]);
+        }
+        consumer(outer_row_ids[outer_idx], matched_inner_row_ids);
+      }
+    }
+  }
+
   /**
    * Only for multi predicated inner joins.
    * Emits all the combinations of row ids from the left table range and the right table range to the join output
@@ -322,13 +376,12 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
    **/
   void _emit_combinations_multi_predicated_inner(size_t output_cluster, TableRange left_range, TableRange right_range,
                                                  MultiPredicateJoinEvaluator& multi_predicate_join_evaluator) {
-    left_range.for_every_row_id(_sorted_left_table, [&](RowID left_row_id) {
-      right_range.for_every_row_id(_sorted_right_table, [&](RowID right_row_id) {
-        if (multi_predicate_join_evaluator.satisfies_all_predicates(left_row_id, right_row_id)) {
-          _emit_combination(output_cluster, left_row_id, right_row_id);
-        }
-      });
-    });
+    _for_every_qualified_combination(left_range, right_range, true, multi_predicate_join_evaluator,
+                                     [&](RowID left_row_id, const std::vector<RowID>& matched_right_row_ids) {
+                                       for (const auto& right_row_id : matched_right_row_ids) {
+                                         _emit_combination(output_cluster, left_row_id, right_row_id);
+                                       }
+                                     });
   }
 
   /**
@@ -340,31 +393,25 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
   void _emit_combinations_multi_predicated_left_outer(size_t output_cluster, TableRange left_range,
                                                       TableRange right_range,
                                                       MultiPredicateJoinEvaluator& multi_predicate_join_evaluator) {
-    if (_primary_predicate_condition == PredicateCondition::Equals) {
-      left_range.for_every_row_id(_sorted_left_table, [&](RowID left_row_id) {
-        bool left_row_id_matched = false;
-        right_range.for_every_row_id(_sorted_right_table, [&](RowID right_row_id) {
-          if (multi_predicate_join_evaluator.satisfies_all_predicates(left_row_id, right_row_id)) {
+    _for_every_qualified_combination(
+        left_range, right_range, true, multi_predicate_join_evaluator,
+        [&](RowID left_row_id, const std::vector<RowID>& matched_right_row_ids) {
+          for (const auto& right_row_id : matched_right_row_ids) {
             _emit_combination(output_cluster, left_row_id, right_row_id);
-            left_row_id_matched = true;
           }
-        });
-        if (!left_row_id_matched) {
-          _emit_combination(output_cluster, left_row_id, NULL_ROW_ID);
-        }
-      });
-    } else {
-      // primary predicate is <, <=, >, or >=
-      left_range.for_every_row_id(_sorted_left_table, [&](RowID left_row_id) {
-        _left_row_ids_emitted.emplace(left_row_id, false);
-        right_range.for_every_row_id(_sorted_right_table, [&](RowID right_row_id) {
-          if (multi_predicate_join_evaluator.satisfies_all_predicates(left_row_id, right_row_id)) {
-            _emit_combination(output_cluster, left_row_id, right_row_id);
-            _left_row_ids_emitted[left_row_id] = true;
+
+          if (_primary_predicate_condition == PredicateCondition::Equals) {
+            if (matched_right_row_ids.empty()) {
+              _emit_combination(output_cluster, left_row_id, NULL_ROW_ID);
+            }
+          } else {
+            // primary predicate is <, <=, >, or >=
+            _left_row_ids_emitted.emplace(left_row_id, false);
+            if (!matched_right_row_ids.empty()) {
+              _left_row_ids_emitted[left_row_id] = true;
+            }
           }
         });
-      });
-    }
   }
 
   /**
@@ -376,31 +423,25 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
   void _emit_combinations_multi_predicated_right_outer(size_t output_cluster, TableRange left_range,
                                                        TableRange right_range,
                                                        MultiPredicateJoinEvaluator& multi_predicate_join_evaluator) {
-    if (_primary_predicate_condition == PredicateCondition::Equals) {
-      right_range.for_every_row_id(_sorted_right_table, [&](RowID right_row_id) {
-        bool right_row_id_matched = false;
-        left_range.for_every_row_id(_sorted_left_table, [&](RowID left_row_id) {
-          if (multi_predicate_join_evaluator.satisfies_all_predicates(left_row_id, right_row_id)) {
+    _for_every_qualified_combination(
+        right_range, left_range, false, multi_predicate_join_evaluator,
+        [&](RowID right_row_id, const std::vector<RowID>& matched_left_row_ids) {
+          for (const auto& left_row_id : matched_left_row_ids) {
             _emit_combination(output_cluster, left_row_id, right_row_id);
-            right_row_id_matched = true;
           }
-        });
-        if (!right_row_id_matched) {
-          _emit_combination(output_cluster, NULL_ROW_ID, right_row_id);
-        }
-      });
-    } else {
-      // primary predicate is <, <=, >, or >=
-      right_range.for_every_row_id(_sorted_right_table, [&](RowID right_row_id) {
-        _right_row_ids_emitted.emplace(right_row_id, false);
-        left_range.for_every_row_id(_sorted_left_table, [&](RowID left_row_id) {
-          if (multi_predicate_join_evaluator.satisfies_all_predicates(left_row_id, right_row_id)) {
-            _emit_combination(output_cluster, left_row_id, right_row_id);
-            _right_row_ids_emitted[right_row_id] = true;
+
+          if (_primary_predicate_condition == PredicateCondition::Equals) {
+            if (matched_left_row_ids.empty()) {
+              _emit_combination(output_cluster, NULL_ROW_ID, right_row_id);
+            }
+          } else {
+            // primary predicate is <, <=, >, or >=
+            _right_row_ids_emitted.emplace(right_row_id, false);
+            if (!matched_left_row_ids.empty()) {
+              _right_row_ids_emitted[right_row_id] = true;
+            }
           }
         });
-      });
-    }
   }
 
   /**
@@ -416,19 +457,16 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
     if (_primary_predicate_condition == PredicateCondition::Equals) {
       std::set<RowID> matched_right_row_ids;
 
-      left_range.for_every_row_id(_sorted_left_table, [&](RowID left_row_id) {
-        bool left_row_id_matched = false;
-        right_range.for_every_row_id(_sorted_right_table, [&](RowID right_row_id) {
-          if (multi_predicate_join_evaluator.satisfies_all_predicates(left_row_id, right_row_id)) {
-            _emit_combination(output_cluster, left_row_id, right_row_id);
-            left_row_id_matched = true;
-            matched_right_row_ids.insert(right_row_id);
-          }
-        });
-        if (!left_row_id_matched) {
-          _emit_combination(output_cluster, left_row_id, NULL_ROW_ID);
-        }
-      });
+      _for_every_qualified_combination(left_range, right_range, true, multi_predicate_join_evaluator,
+                                       [&](RowID left_row_id, const std::vector<RowID>& matched_row_ids) {
+                                         for (const auto& right_row_id : matched_row_ids) {
+                                           _emit_combination(output_cluster, left_row_id, right_row_id);
+                                           matched_right_row_ids.insert(right_row_id);
+                                         }
+                                         if (matched_row_ids.empty()) {
+                                           _emit_combination(output_cluster, left_row_id, NULL_ROW_ID);
+                                         }
+                                       });
       // add null value combinations for right row ids that have no match.
       right_range.for_every_row_id(_sorted_right_table, [&](RowID right_row_id) {
         // right_row_ids_with_match has no key `right_row_id`
@@ -437,19 +475,25 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
         }
       });
     } else {
-      left_range.for_every_row_id(_sorted_left_table, [&](RowID left_row_id) {
-        // If left_row_id not yet in _left_row_ids_emitted, this initializes it to false
-        _left_row_ids_emitted[left_row_id];
-        right_range.for_every_row_id(_sorted_right_table, [&](RowID right_row_id) {
-          // If right_row_id not yet in _right_row_id_has_match, this initializes it to false
-          _right_row_ids_emitted[right_row_id];
-          if (multi_predicate_join_evaluator.satisfies_all_predicates(left_row_id, right_row_id)) {
-            _emit_combination(output_cluster, left_row_id, right_row_id);
-            _left_row_ids_emitted[left_row_id] = true;
-            _right_row_ids_emitted[right_row_id] = true;
-          }
-        });
-      });
+      auto left_range_is_empty = true;
+      left_range.for_every_row_id(_sorted_left_table, [&](RowID /*left_row_id*/) { left_range_is_empty = false; });
+      if (left_range_is_empty) return;
+
+      // If right_row_id not yet in _right_row_ids_emitted, this initializes it to false
+      right_range.for_every_row_id(_sorted_right_table,
+                                   [&](RowID right_row_id) { _right_row_ids_emitted[right_row_id]; });
+
+      _for_every_qualified_combination(left_range, right_range, true, multi_predicate_join_evaluator,
+                                       [&](RowID left_row_id, const std::vector<RowID>& matched_right_row_ids) {
+                                         // If left_row_id not yet in _left_row_ids_emitted, this initializes it to
+                                         // false
+                                         _left_row_ids_emitted[left_row_id];
+                                         for (const auto& right_row_id : matched_right_row_ids) {
+                                           _emit_combination(output_cluster, left_row_id, right_row_id);
+                                           _left_row_ids_emitted[left_row_id] = true;
+                                           _right_row_ids_emitted[right_row_id] = true;
+                                         }
+                                       });
     }
   }
 
@@ -889,6 +933,7 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
     _sorted_right_table = std::move(sort_output.clusters_right);
     _null_rows_left = std::move(sort_output.null_rows_left);
     _null_rows_right = std::move(sort_output.null_rows_right);
+    static_cast<PerformanceData&>(*_sort_merge_join.performance_data).inputs_presorted = sort_output.inputs_presorted;
     _end_of_left_table = _end_of_table(_sorted_left_table);
     _end_of_right_table = _end_of_table(_sorted_right_table);
 
@@ -990,4 +1035,12 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
   }
 };
 
+void JoinSortMerge::PerformanceData::output_to_stream(std::ostream& stream, DescriptionMode description_mode) const {
+  OperatorPerformanceData<AbstractOperatorPerformanceData::NoSteps>::output_to_stream(stream, description_mode);
+
+  if (inputs_presorted) {
+    stream << (description_mode == DescriptionMode::SingleLine ? " " : "\n") << "Inputs were presorted.";
+  }
+}
+
 }  // namespace opossum
@@ -21,6 +21,9 @@ namespace opossum {
    *     - The output chunks will be sorted by the join columns.
    *     - The whole output table will not necessarily be entirely sorted by the join columns.
    *     - However, the whole output table will always be clustered by the join columns.
+   *
+   * If all chunks of both inputs are already sorted by the join columns (see Chunk::individually_sorted_by), the
+   * materialized chunks are not sorted again but merged (see radix_cluster_sort.hpp).
    */
 class JoinSortMerge : public AbstractJoinOperator {
  public:
@@ -33,6 +36,12 @@ class JoinSortMerge : public AbstractJoinOperator {
 
   const std::string& name() const override;
 
+  struct PerformanceData : public OperatorPerformanceData<AbstractOperatorPerformanceData::NoSteps> {
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override;
+
+    bool inputs_presorted{false};
+  };
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   void _on_cleanup() override;
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -48,6 +49,9 @@ struct Subsample {
 /**
  * Materializes a table for a specific segment and sorts it if required. Result is a triple of
  * materialized values, positions of NULL values, and a list of samples.
+ *
+ * Chunks that are already sorted by the column (see Chunk::individually_sorted_by) are not sorted again. Descending
+ * chunks are reversed.
  **/
 template <typename T>
 class ColumnMaterializer {
@@ -105,17 +109,31 @@ class ColumnMaterializer {
                                                                   std::shared_ptr<const Table> input,
                                                                   const ColumnID column_id, Subsample<T>& subsample) {
     return std::make_shared<JobTask>([this, &output, &null_rows_output, input, column_id, chunk_id, &subsample] {
-      auto segment = input->get_chunk(chunk_id)->get_segment(column_id);
+      const auto chunk = input->get_chunk(chunk_id);
+      const auto segment = chunk->get_segment(column_id);
+      const auto sorted_by = _sorted_by(*chunk, column_id);
 
-      if (const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(segment)) {
+      // The bucket sort of the dictionary specialization is not needed if the chunk is already sorted.
+      const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(segment);
+      if (dictionary_segment && !(_sort && sorted_by)) {
         (*output)[chunk_id] =
             _materialize_dictionary_segment(*dictionary_segment, chunk_id, null_rows_output, subsample);
       } else {
-        (*output)[chunk_id] = _materialize_generic_segment(*segment, chunk_id, null_rows_output, subsample);
+        (*output)[chunk_id] = _materialize_generic_segment(*segment, chunk_id, null_rows_output, subsample, sorted_by);
       }
     });
   }
 
+  /**
+   * Returns the sort mode of the given column if the chunk is sorted by it.
+   **/
+  static std::optional<SortMode> _sorted_by(const Chunk& chunk, const ColumnID column_id) {
+    for (const auto& sort_definition : chunk.individually_sorted_by()) {
+      if (sort_definition.column == column_id) return sort_definition.sort_mode;
+    }
+    return std::nullopt;
+  }
+
   /**
    * Samples values from a materialized segment.
    * We collect samples locally and write once to the global sample collection to limit non-local writes.
@@ -145,7 +163,8 @@ class ColumnMaterializer {
   std::shared_ptr<MaterializedSegment<T>> _materialize_generic_segment(const AbstractSegment& segment,
                                                                        const ChunkID chunk_id,
                                                                        std::unique_ptr<RowIDPosList>& null_rows_output,
-                                                                       Subsample<T>& subsample) {
+                                                                       Subsample<T>& subsample,
+                                                                       const std::optional<SortMode> sorted_by) {
     auto output = MaterializedSegment<T>{};
     output.reserve(segment.size());
 
@@ -161,8 +180,12 @@ class ColumnMaterializer {
     });
 
     if (_sort) {
-      std::sort(output.begin(), output.end(),
-                [](const auto& left, const auto& right) { return left.value < right.value; });
+      if (!sorted_by) {
+        std::sort(output.begin(), output.end(),
+                  [](const auto& left, const auto& right) { return left.value < right.value; });
+      } else if (*sorted_by == SortMode::Descending) {
+        std::reverse(output.begin(), output.end());
+      }
     }
 
     _gather_samples_from_segment(output, subsample);
@@ -11,6 +11,8 @@
 #include "column_materializer.hpp"
 #include "hyrise.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 
 namespace opossum {
 
@@ -23,6 +25,9 @@ struct RadixClusterOutput {
   std::unique_ptr<MaterializedSegmentList<T>> clusters_right;
   std::unique_ptr<RowIDPosList> null_rows_left;
   std::unique_ptr<RowIDPosList> null_rows_right;
+
+  // Whether the chunks of both inputs were already sorted by the join columns
+  bool inputs_presorted{false};
 };
 
 /*
@@ -38,6 +43,12 @@ struct RadixClusterOutput {
 * -> Then, either radix clustering or range clustering is performed.
 * -> At last, the resulting clusters are sorted.
 *
+* If all chunks of both inputs are already sorted by their join column (see Chunk::individually_sorted_by), the equi
+* case uses range clustering as well. As clustering keeps the order of the values of each input chunk, every cluster
+* then consists of sorted runs (one per input chunk) that are combined with a multiway merge instead of being sorted.
+* The same applies to the non-equi case, where the chunks are sorted during materialization. If the chunks are sorted
+* across chunk boundaries (e.g., the output of a Sort), a cluster is a single run and neither sorted nor merged.
+*
 * Radix clustering example:
 * cluster_count = 4
 * bits for 4 clusters: 2
@@ -310,12 +321,85 @@ class RadixClusterSort {
   }
 
   /**
-  * Sorts all clusters of a materialized table.
+  * Sorts all clusters of a materialized table in parallel. If the clusters consist of sorted runs, i.e., if the
+  * materialized chunks were sorted, the runs are merged.
   **/
-  void _sort_clusters(std::unique_ptr<MaterializedSegmentList<T>>& clusters) {
+  void _sort_clusters(std::unique_ptr<MaterializedSegmentList<T>>& clusters, const bool consist_of_sorted_runs) {
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    jobs.reserve(clusters->size());
     for (auto cluster : *clusters) {
-      std::sort(cluster->begin(), cluster->end(), [](auto& left, auto& right) { return left.value < right.value; });
+      jobs.emplace_back(std::make_shared<JobTask>([cluster, consist_of_sorted_runs] {
+        if (consist_of_sorted_runs) {
+          _merge_sorted_runs(*cluster);
+        } else {
+          std::sort(cluster->begin(), cluster->end(),
+                    [](auto& left, auto& right) { return left.value < right.value; });
+        }
+      }));
+    }
+
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  }
+
+  /**
+  * Merges the ascending runs of a cluster with a k-way merge. The run boundaries are not passed but detected, so that
+  * runs of consecutive input chunks that are sorted across chunk boundaries are treated as a single run.
+  **/
+  static void _merge_sorted_runs(MaterializedSegment<T>& cluster) {
+    // Each run is represented by the index of its next value and its end index
+    using Run = std::pair<size_t, size_t>;
+    std::vector<Run> runs;
+
+    auto run_begin = size_t{0};
+    for (auto index = size_t{1}; index < cluster.size(); ++index) {
+      if (cluster[index].value < cluster[index - 1].value) {
+        runs.emplace_back(run_begin, index);
+        run_begin = index;
+      }
+    }
+    if (runs.empty()) return;
+    runs.emplace_back(run_begin, cluster.size());
+
+    // Min-heap of the runs, ordered by their next value
+    const auto compare_runs = [&cluster](const Run& left, const Run& right) {
+      return cluster[right.first].value < cluster[left.first].value;
+    };
+    std::make_heap(runs.begin(), runs.end(), compare_runs);
+
+    auto merged_cluster = MaterializedSegment<T>{};
+    merged_cluster.reserve(cluster.size());
+    while (!runs.empty()) {
+      std::pop_heap(runs.begin(), runs.end(), compare_runs);
+      auto& run = runs.back();
+      merged_cluster.emplace_back(std::move(cluster[run.first]));
+      ++run.first;
+
+      if (run.first == run.second) {
+        runs.pop_back();
+      } else {
+        std::push_heap(runs.begin(), runs.end(), compare_runs);
+      }
     }
+
+    cluster = std::move(merged_cluster);
+  }
+
+  /**
+  * Returns whether all chunks of the table are sorted by the given column.
+  **/
+  static bool _chunks_sorted_by(const Table& table, const ColumnID column_id) {
+    const auto chunk_count = table.chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+      if (!chunk) continue;
+
+      const auto& sorted_by = chunk->individually_sorted_by();
+      if (std::none_of(sorted_by.begin(), sorted_by.end(),
+                       [&](const auto& sort_definition) { return sort_definition.column == column_id; })) {
+        return false;
+      }
+    }
+    return true;
   }
 
  public:
@@ -325,9 +409,15 @@ class RadixClusterSort {
   RadixClusterOutput<T> execute() {
     RadixClusterOutput<T> output;
 
-    // Sort the chunks of the input tables in the non-equi cases
-    ColumnMaterializer<T> left_column_materializer(!_equi_case, _materialize_null_left);
-    ColumnMaterializer<T> right_column_materializer(!_equi_case, _materialize_null_right);
+    // Sort the chunks of the input tables in the non-equi cases. If the chunks are already sorted, the materialized
+    // chunks are sorted in the equi case as well, which allows us to merge the clusters instead of sorting them.
+    const auto inputs_presorted = _chunks_sorted_by(*_left_input_table, _left_column_id) &&
+                                  _chunks_sorted_by(*_right_input_table, _right_column_id);
+    const auto sort_chunks = !_equi_case || inputs_presorted;
+    output.inputs_presorted = inputs_presorted;
+
+    ColumnMaterializer<T> left_column_materializer(sort_chunks, _materialize_null_left);
+    ColumnMaterializer<T> right_column_materializer(sort_chunks, _materialize_null_right);
     auto [materialized_left_segments, null_rows_left, samples_left] =
         left_column_materializer.materialize(_left_input_table, _left_column_id);
     auto [materialized_right_segments, null_rows_right, samples_right] =
@@ -342,19 +432,20 @@ class RadixClusterSort {
     if (_cluster_count == 1) {
       output.clusters_left = _concatenate_chunks(materialized_left_segments);
       output.clusters_right = _concatenate_chunks(materialized_right_segments);
-    } else if (_equi_case) {
+    } else if (_equi_case && !inputs_presorted) {
       output.clusters_left = _radix_cluster(materialized_left_segments);
       output.clusters_right = _radix_cluster(materialized_right_segments);
     } else {
+      // Range clustering keeps the order within the materialized chunks. Equal values end up in the same cluster, so
+      // that it can be used for the equi case as well.
       auto result = _range_cluster(materialized_left_segments, materialized_right_segments, samples_left);
       output.clusters_left = std::move(result.first);
       output.clusters_right = std::move(result.second);
     }
 
-    // Sort each cluster (right now std::sort -> but maybe can be replaced with
-    // an more efficient algorithm if subparts are already sorted [InsertionSort?!])
-    _sort_clusters(output.clusters_left);
-    _sort_clusters(output.clusters_right);
+    // Sort each cluster, or merge its sorted runs if the materialized chunks were sorted
+    _sort_clusters(output.clusters_left, sort_chunks);
+    _sort_clusters(output.clusters_right, sort_chunks);
 
     return output;
   }
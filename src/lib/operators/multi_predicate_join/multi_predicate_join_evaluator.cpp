@@ -1,5 +1,6 @@
 #include "multi_predicate_join_evaluator.hpp"
 
+#include <numeric>
 #include <vector>
 
 #include "operators/operator_join_predicate.hpp"
@@ -43,6 +44,8 @@ MultiPredicateJoinEvaluator::MultiPredicateJoinEvaluator(const Table& left, cons
   }
 }
 
+bool MultiPredicateJoinEvaluator::has_predicates() const { return !_comparators.empty(); }
+
 bool MultiPredicateJoinEvaluator::satisfies_all_predicates(const RowID& left_row_id, const RowID& right_row_id) {
   for (const auto& comparator : _comparators) {
     if (!comparator->compare(left_row_id, right_row_id)) {
@@ -53,6 +56,25 @@ bool MultiPredicateJoinEvaluator::satisfies_all_predicates(const RowID& left_row
   return true;
 }
 
+void MultiPredicateJoinEvaluator::satisfies_all_predicates(const std::vector<RowID>& left_row_ids,
+                                                           const std::vector<RowID>& right_row_ids,
+                                                           std::vector<bool>& matches) {
+  DebugAssert(left_row_ids.size() == right_row_ids.size(), "Expected the same number of left and right RowIDs");
+  const auto candidate_count = left_row_ids.size();
+
+  _selection.resize(candidate_count);
+  std::iota(_selection.begin(), _selection.end(), size_t{0});
+  for (const auto& comparator : _comparators) {
+    if (_selection.empty()) break;
+    comparator->filter(left_row_ids, right_row_ids, _selection);
+  }
+
+  matches.assign(candidate_count, false);
+  for (const auto candidate_idx : _selection) {
+    matches[candidate_idx] = true;
+  }
+}
+
 template <typename T>
 std::vector<std::unique_ptr<AbstractSegmentAccessor<T>>> MultiPredicateJoinEvaluator::_create_accessors(
     const Table& table, const ColumnID column_id) {
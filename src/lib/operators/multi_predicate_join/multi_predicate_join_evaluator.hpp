@@ -14,15 +14,36 @@ namespace opossum {
 // As accessors are not thread-safe, instances of this class should not be used in multiple threads.
 class MultiPredicateJoinEvaluator {
  public:
+  // Number of candidate pairs that the join operators collect before evaluating them with the batch interface
+  static constexpr auto BATCH_SIZE = size_t{1'024};
+
   MultiPredicateJoinEvaluator(const Table& left, const Table& right, const JoinMode join_mode,
                               const std::vector<OperatorJoinPredicate>& join_predicates);
 
+  bool has_predicates() const;
+
   bool satisfies_all_predicates(const RowID& left_row_id, const RowID& right_row_id);
 
+  /**
+   * Batch interface: For each candidate pair (left_row_ids[i], right_row_ids[i]), sets matches[i] to whether it
+   * satisfies all predicates. matches is resized to the number of candidates.
+   *
+   * Instead of comparing the values of one pair after the other, the predicates are evaluated one after the other for
+   * all pairs: The values of the predicate's columns are gathered for all pairs that satisfied the previous predicates,
+   * and compared in a tight loop. Pairs that do not satisfy a predicate are removed before the next one is evaluated.
+   */
+  void satisfies_all_predicates(const std::vector<RowID>& left_row_ids, const std::vector<RowID>& right_row_ids,
+                                std::vector<bool>& matches);
+
  protected:
   class BaseFieldComparator : public Noncopyable {
    public:
     virtual bool compare(const RowID& left, const RowID& right) const = 0;
+
+    // Removes the indices of the candidate pairs that do not satisfy the predicate from the ascending selection
+    virtual void filter(const std::vector<RowID>& left_row_ids, const std::vector<RowID>& right_row_ids,
+                        std::vector<size_t>& selection) = 0;
+
     virtual ~BaseFieldComparator() = default;
   };
 
@@ -53,15 +74,58 @@ class MultiPredicateJoinEvaluator {
       }
     }
 
+    void filter(const std::vector<RowID>& left_row_ids, const std::vector<RowID>& right_row_ids,
+                std::vector<size_t>& selection) override {
+      const auto selection_size = selection.size();
+      _left_values.resize(selection_size);
+      _right_values.resize(selection_size);
+      _nulls.resize(selection_size);
+
+      // Gather the values of the selected pairs column by column
+      for (auto selection_idx = size_t{0}; selection_idx < selection_size; ++selection_idx) {
+        const auto& left = left_row_ids[selection[selection_idx]];
+        const auto left_value = _left_accessors[left.chunk_id]->access(left.chunk_offset);
+        _left_values[selection_idx] = left_value ? *left_value : L{};
+        _nulls[selection_idx] = !left_value;
+      }
+      for (auto selection_idx = size_t{0}; selection_idx < selection_size; ++selection_idx) {
+        const auto& right = right_row_ids[selection[selection_idx]];
+        const auto right_value = _right_accessors[right.chunk_id]->access(right.chunk_offset);
+        _right_values[selection_idx] = right_value ? *right_value : R{};
+        if (!right_value) _nulls[selection_idx] = true;
+      }
+
+      // Compare the gathered values and compact the selection without branching on the result. For NULL values, see
+      // compare().
+      const auto null_result = _join_mode == JoinMode::AntiNullAsTrue;
+      auto selected_count = size_t{0};
+      for (auto selection_idx = size_t{0}; selection_idx < selection_size; ++selection_idx) {
+        const auto result = _nulls[selection_idx] ? null_result
+                                                  : _compare_functor(_left_values[selection_idx],
+                                                                     _right_values[selection_idx]);
+        selection[selected_count] = selection[selection_idx];
+        selected_count += result;
+      }
+      selection.resize(selected_count);
+    }
+
    private:
     const CompareFunctor _compare_functor;
     const JoinMode _join_mode;
     const std::vector<std::unique_ptr<AbstractSegmentAccessor<L>>> _left_accessors;
     const std::vector<std::unique_ptr<AbstractSegmentAccessor<R>>> _right_accessors;
+
+    // Buffers for the gathered values, kept across batches to avoid reallocations
+    std::vector<L> _left_values;
+    std::vector<R> _right_values;
+    std::vector<uint8_t> _nulls;
   };
 
   std::vector<std::unique_ptr<BaseFieldComparator>> _comparators;
 
+  // Indices of the candidate pairs that satisfied all predicates evaluated so far, used by the batch interface
+  std::vector<size_t> _selection;
+
   template <typename T>
   static std::vector<std::unique_ptr<AbstractSegmentAccessor<T>>> _create_accessors(const Table& table,
                                                                                     const ColumnID column_id);
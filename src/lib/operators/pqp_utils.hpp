@@ -37,9 +37,11 @@ void visit_pqp(const std::shared_ptr<Operator>& pqp, Visitor visitor) {
       if constexpr (std::is_const_v<AbstractOperatorType>) {
         if (op->left_input()) operator_queue.push(op->left_input());
         if (op->right_input()) operator_queue.push(op->right_input());
+        for (const auto& input : op->additional_inputs()) operator_queue.push(input);
       } else {
         if (op->left_input()) operator_queue.push(op->mutable_left_input());
         if (op->right_input()) operator_queue.push(op->mutable_right_input());
+        for (const auto& input : op->mutable_additional_inputs()) operator_queue.push(input);
       }
     }
   }
@@ -12,6 +12,7 @@
 #include "expression/expression_utils.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "operators/row_budget.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/vector_compression/vector_compression.hpp"
@@ -100,12 +101,22 @@ std::shared_ptr<const Table> Projection::_on_execute() {
   // Perform the actual projection on a per-chunk level. `output_segments_by_chunk` will contain both forwarded and
   // newly generated columns. In the upcoming loop, we do not yet deal with the projection_result_table indirection
   // described above.
-  auto output_segments_by_chunk = std::vector<Segments>(input_table.chunk_count());
+  // If a downstream Limit only needs the rows of the first chunks, the remaining chunks are neither evaluated nor
+  // part of the output. As the Projection neither adds nor removes rows, these chunks are known upfront.
+  auto row_budget = RowBudget{_output_row_budget};
+  auto chunk_count = ChunkID{0};
+  while (chunk_count < input_table.chunk_count() && !row_budget.is_exhausted()) {
+    const auto input_chunk = input_table.get_chunk(chunk_count);
+    Assert(input_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+    row_budget.consume(input_chunk->size());
+    ++chunk_count;
+  }
+
+  auto output_segments_by_chunk = std::vector<Segments>(chunk_count);
 
   auto forwarding_cost = std::chrono::nanoseconds{};
   auto expression_evaluator_cost = std::chrono::nanoseconds{};
 
-  const auto chunk_count = input_table.chunk_count();
   for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
     const auto input_chunk = input_table.get_chunk(chunk_id);
     Assert(input_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
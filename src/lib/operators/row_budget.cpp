@@ -0,0 +1,14 @@
+#include "row_budget.hpp"
+
+#include <limits>
+
+namespace opossum {
+
+RowBudget::RowBudget(const std::optional<size_t>& row_count)
+    : _row_count(row_count.value_or(std::numeric_limits<size_t>::max())) {}
+
+bool RowBudget::is_exhausted() const { return _consumed_row_count.load() >= _row_count; }
+
+void RowBudget::consume(const size_t row_count) { _consumed_row_count += row_count; }
+
+}  // namespace opossum
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <atomic>
+#include <optional>
+
+namespace opossum {
+
+/**
+ * Counts the rows that an operator has produced against the output row budget that a downstream Limit has given it
+ * (see AbstractOperator::set_output_row_budget). It is shared by the jobs that produce the output chunks: Each job
+ * checks whether the budget is exhausted before it processes a chunk and afterwards consumes the rows that it has
+ * produced. As the jobs run concurrently, the output may exceed the budget, but it never falls short of it.
+ */
+class RowBudget {
+ public:
+  // Without a row count, the budget is never exhausted
+  explicit RowBudget(const std::optional<size_t>& row_count);
+
+  bool is_exhausted() const;
+  void consume(const size_t row_count);
+
+ private:
+  const size_t _row_count;
+  std::atomic<size_t> _consumed_row_count{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,310 @@
+#include "runtime_join_filter.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "operators/join_hash/join_hash_bloom_filter.hpp"
+#include "operators/join_hash/join_hash_traits.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "statistics/statistics_objects/range_filter.hpp"
+#include "storage/chunk.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+using namespace std::string_literals;  // NOLINT
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Filter over the join column of the build side. Values are hashed and compared the same way as in JoinHash, i.e.,
+// after casting them to the HashedType that JoinHash uses for the two join columns.
+template <typename HashedType>
+struct BuildSideFilter {
+  BloomFilter bloom_filter;
+  std::optional<HashedType> min;
+  std::optional<HashedType> max;
+
+  bool might_contain(const HashedType& value) const {
+    return min && value >= *min && value <= *max && bloom_filter.contains(std::hash<HashedType>{}(value));
+  }
+
+  // Used for pruning. The cast to the HashedType is monotonic, so the order of the bounds is preserved.
+  bool might_contain_range(const HashedType& range_min, const HashedType& range_max) const {
+    return min && range_max >= *min && range_min <= *max;
+  }
+};
+
+template <typename BuildColumnType, typename HashedType>
+BuildSideFilter<HashedType> create_build_side_filter(const Table& build_table, const ColumnID column_id) {
+  auto filter = BuildSideFilter<HashedType>{BloomFilter(build_table.row_count()), std::nullopt, std::nullopt};
+  auto range_mutex = std::mutex{};
+  const auto hash_function = std::hash<HashedType>{};
+
+  const auto chunk_count = build_table.chunk_count();
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = build_table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk]() {
+      auto local_min = std::optional<HashedType>{};
+      auto local_max = std::optional<HashedType>{};
+
+      segment_iterate<BuildColumnType>(*chunk->get_segment(column_id), [&](const auto& position) {
+        if (position.is_null()) return;
+
+        const auto value = static_cast<HashedType>(position.value());
+        filter.bloom_filter.insert_concurrently(hash_function(value));
+        if (!local_min || value < *local_min) local_min = value;
+        if (!local_max || value > *local_max) local_max = value;
+      });
+
+      if (!local_min) return;
+
+      const auto lock = std::lock_guard<std::mutex>{range_mutex};
+      if (!filter.min || *local_min < *filter.min) filter.min = std::move(local_min);
+      if (!filter.max || *local_max > *filter.max) filter.max = std::move(local_max);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  // Even if the bloom filter is ineffective, the range of the build side's values might still be used for pruning.
+  filter.bloom_filter.disable_if_ineffective();
+
+  return filter;
+}
+
+// Returns the range of values of a stored chunk's segment as stored in its pruning statistics, if available.
+template <typename T>
+std::optional<std::pair<T, T>> segment_range(const Chunk& chunk, const ColumnID column_id) {
+  const auto& pruning_statistics = chunk.pruning_statistics();
+  if (!pruning_statistics) return std::nullopt;
+
+  const auto attribute_statistics =
+      std::dynamic_pointer_cast<const AttributeStatistics<T>>((*pruning_statistics)[column_id]);
+  if (!attribute_statistics) return std::nullopt;
+
+  if (attribute_statistics->min_max_filter) {
+    return std::pair<T, T>{attribute_statistics->min_max_filter->min, attribute_statistics->min_max_filter->max};
+  }
+
+  if constexpr (std::is_arithmetic_v<T>) {
+    if (attribute_statistics->range_filter && !attribute_statistics->range_filter->ranges.empty()) {
+      const auto& ranges = attribute_statistics->range_filter->ranges;
+      return std::pair<T, T>{ranges.front().first, ranges.back().second};
+    }
+  }
+
+  return std::nullopt;
+}
+
+}  // namespace
+
+namespace opossum {
+
+RuntimeJoinFilter::RuntimeJoinFilter(const std::shared_ptr<const AbstractOperator>& probe_input,
+                                     const std::shared_ptr<const AbstractOperator>& build_input,
+                                     const ColumnIDPair& column_ids)
+    : AbstractReadOnlyOperator(OperatorType::RuntimeJoinFilter, probe_input, build_input,
+                               std::make_unique<PerformanceData>()),
+      _column_ids(column_ids) {}
+
+const std::string& RuntimeJoinFilter::name() const {
+  static const auto name = std::string{"RuntimeJoinFilter"};
+  return name;
+}
+
+std::string RuntimeJoinFilter::description(DescriptionMode description_mode) const {
+  const auto column_name = [&](const auto& input, const auto column_id) {
+    const auto& input_table = input->get_output();
+    return input_table ? input_table->column_name(column_id) : "Column #"s + std::to_string(column_id);
+  };
+
+  const auto* const separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+  stream << name() << separator << "(" << column_name(_left_input, _column_ids.first) << " IN build side "
+         << column_name(_right_input, _column_ids.second) << ")";
+  return stream.str();
+}
+
+const ColumnIDPair& RuntimeJoinFilter::column_ids() const { return _column_ids; }
+
+std::shared_ptr<const Table> RuntimeJoinFilter::_on_execute() {
+  auto output_table = std::shared_ptr<const Table>{};
+
+  resolve_data_type(left_input_table()->column_data_type(_column_ids.first), [&](const auto probe_data_type_t) {
+    using ProbeColumnDataType = typename decltype(probe_data_type_t)::type;
+    resolve_data_type(right_input_table()->column_data_type(_column_ids.second), [&](const auto build_data_type_t) {
+      using BuildColumnDataType = typename decltype(build_data_type_t)::type;
+
+      constexpr auto NEITHER_IS_STRING =
+          !std::is_same_v<pmr_string, ProbeColumnDataType> && !std::is_same_v<pmr_string, BuildColumnDataType>;
+      constexpr auto BOTH_ARE_STRING =
+          std::is_same_v<pmr_string, ProbeColumnDataType> && std::is_same_v<pmr_string, BuildColumnDataType>;
+
+      if constexpr (NEITHER_IS_STRING || BOTH_ARE_STRING) {
+        output_table = _filter<ProbeColumnDataType, BuildColumnDataType>();
+      } else {
+        Fail("Cannot filter String with non-String column");
+      }
+    });
+  });
+
+  return output_table;
+}
+
+template <typename ProbeColumnType, typename BuildColumnType>
+std::shared_ptr<const Table> RuntimeJoinFilter::_filter() {
+  using HashedType = typename JoinHashTraits<ProbeColumnType, BuildColumnType>::HashType;
+
+  const auto filter =
+      create_build_side_filter<BuildColumnType, HashedType>(*right_input_table(), _column_ids.second);
+
+  const auto& probe_table = left_input_table();
+  const auto chunk_count = probe_table->chunk_count();
+  const auto column_count = probe_table->column_count();
+
+  auto chunks_pruned = std::atomic<size_t>{0};
+  auto rows_filtered = std::atomic<size_t>{0};
+
+  // Output chunks are written to the position of their input chunk to keep the order of the input.
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk_in = probe_table->get_chunk(chunk_id);
+    Assert(chunk_in, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+    // Without a single non-NULL value on the build side, no row can find a join partner. Otherwise, chunks of stored
+    // tables can be pruned if the range of their values does not overlap with the build side's range.
+    if (!filter.min) {
+      ++chunks_pruned;
+      continue;
+    }
+
+    if (probe_table->type() == TableType::Data) {
+      const auto range = segment_range<ProbeColumnType>(*chunk_in, _column_ids.first);
+      if (range && !filter.might_contain_range(static_cast<HashedType>(range->first),
+                                               static_cast<HashedType>(range->second))) {
+        ++chunks_pruned;
+        continue;
+      }
+    }
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id, chunk_in]() {
+      // Rows that are appended to a mutable chunk while it is being filtered are ignored (as they are not visible for
+      // the current transaction anyway).
+      const auto chunk_size = chunk_in->size();
+
+      auto matches = std::make_shared<RowIDPosList>();
+      segment_with_iterators<ProbeColumnType>(*chunk_in->get_segment(_column_ids.first), [&](auto it, const auto end) {
+        for (auto chunk_offset = ChunkOffset{0}; it != end && chunk_offset < chunk_size; ++it, ++chunk_offset) {
+          const auto& position = *it;
+          if (!position.is_null() && filter.might_contain(static_cast<HashedType>(position.value()))) {
+            matches->emplace_back(chunk_id, chunk_offset);
+          }
+        }
+      });
+
+      rows_filtered += chunk_size - matches->size();
+      if (matches->empty()) return;
+
+      auto output_segments = Segments{};
+      output_segments.reserve(column_count);
+
+      if (probe_table->type() == TableType::References) {
+        if (matches->size() == chunk_size) {
+          // The entire chunk passes the filter, so we can simply forward it
+          output_chunks[chunk_id] = std::const_pointer_cast<Chunk>(chunk_in);
+          return;
+        }
+
+        // Resolve the matches so that the output references the stored tables. Columns that share their input
+        // PosList also share their output PosList (see TableScan).
+        auto filtered_pos_lists = std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<RowIDPosList>>{};
+        for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+          const auto reference_segment =
+              std::static_pointer_cast<const ReferenceSegment>(chunk_in->get_segment(column_id));
+          const auto& pos_list_in = reference_segment->pos_list();
+
+          auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+          if (!filtered_pos_list) {
+            filtered_pos_list = std::make_shared<RowIDPosList>();
+            filtered_pos_list->reserve(matches->size());
+            for (const auto& match : *matches) {
+              filtered_pos_list->emplace_back((*pos_list_in)[match.chunk_offset]);
+            }
+            if (pos_list_in->references_single_chunk()) filtered_pos_list->guarantee_single_chunk();
+          }
+
+          output_segments.emplace_back(std::make_shared<ReferenceSegment>(
+              reference_segment->referenced_table(), reference_segment->referenced_column_id(), filtered_pos_list));
+        }
+      } else {
+        matches->guarantee_single_chunk();
+
+        // If the entire chunk passes the filter, create an EntireChunkPosList instead
+        auto output_pos_list = std::shared_ptr<AbstractPosList>{matches};
+        if (matches->size() == chunk_size) output_pos_list = std::make_shared<EntireChunkPosList>(chunk_id, chunk_size);
+
+        for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+          output_segments.emplace_back(std::make_shared<ReferenceSegment>(probe_table, column_id, output_pos_list));
+        }
+      }
+
+      // Filtering keeps the order of the rows within a chunk.
+      const auto output_chunk = std::make_shared<Chunk>(output_segments, nullptr, chunk_in->get_allocator());
+      output_chunk->finalize();
+      if (!chunk_in->individually_sorted_by().empty()) {
+        output_chunk->set_individually_sorted_by(chunk_in->individually_sorted_by());
+      }
+      output_chunks[chunk_id] = output_chunk;
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  output_chunks.erase(std::remove(output_chunks.begin(), output_chunks.end(), nullptr), output_chunks.end());
+
+  auto& performance = static_cast<PerformanceData&>(*performance_data);
+  performance.chunks_pruned = chunks_pruned;
+  performance.rows_filtered = rows_filtered;
+
+  return std::make_shared<Table>(probe_table->column_definitions(), TableType::References, std::move(output_chunks));
+}
+
+std::shared_ptr<AbstractOperator> RuntimeJoinFilter::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  return std::make_shared<RuntimeJoinFilter>(copied_left_input, copied_right_input, _column_ids);
+}
+
+void RuntimeJoinFilter::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+void RuntimeJoinFilter::PerformanceData::output_to_stream(std::ostream& stream,
+                                                          DescriptionMode description_mode) const {
+  OperatorPerformanceData<AbstractOperatorPerformanceData::NoSteps>::output_to_stream(stream, description_mode);
+
+  stream << (description_mode == DescriptionMode::SingleLine ? " " : "\n") << "Chunks pruned: " << chunks_pruned
+         << ", rows filtered: " << rows_filtered << ".";
+}
+
+}  // namespace opossum
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Sideways information passing for hash joins: The RuntimeJoinFilter reads the build side of a join (right input) and
+ * creates a filter over its join column, consisting of a bloom filter (as used by JoinHash, see
+ * join_hash_bloom_filter.hpp) and the range of the build side's values. The filter is applied to the probe side (left
+ * input), which is usually the output of a GetTable: Chunks whose pruning statistics do not overlap with the range are
+ * skipped without being accessed, and rows that cannot find a join partner are dropped before the join (and the table
+ * scans between the GetTable and the join) have to process them.
+ *
+ * As the bloom filter has false positives, the output is a superset of what a semi join would emit. Thus, the
+ * RuntimeJoinFilter does not replace the join, but is placed on its probe side by the RuntimeJoinFilterRule. NULL
+ * values never find a join partner and are dropped.
+ */
+class RuntimeJoinFilter : public AbstractReadOnlyOperator {
+ public:
+  // column_ids.first refers to the probe side (left input), column_ids.second to the build side (right input).
+  RuntimeJoinFilter(const std::shared_ptr<const AbstractOperator>& probe_input,
+                    const std::shared_ptr<const AbstractOperator>& build_input, const ColumnIDPair& column_ids);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  const ColumnIDPair& column_ids() const;
+
+  struct PerformanceData : public OperatorPerformanceData<AbstractOperatorPerformanceData::NoSteps> {
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override;
+
+    size_t chunks_pruned{0};
+    size_t rows_filtered{0};
+  };
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  template <typename ProbeColumnType, typename BuildColumnType>
+  std::shared_ptr<const Table> _filter();
+
+ private:
+  const ColumnIDPair _column_ids;
+};
+
+}  // namespace opossum
@@ -0,0 +1,299 @@
+#include "set_operation_hash.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <magic_enum.hpp>
+
+#include "boost/functional/hash.hpp"
+
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace opossum {
+
+SetOperationHash::SetOperationHash(const std::shared_ptr<const AbstractOperator>& left_in,
+                                   const std::shared_ptr<const AbstractOperator>& right_in,
+                                   const SetOperation set_operation)
+    : AbstractReadOnlyOperator(OperatorType::SetOperationHash, left_in, right_in,
+                               std::make_unique<OperatorPerformanceData<OperatorSteps>>()),
+      _set_operation(set_operation) {}
+
+const std::string& SetOperationHash::name() const {
+  static const auto name = std::string{"SetOperationHash"};
+  return name;
+}
+
+std::string SetOperationHash::description(DescriptionMode description_mode) const {
+  const auto* const separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+  stream << name() << separator << magic_enum::enum_name(_set_operation);
+  return stream.str();
+}
+
+SetOperation SetOperationHash::set_operation() const { return _set_operation; }
+
+std::shared_ptr<AbstractOperator> SetOperationHash::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  return std::make_shared<SetOperationHash>(copied_left_input, copied_right_input, _set_operation);
+}
+
+void SetOperationHash::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+void SetOperationHash::_on_cleanup() { _column_values.clear(); }
+
+std::shared_ptr<const Table> SetOperationHash::_on_execute() {
+  Timer timer;
+
+  const auto& left_table = left_input_table();
+  const auto& right_table = right_input_table();
+
+  const auto column_count = left_table->column_count();
+  Assert(right_table->column_count() == column_count, "Input tables must have the same number of columns");
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    Assert(left_table->column_data_type(column_id) == right_table->column_data_type(column_id),
+           "Input tables must have the same column data types");
+  }
+
+  // The chunks of both inputs are addressed by a common ChunkID, where the right input's chunks come after the left
+  // input's chunks. This way, the rows of both inputs can be compared and hashed in the same way.
+  const auto left_chunk_count = left_table->chunk_count();
+  const auto chunk_count = ChunkID{left_chunk_count + right_table->chunk_count()};
+
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(left_table->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      _column_values.emplace_back(
+          std::make_unique<SortColumnValues<ColumnDataType>>(column_id, SortMode::Ascending, chunk_count));
+    });
+  }
+
+  // Similar to the AggregateHash, the number of hash partitions is a power of two, so that the partition is given by
+  // the upper bits of the hash value
+  auto radix_bits = size_t{0};
+  while ((size_t{1} << radix_bits) < std::min(static_cast<size_t>(chunk_count), MAX_PARTITION_COUNT)) {
+    ++radix_bits;
+  }
+  const auto partition_count = size_t{1} << radix_bits;
+
+  // Phase 1: Hash and partition the rows of each chunk. rows[partition_idx][chunk_id] holds the chunk's rows that
+  // belong to the hash partition.
+  auto rows = std::vector<std::vector<RowIDPosList>>(partition_count);
+  for (auto& partition_rows : rows) {
+    partition_rows.resize(chunk_count);
+  }
+  auto hashes = std::vector<std::vector<size_t>>(chunk_count);
+  auto kept_rows = std::vector<std::vector<uint8_t>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto& input_table = chunk_id < left_chunk_count ? left_table : right_table;
+      const auto input_chunk_id = chunk_id < left_chunk_count ? chunk_id : ChunkID{chunk_id - left_chunk_count};
+      const auto chunk = input_table->get_chunk(input_chunk_id);
+      Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+      for (const auto& column_values : _column_values) {
+        column_values->materialize(*chunk, chunk_id);
+      }
+
+      // NULLs are hashed as 0, so that all NULLs end up in the same partition
+      const auto chunk_size = chunk->size();
+      auto& chunk_hashes = hashes[chunk_id];
+      chunk_hashes.resize(chunk_size);
+      kept_rows[chunk_id].resize(chunk_size);
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        resolve_data_type(input_table->column_data_type(column_id), [&](const auto data_type_t) {
+          using ColumnDataType = typename decltype(data_type_t)::type;
+          segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+            const auto value_hash = position.is_null() ? size_t{0} : std::hash<ColumnDataType>{}(position.value());
+            boost::hash_combine(chunk_hashes[position.chunk_offset()], value_hash);
+          });
+        });
+      }
+
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        // Fibonacci hashing spreads similar hash values across the partitions
+        const auto partition_idx =
+            radix_bits == 0 ? size_t{0}
+                            : (chunk_hashes[chunk_offset] * 11'400'714'819'323'198'485ul) >> (64 - radix_bits);
+        rows[partition_idx][chunk_id].emplace_back(RowID{chunk_id, chunk_offset});
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  auto& step_performance_data = dynamic_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
+  step_performance_data.set_step_runtime(OperatorSteps::PartitionRows, timer.lap());
+
+  // Phase 2: Build and probe a hash set per partition. The jobs mark the kept rows at disjoint positions of
+  // kept_rows, which is why the flags are stored as bytes instead of in a (not thread-safe) vector<bool>.
+  const auto row_hash = [&](const RowID& row_id) { return hashes[row_id.chunk_id][row_id.chunk_offset]; };
+  const auto rows_equal = [&](const RowID& lhs, const RowID& rhs) { return _rows_equal(lhs, rhs); };
+
+  jobs.clear();
+  jobs.reserve(partition_count);
+  for (auto partition_idx = size_t{0}; partition_idx < partition_count; ++partition_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_idx]() {
+      const auto& partition_rows = rows[partition_idx];
+      const auto right_rows_begin = partition_rows.cbegin() + left_chunk_count;
+
+      auto row_count = size_t{0};
+      for (const auto& chunk_rows : partition_rows) {
+        row_count += chunk_rows.size();
+      }
+      auto hash_set = std::unordered_set<RowID, decltype(row_hash), decltype(rows_equal)>(row_count, row_hash,
+                                                                                         rows_equal);
+
+      const auto keep_row = [&](const RowID& row_id) { kept_rows[row_id.chunk_id][row_id.chunk_offset] = 1; };
+
+      switch (_set_operation) {
+        case SetOperation::Union:
+          for (const auto& chunk_rows : partition_rows) {
+            for (const auto& row_id : chunk_rows) {
+              if (hash_set.emplace(row_id).second) keep_row(row_id);
+            }
+          }
+          break;
+
+        case SetOperation::Intersect:
+          // Each right row is removed once a left row has matched it, so that only the first matching left row is kept
+          std::for_each(right_rows_begin, partition_rows.cend(),
+                        [&](const auto& chunk_rows) { hash_set.insert(chunk_rows.cbegin(), chunk_rows.cend()); });
+          std::for_each(partition_rows.cbegin(), right_rows_begin, [&](const auto& chunk_rows) {
+            for (const auto& row_id : chunk_rows) {
+              if (hash_set.erase(row_id) > 0) keep_row(row_id);
+            }
+          });
+          break;
+
+        case SetOperation::Except:
+          // Left rows can only be inserted if neither a right row nor an earlier left row is equal to them
+          std::for_each(right_rows_begin, partition_rows.cend(),
+                        [&](const auto& chunk_rows) { hash_set.insert(chunk_rows.cbegin(), chunk_rows.cend()); });
+          std::for_each(partition_rows.cbegin(), right_rows_begin, [&](const auto& chunk_rows) {
+            for (const auto& row_id : chunk_rows) {
+              if (hash_set.emplace(row_id).second) keep_row(row_id);
+            }
+          });
+          break;
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  step_performance_data.set_step_runtime(OperatorSteps::BuildAndProbe, timer.lap());
+
+  // Phase 3: Write an output chunk per input chunk with kept rows. Only UNION keeps rows of the right input.
+  const auto output_chunk_count = _set_operation == SetOperation::Union ? chunk_count : left_chunk_count;
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(output_chunk_count);
+
+  jobs.clear();
+  jobs.reserve(output_chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < output_chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      if (chunk_id < left_chunk_count) {
+        output_chunks[chunk_id] = _write_output_chunk(left_table, chunk_id, kept_rows[chunk_id]);
+      } else {
+        output_chunks[chunk_id] =
+            _write_output_chunk(right_table, ChunkID{chunk_id - left_chunk_count}, kept_rows[chunk_id]);
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  output_chunks.erase(std::remove(output_chunks.begin(), output_chunks.end(), nullptr), output_chunks.end());
+
+  auto output_column_definitions = left_table->column_definitions();
+  if (_set_operation == SetOperation::Union) {
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      output_column_definitions[column_id].nullable |= right_table->column_is_nullable(column_id);
+    }
+  }
+
+  step_performance_data.set_step_runtime(OperatorSteps::WriteOutput, timer.lap());
+
+  return std::make_shared<Table>(output_column_definitions, TableType::References, std::move(output_chunks));
+}
+
+bool SetOperationHash::_rows_equal(const RowID& lhs, const RowID& rhs) const {
+  return std::all_of(_column_values.cbegin(), _column_values.cend(),
+                     [&](const auto& column_values) { return column_values->compare(lhs, rhs) == 0; });
+}
+
+std::shared_ptr<Chunk> SetOperationHash::_write_output_chunk(const std::shared_ptr<const Table>& input_table,
+                                                             const ChunkID chunk_id,
+                                                             const std::vector<uint8_t>& kept_rows) {
+  auto kept_chunk_offsets = std::vector<ChunkOffset>{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < kept_rows.size(); ++chunk_offset) {
+    if (kept_rows[chunk_offset]) kept_chunk_offsets.emplace_back(chunk_offset);
+  }
+  if (kept_chunk_offsets.empty()) return nullptr;
+
+  const auto input_chunk = input_table->get_chunk(chunk_id);
+  const auto column_count = input_table->column_count();
+
+  auto output_segments = Segments{};
+  output_segments.reserve(column_count);
+
+  if (input_table->type() == TableType::Data) {
+    auto pos_list = std::make_shared<RowIDPosList>();
+    pos_list->reserve(kept_chunk_offsets.size());
+    for (const auto chunk_offset : kept_chunk_offsets) {
+      pos_list->emplace_back(RowID{chunk_id, chunk_offset});
+    }
+    pos_list->guarantee_single_chunk();
+
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      output_segments.emplace_back(std::make_shared<ReferenceSegment>(input_table, column_id, pos_list));
+    }
+  } else {
+    // Segments that share a PosList in the input share a PosList in the output as well (see table_scan.hpp)
+    auto output_pos_lists = std::unordered_map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<RowIDPosList>>{};
+
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto reference_segment =
+          std::static_pointer_cast<const ReferenceSegment>(input_chunk->get_segment(column_id));
+      const auto& input_pos_list = reference_segment->pos_list();
+
+      auto& pos_list = output_pos_lists[input_pos_list];
+      if (!pos_list) {
+        pos_list = std::make_shared<RowIDPosList>();
+        pos_list->reserve(kept_chunk_offsets.size());
+        for (const auto chunk_offset : kept_chunk_offsets) {
+          pos_list->emplace_back((*input_pos_list)[chunk_offset]);
+        }
+        if (input_pos_list->references_single_chunk()) pos_list->guarantee_single_chunk();
+      }
+
+      output_segments.emplace_back(std::make_shared<ReferenceSegment>(
+          reference_segment->referenced_table(), reference_segment->referenced_column_id(), pos_list));
+    }
+  }
+
+  // The kept rows are in the order of the input chunk, so that they are still sorted like the input chunk
+  const auto output_chunk = std::make_shared<Chunk>(std::move(output_segments));
+  output_chunk->finalize();
+  const auto& sorted_by = input_chunk->individually_sorted_by();
+  if (!sorted_by.empty()) output_chunk->set_individually_sorted_by(sorted_by);
+
+  return output_chunk;
+}
+
+}  // namespace opossum
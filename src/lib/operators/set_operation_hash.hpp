@@ -0,0 +1,71 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "operators/sort/sort_utils.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class SetOperation { Union, Intersect, Except };
+
+/**
+ * Computes UNION, INTERSECT, or EXCEPT with set semantics (i.e., UNION DISTINCT, INTERSECT DISTINCT, and EXCEPT
+ * DISTINCT) on two inputs with the same column types. Rows are compared by all of their columns, and NULLs are
+ * considered equal to each other, as SQL demands for set operations. The output is a reference table: INTERSECT and
+ * EXCEPT return distinct rows of the left input, UNION returns distinct rows of the left input followed by those rows
+ * of the right input that are not part of the left input.
+ *
+ * The rows are processed in three phases:
+ *  1. Each chunk of both inputs is processed by a job of its own, which materializes the chunk's values and hashes its
+ *     rows by the values of all columns (without converting them to strings). The rows are then radix-partitioned by
+ *     their hashes, similar to the AggregateHash.
+ *  2. Each hash partition is processed by a job of its own. As equal rows share a hash partition, the partitions can be
+ *     processed independently: For UNION, the left and then the right rows are inserted into a hash set, and those
+ *     that are not yet contained are kept. For INTERSECT and EXCEPT, a hash set of the right rows is built first, which
+ *     is then probed by the left rows.
+ *  3. Each input chunk with kept rows is turned into an output chunk, again by a job per chunk. The rows keep their
+ *     order within the chunk, so that the chunks' sort orders are forwarded.
+ */
+class SetOperationHash : public AbstractReadOnlyOperator {
+ public:
+  SetOperationHash(const std::shared_ptr<const AbstractOperator>& left_in,
+                   const std::shared_ptr<const AbstractOperator>& right_in, const SetOperation set_operation);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  SetOperation set_operation() const;
+
+  enum class OperatorSteps : uint8_t { PartitionRows, BuildAndProbe, WriteOutput };
+
+  // Upper bound for the number of hash partitions, i.e., for the number of jobs that build and probe the hash sets
+  static constexpr auto MAX_PARTITION_COUNT = size_t{64};
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+  void _on_cleanup() override;
+
+  // Whether two rows have equal values in all columns. Rows of the right input are addressed by ChunkIDs that are
+  // offset by the left input's chunk count.
+  bool _rows_equal(const RowID& lhs, const RowID& rhs) const;
+
+  // Builds an output chunk from the kept rows of an input chunk, or returns nullptr if no row of the chunk is kept
+  static std::shared_ptr<Chunk> _write_output_chunk(const std::shared_ptr<const Table>& input_table,
+                                                    const ChunkID chunk_id, const std::vector<uint8_t>& kept_rows);
+
+ private:
+  const SetOperation _set_operation;
+
+  // Materialized values of the columns of both inputs, used to compare rows. Only set during execution.
+  std::vector<std::unique_ptr<BaseSortColumnValues>> _column_values;
+};
+
+}  // namespace opossum
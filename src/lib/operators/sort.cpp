@@ -1,218 +1,416 @@
 #include "sort.hpp"
 
-#include "storage/segment_iterate.hpp"
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+
+#include "hyrise.hpp"
+#include "operators/sort/normalized_keys.hpp"
+#include "operators/sort/sort_utils.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/spill_file.hpp"
 #include "utils/timer.hpp"
 
 namespace {
 
 using namespace opossum;  // NOLINT
 
-// Given an unsorted_table and a pos_list that defines the output order, this materializes all columns in the table,
-// creating chunks of output_chunk_size rows at maximum.
-std::shared_ptr<Table> write_materialized_output_table(const std::shared_ptr<const Table>& unsorted_table,
-                                                       RowIDPosList pos_list, const ChunkOffset output_chunk_size) {
-  // First, we create a new table as the output
-  // We have decided against duplicating MVCC data in https://github.com/hyrise/hyrise/issues/408
-  auto output = std::make_shared<Table>(unsorted_table->column_definitions(), TableType::Data, output_chunk_size);
-
-  // After we created the output table and initialized the column structure, we can start adding values. Because the
-  // values are not sorted by input chunks anymore, we can't process them chunk by chunk. Instead the values are copied
-  // column by column for each output row.
-
-  // Ceiling of integer division
-  const auto div_ceil = [](auto x, auto y) { return (x + y - 1u) / y; };
-  const auto output_chunk_count = div_ceil(pos_list.size(), output_chunk_size);
-  Assert(pos_list.size() == unsorted_table->row_count(), "Mismatching size of input table and PosList");
-
-  // Vector of segments for each chunk
-  std::vector<Segments> output_segments_by_chunk(output_chunk_count);
-
-  // Materialize column by column, starting a new ValueSegment whenever output_chunk_size is reached
-  const auto input_chunk_count = unsorted_table->chunk_count();
-  const auto row_count = unsorted_table->row_count();
-  for (ColumnID column_id{0u}; column_id < output->column_count(); ++column_id) {
-    const auto column_data_type = output->column_data_type(column_id);
-    const auto column_is_nullable = unsorted_table->column_is_nullable(column_id);
-
-    resolve_data_type(column_data_type, [&](auto type) {
+// Given an unsorted_table and a pos_list that defines the order of an output chunk's rows, this materializes all
+// columns of the output chunk.
+Segments write_materialized_output_segments(const Table& unsorted_table, const RowIDPosList& pos_list) {
+  // Because the values are not sorted by input chunks anymore, we can't process them chunk by chunk. Instead, the
+  // values are copied column by column. Accessors for the input segments are only created once a row references them.
+  const auto input_chunk_count = unsorted_table.chunk_count();
+  const auto column_count = unsorted_table.column_count();
+  auto output_segments = Segments(column_count);
+
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(unsorted_table.column_data_type(column_id), [&](auto type) {
       using ColumnDataType = typename decltype(type)::type;
 
-      auto chunk_it = output_segments_by_chunk.begin();
-      auto current_segment_size = 0u;
-
-      auto value_segment_value_vector = pmr_vector<ColumnDataType>();
-      auto value_segment_null_vector = pmr_vector<bool>();
-
-      {
-        const auto next_chunk_size = std::min(static_cast<size_t>(output_chunk_size), static_cast<size_t>(row_count));
-        value_segment_value_vector.reserve(next_chunk_size);
-        if (column_is_nullable) value_segment_null_vector.reserve(next_chunk_size);
-      }
-
       auto accessor_by_chunk_id =
-          std::vector<std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>>(unsorted_table->chunk_count());
-      for (auto input_chunk_id = ChunkID{0}; input_chunk_id < input_chunk_count; ++input_chunk_id) {
-        const auto& abstract_segment = unsorted_table->get_chunk(input_chunk_id)->get_segment(column_id);
-        accessor_by_chunk_id[input_chunk_id] = create_segment_accessor<ColumnDataType>(abstract_segment);
-      }
+          std::vector<std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>>(input_chunk_count);
+      auto values = pmr_vector<ColumnDataType>(pos_list.size());
+      auto null_values = pmr_vector<bool>(pos_list.size());
 
-      for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+      for (auto row_index = size_t{0}; row_index < pos_list.size(); ++row_index) {
         const auto [chunk_id, chunk_offset] = pos_list[row_index];
 
         auto& accessor = accessor_by_chunk_id[chunk_id];
-        const auto typed_value = accessor->access(chunk_offset);
-        const auto is_null = !typed_value;
-        value_segment_value_vector.push_back(is_null ? ColumnDataType{} : typed_value.value());
-        if (column_is_nullable) value_segment_null_vector.push_back(is_null);
-
-        ++current_segment_size;
-
-        // Check if value segment is full
-        if (current_segment_size >= output_chunk_size) {
-          current_segment_size = 0u;
-
-          std::shared_ptr<ValueSegment<ColumnDataType>> value_segment;
-          if (column_is_nullable) {
-            value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector),
-                                                                           std::move(value_segment_null_vector));
-          } else {
-            value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector));
-          }
-
-          chunk_it->push_back(value_segment);
-          value_segment_value_vector = pmr_vector<ColumnDataType>();
-          value_segment_null_vector = pmr_vector<bool>();
-
-          const auto next_chunk_size =
-              std::min(static_cast<size_t>(output_chunk_size), static_cast<size_t>(row_count - row_index));
-          value_segment_value_vector.reserve(next_chunk_size);
-          if (column_is_nullable) value_segment_null_vector.reserve(next_chunk_size);
-
-          ++chunk_it;
+        if (!accessor) {
+          accessor =
+              create_segment_accessor<ColumnDataType>(unsorted_table.get_chunk(chunk_id)->get_segment(column_id));
         }
-      }
 
-      // Last segment has not been added
-      if (current_segment_size > 0u) {
-        std::shared_ptr<ValueSegment<ColumnDataType>> value_segment;
-        if (column_is_nullable) {
-          value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector),
-                                                                         std::move(value_segment_null_vector));
+        const auto typed_value = accessor->access(chunk_offset);
+        if (typed_value) {
+          values[row_index] = *typed_value;
         } else {
-          value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector));
+          null_values[row_index] = true;
         }
-        chunk_it->push_back(value_segment);
+      }
+
+      if (unsorted_table.column_is_nullable(column_id)) {
+        output_segments[column_id] =
+            std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values));
+      } else {
+        output_segments[column_id] = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
       }
     });
   }
 
-  for (auto& segments : output_segments_by_chunk) {
-    output->append_chunk(segments);
+  return output_segments;
+}
+
+// Given an unsorted_table and a pos_list that defines the order of an output chunk's rows, this writes the output
+// chunk as ReferenceSegments. This is usually faster, but can only be done if a single column in the input table does
+// not reference multiple tables. An example where this restriction applies is the sorted result of a union between
+// two tables. The restriction is needed because a ReferenceSegment can only reference a single table. It does,
+// however, not necessarily apply to joined tables, so two tables referenced in different columns is fine.
+//
+// If unsorted_table is of TableType::Data, this is trivial and the pos_list is used by all output segments. If the
+// input is already a reference table, the double indirection needs to be resolved.
+Segments write_reference_output_segments(const std::shared_ptr<const Table>& unsorted_table,
+                                         const std::shared_ptr<RowIDPosList>& pos_list) {
+  const auto column_count = unsorted_table->column_count();
+  auto output_segments = Segments(column_count);
+
+  if (unsorted_table->type() == TableType::Data) {
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      output_segments[column_id] = std::make_shared<ReferenceSegment>(unsorted_table, column_id, pos_list);
+    }
+    return output_segments;
+  }
+
+  const auto input_chunk_count = unsorted_table->chunk_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    // To keep the implementation simple, we write the output ReferenceSegments column by column. This means that even
+    // if input ReferenceSegments share a PosList, the output will contain independent PosLists. While this is
+    // slightly more expensive to generate and slightly less efficient for following operators, we assume that the
+    // lion's share of the work has been done before the Sort operator is executed and that the relative cost of this
+    // is acceptable. In the future, this could be improved.
+    auto input_segments = std::vector<std::shared_ptr<AbstractSegment>>(input_chunk_count);
+    for (auto input_chunk_id = ChunkID{0}; input_chunk_id < input_chunk_count; ++input_chunk_id) {
+      input_segments[input_chunk_id] = unsorted_table->get_chunk(input_chunk_id)->get_segment(column_id);
+    }
+
+    const auto& first_reference_segment = static_cast<ReferenceSegment&>(*input_segments[pos_list->front().chunk_id]);
+    const auto& referenced_table = first_reference_segment.referenced_table();
+    const auto referenced_column_id = first_reference_segment.referenced_column_id();
+
+    auto output_pos_list = std::make_shared<RowIDPosList>();
+    output_pos_list->reserve(pos_list->size());
+    for (const auto& row_id : *pos_list) {
+      const auto& input_reference_segment = static_cast<ReferenceSegment&>(*input_segments[row_id.chunk_id]);
+      DebugAssert(input_reference_segment.referenced_table() == referenced_table,
+                  "Input column references more than one table");
+      DebugAssert(input_reference_segment.referenced_column_id() == referenced_column_id,
+                  "Input column references more than one column");
+      output_pos_list->emplace_back((*input_reference_segment.pos_list())[row_id.chunk_offset]);
+    }
+
+    output_segments[column_id] =
+        std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, output_pos_list);
   }
 
-  return output;
+  return output_segments;
 }
 
-// Given an unsorted_table and an input_pos_list that defines the output order, this writes the output table as a
-// reference table. This is usually faster, but can only be done if a single column in the input table does not
-// reference multiple tables. An example where this restriction applies is the sorted result of a union between two
-// tables. The restriction is needed because a ReferenceSegment can only reference a single table. It does, however,
-// not necessarily apply to joined tables, so two tables referenced in different columns is fine.
-//
-// If unsorted_table is of TableType::Data, this is trivial and the input_pos_list is used to create the output
-// reference table. If the input is already a reference table, the double indirection needs to be resolved.
-std::shared_ptr<Table> write_reference_output_table(const std::shared_ptr<const Table>& unsorted_table,
-                                                    RowIDPosList input_pos_list, const ChunkOffset output_chunk_size) {
-  // First we create a new table as the output
-  // We have decided against duplicating MVCC data in https://github.com/hyrise/hyrise/issues/408
-  auto output_table = std::make_shared<Table>(unsorted_table->column_definitions(), TableType::References);
-
-  const auto resolve_indirection = unsorted_table->type() == TableType::References;
-  const auto column_count = output_table->column_count();
-
-  // Ceiling of integer division
-  const auto div_ceil = [](auto x, auto y) { return (x + y - 1u) / y; };
-  const auto output_chunk_count = div_ceil(input_pos_list.size(), output_chunk_size);
-  Assert(input_pos_list.size() == unsorted_table->row_count(), "Mismatching size of input table and PosList");
-
-  // Vector of segments for each chunk
-  auto output_segments_by_chunk = std::vector<Segments>(output_chunk_count, Segments(column_count));
-
-  if (!resolve_indirection && input_pos_list.size() <= output_chunk_size) {
-    // Shortcut: No need to copy RowIDs if input_pos_list is small enough and we do not need to resolve the indirection.
-    const auto output_pos_list = std::make_shared<RowIDPosList>(std::move(input_pos_list));
-    auto& output_segments = output_segments_by_chunk.at(0);
-    for (auto column_id = ColumnID{0u}; column_id < column_count; ++column_id) {
-      output_segments[column_id] = std::make_shared<ReferenceSegment>(unsorted_table, column_id, output_pos_list);
+// Writes the output chunks of the Sort. Each output chunk is written by a job of its own, so that the output can be
+// written while the sorted rows are still being produced (e.g., by the merge of spilled runs).
+class OutputWriter {
+ public:
+  OutputWriter(const std::shared_ptr<const Table>& unsorted_table, const bool materialize)
+      : _unsorted_table(unsorted_table), _materialize(materialize) {}
+
+  // Schedules the writing of an output chunk that contains the rows of the pos_list in their order
+  void write_chunk(const std::shared_ptr<RowIDPosList>& pos_list) {
+    // References to elements of a deque stay valid when elements are added
+    auto* output_segments = &_output_segments_by_chunk.emplace_back();
+    _jobs.emplace_back(std::make_shared<JobTask>([this, output_segments, pos_list]() {
+      *output_segments = _materialize ? write_materialized_output_segments(*_unsorted_table, *pos_list)
+                                     : write_reference_output_segments(_unsorted_table, pos_list);
+    }));
+    _jobs.back()->schedule();
+  }
+
+  std::shared_ptr<Table> finish(const ChunkOffset output_chunk_size) {
+    Hyrise::get().scheduler()->wait_for_tasks(_jobs);
+
+    // We have decided against duplicating MVCC data in https://github.com/hyrise/hyrise/issues/408
+    const auto& column_definitions = _unsorted_table->column_definitions();
+    const auto output_table = _materialize
+                                  ? std::make_shared<Table>(column_definitions, TableType::Data, output_chunk_size)
+                                  : std::make_shared<Table>(column_definitions, TableType::References);
+    for (auto& output_segments : _output_segments_by_chunk) {
+      output_table->append_chunk(output_segments);
     }
-  } else {
-    for (ColumnID column_id{0u}; column_id < column_count; ++column_id) {
-      // To keep the implementation simple, we write the output ReferenceSegments column by column. This means that even
-      // if input ReferenceSegments share a PosList, the output will contain independent PosLists. While this is
-      // slightly more expensive to generate and slightly less efficient for following operators, we assume that the
-      // lion's share of the work has been done before the Sort operator is executed and that the relative cost of this
-      // is acceptable. In the future, this could be improved.
-      auto output_pos_list = std::make_shared<RowIDPosList>();
-      output_pos_list->reserve(output_chunk_size);
+    return output_table;
+  }
 
-      // Collect all input segments for the current column
-      const auto input_chunk_count = unsorted_table->chunk_count();
-      auto input_segments = std::vector<std::shared_ptr<AbstractSegment>>(input_chunk_count);
-      for (auto input_chunk_id = ChunkID{0}; input_chunk_id < input_chunk_count; ++input_chunk_id) {
-        input_segments[input_chunk_id] = unsorted_table->get_chunk(input_chunk_id)->get_segment(column_id);
-      }
+ private:
+  const std::shared_ptr<const Table> _unsorted_table;
+  const bool _materialize;
+  std::deque<Segments> _output_segments_by_chunk;
+  std::vector<std::shared_ptr<AbstractTask>> _jobs;
+};
 
-      const auto first_reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(input_segments.at(0));
-      const auto referenced_table = resolve_indirection ? first_reference_segment->referenced_table() : unsorted_table;
-      const auto referenced_column_id =
-          resolve_indirection ? first_reference_segment->referenced_column_id() : column_id;
-
-      // write_output_pos_list creates an output reference segment for a given ChunkID, ColumnID and PosList.
-      auto output_chunk_id = ChunkID{0};
-      const auto write_output_pos_list = [&] {
-        DebugAssert(!output_pos_list->empty(), "Asked to write empty output_pos_list");
-        output_segments_by_chunk.at(output_chunk_id)[column_id] =
-            std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, output_pos_list);
-        ++output_chunk_id;
-
-        output_pos_list = std::make_shared<RowIDPosList>();
-        if (output_chunk_id < output_chunk_count) {
-          output_pos_list->reserve(output_chunk_size);
-        }
-      };
-
-      // Iterate over rows in sorted input pos list, dereference them if necessary, and write a chunk every
-      // `output_chunk_size` rows.
-      for (auto input_pos_list_offset = size_t{0}; input_pos_list_offset < input_pos_list.size();
-           ++input_pos_list_offset) {
-        const auto& row_id = input_pos_list[input_pos_list_offset];
-        if (resolve_indirection) {
-          const auto& input_reference_segment = static_cast<ReferenceSegment&>(*input_segments[row_id.chunk_id]);
-          DebugAssert(input_reference_segment.referenced_table() == referenced_table,
-                      "Input column references more than one table");
-          DebugAssert(input_reference_segment.referenced_column_id() == referenced_column_id,
-                      "Input column references more than one column");
-          const auto& input_reference_pos_list = input_reference_segment.pos_list();
-          output_pos_list->emplace_back((*input_reference_pos_list)[row_id.chunk_offset]);
-        } else {
-          output_pos_list->emplace_back(row_id);
-        }
+// Rows with equal values keep their order in the input, which is the order of their RowIDs
+auto row_comparator(const NormalizedKeys& normalized_keys) {
+  return [&normalized_keys](const RowID& lhs, const RowID& rhs) {
+    const auto result = normalized_keys.compare(lhs, rhs);
+    return result != 0 ? result < 0 : lhs < rhs;
+  };
+}
 
-        if (output_pos_list->size() == output_chunk_size) {
-          write_output_pos_list();
-        }
-      }
-      if (!output_pos_list->empty()) {
-        write_output_pos_list();
+// Materializes the keys of the given chunks and sorts the rows of each chunk by a job of its own. Returns the sorted
+// rows of each chunk.
+std::vector<RowIDPosList> sort_chunks(NormalizedKeys& normalized_keys, const Table& table,
+                                      const std::vector<ChunkID>& chunk_ids) {
+  const auto comes_before = row_comparator(normalized_keys);
+  auto sorted_runs = std::vector<RowIDPosList>(chunk_ids.size());
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_ids.size());
+  for (auto chunk_idx = size_t{0}; chunk_idx < chunk_ids.size(); ++chunk_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_idx]() {
+      const auto chunk_id = chunk_ids[chunk_idx];
+      normalized_keys.materialize(chunk_id);
+
+      auto& sorted_run = sorted_runs[chunk_idx];
+      const auto chunk_size = table.get_chunk(chunk_id)->size();
+      sorted_run.reserve(chunk_size);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        sorted_run.emplace_back(chunk_id, chunk_offset);
       }
+      std::sort(sorted_run.begin(), sorted_run.end(), comes_before);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  return sorted_runs;
+}
+
+// A sorted run of the external sort that has been written to a temporary file. Each row is stored as its RowID,
+// followed by its normalized key.
+struct SpilledRun {
+  std::unique_ptr<SpillFile> file;
+  size_t row_count;
+};
+
+// Writes the sorted rows and their keys to the file. Returns the number of bytes written.
+size_t spill_run(const RowIDPosList& sorted_rows, const NormalizedKeys& normalized_keys, const SpillFile& file) {
+  auto stream = std::ofstream{file.path(), std::ios::binary | std::ios::trunc};
+  Assert(stream.is_open(), "Could not open spill file " + file.path());
+
+  const auto key_width = static_cast<std::streamsize>(normalized_keys.key_width());
+  for (const auto& row_id : sorted_rows) {
+    stream.write(reinterpret_cast<const char*>(&row_id), sizeof(RowID));
+    stream.write(reinterpret_cast<const char*>(normalized_keys.key(row_id)), key_width);
+  }
+
+  Assert(stream.good(), "Could not write spill file " + file.path());
+  return static_cast<size_t>(stream.tellp());
+}
+
+// Reads the rows of a spilled run in blocks of block_row_count rows, so that only one block per run is kept in memory
+// during the merge.
+class SpilledRunReader {
+ public:
+  SpilledRunReader(const SpilledRun& run, const size_t key_width, const size_t block_row_count)
+      : _stream(run.file->path(), std::ios::binary),
+        _path(run.file->path()),
+        _entry_width(sizeof(RowID) + key_width),
+        _block_row_count(block_row_count),
+        _remaining_row_count(run.row_count) {
+    Assert(_stream.is_open(), "Could not open spill file " + _path);
+    _read_block();
+  }
+
+  bool is_exhausted() const { return _block_offset == _block_size; }
+
+  RowID row_id() const {
+    auto row_id = RowID{};
+    std::memcpy(&row_id, _block.data() + _block_offset * _entry_width, sizeof(RowID));
+    return row_id;
+  }
+
+  const uint8_t* key() const {
+    return reinterpret_cast<const uint8_t*>(_block.data() + _block_offset * _entry_width + sizeof(RowID));
+  }
+
+  void advance() {
+    ++_block_offset;
+    if (_block_offset == _block_size) _read_block();
+  }
+
+ private:
+  void _read_block() {
+    _block_size = std::min(_block_row_count, _remaining_row_count);
+    _remaining_row_count -= _block_size;
+    _block_offset = 0;
+
+    if (_block_size == 0) return;
+    _block.resize(_block_size * _entry_width);
+    _stream.read(_block.data(), static_cast<std::streamsize>(_block.size()));
+    Assert(_stream.good(), "Could not read spill file " + _path);
+  }
+
+  std::ifstream _stream;
+  const std::string _path;
+  const size_t _entry_width;
+  const size_t _block_row_count;
+  size_t _remaining_row_count;
+
+  std::vector<char> _block;
+  size_t _block_size{0};
+  size_t _block_offset{0};
+};
+
+// Compares two rows of the input table by a sort column, reading the values through segment accessors. As the spilled
+// keys contain only a prefix of strings, the merge of spilled runs uses this to compare rows with equal keys.
+class BaseSortColumnAccessor {
+ public:
+  virtual ~BaseSortColumnAccessor() = default;
+
+  virtual int compare(const RowID& lhs, const RowID& rhs) = 0;
+};
+
+template <typename T>
+class SortColumnAccessor : public BaseSortColumnAccessor {
+ public:
+  SortColumnAccessor(const Table& table, const SortColumnDefinition& sort_definition)
+      : _table(table), _sort_definition(sort_definition), _accessor_by_chunk_id(table.chunk_count()) {}
+
+  int compare(const RowID& lhs, const RowID& rhs) override {
+    const auto lhs_value = _accessor(lhs.chunk_id).access(lhs.chunk_offset);
+    const auto rhs_value = _accessor(rhs.chunk_id).access(rhs.chunk_offset);
+    return compare_sort_values(lhs_value ? &*lhs_value : nullptr, rhs_value ? &*rhs_value : nullptr,
+                               _sort_definition.sort_mode);
+  }
+
+ private:
+  AbstractSegmentAccessor<T>& _accessor(const ChunkID chunk_id) {
+    auto& accessor = _accessor_by_chunk_id[chunk_id];
+    if (!accessor) {
+      accessor = create_segment_accessor<T>(_table.get_chunk(chunk_id)->get_segment(_sort_definition.column));
     }
+    return *accessor;
+  }
+
+  const Table& _table;
+  const SortColumnDefinition _sort_definition;
+  std::vector<std::unique_ptr<AbstractSegmentAccessor<T>>> _accessor_by_chunk_id;
+};
+
+// External merge sort for inputs whose keys do not fit into the memory budget (see sort.hpp). The sorted rows are
+// passed to the output_writer.
+void sort_externally(const std::shared_ptr<const Table>& input_table,
+                     const std::vector<SortColumnDefinition>& sort_definitions, const NormalizedKeys& normalized_keys,
+                     const size_t memory_budget, const ChunkOffset output_chunk_size, OutputWriter& output_writer,
+                     Sort::PerformanceData& performance_data, Timer& timer) {
+  const auto key_width = normalized_keys.key_width();
+  const auto max_run_row_count = std::max(size_t{1}, memory_budget / (key_width + 2 * sizeof(RowID)));
+
+  // Split the chunks into groups whose keys fit into the memory budget. Each group is sorted like the input of an
+  // in-memory Sort and written to a spill file as a sorted run.
+  auto spilled_runs = std::vector<SpilledRun>{};
+  auto run_chunk_ids = std::vector<ChunkID>{};
+  auto run_row_count = size_t{0};
+  const auto spill_chunks = [&]() {
+    auto run_keys = NormalizedKeys{input_table, sort_definitions};
+    const auto sorted_rows =
+        merge_sorted_runs(sort_chunks(run_keys, *input_table, run_chunk_ids), row_comparator(run_keys));
+
+    auto& spilled_run =
+        spilled_runs.emplace_back(SpilledRun{std::make_unique<SpillFile>("hyrise_sort"), run_row_count});
+    performance_data.spilled_bytes += spill_run(sorted_rows, run_keys, *spilled_run.file);
+
+    run_chunk_ids.clear();
+    run_row_count = 0;
+  };
+
+  const auto chunk_count = input_table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
+    const auto chunk_size = static_cast<size_t>(chunk->size());
+    if (chunk_size == 0) continue;
+
+    if (!run_chunk_ids.empty() && run_row_count + chunk_size > max_run_row_count) spill_chunks();
+    run_chunk_ids.emplace_back(chunk_id);
+    run_row_count += chunk_size;
+  }
+  if (!run_chunk_ids.empty()) spill_chunks();
+
+  performance_data.spilled_run_count = spilled_runs.size();
+  performance_data.set_step_runtime(Sort::OperatorSteps::SortChunks, timer.lap());
+
+  // Merge all runs at once (k-way merge). The budget is shared by the blocks that are read from the runs.
+  const auto block_row_count =
+      std::max(size_t{1}, memory_budget / (spilled_runs.size() * (sizeof(RowID) + key_width)));
+  auto readers = std::vector<std::unique_ptr<SpilledRunReader>>{};
+  readers.reserve(spilled_runs.size());
+  for (const auto& spilled_run : spilled_runs) {
+    readers.emplace_back(std::make_unique<SpilledRunReader>(spilled_run, key_width, block_row_count));
   }
 
-  for (auto& segments : output_segments_by_chunk) {
-    output_table->append_chunk(segments);
+  auto tie_breaker_columns = std::vector<std::unique_ptr<BaseSortColumnAccessor>>{};
+  for (const auto& sort_definition : normalized_keys.tie_breaker_sort_definitions()) {
+    resolve_data_type(input_table->column_data_type(sort_definition.column), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      tie_breaker_columns.emplace_back(
+          std::make_unique<SortColumnAccessor<ColumnDataType>>(*input_table, sort_definition));
+    });
+  }
+
+  // As std::push_heap and std::pop_heap maintain a max-heap, the comparator returns whether the current row of the
+  // first reader comes after that of the second one. As the chunks of a run precede those of later runs, rows with
+  // equal values are ordered by their RowIDs, as in the in-memory sort.
+  const auto comes_after = [&](const size_t lhs_reader_idx, const size_t rhs_reader_idx) {
+    const auto& lhs_reader = *readers[lhs_reader_idx];
+    const auto& rhs_reader = *readers[rhs_reader_idx];
+
+    auto result = std::memcmp(lhs_reader.key(), rhs_reader.key(), key_width);
+    for (auto tie_breaker_column_iter = tie_breaker_columns.begin();
+         result == 0 && tie_breaker_column_iter != tie_breaker_columns.end(); ++tie_breaker_column_iter) {
+      result = (*tie_breaker_column_iter)->compare(lhs_reader.row_id(), rhs_reader.row_id());
+    }
+    return result != 0 ? result > 0 : rhs_reader.row_id() < lhs_reader.row_id();
+  };
+
+  auto heap = std::vector<size_t>(readers.size());
+  std::iota(heap.begin(), heap.end(), size_t{0});
+  std::make_heap(heap.begin(), heap.end(), comes_after);
+
+  auto output_pos_list = std::make_shared<RowIDPosList>();
+  output_pos_list->reserve(output_chunk_size);
+  while (!heap.empty()) {
+    std::pop_heap(heap.begin(), heap.end(), comes_after);
+    auto& reader = *readers[heap.back()];
+
+    output_pos_list->emplace_back(reader.row_id());
+    if (output_pos_list->size() == output_chunk_size) {
+      output_writer.write_chunk(output_pos_list);
+      output_pos_list = std::make_shared<RowIDPosList>();
+      output_pos_list->reserve(output_chunk_size);
+    }
+
+    reader.advance();
+    if (reader.is_exhausted()) {
+      heap.pop_back();
+    } else {
+      std::push_heap(heap.begin(), heap.end(), comes_after);
+    }
   }
+  if (!output_pos_list->empty()) output_writer.write_chunk(output_pos_list);
 
-  return output_table;
+  performance_data.set_step_runtime(Sort::OperatorSteps::MergeChunks, timer.lap());
 }
 
 }  // namespace
@@ -220,12 +418,13 @@ std::shared_ptr<Table> write_reference_output_table(const std::shared_ptr<const
 namespace opossum {
 
 Sort::Sort(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
-           const ChunkOffset output_chunk_size, const ForceMaterialization force_materialization)
-    : AbstractReadOnlyOperator(OperatorType::Sort, in, nullptr,
-                               std::make_unique<OperatorPerformanceData<OperatorSteps>>()),
+           const ChunkOffset output_chunk_size, const ForceMaterialization force_materialization,
+           const std::optional<size_t>& memory_budget)
+    : AbstractReadOnlyOperator(OperatorType::Sort, in, nullptr, std::make_unique<PerformanceData>()),
       _sort_definitions(sort_definitions),
       _output_chunk_size(output_chunk_size),
-      _force_materialization(force_materialization) {
+      _force_materialization(force_materialization),
+      _memory_budget(memory_budget) {
   DebugAssert(!_sort_definitions.empty(), "Expected at least one sort criterion");
 }
 
@@ -236,14 +435,34 @@ const std::string& Sort::name() const {
   return name;
 }
 
+std::string Sort::description(DescriptionMode description_mode) const {
+  auto stream = std::stringstream{};
+  stream << AbstractReadOnlyOperator::description(description_mode);
+  if (_memory_budget) {
+    stream << " Memory budget: " << *_memory_budget << " bytes";
+  }
+
+  return stream.str();
+}
+
 std::shared_ptr<AbstractOperator> Sort::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& copied_right_input) const {
-  return std::make_shared<Sort>(copied_left_input, _sort_definitions, _output_chunk_size, _force_materialization);
+  return std::make_shared<Sort>(copied_left_input, _sort_definitions, _output_chunk_size, _force_materialization,
+                                _memory_budget);
 }
 
 void Sort::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
+void Sort::PerformanceData::output_to_stream(std::ostream& stream, DescriptionMode description_mode) const {
+  OperatorPerformanceData<OperatorSteps>::output_to_stream(stream, description_mode);
+
+  if (spilled_run_count > 0) {
+    stream << (description_mode == DescriptionMode::SingleLine ? " " : "\n") << "Spilled " << spilled_run_count
+           << " sorted run" << (spilled_run_count > 1 ? "s" : "") << " (" << spilled_bytes << " bytes).";
+  }
+}
+
 std::shared_ptr<const Table> Sort::_on_execute() {
   Timer timer;
   const auto& input_table = left_input_table();
@@ -262,31 +481,9 @@ std::shared_ptr<const Table> Sort::_on_execute() {
     }
   }
 
-  std::shared_ptr<Table> sorted_table;
-
-  // After the first (least significant) sort operation has been completed, this holds the order of the table as it has
-  // been determined so far. This is not a completely proper PosList on the input table as it might point to
-  // ReferenceSegments.
-  auto previously_sorted_pos_list = std::optional<RowIDPosList>{};
-
-  for (auto sort_step = static_cast<int64_t>(_sort_definitions.size() - 1); sort_step >= 0; --sort_step) {
-    const auto& sort_definition = _sort_definitions[sort_step];
-    const auto data_type = input_table->column_data_type(sort_definition.column);
-
-    resolve_data_type(data_type, [&](auto type) {
-      using ColumnDataType = typename decltype(type)::type;
-
-      auto sort_impl = SortImpl<ColumnDataType>(input_table, sort_definition.column, sort_definition.sort_mode);
-      previously_sorted_pos_list = sort_impl.sort(previously_sorted_pos_list);
-    });
-  }
-
-  auto& step_performance_data = dynamic_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
-  step_performance_data.set_step_runtime(OperatorSteps::Sort, timer.lap());
-
   // We have to materialize the output (i.e., write ValueSegments) if
   //  (a) it is requested by the user,
-  //  (b) a column in the table references multiple tables (see write_reference_output_table for details), or
+  //  (b) a column in the table references multiple tables (see write_reference_output_segments for details), or
   //  (c) a column in the table references multiple columns in the same table (which is an unlikely edge case).
   // Cases (b) and (c) can only occur if there is more than one ReferenceSegment in an input chunk.
   auto must_materialize = _force_materialization == ForceMaterialization::Yes;
@@ -315,137 +512,45 @@ std::shared_ptr<const Table> Sort::_on_execute() {
     }
   }
 
-  if (must_materialize) {
-    sorted_table =
-        write_materialized_output_table(input_table, std::move(*previously_sorted_pos_list), _output_chunk_size);
+  auto output_writer = OutputWriter{input_table, must_materialize};
+  auto& step_performance_data = static_cast<PerformanceData&>(*performance_data);
+
+  // A row needs its key, its RowID in the sorted chunk, and its RowID in the merged result
+  auto normalized_keys = NormalizedKeys{input_table, _sort_definitions};
+  const auto bytes_per_row = normalized_keys.key_width() + 2 * sizeof(RowID);
+
+  if (_memory_budget && input_table->row_count() * bytes_per_row > *_memory_budget) {
+    sort_externally(input_table, _sort_definitions, normalized_keys, *_memory_budget, _output_chunk_size,
+                    output_writer, step_performance_data, timer);
   } else {
-    sorted_table =
-        write_reference_output_table(input_table, std::move(*previously_sorted_pos_list), _output_chunk_size);
+    auto chunk_ids = std::vector<ChunkID>(input_chunk_count);
+    std::iota(chunk_ids.begin(), chunk_ids.end(), ChunkID{0});
+    auto sorted_runs = sort_chunks(normalized_keys, *input_table, chunk_ids);
+    step_performance_data.set_step_runtime(OperatorSteps::SortChunks, timer.lap());
+
+    const auto sorted_rows = merge_sorted_runs(std::move(sorted_runs), row_comparator(normalized_keys));
+    step_performance_data.set_step_runtime(OperatorSteps::MergeChunks, timer.lap());
+
+    for (auto output_begin = size_t{0}; output_begin < sorted_rows.size(); output_begin += _output_chunk_size) {
+      const auto output_end = std::min(output_begin + _output_chunk_size, sorted_rows.size());
+      output_writer.write_chunk(
+          std::make_shared<RowIDPosList>(sorted_rows.begin() + output_begin, sorted_rows.begin() + output_end));
+    }
   }
 
-  const auto& final_sort_definition = _sort_definitions[0];
-  // Set the sorted_by attribute of the output's chunks according to the most significant sort operation, which is the
-  // column the table was sorted by last.
+  const auto sorted_table = output_writer.finish(_output_chunk_size);
+
+  // Set the sorted_by attribute of the output's chunks according to the most significant sort column
+  const auto output_sorted_by = output_chunk_sorted_by(*sorted_table, _sort_definitions.front());
   const auto output_chunk_count = sorted_table->chunk_count();
   for (auto output_chunk_id = ChunkID{0}; output_chunk_id < output_chunk_count; ++output_chunk_id) {
     const auto& output_chunk = sorted_table->get_chunk(output_chunk_id);
     output_chunk->finalize();
-    output_chunk->set_individually_sorted_by(final_sort_definition);
+    if (output_sorted_by) output_chunk->set_individually_sorted_by(*output_sorted_by);
   }
 
   step_performance_data.set_step_runtime(OperatorSteps::WriteOutput, timer.lap());
   return sorted_table;
 }
 
-template <typename SortColumnType>
-class Sort::SortImpl {
- public:
-  using RowIDValuePair = std::pair<RowID, SortColumnType>;
-
-  SortImpl(const std::shared_ptr<const Table>& table_in, const ColumnID column_id,
-           const SortMode sort_mode = SortMode::Ascending)
-      : _table_in(table_in), _column_id(column_id), _sort_mode(sort_mode) {
-    const auto row_count = _table_in->row_count();
-    _row_id_value_vector.reserve(row_count);
-    _null_value_rows.reserve(row_count);
-  }
-
-  // Sorts table_in, potentially taking the pre-existing order of previously_sorted_pos_list into account.
-  // Returns a PosList, which can either be used as an input to the next call of sort or for materializing the
-  // output table.
-  RowIDPosList sort(const std::optional<RowIDPosList>& previously_sorted_pos_list) {
-    // 1. Prepare Sort: Creating RowID-value-Structure
-    _materialize_sort_column(previously_sorted_pos_list);
-
-    // 2. After we got our ValueRowID Map we sort the map by the value of the pair
-    const auto sort_with_comparator = [&](auto comparator) {
-      std::stable_sort(_row_id_value_vector.begin(), _row_id_value_vector.end(),
-                       [comparator](RowIDValuePair a, RowIDValuePair b) { return comparator(a.second, b.second); });
-    };
-    if (_sort_mode == SortMode::Ascending) {
-      sort_with_comparator(std::less<>{});
-    } else {
-      sort_with_comparator(std::greater<>{});
-    }
-
-    // 2b. Insert null rows in front of all non-NULL rows
-    if (!_null_value_rows.empty()) {
-      // NULLs come before all values. The SQL standard allows for this to be implementation-defined. We used to have
-      // a NULLS LAST mode, but never used it over multiple years. Different databases have different behaviors, and
-      // storing NULLs first even for descending orders is somewhat uncommon:
-      //   https://docs.mendix.com/refguide/null-ordering-behavior
-      // For Hyrise, we found that storing NULLs first is the method that requires the least amount of code.
-      _row_id_value_vector.insert(_row_id_value_vector.begin(), _null_value_rows.begin(), _null_value_rows.end());
-    }
-
-    RowIDPosList pos_list{};
-    pos_list.reserve(_row_id_value_vector.size());
-    for (const auto& [row_id, _] : _row_id_value_vector) {
-      pos_list.emplace_back(row_id);
-    }
-    return pos_list;
-  }
-
- protected:
-  // completely materializes the sort column to create a vector of RowID-Value pairs
-  void _materialize_sort_column(const std::optional<RowIDPosList>& previously_sorted_pos_list) {
-    // If there was no PosList passed, this is the first sorting run and we simply fill our values and nulls data
-    // structures from our input table. Otherwise we will materialize according to the PosList which is the result of
-    // the last run.
-    if (previously_sorted_pos_list) {
-      _materialize_column_from_pos_list(*previously_sorted_pos_list);
-    } else {
-      const auto chunk_count = _table_in->chunk_count();
-      for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-        const auto chunk = _table_in->get_chunk(chunk_id);
-        Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
-
-        auto abstract_segment = chunk->get_segment(_column_id);
-
-        segment_iterate<SortColumnType>(*abstract_segment, [&](const auto& position) {
-          if (position.is_null()) {
-            _null_value_rows.emplace_back(RowID{chunk_id, position.chunk_offset()}, SortColumnType{});
-          } else {
-            _row_id_value_vector.emplace_back(RowID{chunk_id, position.chunk_offset()}, position.value());
-          }
-        });
-      }
-    }
-  }
-
-  // When there was a preceding sorting run, we materialize by retaining the order of the values in the passed PosList.
-  void _materialize_column_from_pos_list(const RowIDPosList& pos_list) {
-    const auto input_chunk_count = _table_in->chunk_count();
-    auto accessor_by_chunk_id =
-        std::vector<std::unique_ptr<AbstractSegmentAccessor<SortColumnType>>>(input_chunk_count);
-    for (auto input_chunk_id = ChunkID{0}; input_chunk_id < input_chunk_count; ++input_chunk_id) {
-      const auto& abstract_segment = _table_in->get_chunk(input_chunk_id)->get_segment(_column_id);
-      accessor_by_chunk_id[input_chunk_id] = create_segment_accessor<SortColumnType>(abstract_segment);
-    }
-
-    for (auto row_id : pos_list) {
-      const auto [chunk_id, chunk_offset] = row_id;
-
-      auto& accessor = accessor_by_chunk_id[chunk_id];
-      const auto typed_value = accessor->access(chunk_offset);
-      if (!typed_value) {
-        _null_value_rows.emplace_back(row_id, SortColumnType{});
-      } else {
-        _row_id_value_vector.emplace_back(row_id, typed_value.value());
-      }
-    }
-  }
-
-  const std::shared_ptr<const Table> _table_in;
-
-  // column to sort by
-  const ColumnID _column_id;
-  const SortMode _sort_mode;
-
-  std::vector<RowIDValuePair> _row_id_value_vector;
-
-  // Stored as RowIDValuePair for better type compatibility even if value is unused
-  std::vector<RowIDValuePair> _null_value_rows;
-};
-
 }  // namespace opossum
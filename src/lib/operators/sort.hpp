@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -18,20 +19,41 @@ namespace opossum {
  * Operator to sort a table by one or multiple columns. This implements a stable sort, i.e., rows that share the same
  * value will maintain their relative order.
  * By passing multiple sort column definitions it is possible to sort multiple columns with one operator run.
+ *
+ * The sort is a parallel merge sort over the input chunks: The sort columns of each row are encoded into a single
+ * normalized key (see NormalizedKeys), and the rows of each chunk are sorted by a job of their own. The sorted chunks
+ * are then merged pairwise in parallel rounds. Finally, the output chunks are written in parallel.
+ *
+ * If a memory budget (see OperatorMemoryBudgetSetting) is given and the keys of all rows do not fit into it, the Sort
+ * becomes an external merge sort: The chunks are split into groups whose keys fit into the budget. Each group is
+ * sorted as described above, and its sorted run (the RowIDs and keys of its rows) is written to a temporary file.
+ * Afterwards, all runs are read back in blocks and merged by a k-way merge, which streams the sorted rows into the
+ * output chunks. Note that the budget only covers the sort keys, not the output or the values of sort columns by
+ * which rows with equal keys are compared (see NormalizedKeys).
  */
 class Sort : public AbstractReadOnlyOperator {
  public:
   enum class ForceMaterialization : bool { Yes = true, No = false };
 
-  enum class OperatorSteps : uint8_t { Sort, WriteOutput };
+  enum class OperatorSteps : uint8_t { SortChunks, MergeChunks, WriteOutput };
 
   Sort(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
        const ChunkOffset output_chunk_size = Chunk::DEFAULT_SIZE,
-       const ForceMaterialization force_materialization = ForceMaterialization::No);
+       const ForceMaterialization force_materialization = ForceMaterialization::No,
+       const std::optional<size_t>& memory_budget = std::nullopt);
 
   const std::vector<SortColumnDefinition>& sort_definitions() const;
 
   const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  struct PerformanceData : public OperatorPerformanceData<OperatorSteps> {
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override;
+
+    // Sorted runs that were written to temporary files to stay within the memory budget
+    size_t spilled_run_count{0};
+    size_t spilled_bytes{0};
+  };
 
  protected:
   std::shared_ptr<const Table> _on_execute() override;
@@ -40,15 +62,10 @@ class Sort : public AbstractReadOnlyOperator {
       const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
-  template <typename SortColumnType>
-  class SortImpl;
-
-  template <typename SortColumnType>
-  class SortImplMaterializeOutput;
-
   const std::vector<SortColumnDefinition> _sort_definitions;
   const ChunkOffset _output_chunk_size;
   const ForceMaterialization _force_materialization;
+  const std::optional<size_t> _memory_budget;
 };
 
 }  // namespace opossum
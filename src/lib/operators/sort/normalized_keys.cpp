@@ -0,0 +1,156 @@
+#include "normalized_keys.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <type_traits>
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+template <typename T>
+size_t value_width() {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    return NormalizedKeys::STRING_PREFIX_LENGTH;
+  } else {
+    return sizeof(T);
+  }
+}
+
+template <typename UnsignedT>
+void write_big_endian(uint8_t* destination, UnsignedT value) {
+  for (auto byte_idx = sizeof(UnsignedT); byte_idx > 0; --byte_idx) {
+    destination[byte_idx - 1] = static_cast<uint8_t>(value);
+    value >>= 8;
+  }
+}
+
+// Writes the encoding of a value so that memcmp orders the encodings of two values like the values themselves
+template <typename T>
+void encode_value(uint8_t* destination, const T& value) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    // The remaining bytes are already zero
+    std::memcpy(destination, value.data(), std::min(value.size(), NormalizedKeys::STRING_PREFIX_LENGTH));
+  } else if constexpr (std::is_integral_v<T>) {
+    using UnsignedT = std::make_unsigned_t<T>;
+    constexpr auto SIGN_BIT = UnsignedT{1} << (sizeof(T) * 8 - 1);
+    write_big_endian(destination, static_cast<UnsignedT>(value) ^ SIGN_BIT);
+  } else {
+    static_assert(std::is_floating_point_v<T>, "Unexpected data type");
+    using UnsignedT = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+    constexpr auto SIGN_BIT = UnsignedT{1} << (sizeof(T) * 8 - 1);
+
+    // -0.0 == 0.0, but their bits differ
+    const auto bits = std::bit_cast<UnsignedT>(value == T{0} ? T{0} : value);
+    write_big_endian(destination, bits & SIGN_BIT ? ~bits : bits | SIGN_BIT);
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+NormalizedKeys::NormalizedKeys(const std::shared_ptr<const Table>& table,
+                               const std::vector<SortColumnDefinition>& sort_definitions)
+    : _table(table), _keys(table->chunk_count()) {
+  DebugAssert(!sort_definitions.empty(), "Expected at least one sort criterion");
+
+  for (const auto& sort_definition : sort_definitions) {
+    const auto data_type = _table->column_data_type(sort_definition.column);
+    const auto nullable = _table->column_is_nullable(sort_definition.column);
+
+    if (_tie_breaker_columns.empty()) {
+      _encoded_columns.emplace_back(
+          EncodedColumn{sort_definition.column, sort_definition.sort_mode, data_type, nullable, _key_width});
+
+      resolve_data_type(data_type, [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        _key_width += (nullable ? 1 : 0) + value_width<ColumnDataType>();
+      });
+    }
+
+    if (data_type == DataType::String || !_tie_breaker_columns.empty()) {
+      _tie_breaker_sort_definitions.emplace_back(sort_definition);
+      resolve_data_type(data_type, [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        _tie_breaker_columns.emplace_back(std::make_unique<SortColumnValues<ColumnDataType>>(
+            sort_definition.column, sort_definition.sort_mode, _table->chunk_count()));
+      });
+    }
+  }
+}
+
+void NormalizedKeys::materialize(const ChunkID chunk_id) {
+  const auto chunk = _table->get_chunk(chunk_id);
+  Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
+
+  auto& keys = _keys[chunk_id];
+  keys.resize(chunk->size() * _key_width);
+
+  for (const auto& encoded_column : _encoded_columns) {
+    resolve_data_type(encoded_column.data_type, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      _encode_column<ColumnDataType>(encoded_column, *chunk, keys);
+    });
+  }
+
+  for (const auto& tie_breaker_column : _tie_breaker_columns) {
+    tie_breaker_column->materialize(*chunk, chunk_id);
+  }
+}
+
+int NormalizedKeys::compare(const RowID& lhs, const RowID& rhs) const {
+  const auto key_result = std::memcmp(key(lhs), key(rhs), _key_width);
+  if (key_result != 0) return key_result;
+
+  for (const auto& tie_breaker_column : _tie_breaker_columns) {
+    const auto result = tie_breaker_column->compare(lhs, rhs);
+    if (result != 0) return result;
+  }
+  return 0;
+}
+
+const uint8_t* NormalizedKeys::key(const RowID& row_id) const {
+  return _keys[row_id.chunk_id].data() + static_cast<size_t>(row_id.chunk_offset) * _key_width;
+}
+
+size_t NormalizedKeys::key_width() const { return _key_width; }
+
+bool NormalizedKeys::keys_are_complete() const { return _tie_breaker_columns.empty(); }
+
+const std::vector<SortColumnDefinition>& NormalizedKeys::tie_breaker_sort_definitions() const {
+  return _tie_breaker_sort_definitions;
+}
+
+template <typename T>
+void NormalizedKeys::_encode_column(const EncodedColumn& encoded_column, const Chunk& chunk,
+                                    std::vector<uint8_t>& keys) const {
+  const auto non_null_byte = is_nulls_first_sort_mode(encoded_column.sort_mode) ? uint8_t{1} : uint8_t{0};
+  const auto value_offset = encoded_column.offset + (encoded_column.nullable ? 1 : 0);
+  const auto invert = !is_ascending_sort_mode(encoded_column.sort_mode);
+
+  segment_iterate<T>(*chunk.get_segment(encoded_column.column_id), [&](const auto& position) {
+    auto* const key = keys.data() + static_cast<size_t>(position.chunk_offset()) * _key_width;
+
+    // NULLs get the other NULL byte and an all-zero value, so that all NULLs are equal
+    if (position.is_null()) {
+      key[encoded_column.offset] = static_cast<uint8_t>(1 - non_null_byte);
+      return;
+    }
+    if (encoded_column.nullable) key[encoded_column.offset] = non_null_byte;
+
+    auto* const value = key + value_offset;
+    encode_value(value, position.value());
+    if (invert) {
+      std::transform(value, value + value_width<T>(), value,
+                     [](const uint8_t byte) { return static_cast<uint8_t>(~byte); });
+    }
+  });
+}
+
+}  // namespace opossum
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "operators/sort/sort_utils.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Encodes the sort columns of a row into a single fixed-width binary key, so that two rows can be compared with a
+ * single memcmp instead of one virtual, typed comparison per sort column (see Graefe, "Implementing Sorting in
+ * Database Systems", ACM Computing Surveys 2006). The key is the concatenation of the sort columns' encodings in the
+ * order of the sort definitions:
+ *
+ *  - Nullable columns are prefixed by a byte that orders NULLs before (NULLS FIRST) or after (NULLS LAST) all values.
+ *  - Integers are stored big-endian with a flipped sign bit, so that negative values come before positive ones.
+ *  - Floating-point numbers are stored as their IEEE 754 bits, with all bits flipped for negative numbers and the sign
+ *    bit flipped for all others. -0.0 is encoded as 0.0.
+ *  - Strings are stored as their first STRING_PREFIX_LENGTH bytes, padded with zero bytes.
+ *  - For descending orders, all bytes of the value (but not the NULL byte) are inverted.
+ *
+ * As equal string prefixes do not imply equal strings, sort columns after the first string column are not encoded.
+ * If two keys are equal, the rows are compared by their values from the first string column on.
+ */
+class NormalizedKeys {
+ public:
+  static constexpr auto STRING_PREFIX_LENGTH = size_t{12};
+
+  NormalizedKeys(const std::shared_ptr<const Table>& table, const std::vector<SortColumnDefinition>& sort_definitions);
+
+  // Encodes the keys of a chunk's rows. Different chunks can be materialized by parallel jobs.
+  void materialize(const ChunkID chunk_id);
+
+  // Negative if lhs comes before rhs in the sort order, positive if it comes after rhs, zero if all of the sort
+  // columns' values are equal. Both rows' chunks have to be materialized.
+  int compare(const RowID& lhs, const RowID& rhs) const;
+
+  const uint8_t* key(const RowID& row_id) const;
+  size_t key_width() const;
+
+  // Whether equal keys imply equal values in all sort columns, i.e., whether there is no string column
+  bool keys_are_complete() const;
+
+  // The sort columns from the first string column on, by which rows with equal keys are compared
+  const std::vector<SortColumnDefinition>& tie_breaker_sort_definitions() const;
+
+ private:
+  struct EncodedColumn {
+    ColumnID column_id;
+    SortMode sort_mode;
+    DataType data_type;
+    bool nullable;
+
+    // Position of the column's encoding (including the NULL byte) in the key
+    size_t offset;
+  };
+
+  template <typename T>
+  void _encode_column(const EncodedColumn& encoded_column, const Chunk& chunk, std::vector<uint8_t>& keys) const;
+
+  const std::shared_ptr<const Table> _table;
+  std::vector<EncodedColumn> _encoded_columns;
+  size_t _key_width{0};
+
+  // Keys of all rows of a chunk, stored back to back
+  std::vector<std::vector<uint8_t>> _keys;
+
+  // Values of the sort columns from the first string column on, used to compare rows with equal keys
+  std::vector<SortColumnDefinition> _tie_breaker_sort_definitions;
+  std::vector<std::unique_ptr<BaseSortColumnValues>> _tie_breaker_columns;
+};
+
+}  // namespace opossum
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Compares two values of a sort column. NULLs are passed as nullptr. Negative if lhs comes before rhs in the sort
+// order, positive if it comes after rhs, zero if both are equal.
+template <typename T>
+int compare_sort_values(const T* lhs, const T* rhs, const SortMode sort_mode) {
+  if (!lhs || !rhs) {
+    const auto null_order = static_cast<int>(!rhs) - static_cast<int>(!lhs);
+    return is_nulls_first_sort_mode(sort_mode) ? null_order : -null_order;
+  }
+
+  if (*lhs == *rhs) return 0;
+  return (*lhs < *rhs) == is_ascending_sort_mode(sort_mode) ? -1 : 1;
+}
+
+// Materialized values of one sort column, used by the Sort and TopK operators to compare rows. The values are stored
+// per input chunk, so that the chunks can be materialized by parallel jobs. Chunks that are never materialized (e.g.,
+// chunks pruned by the TopK) cost no memory.
+class BaseSortColumnValues {
+ public:
+  virtual ~BaseSortColumnValues() = default;
+
+  virtual void materialize(const Chunk& chunk, const ChunkID chunk_id) = 0;
+
+  // Negative if lhs comes before rhs in the sort order, positive if it comes after rhs, zero if both are equal.
+  virtual int compare(const RowID& lhs, const RowID& rhs) const = 0;
+};
+
+template <typename T>
+class SortColumnValues : public BaseSortColumnValues {
+ public:
+  SortColumnValues(const ColumnID column_id, const SortMode sort_mode, const ChunkID chunk_count)
+      : _column_id(column_id), _sort_mode(sort_mode), _values(chunk_count), _null_values(chunk_count) {}
+
+  void materialize(const Chunk& chunk, const ChunkID chunk_id) override {
+    auto& values = _values[chunk_id];
+    auto& null_values = _null_values[chunk_id];
+    values.resize(chunk.size());
+    null_values.resize(chunk.size());
+
+    segment_iterate<T>(*chunk.get_segment(_column_id), [&](const auto& position) {
+      if (position.is_null()) {
+        null_values[position.chunk_offset()] = true;
+      } else {
+        values[position.chunk_offset()] = position.value();
+      }
+    });
+  }
+
+  int compare(const RowID& lhs, const RowID& rhs) const override {
+    const auto* const lhs_value =
+        _null_values[lhs.chunk_id][lhs.chunk_offset] ? nullptr : &_values[lhs.chunk_id][lhs.chunk_offset];
+    const auto* const rhs_value =
+        _null_values[rhs.chunk_id][rhs.chunk_offset] ? nullptr : &_values[rhs.chunk_id][rhs.chunk_offset];
+    return compare_sort_values(lhs_value, rhs_value, _sort_mode);
+  }
+
+  std::optional<T> value(const RowID& row_id) const {
+    if (_null_values[row_id.chunk_id][row_id.chunk_offset]) return std::nullopt;
+    return _values[row_id.chunk_id][row_id.chunk_offset];
+  }
+
+ private:
+  const ColumnID _column_id;
+  const SortMode _sort_mode;
+  std::vector<std::vector<T>> _values;
+  std::vector<std::vector<bool>> _null_values;
+};
+
+// Merges sorted runs of RowIDs (e.g., the sorted rows of each chunk) or of other row identifiers into a single sorted
+// run. The runs are merged pairwise in parallel rounds, so that log2(#runs) rounds are needed. If max_row_count is
+// given, each merge result is cut off after max_row_count rows, which is all that the TopK operator needs. For equal
+// rows, those of the left run come first, but usually, comes_before breaks ties by the RowIDs anyway.
+template <typename Run, typename Comparator>
+Run merge_sorted_runs(std::vector<Run> runs, const Comparator& comes_before,
+                      const size_t max_row_count = std::numeric_limits<size_t>::max()) {
+  if (runs.empty()) return Run{};
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  while (runs.size() > 1) {
+    auto merged_runs = std::vector<Run>((runs.size() + 1) / 2);
+
+    jobs.clear();
+    jobs.reserve(merged_runs.size());
+    for (auto merged_idx = size_t{0}; merged_idx < merged_runs.size(); ++merged_idx) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, merged_idx]() {
+        auto& left_run = runs[2 * merged_idx];
+        auto& merged_run = merged_runs[merged_idx];
+        if (2 * merged_idx + 1 == runs.size()) {
+          merged_run = std::move(left_run);
+          return;
+        }
+
+        const auto& right_run = runs[2 * merged_idx + 1];
+        merged_run.resize(std::min(left_run.size() + right_run.size(), max_row_count));
+        auto left_iter = left_run.cbegin();
+        auto right_iter = right_run.cbegin();
+        for (auto& row : merged_run) {
+          if (right_iter == right_run.cend() ||
+              (left_iter != left_run.cend() && !comes_before(*right_iter, *left_iter))) {
+            row = *left_iter++;
+          } else {
+            row = *right_iter++;
+          }
+        }
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+    runs = std::move(merged_runs);
+  }
+
+  auto& result = runs.front();
+  if (result.size() > max_row_count) result.resize(max_row_count);
+  return std::move(result);
+}
+
+// Chunks can only be marked as sorted with NULLs first (see Chunk::set_individually_sorted_by). For a column without
+// NULLs, the NULLS LAST order is the same as the NULLS FIRST order, so that the output of a sort is still marked.
+inline std::optional<SortColumnDefinition> output_chunk_sorted_by(const Table& output_table,
+                                                                 const SortColumnDefinition& sort_definition) {
+  if (is_nulls_first_sort_mode(sort_definition.sort_mode)) return sort_definition;
+  if (output_table.column_is_nullable(sort_definition.column)) return std::nullopt;
+
+  const auto sort_mode = is_ascending_sort_mode(sort_definition.sort_mode) ? SortMode::Ascending : SortMode::Descending;
+  return SortColumnDefinition{sort_definition.column, sort_mode};
+}
+
+}  // namespace opossum
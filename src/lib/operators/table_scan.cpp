@@ -22,6 +22,7 @@
 #include "hyrise.hpp"
 #include "lossless_cast.hpp"
 #include "operators/operator_scan_predicate.hpp"
+#include "operators/row_budget.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/abstract_segment.hpp"
@@ -94,6 +95,9 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
   jobs.reserve(in_table->chunk_count() - excluded_chunk_set.size());
 
+  // Once a downstream Limit has enough rows, the jobs of the remaining chunks return without scanning
+  auto row_budget = RowBudget{_output_row_budget};
+
   const auto chunk_count = in_table->chunk_count();
   for (ChunkID chunk_id{0u}; chunk_id < chunk_count; ++chunk_id) {
     if (excluded_chunk_set.count(chunk_id)) continue;
@@ -101,10 +105,14 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
     Assert(chunk_in, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
     // chunk_in – Copy by value since copy by reference is not possible due to the limited scope of the for-iteration.
-    auto job_task = std::make_shared<JobTask>([this, chunk_id, chunk_in, &in_table, &output_mutex, &output_chunks]() {
+    auto job_task = std::make_shared<JobTask>([this, chunk_id, chunk_in, &in_table, &output_mutex, &output_chunks,
+                                               &row_budget]() {
+      if (row_budget.is_exhausted()) return;
+
       // The actual scan happens in the sub classes of BaseTableScanImpl
       const auto matches_out = _impl->scan_chunk(chunk_id);
       if (matches_out->empty()) return;
+      row_budget.consume(matches_out->size());
 
       Segments out_segments;
       out_segments.reserve(in_table->column_count());
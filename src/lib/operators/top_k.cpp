@@ -0,0 +1,414 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "expression/evaluation/expression_evaluator.hpp"
+#include "expression/expression_utils.hpp"
+#include "hyrise.hpp"
+#include "operators/sort/sort_utils.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "statistics/statistics_objects/range_filter.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+using namespace std::string_literals;  // NOLINT
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Returns the best value that a segment might contain according to the pruning statistics of its chunk, i.e., its
+// minimum for ascending and its maximum for descending orders. For a ReferenceSegment, the statistics of the
+// referenced chunk are used if all rows reference the same chunk, as the segment's values are a subset of its values.
+template <typename T>
+std::optional<T> best_value_bound(const Chunk& chunk, const ColumnID column_id, const SortMode sort_mode) {
+  auto statistics_chunk = &chunk;
+  auto statistics_column_id = column_id;
+
+  const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk.get_segment(column_id));
+  if (reference_segment) {
+    const auto& pos_list = *reference_segment->pos_list();
+    if (pos_list.empty() || !pos_list.references_single_chunk()) return std::nullopt;
+
+    const auto& referenced_table = *reference_segment->referenced_table();
+    if (referenced_table.type() != TableType::Data) return std::nullopt;
+
+    const auto referenced_chunk = referenced_table.get_chunk(pos_list.common_chunk_id());
+    if (!referenced_chunk) return std::nullopt;
+    statistics_chunk = referenced_chunk.get();
+    statistics_column_id = reference_segment->referenced_column_id();
+  }
+
+  const auto& pruning_statistics = statistics_chunk->pruning_statistics();
+  if (!pruning_statistics) return std::nullopt;
+
+  const auto attribute_statistics =
+      std::dynamic_pointer_cast<const AttributeStatistics<T>>((*pruning_statistics)[statistics_column_id]);
+  if (!attribute_statistics) return std::nullopt;
+
+  if (attribute_statistics->min_max_filter) {
+    const auto& min_max_filter = *attribute_statistics->min_max_filter;
+    return is_ascending_sort_mode(sort_mode) ? min_max_filter.min : min_max_filter.max;
+  }
+
+  if constexpr (std::is_arithmetic_v<T>) {
+    if (attribute_statistics->range_filter && !attribute_statistics->range_filter->ranges.empty()) {
+      const auto& ranges = attribute_statistics->range_filter->ranges;
+      return is_ascending_sort_mode(sort_mode) ? ranges.front().first : ranges.back().second;
+    }
+  }
+
+  return std::nullopt;
+}
+
+}  // namespace
+
+namespace opossum {
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const std::shared_ptr<AbstractExpression>& row_count_expression)
+    : AbstractReadOnlyOperator(OperatorType::TopK, in, nullptr, std::make_unique<PerformanceData>()),
+      _sort_definitions(sort_definitions),
+      _row_count_expression(row_count_expression) {
+  DebugAssert(!_sort_definitions.empty(), "Expected at least one sort criterion");
+}
+
+const std::string& TopK::name() const {
+  static const auto name = std::string{"TopK"};
+  return name;
+}
+
+std::string TopK::description(DescriptionMode description_mode) const {
+  const auto column_name = [&](const auto column_id) {
+    const auto& input_table = _left_input->get_output();
+    return input_table ? input_table->column_name(column_id) : "Column #"s + std::to_string(column_id);
+  };
+
+  const auto* const separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+  stream << name() << separator << "(k: " << _row_count_expression->as_column_name() << ")" << separator << "[";
+  for (auto sort_definition_idx = size_t{0}; sort_definition_idx < _sort_definitions.size(); ++sort_definition_idx) {
+    if (sort_definition_idx > 0) stream << ", ";
+    const auto& sort_definition = _sort_definitions[sort_definition_idx];
+    stream << column_name(sort_definition.column) << " " << sort_definition.sort_mode;
+  }
+  stream << "]";
+  return stream.str();
+}
+
+const std::vector<SortColumnDefinition>& TopK::sort_definitions() const { return _sort_definitions; }
+
+std::shared_ptr<AbstractExpression> TopK::row_count_expression() const { return _row_count_expression; }
+
+std::shared_ptr<AbstractOperator> TopK::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  return std::make_shared<TopK>(copied_left_input, _sort_definitions, _row_count_expression->deep_copy());
+}
+
+void TopK::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  expression_set_parameters(_row_count_expression, parameters);
+}
+
+void TopK::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
+  expression_set_transaction_context(_row_count_expression, transaction_context);
+}
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  Timer timer;
+  const auto& input_table = left_input_table();
+
+  for (const auto& sort_definition : _sort_definitions) {
+    Assert(sort_definition.column != INVALID_COLUMN_ID, "TopK: Invalid column in sort definition");
+    Assert(sort_definition.column < input_table->column_count(),
+           "TopK: Column ID is greater than table's column count");
+  }
+
+  // Evaluate the _row_count_expression to determine k, as the Limit operator does
+  auto row_count = size_t{};
+  resolve_data_type(_row_count_expression->data_type(), [&](const auto data_type_t) {
+    using LimitDataType = typename decltype(data_type_t)::type;
+
+    if constexpr (std::is_integral_v<LimitDataType>) {
+      const auto row_count_expression_result =
+          ExpressionEvaluator{}.evaluate_expression_to_result<LimitDataType>(*_row_count_expression);
+      Assert(row_count_expression_result->size() == 1, "Expected exactly one row for TopK");
+      Assert(!row_count_expression_result->is_null(0), "Expected non-null for TopK");
+
+      const auto signed_row_count = row_count_expression_result->value(0);
+      Assert(signed_row_count >= 0, "Can't TopK to a negative number of Rows");
+
+      row_count = static_cast<size_t>(signed_row_count);
+    } else {
+      Fail("Non-integral types not allowed in TopK");
+    }
+  });
+
+  if (row_count == 0 || input_table->empty()) {
+    return std::make_shared<Table>(input_table->column_definitions(), TableType::References);
+  }
+
+  auto pos_list = RowIDPosList{};
+  resolve_data_type(input_table->column_data_type(_sort_definitions.front().column), [&](const auto data_type_t) {
+    using FirstSortColumnType = typename decltype(data_type_t)::type;
+    pos_list = _select_rows<FirstSortColumnType>(row_count);
+  });
+
+  auto& step_performance_data = static_cast<PerformanceData&>(*performance_data);
+  step_performance_data.set_step_runtime(OperatorSteps::SelectCandidates, timer.lap());
+
+  // For a reference table, the indirection is resolved. This is only possible if, for each column, the input segments
+  // of all output rows reference the same column of the same table (see write_reference_output_table in sort.cpp).
+  // Otherwise, the (at most k) output rows are materialized.
+  const auto column_count = input_table->column_count();
+  const auto resolve_indirection = input_table->type() == TableType::References;
+  const auto referenced_segment = [&](const RowID& row_id, const ColumnID column_id) -> const ReferenceSegment& {
+    return static_cast<const ReferenceSegment&>(*input_table->get_chunk(row_id.chunk_id)->get_segment(column_id));
+  };
+
+  auto must_materialize = false;
+  if (resolve_indirection) {
+    for (auto column_id = ColumnID{0}; column_id < column_count && !must_materialize; ++column_id) {
+      const auto& first_segment = referenced_segment(pos_list.front(), column_id);
+      must_materialize = std::any_of(pos_list.begin(), pos_list.end(), [&](const auto& row_id) {
+        const auto& segment = referenced_segment(row_id, column_id);
+        return segment.referenced_table() != first_segment.referenced_table() ||
+               segment.referenced_column_id() != first_segment.referenced_column_id();
+      });
+    }
+  }
+
+  const auto output_row_count = pos_list.size();
+  const auto output_sorted_by = output_chunk_sorted_by(*input_table, _sort_definitions.front());
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  output_chunks.reserve((output_row_count + Chunk::DEFAULT_SIZE - 1) / Chunk::DEFAULT_SIZE);
+  for (auto output_begin = size_t{0}; output_begin < output_row_count; output_begin += Chunk::DEFAULT_SIZE) {
+    const auto output_end = std::min(output_begin + Chunk::DEFAULT_SIZE, output_row_count);
+    auto output_segments = Segments(column_count);
+
+    if (must_materialize) {
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        resolve_data_type(input_table->column_data_type(column_id), [&](const auto data_type_t) {
+          using ColumnDataType = typename decltype(data_type_t)::type;
+
+          auto accessor_by_chunk_id =
+              std::vector<std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>>(input_table->chunk_count());
+          auto values = pmr_vector<ColumnDataType>(output_end - output_begin);
+          auto null_values = pmr_vector<bool>(output_end - output_begin);
+          for (auto row_idx = output_begin; row_idx < output_end; ++row_idx) {
+            const auto [chunk_id, chunk_offset] = pos_list[row_idx];
+            auto& accessor = accessor_by_chunk_id[chunk_id];
+            if (!accessor) {
+              const auto& segment = input_table->get_chunk(chunk_id)->get_segment(column_id);
+              accessor = create_segment_accessor<ColumnDataType>(segment);
+            }
+
+            const auto typed_value = accessor->access(chunk_offset);
+            if (typed_value) {
+              values[row_idx - output_begin] = *typed_value;
+            } else {
+              null_values[row_idx - output_begin] = true;
+            }
+          }
+
+          if (input_table->column_is_nullable(column_id)) {
+            output_segments[column_id] =
+                std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values));
+          } else {
+            output_segments[column_id] = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+          }
+        });
+      }
+    } else if (resolve_indirection) {
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        auto output_pos_list = std::make_shared<RowIDPosList>();
+        output_pos_list->reserve(output_end - output_begin);
+        for (auto row_idx = output_begin; row_idx < output_end; ++row_idx) {
+          const auto& row_id = pos_list[row_idx];
+          output_pos_list->emplace_back((*referenced_segment(row_id, column_id).pos_list())[row_id.chunk_offset]);
+        }
+
+        const auto& first_segment = referenced_segment(pos_list.front(), column_id);
+        output_segments[column_id] = std::make_shared<ReferenceSegment>(
+            first_segment.referenced_table(), first_segment.referenced_column_id(), output_pos_list);
+      }
+    } else {
+      const auto output_pos_list =
+          std::make_shared<RowIDPosList>(pos_list.begin() + output_begin, pos_list.begin() + output_end);
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        output_segments[column_id] = std::make_shared<ReferenceSegment>(input_table, column_id, output_pos_list);
+      }
+    }
+
+    // As with the Sort operator, the output is sorted by the most significant sort column
+    const auto output_chunk = std::make_shared<Chunk>(std::move(output_segments));
+    output_chunk->finalize();
+    if (output_sorted_by) output_chunk->set_individually_sorted_by(*output_sorted_by);
+    output_chunks.emplace_back(output_chunk);
+  }
+
+  step_performance_data.set_step_runtime(OperatorSteps::WriteOutput, timer.lap());
+  return std::make_shared<Table>(input_table->column_definitions(),
+                                 must_materialize ? TableType::Data : TableType::References, std::move(output_chunks));
+}
+
+template <typename FirstSortColumnType>
+RowIDPosList TopK::_select_rows(const size_t row_count) {
+  const auto& input_table = left_input_table();
+  const auto chunk_count = input_table->chunk_count();
+
+  auto sort_columns = std::vector<std::unique_ptr<BaseSortColumnValues>>{};
+  sort_columns.reserve(_sort_definitions.size());
+  for (const auto& sort_definition : _sort_definitions) {
+    resolve_data_type(input_table->column_data_type(sort_definition.column), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      sort_columns.emplace_back(
+          std::make_unique<SortColumnValues<ColumnDataType>>(sort_definition.column, sort_definition.sort_mode,
+                                                             chunk_count));
+    });
+  }
+
+  // Orders rows like the stable Sort does: Rows with equal values keep their order in the input.
+  const auto comes_before = [&](const RowID& lhs, const RowID& rhs) {
+    for (const auto& sort_column : sort_columns) {
+      const auto result = sort_column->compare(lhs, rhs);
+      if (result != 0) return result < 0;
+    }
+    return lhs < rhs;
+  };
+
+  // Materializes the sort columns of the given chunks and returns their best row_count rows in the sorted order. Each
+  // chunk keeps its candidates in a max-heap, so that the worst of them is replaced whenever a better row is found.
+  // The candidates of the chunks are then merged pairwise in parallel, keeping at most row_count rows per merge.
+  const auto select_candidates = [&](const std::vector<ChunkID>& chunk_ids) {
+    auto candidates = std::vector<RowIDPosList>(chunk_ids.size());
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(chunk_ids.size());
+    for (auto chunk_idx = size_t{0}; chunk_idx < chunk_ids.size(); ++chunk_idx) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_idx]() {
+        const auto chunk_id = chunk_ids[chunk_idx];
+        const auto& chunk = *input_table->get_chunk(chunk_id);
+        for (const auto& sort_column : sort_columns) {
+          sort_column->materialize(chunk, chunk_id);
+        }
+
+        auto& heap = candidates[chunk_idx];
+        const auto chunk_size = chunk.size();
+        heap.reserve(std::min(row_count, static_cast<size_t>(chunk_size)));
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+          const auto row_id = RowID{chunk_id, chunk_offset};
+          if (heap.size() < row_count) {
+            heap.emplace_back(row_id);
+            std::push_heap(heap.begin(), heap.end(), comes_before);
+          } else if (comes_before(row_id, heap.front())) {
+            std::pop_heap(heap.begin(), heap.end(), comes_before);
+            heap.back() = row_id;
+            std::push_heap(heap.begin(), heap.end(), comes_before);
+          }
+        }
+        std::sort_heap(heap.begin(), heap.end(), comes_before);
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+    return merge_sorted_runs(std::move(candidates), comes_before, row_count);
+  };
+
+  // Order the chunks by the best value of the first sort column their pruning statistics allow for. Chunks without
+  // such a bound are always processed in the first wave. As the statistics do not tell whether a chunk contains NULLs,
+  // nullable columns can only be pruned if NULLs come last.
+  const auto& first_sort_definition = _sort_definitions.front();
+  const auto can_prune = !input_table->column_is_nullable(first_sort_definition.column) ||
+                         !is_nulls_first_sort_mode(first_sort_definition.sort_mode);
+  const auto first_is_better = [&](const FirstSortColumnType& lhs, const FirstSortColumnType& rhs) {
+    return is_ascending_sort_mode(first_sort_definition.sort_mode) ? lhs < rhs : rhs < lhs;
+  };
+
+  auto first_wave_chunk_ids = std::vector<ChunkID>{};
+  auto bounded_chunks = std::vector<std::pair<FirstSortColumnType, ChunkID>>{};
+  auto first_wave_row_count = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
+    if (chunk->size() == 0) continue;
+
+    const auto bound = can_prune ? best_value_bound<FirstSortColumnType>(*chunk, first_sort_definition.column,
+                                                                         first_sort_definition.sort_mode)
+                                 : std::nullopt;
+    if (bound) {
+      bounded_chunks.emplace_back(*bound, chunk_id);
+    } else {
+      first_wave_chunk_ids.emplace_back(chunk_id);
+      first_wave_row_count += chunk->size();
+    }
+  }
+
+  std::stable_sort(bounded_chunks.begin(), bounded_chunks.end(),
+                   [&](const auto& lhs, const auto& rhs) { return first_is_better(lhs.first, rhs.first); });
+
+  auto bounded_chunk_idx = size_t{0};
+  while (bounded_chunk_idx < bounded_chunks.size() && first_wave_row_count < row_count) {
+    const auto chunk_id = bounded_chunks[bounded_chunk_idx].second;
+    first_wave_chunk_ids.emplace_back(chunk_id);
+    first_wave_row_count += input_table->get_chunk(chunk_id)->size();
+    ++bounded_chunk_idx;
+  }
+
+  auto candidates = select_candidates(first_wave_chunk_ids);
+  if (bounded_chunk_idx == bounded_chunks.size()) return candidates;
+
+  // The k-th candidate is the worst row that can still be part of the output. As the remaining chunks are ordered by
+  // their bounds, all chunks after the first one whose bound is worse than its value can be pruned. A NULL can only be
+  // the k-th candidate if NULLs come last, so that any value of the remaining chunks is better.
+  auto remaining_chunks_end = bounded_chunks.size();
+  if (candidates.size() == row_count) {
+    const auto& first_sort_column = static_cast<const SortColumnValues<FirstSortColumnType>&>(*sort_columns.front());
+    const auto threshold = first_sort_column.value(candidates.back());
+    remaining_chunks_end = static_cast<size_t>(
+        std::find_if(bounded_chunks.begin() + static_cast<std::ptrdiff_t>(bounded_chunk_idx), bounded_chunks.end(),
+                     [&](const auto& bounded_chunk) {
+                       return threshold && first_is_better(*threshold, bounded_chunk.first);
+                     }) -
+        bounded_chunks.begin());
+  }
+
+  auto& step_performance_data = static_cast<PerformanceData&>(*performance_data);
+  step_performance_data.chunks_pruned = bounded_chunks.size() - remaining_chunks_end;
+
+  auto second_wave_chunk_ids = std::vector<ChunkID>{};
+  second_wave_chunk_ids.reserve(remaining_chunks_end - bounded_chunk_idx);
+  for (; bounded_chunk_idx < remaining_chunks_end; ++bounded_chunk_idx) {
+    second_wave_chunk_ids.emplace_back(bounded_chunks[bounded_chunk_idx].second);
+  }
+  if (second_wave_chunk_ids.empty()) return candidates;
+
+  auto runs = std::vector<RowIDPosList>{};
+  runs.emplace_back(std::move(candidates));
+  runs.emplace_back(select_candidates(second_wave_chunk_ids));
+  return merge_sorted_runs(std::move(runs), comes_before, row_count);
+}
+
+void TopK::PerformanceData::output_to_stream(std::ostream& stream, DescriptionMode description_mode) const {
+  OperatorPerformanceData<OperatorSteps>::output_to_stream(stream, description_mode);
+
+  stream << (description_mode == DescriptionMode::SingleLine ? " " : "\n") << "Chunks pruned: " << chunks_pruned
+         << ".";
+}
+
+}  // namespace opossum
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "expression/abstract_expression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Fuses a Sort and a Limit (ORDER BY ... LIMIT k) into a single operator that emits the first k rows of the sorted
+ * input without sorting the entire input. Each chunk is processed by a job of its own, which keeps the best k rows
+ * of the chunk in a bounded heap. The sorted candidates of all chunks are then merged pairwise in parallel, cutting
+ * each merge result off after k rows. The output is the same as that of a Sort followed by a Limit, including the
+ * order of rows with equal values (the Sort is stable) and the position of NULLs.
+ *
+ * Chunks are processed in two waves: The first wave consists of the chunks that might contain the best values of the
+ * first sort column according to their pruning statistics (plus all chunks without usable statistics), until at
+ * least k rows are covered. Once the first wave has found k candidates, the k-th of them is the worst row that can
+ * still be part of the output. Chunks whose best possible value (the minimum for ascending, the maximum for
+ * descending orders) is worse than the k-th candidate's value cannot contribute to the output and are pruned without
+ * being accessed. For nullable columns, pruning statistics are only used if NULLs come last, as the statistics do not
+ * tell whether a segment contains NULLs, which would otherwise come first. For reference tables, the statistics of the
+ * referenced chunk are used if a segment references only a single chunk (e.g., the output of a Validate on top of a
+ * GetTable).
+ *
+ * The TopKRule marks LimitNodes on top of SortNodes, which the LQPTranslator then translates into a TopK.
+ */
+class TopK : public AbstractReadOnlyOperator {
+ public:
+  TopK(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const std::shared_ptr<AbstractExpression>& row_count_expression);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+  std::shared_ptr<AbstractExpression> row_count_expression() const;
+
+  enum class OperatorSteps : uint8_t { SelectCandidates, WriteOutput };
+
+  struct PerformanceData : public OperatorPerformanceData<OperatorSteps> {
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override;
+
+    size_t chunks_pruned{0};
+  };
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
+
+  // Returns the RowIDs of the input table's first k rows in the sorted order. The data type of the first sort column is
+  // needed for the chunk pruning.
+  template <typename FirstSortColumnType>
+  RowIDPosList _select_rows(const size_t row_count);
+
+ private:
+  const std::vector<SortColumnDefinition> _sort_definitions;
+  std::shared_ptr<AbstractExpression> _row_count_expression;
+};
+
+}  // namespace opossum
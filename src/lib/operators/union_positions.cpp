@@ -8,6 +8,10 @@
 #include <utility>
 #include <vector>
 
+#include "hyrise.hpp"
+#include "operators/sort/sort_utils.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/chunk.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
@@ -23,6 +27,8 @@
  * Each element of this VirtualPosList references a row in a ReferenceMatrix by index. This way, if two values need to
  * be swapped while sorting, only two indices need to swapped instead of a RowID for each column in the
  * ReferenceMatrices.
+ * The sorting is the most expensive part of this operator. Therefore, the virtual pos lists are split into runs that
+ * are sorted by parallel jobs and then merged (see merge_sorted_runs).
  * Using a implementation derived from std::set_union, the two virtual pos lists are merged into the result table.
  *
  *
@@ -50,8 +56,6 @@
  * ### TODO(anybody) for potential performance improvements
  * Instead of using a ReferenceMatrix, consider using a linked list of RowIDs for each row. Since most of the sorting
  *      will depend on the leftmost column, this way most of the time no remote memory would need to be accessed
- *
- * The sorting, which is the most expensive part of this operator, could probably be parallelized.
  */
 namespace opossum {
 
@@ -86,23 +90,15 @@ std::shared_ptr<const Table> UnionPositions::_on_execute() {
   auto reference_matrix_left = _build_reference_matrix(left_input_table());
   auto reference_matrix_right = _build_reference_matrix(right_input_table());
 
-  /**
-   * Init the virtual pos lists
-   */
-  VirtualPosList virtual_pos_list_left(left_in_table.row_count(), 0u);
-  std::iota(virtual_pos_list_left.begin(), virtual_pos_list_left.end(), 0u);
-  VirtualPosList virtual_pos_list_right(right_input_table()->row_count(), 0u);
-  std::iota(virtual_pos_list_right.begin(), virtual_pos_list_right.end(), 0u);
-
   /**
    * Sort the virtual pos lists so that they bring the rows in their respective ReferenceMatrix into order.
    * This is necessary for merging them.
-   * PERFORMANCE NOTE: These sorts take the vast majority of time spend in this Operator
+   * PERFORMANCE NOTE: These sorts take the vast majority of time spend in this Operator, which is why they are
+   * performed by parallel jobs.
    */
-  std::sort(virtual_pos_list_left.begin(), virtual_pos_list_left.end(),
-            VirtualPosListCmpContext{reference_matrix_left});
-  std::sort(virtual_pos_list_right.begin(), virtual_pos_list_right.end(),
-            VirtualPosListCmpContext{reference_matrix_right});
+  const auto virtual_pos_list_left = _sort_virtual_pos_list(reference_matrix_left, left_in_table.row_count());
+  const auto virtual_pos_list_right =
+      _sort_virtual_pos_list(reference_matrix_right, right_input_table()->row_count());
 
   /**
    * Build result table
@@ -346,6 +342,32 @@ bool UnionPositions::_compare_reference_matrix_rows(const ReferenceMatrix& left_
   return false;
 }
 
+UnionPositions::VirtualPosList UnionPositions::_sort_virtual_pos_list(ReferenceMatrix& reference_matrix,
+                                                                     const size_t row_count) {
+  const auto comparator = VirtualPosListCmpContext{reference_matrix};
+
+  // Each run of the virtual pos list is initialized and sorted by a job of its own
+  const auto run_count = std::max(size_t{1}, (row_count + SORT_RUN_SIZE - 1) / SORT_RUN_SIZE);
+  auto runs = std::vector<VirtualPosList>(run_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(run_count);
+  for (auto run_idx = size_t{0}; run_idx < run_count; ++run_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, run_idx]() {
+      const auto run_begin = run_idx * SORT_RUN_SIZE;
+      const auto run_end = std::min(run_begin + SORT_RUN_SIZE, row_count);
+
+      auto& run = runs[run_idx];
+      run.resize(run_end - run_begin);
+      std::iota(run.begin(), run.end(), run_begin);
+      std::sort(run.begin(), run.end(), comparator);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  return merge_sorted_runs(std::move(runs), comparator);
+}
+
 bool UnionPositions::VirtualPosListCmpContext::operator()(size_t left, size_t right) const {
   for (const auto& reference_matrix_column : reference_matrix) {
     const auto left_row_id = reference_matrix_column[left];
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "operators/abstract_read_only_operator.hpp"
+#include "storage/chunk.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 
 namespace opossum {
@@ -88,6 +89,9 @@ class UnionPositions : public AbstractReadOnlyOperator {
     bool operator()(size_t left, size_t right) const;
   };
 
+  // Number of rows of a virtual pos list that are sorted by a single job before the sorted runs are merged
+  static constexpr auto SORT_RUN_SIZE = size_t{Chunk::DEFAULT_SIZE};
+
   std::shared_ptr<const Table> _on_execute() override;
 
   std::shared_ptr<AbstractOperator> _on_deep_copy(
@@ -108,6 +112,9 @@ class UnionPositions : public AbstractReadOnlyOperator {
   std::shared_ptr<const Table> _prepare_operator();
 
   UnionPositions::ReferenceMatrix _build_reference_matrix(const std::shared_ptr<const Table>& input_table) const;
+
+  // Returns the indices of the rows of the ReferenceMatrix in the order in which they are merged
+  static VirtualPosList _sort_virtual_pos_list(ReferenceMatrix& reference_matrix, const size_t row_count);
   static bool _compare_reference_matrix_rows(const ReferenceMatrix& left_matrix, size_t left_row_idx,
                                              const ReferenceMatrix& right_matrix, size_t right_row_idx);
 
@@ -0,0 +1,107 @@
+#include "unique_index_scan.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+#include "hyrise.hpp"
+#include "lossless_cast.hpp"
+#include "operators/get_table.hpp"
+#include "storage/index/unique_key_index.hpp"
+#include "storage/reference_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+UniqueIndexScan::UniqueIndexScan(const std::shared_ptr<const AbstractOperator>& in,
+                                 const std::vector<ColumnID>& column_ids, const std::vector<AllTypeVariant>& values)
+    : AbstractReadOnlyOperator{OperatorType::UniqueIndexScan, in}, _column_ids{column_ids}, _values{values} {
+  Assert(_column_ids.size() == _values.size(), "Expected one value per key column");
+}
+
+const std::string& UniqueIndexScan::name() const {
+  static const auto name = std::string{"UniqueIndexScan"};
+  return name;
+}
+
+std::string UniqueIndexScan::description(DescriptionMode description_mode) const {
+  const auto* const separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+  stream << name();
+  for (auto key_column_index = size_t{0}; key_column_index < _column_ids.size(); ++key_column_index) {
+    stream << separator << "Column #" << _column_ids[key_column_index] << " = " << _values[key_column_index];
+  }
+
+  return stream.str();
+}
+
+std::shared_ptr<const Table> UniqueIndexScan::_on_execute() {
+  const auto get_table = std::dynamic_pointer_cast<const GetTable>(left_input());
+  Assert(get_table, "UniqueIndexScan must follow a GetTable");
+
+  const auto stored_table = Hyrise::get().storage_manager.get_table(get_table->table_name());
+  const auto output_table = std::make_shared<Table>(left_input_table()->column_definitions(), TableType::References);
+
+  auto sorted_column_ids = _column_ids;
+  std::sort(sorted_column_ids.begin(), sorted_column_ids.end());
+
+  const auto& unique_key_indexes = stored_table->unique_key_indexes();
+  const auto unique_key_index_iter =
+      std::find_if(unique_key_indexes.cbegin(), unique_key_indexes.cend(),
+                   [&](const auto& unique_key_index) { return unique_key_index->column_ids() == sorted_column_ids; });
+  Assert(unique_key_index_iter != unique_key_indexes.cend(), "No enforced key constraint for the given columns");
+  const auto& unique_key_index = **unique_key_index_iter;
+
+  // Bring the values into the order of the index' columns and convert them to the columns' data types. Values that
+  // cannot be represented in a column's data type (e.g., 1.5 for an int column) and NULLs do not match any row.
+  auto key = UniqueKeyIndex::Key{};
+  key.reserve(_values.size());
+  for (const auto column_id : unique_key_index.column_ids()) {
+    const auto key_column_index = std::distance(_column_ids.cbegin(), std::find(_column_ids.cbegin(),
+                                                                                _column_ids.cend(), column_id));
+    const auto value = lossless_variant_cast(_values[key_column_index], stored_table->column_data_type(column_id));
+    if (!value || variant_is_null(*value)) return output_table;
+
+    key.emplace_back(*value);
+  }
+
+  auto row_ids = unique_key_index.lookup(key);
+
+  // Skip the rows of chunks that were pruned or physically deleted
+  const auto& pruned_chunk_ids = get_table->pruned_chunk_ids();
+  row_ids.erase(std::remove_if(row_ids.begin(), row_ids.end(),
+                               [&](const auto& row_id) {
+                                 return std::binary_search(pruned_chunk_ids.cbegin(), pruned_chunk_ids.cend(),
+                                                           row_id.chunk_id) ||
+                                        !stored_table->get_chunk(row_id.chunk_id);
+                               }),
+                row_ids.end());
+  if (row_ids.empty()) return output_table;
+
+  std::sort(row_ids.begin(), row_ids.end());
+  const auto pos_list = std::make_shared<RowIDPosList>(row_ids.cbegin(), row_ids.cend());
+  if (row_ids.front().chunk_id == row_ids.back().chunk_id) pos_list->guarantee_single_chunk();
+
+  // The output references the stored table directly, skipping the columns pruned by the GetTable
+  const auto& pruned_column_ids = get_table->pruned_column_ids();
+  auto segments = Segments{};
+  const auto stored_column_count = stored_table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < stored_column_count; ++column_id) {
+    if (std::binary_search(pruned_column_ids.cbegin(), pruned_column_ids.cend(), column_id)) continue;
+
+    segments.emplace_back(std::make_shared<ReferenceSegment>(stored_table, column_id, pos_list));
+  }
+
+  output_table->append_chunk(segments);
+  return output_table;
+}
+
+std::shared_ptr<AbstractOperator> UniqueIndexScan::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  return std::make_shared<UniqueIndexScan>(copied_left_input, _column_ids, _values);
+}
+
+void UniqueIndexScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+}  // namespace opossum
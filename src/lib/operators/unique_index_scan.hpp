@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that answers equality predicates on all columns of an enforced key constraint with the UniqueKeyIndex of
+ * the stored table (see Table::enforce_key_constraint) instead of scanning it. The input has to be a GetTable, whose
+ * pruned chunks and columns are respected. As the index holds all versions of a key, the output may contain rows that
+ * are invisible for the current transaction and still has to be validated.
+ */
+class UniqueIndexScan : public AbstractReadOnlyOperator {
+ public:
+  // The column ids refer to the stored table. There has to be one value per key column.
+  UniqueIndexScan(const std::shared_ptr<const AbstractOperator>& in, const std::vector<ColumnID>& column_ids,
+                  const std::vector<AllTypeVariant>& values);
+
+  const std::string& name() const final;
+  std::string description(DescriptionMode description_mode) const final;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() final;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+ private:
+  const std::vector<ColumnID> _column_ids;
+  const std::vector<AllTypeVariant> _values;
+};
+
+}  // namespace opossum
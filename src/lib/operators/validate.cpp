@@ -8,6 +8,7 @@
 #include "concurrency/transaction_context.hpp"
 #include "hyrise.hpp"
 #include "operators/delete.hpp"
+#include "operators/row_budget.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
 #include "storage/reference_segment.hpp"
@@ -25,6 +26,24 @@ bool is_row_visible(TransactionID our_tid, CommitID snapshot_commit_id, ChunkOff
   return Validate::is_row_visible(our_tid, snapshot_commit_id, row_tid, begin_cid, end_cid);
 }
 
+// For compact MvccData (see MvccData::compact()), all rows share the same begin CID and only locked or invalidated
+// rows have individual MVCC information. Instead of looking at every row, we evaluate the visibility of an untouched
+// row once and only check the sparse rows individually.
+std::vector<bool> visible_rows_of_compact_chunk(TransactionID our_tid, CommitID snapshot_commit_id,
+                                                const MvccData& mvcc_data, const ChunkOffset chunk_size) {
+  const auto begin_cid = mvcc_data.get_begin_cid(ChunkOffset{0});
+  const auto untouched_row_visible = Validate::is_row_visible(our_tid, snapshot_commit_id, INVALID_TRANSACTION_ID,
+                                                              begin_cid, MvccData::MAX_COMMIT_ID);
+  auto visible_rows = std::vector<bool>(chunk_size, untouched_row_visible);
+
+  mvcc_data.for_each_sparse_row([&](const auto chunk_offset, const auto row_tid, const auto end_cid) {
+    if (chunk_offset >= chunk_size) return;
+    visible_rows[chunk_offset] = Validate::is_row_visible(our_tid, snapshot_commit_id, row_tid, begin_cid, end_cid);
+  });
+
+  return visible_rows;
+}
+
 }  // namespace
 
 bool Validate::is_row_visible(TransactionID our_tid, CommitID snapshot_commit_id, const TransactionID row_tid,
@@ -106,6 +125,13 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
       break;
     }
   }
+  _is_read_only_transaction = read_write_operators.empty();
+
+  // Used to bound the validity of cached visibility bitmaps. Must be read before looking at the chunks.
+  const auto last_commit_id = Hyrise::get().transaction_manager.last_commit_id();
+
+  // Once a downstream Limit has enough rows, the remaining chunks are not validated
+  auto row_budget = RowBudget{_output_row_budget};
 
   while (job_end_chunk_id < chunk_count) {
     const auto chunk = in_table->get_chunk(job_end_chunk_id);
@@ -119,12 +145,12 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
       bool execute_directly = job_start_chunk_id == 0 && job_end_chunk_id == (chunk_count - 1);
 
       if (execute_directly) {
-        _validate_chunks(in_table, job_start_chunk_id, job_end_chunk_id, our_tid, snapshot_commit_id, output_chunks,
-                         output_mutex);
+        _validate_chunks(in_table, job_start_chunk_id, job_end_chunk_id, our_tid, snapshot_commit_id, last_commit_id,
+                         output_chunks, output_mutex, row_budget);
       } else {
-        jobs.push_back(std::make_shared<JobTask>([=, this, &output_chunks, &output_mutex] {
-          _validate_chunks(in_table, job_start_chunk_id, job_end_chunk_id, our_tid, snapshot_commit_id, output_chunks,
-                           output_mutex);
+        jobs.push_back(std::make_shared<JobTask>([=, this, &output_chunks, &output_mutex, &row_budget] {
+          _validate_chunks(in_table, job_start_chunk_id, job_end_chunk_id, our_tid, snapshot_commit_id,
+                           last_commit_id, output_chunks, output_mutex, row_budget);
         }));
 
         // Prepare next job
@@ -142,8 +168,9 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
 
 void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id_start,
                                 const ChunkID chunk_id_end, const TransactionID our_tid,
-                                const TransactionID snapshot_commit_id,
-                                std::vector<std::shared_ptr<Chunk>>& output_chunks, std::mutex& output_mutex) const {
+                                const TransactionID snapshot_commit_id, const CommitID last_commit_id,
+                                std::vector<std::shared_ptr<Chunk>>& output_chunks, std::mutex& output_mutex,
+                                RowBudget& row_budget) const {
   // Stores whether a chunk has been found to be entirely visible. Only used for reference tables where no single
   // chunk guarantee has been given. Not stored in Validate object to avoid concurrency issues. This assumes that
   // only one table is referenced over all chunks. If, in the future, this is not true anymore, entirely_visible_chunks
@@ -151,7 +178,7 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, co
   auto entirely_visible_chunks = std::vector<bool>{};
   auto entirely_visible_chunks_table = std::shared_ptr<const Table>{};  // used only for sanity check
 
-  for (auto chunk_id = chunk_id_start; chunk_id <= chunk_id_end; ++chunk_id) {
+  for (auto chunk_id = chunk_id_start; chunk_id <= chunk_id_end && !row_budget.is_exhausted(); ++chunk_id) {
     const auto chunk_in = in_table->get_chunk(chunk_id);
     Assert(chunk_in, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
@@ -191,6 +218,29 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, co
           // We can reuse the old PosList since it is entirely visible. Not using the entirely_visible_chunks cache for
           // this shortcut to keep the code short.
           pos_list_out = pos_list_in;
+        } else if (mvcc_data->is_compact()) {
+          const auto visible_rows =
+              visible_rows_of_compact_chunk(our_tid, snapshot_commit_id, *mvcc_data, referenced_chunk->size());
+          RowIDPosList temp_pos_list;
+          temp_pos_list.guarantee_single_chunk();
+          for (auto row_id : *pos_list_in) {
+            if (visible_rows[row_id.chunk_offset]) {
+              temp_pos_list.emplace_back(row_id);
+            }
+          }
+          pos_list_out = std::make_shared<const RowIDPosList>(std::move(temp_pos_list));
+        } else if (const auto cached_visibility =
+                       _is_read_only_transaction ? mvcc_data->cached_visibility(snapshot_commit_id) : nullptr) {
+          // Another read-only transaction with a similar snapshot has already evaluated the visibility of this chunk.
+          const auto& visible_rows = cached_visibility->visible_rows;
+          RowIDPosList temp_pos_list;
+          temp_pos_list.guarantee_single_chunk();
+          for (auto row_id : *pos_list_in) {
+            if (row_id.chunk_offset < visible_rows.size() && visible_rows[row_id.chunk_offset]) {
+              temp_pos_list.emplace_back(row_id);
+            }
+          }
+          pos_list_out = std::make_shared<const RowIDPosList>(std::move(temp_pos_list));
         } else {
           RowIDPosList temp_pos_list;
           temp_pos_list.guarantee_single_chunk();
@@ -263,9 +313,51 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, co
         temp_pos_list.guarantee_single_chunk();
         // Generate pos_list_out.
         auto chunk_size = chunk_in->size();  // The compiler fails to optimize this in the for clause :(
-        for (auto i = 0u; i < chunk_size; i++) {
-          if (opossum::is_row_visible(our_tid, snapshot_commit_id, i, *mvcc_data)) {
-            temp_pos_list.emplace_back(RowID{chunk_id, i});
+        if (mvcc_data->is_compact()) {
+          const auto visible_rows = visible_rows_of_compact_chunk(our_tid, snapshot_commit_id, *mvcc_data, chunk_size);
+          for (auto i = 0u; i < chunk_size; i++) {
+            if (visible_rows[i]) {
+              temp_pos_list.emplace_back(RowID{chunk_id, i});
+            }
+          }
+        } else if (_is_read_only_transaction) {
+          auto cached_visibility = mvcc_data->cached_visibility(snapshot_commit_id);
+          if (!cached_visibility) {
+            cached_visibility =
+                _evaluate_visibility_read_only(*mvcc_data, chunk_size, snapshot_commit_id, last_commit_id);
+            if (cached_visibility && snapshot_commit_id < cached_visibility->end_snapshot_commit_id) {
+              mvcc_data->set_cached_visibility(cached_visibility);
+            }
+          }
+
+          if (!cached_visibility && !mvcc_data->is_compact()) {
+            // The MvccData is being compacted. Its sparse rows are still incomplete, so we look at each row.
+            for (auto i = 0u; i < chunk_size; i++) {
+              if (opossum::is_row_visible(our_tid, snapshot_commit_id, i, *mvcc_data)) {
+                temp_pos_list.emplace_back(RowID{chunk_id, i});
+              }
+            }
+          } else {
+            auto compact_visible_rows = std::vector<bool>{};
+            if (!cached_visibility) {
+              compact_visible_rows =
+                  visible_rows_of_compact_chunk(our_tid, snapshot_commit_id, *mvcc_data, chunk_size);
+            }
+
+            // Rows that were added after the bitmap was created are not visible for the snapshot
+            const auto& visible_rows = cached_visibility ? cached_visibility->visible_rows : compact_visible_rows;
+            const auto visible_rows_size = std::min(chunk_size, static_cast<ChunkOffset>(visible_rows.size()));
+            for (auto i = 0u; i < visible_rows_size; i++) {
+              if (visible_rows[i]) {
+                temp_pos_list.emplace_back(RowID{chunk_id, i});
+              }
+            }
+          }
+        } else {
+          for (auto i = 0u; i < chunk_size; i++) {
+            if (opossum::is_row_visible(our_tid, snapshot_commit_id, i, *mvcc_data)) {
+              temp_pos_list.emplace_back(RowID{chunk_id, i});
+            }
           }
         }
         pos_list_out = std::make_shared<const RowIDPosList>(std::move(temp_pos_list));
@@ -279,6 +371,8 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, co
     }
 
     if (!pos_list_out->empty()) {
+      row_budget.consume(pos_list_out->size());
+
       std::lock_guard<std::mutex> lock(output_mutex);
       // The validate operator does not affect the sorted_by property. If a chunk has been sorted before, it still is
       // after the validate operator.
@@ -294,4 +388,49 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, co
   }
 }
 
+std::shared_ptr<const MvccData::CachedVisibility> Validate::_evaluate_visibility_read_only(
+    const MvccData& mvcc_data, const ChunkOffset chunk_size, const CommitID snapshot_commit_id,
+    const CommitID last_commit_id) {
+  // Read-only transactions never find their own TID in the MvccData. Thus, the TIDs do not need to be looked at and
+  // the visibility check simplifies to begin_cid <= snapshot_commit_id < end_cid.
+  const auto* const begin_cids = mvcc_data._begin_cids.data();
+  const auto* const end_cids = mvcc_data._end_cids.data();
+
+  auto visible_rows_mask = std::vector<uint8_t>(chunk_size);
+  auto* const visible_rows_mask_data = visible_rows_mask.data();
+
+  // The visibility of the rows does not change for snapshot commit ids between the largest begin/end CID that is not
+  // greater than the snapshot commit id (lower_bound) and the smallest one that is greater (upper_bound).
+  auto lower_bound = CommitID{0};
+  auto upper_bound = MvccData::MAX_COMMIT_ID;
+
+  // The OpenMP pragma makes the compiler vectorize the loop including the reductions of the bounds (see
+  // AbstractTableScanImpl for more details on -fopenmp-simd).
+  // NOLINTNEXTLINE
+  {}  // clang-format off
+  #pragma omp simd reduction(max:lower_bound) reduction(min:upper_bound)
+  // clang-format on
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    const auto begin_cid = begin_cids[chunk_offset];
+    const auto end_cid = end_cids[chunk_offset];
+    visible_rows_mask_data[chunk_offset] = (begin_cid <= snapshot_commit_id) & (snapshot_commit_id < end_cid);
+
+    lower_bound = begin_cid <= snapshot_commit_id && begin_cid > lower_bound ? begin_cid : lower_bound;
+    lower_bound = end_cid <= snapshot_commit_id && end_cid > lower_bound ? end_cid : lower_bound;
+    upper_bound = begin_cid > snapshot_commit_id && begin_cid < upper_bound ? begin_cid : upper_bound;
+    upper_bound = end_cid > snapshot_commit_id && end_cid < upper_bound ? end_cid : upper_bound;
+  }
+
+  // Once a compaction has started, invalidations are no longer written to the vectors that we have just looked at.
+  if (mvcc_data._representation.load() != MvccData::Representation::Full) return nullptr;
+
+  auto cached_visibility = std::make_shared<MvccData::CachedVisibility>();
+  cached_visibility->begin_snapshot_commit_id = lower_bound;
+  // Commits that had not been published when last_commit_id was read might have been written only partially (or not
+  // at all) when we looked at the MvccData. Their commit ids are greater than last_commit_id.
+  cached_visibility->end_snapshot_commit_id = std::min(upper_bound, static_cast<CommitID>(last_commit_id + 1));
+  cached_visibility->visible_rows = std::vector<bool>(visible_rows_mask.begin(), visible_rows_mask.end());
+  return cached_visibility;
+}
+
 }  // namespace opossum
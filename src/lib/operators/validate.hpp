@@ -5,11 +5,14 @@
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
+#include "storage/mvcc_data.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+class RowBudget;
+
 /**
  * Validates visibility of records of a table
  * within the context of a given transaction
@@ -31,7 +34,16 @@ class Validate : public AbstractReadOnlyOperator {
  private:
   void _validate_chunks(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id_start,
                         const ChunkID chunk_id_end, const TransactionID our_tid, const TransactionID snapshot_commit_id,
-                        std::vector<std::shared_ptr<Chunk>>& output_chunks, std::mutex& output_mutex) const;
+                        const CommitID last_commit_id, std::vector<std::shared_ptr<Chunk>>& output_chunks,
+                        std::mutex& output_mutex, RowBudget& row_budget) const;
+
+  // Evaluates the visibility of the first `chunk_size` rows of full-length MvccData for a read-only transaction. The
+  // loop over the begin and end CIDs is vectorized. Besides the visibility bitmap, it determines the range of snapshot
+  // commit ids for which the bitmap is valid, so that it can be cached in the MvccData. Returns nullptr if the MvccData
+  // is being compacted concurrently.
+  static std::shared_ptr<const MvccData::CachedVisibility> _evaluate_visibility_read_only(
+      const MvccData& mvcc_data, const ChunkOffset chunk_size, const CommitID snapshot_commit_id,
+      const CommitID last_commit_id);
 
   // This is a performance optimization that can only be used if a couple of conditions are met, i.e., if
   // _can_use_chunk_shortcut is true. Consult _on_execute() for more details on the conditions.
@@ -39,6 +51,10 @@ class Validate : public AbstractReadOnlyOperator {
 
   bool _can_use_chunk_shortcut = true;
 
+  // Transactions that have not modified any data cannot see their own (uncommitted) changes. Thus, they can use and
+  // populate the visibility bitmaps cached in the MvccData. Determined in _on_execute().
+  bool _is_read_only_transaction = false;
+
  protected:
   std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> transaction_context) override;
   std::shared_ptr<const Table> _on_execute() override;
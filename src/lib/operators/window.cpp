@@ -0,0 +1,533 @@
+#include "window.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "boost/functional/hash.hpp"
+
+#include "expression/aggregate_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "hyrise.hpp"
+#include "operators/aggregate/aggregate_traits.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::vector<ColumnID> column_ids(const std::vector<std::shared_ptr<AbstractExpression>>& expressions) {
+  auto column_ids = std::vector<ColumnID>{};
+  column_ids.reserve(expressions.size());
+  for (const auto& expression : expressions) {
+    const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expression);
+    Assert(pqp_column_expression, "Window operator can only partition and sort by columns");
+    column_ids.emplace_back(pqp_column_expression->column_id);
+  }
+  return column_ids;
+}
+
+std::unique_ptr<BaseSortColumnValues> make_sort_column_values(const Table& table, const ColumnID column_id,
+                                                              const SortMode sort_mode) {
+  auto sort_column_values = std::unique_ptr<BaseSortColumnValues>{};
+  resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    sort_column_values =
+        std::make_unique<SortColumnValues<ColumnDataType>>(column_id, sort_mode, table.chunk_count());
+  });
+  return sort_column_values;
+}
+
+int compare_rows(const std::vector<std::unique_ptr<BaseSortColumnValues>>& columns, const RowID& lhs,
+                 const RowID& rhs) {
+  for (const auto& column : columns) {
+    const auto result = column->compare(lhs, rhs);
+    if (result != 0) return result;
+  }
+  return 0;
+}
+
+// Merges sorted runs within a single job. Unlike merge_sorted_runs, this is used by the jobs that process the hash
+// partitions, which are already running in parallel.
+template <typename Comparator>
+RowIDPosList merge_runs_sequentially(std::vector<RowIDPosList>& runs, const Comparator& comes_before) {
+  auto row_count = size_t{0};
+  for (const auto& run : runs) {
+    row_count += run.size();
+  }
+
+  // The runs are concatenated, then adjacent runs are merged in place until a single run is left
+  auto rows = RowIDPosList{};
+  rows.reserve(row_count);
+  auto run_ends = std::vector<size_t>{};
+  for (auto& run : runs) {
+    if (run.empty()) continue;
+    rows.insert(rows.end(), run.begin(), run.end());
+    run_ends.emplace_back(rows.size());
+    run = RowIDPosList{};
+  }
+
+  while (run_ends.size() > 1) {
+    auto merged_run_ends = std::vector<size_t>{};
+    merged_run_ends.reserve((run_ends.size() + 1) / 2);
+    for (auto run_idx = size_t{0}; run_idx < run_ends.size(); run_idx += 2) {
+      if (run_idx + 1 == run_ends.size()) {
+        merged_run_ends.emplace_back(run_ends[run_idx]);
+        break;
+      }
+
+      const auto run_begin = run_idx == 0 ? size_t{0} : run_ends[run_idx - 1];
+      std::inplace_merge(rows.begin() + run_begin, rows.begin() + run_ends[run_idx],
+                         rows.begin() + run_ends[run_idx + 1], comes_before);
+      merged_run_ends.emplace_back(run_ends[run_idx + 1]);
+    }
+    run_ends = std::move(merged_run_ends);
+  }
+
+  return rows;
+}
+
+// Sums of the values of a partition (in the sorted order) over arbitrary frames. NULLs are skipped, and the sum of a
+// frame without any non-NULL value is NULL. The sums are either computed from prefix sums or, if the difference of
+// two prefix sums is not exact (i.e., for floating-point sums), with a segment tree.
+template <typename SumType>
+class FrameSums {
+ public:
+  FrameSums(const std::vector<std::optional<SumType>>& values, const bool use_segment_tree)
+      : _value_count(values.size()), _use_segment_tree(use_segment_tree) {
+    if (_use_segment_tree) {
+      // The leaves are stored at [_value_count, 2 * _value_count), and each inner node is the sum of its two children
+      _nodes.resize(2 * _value_count);
+      // Without values, there are no inner nodes to build (and _value_count - 1 would underflow)
+      if (_value_count == 0) return;
+
+      for (auto value_idx = size_t{0}; value_idx < _value_count; ++value_idx) {
+        if (values[value_idx]) _nodes[_value_count + value_idx] = {*values[value_idx], 1};
+      }
+      for (auto node_idx = _value_count - 1; node_idx > 0; --node_idx) {
+        _nodes[node_idx] = _nodes[2 * node_idx] + _nodes[2 * node_idx + 1];
+      }
+    } else {
+      _nodes.resize(_value_count + 1);
+      for (auto value_idx = size_t{0}; value_idx < _value_count; ++value_idx) {
+        _nodes[value_idx + 1] = _nodes[value_idx];
+        if (values[value_idx]) _nodes[value_idx + 1] = _nodes[value_idx + 1] + Sum{*values[value_idx], 1};
+      }
+    }
+  }
+
+  // Sum of the values in [begin, end)
+  std::optional<SumType> sum(const size_t begin, const size_t end) const {
+    auto result = Sum{};
+    if (_use_segment_tree) {
+      for (auto left = begin + _value_count, right = end + _value_count; left < right; left /= 2, right /= 2) {
+        if (left % 2 == 1) result = result + _nodes[left++];
+        if (right % 2 == 1) result = result + _nodes[--right];
+      }
+    } else {
+      result = {_nodes[end].sum - _nodes[begin].sum, _nodes[end].non_null_count - _nodes[begin].non_null_count};
+    }
+
+    if (result.non_null_count == 0) return std::nullopt;
+    return result.sum;
+  }
+
+ private:
+  struct Sum {
+    Sum operator+(const Sum& other) const { return {sum + other.sum, non_null_count + other.non_null_count}; }
+
+    SumType sum{};
+    size_t non_null_count{0};
+  };
+
+  const size_t _value_count;
+  const bool _use_segment_tree;
+
+  // Either the segment tree's nodes or the prefix sums, where _nodes[i] is the sum of the first i values
+  std::vector<Sum> _nodes;
+};
+
+}  // namespace
+
+namespace opossum {
+
+Window::Window(const std::shared_ptr<const AbstractOperator>& in,
+               const std::shared_ptr<WindowFunctionExpression>& window_function_expression)
+    : AbstractReadOnlyOperator(OperatorType::Window, in, nullptr,
+                               std::make_unique<OperatorPerformanceData<OperatorSteps>>()),
+      _window_function_expression(window_function_expression),
+      _partition_by_column_ids(column_ids(window_function_expression->partition_by_expressions())),
+      _order_by_column_ids(column_ids(window_function_expression->order_by_expressions())) {
+  const auto& argument = _window_function_expression->argument();
+  Assert(!argument || argument->type == ExpressionType::PQPColumn, "Window operator can only aggregate columns");
+}
+
+const std::string& Window::name() const {
+  static const auto name = std::string{"Window"};
+  return name;
+}
+
+std::string Window::description(DescriptionMode description_mode) const {
+  const auto* const separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+  stream << name() << separator << _window_function_expression->as_column_name();
+  return stream.str();
+}
+
+std::shared_ptr<WindowFunctionExpression> Window::window_function_expression() const {
+  return _window_function_expression;
+}
+
+std::shared_ptr<AbstractOperator> Window::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  return std::make_shared<Window>(
+      copied_left_input, std::static_pointer_cast<WindowFunctionExpression>(_window_function_expression->deep_copy()));
+}
+
+void Window::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+void Window::_on_cleanup() {
+  _partition_by_values.clear();
+  _order_by_values.clear();
+}
+
+std::shared_ptr<const Table> Window::_on_execute() {
+  Timer timer;
+
+  const auto& input_table = left_input_table();
+  const auto chunk_count = input_table->chunk_count();
+
+  for (const auto column_id : _partition_by_column_ids) {
+    _partition_by_values.emplace_back(make_sort_column_values(*input_table, column_id, SortMode::Ascending));
+  }
+  for (auto order_by_idx = size_t{0}; order_by_idx < _order_by_column_ids.size(); ++order_by_idx) {
+    _order_by_values.emplace_back(make_sort_column_values(*input_table, _order_by_column_ids[order_by_idx],
+                                                          _window_function_expression->sort_modes[order_by_idx]));
+  }
+
+  const auto& argument = _window_function_expression->argument();
+  auto argument_column_id = std::optional<ColumnID>{};
+  auto argument_values = std::unique_ptr<BaseSortColumnValues>{};
+  if (argument) {
+    argument_column_id = static_cast<const PQPColumnExpression&>(*argument).column_id;
+    argument_values = make_sort_column_values(*input_table, *argument_column_id, SortMode::Ascending);
+  }
+
+  // Rows with equal PARTITION BY values need to end up in the same hash partition. Similar to the AggregateHash, the
+  // number of hash partitions is a power of two, so that the partition is given by the upper bits of the hash value.
+  auto radix_bits = size_t{0};
+  if (!_partition_by_column_ids.empty()) {
+    const auto job_count = std::min(static_cast<size_t>(chunk_count), MAX_PARTITION_COUNT);
+    while ((size_t{1} << radix_bits) < job_count) {
+      ++radix_bits;
+    }
+  }
+  const auto partition_count = size_t{1} << radix_bits;
+
+  const auto comes_before = [&](const RowID& lhs, const RowID& rhs) { return _comes_before(lhs, rhs); };
+
+  // Phase 1: Partition and sort the rows of each chunk. runs[partition_idx][chunk_id] holds the chunk's sorted rows
+  // that belong to the hash partition.
+  auto runs = std::vector<std::vector<RowIDPosList>>(partition_count);
+  for (auto& partition_runs : runs) {
+    partition_runs.resize(chunk_count);
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk = input_table->get_chunk(chunk_id);
+      Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
+
+      for (const auto& sort_column_values : _partition_by_values) {
+        sort_column_values->materialize(*chunk, chunk_id);
+      }
+      for (const auto& sort_column_values : _order_by_values) {
+        sort_column_values->materialize(*chunk, chunk_id);
+      }
+      if (argument_values) argument_values->materialize(*chunk, chunk_id);
+
+      const auto chunk_size = chunk->size();
+      if (partition_count == 1) {
+        auto& run = runs[0][chunk_id];
+        run.resize(chunk_size);
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+          run[chunk_offset] = RowID{chunk_id, chunk_offset};
+        }
+      } else {
+        // NULLs are hashed as 0, so that all NULLs end up in the same partition
+        auto hashes = std::vector<size_t>(chunk_size);
+        for (const auto column_id : _partition_by_column_ids) {
+          resolve_data_type(input_table->column_data_type(column_id), [&](const auto data_type_t) {
+            using ColumnDataType = typename decltype(data_type_t)::type;
+            segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+              const auto value_hash = position.is_null() ? size_t{0} : std::hash<ColumnDataType>{}(position.value());
+              boost::hash_combine(hashes[position.chunk_offset()], value_hash);
+            });
+          });
+        }
+
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+          // Fibonacci hashing spreads similar hash values (e.g., those of consecutive integers) across the partitions
+          const auto partition_idx = (hashes[chunk_offset] * 11'400'714'819'323'198'485ul) >> (64 - radix_bits);
+          runs[partition_idx][chunk_id].emplace_back(RowID{chunk_id, chunk_offset});
+        }
+      }
+
+      for (auto partition_idx = size_t{0}; partition_idx < partition_count; ++partition_idx) {
+        auto& run = runs[partition_idx][chunk_id];
+        std::sort(run.begin(), run.end(), comes_before);
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  auto& step_performance_data = dynamic_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
+  step_performance_data.set_step_runtime(OperatorSteps::PartitionAndSortChunks, timer.lap());
+
+  // Phase 2: Merge the runs of each hash partition and compute the window function. As each frame contains at least the
+  // current row, SUM() can only be NULL if its argument is nullable.
+  const auto result_is_nullable = argument_column_id && input_table->column_is_nullable(*argument_column_id);
+  auto result_segments = std::vector<std::shared_ptr<AbstractSegment>>{};
+  if (argument) {
+    resolve_data_type(argument->data_type(), [&](const auto data_type_t) {
+      using ArgumentType = typename decltype(data_type_t)::type;
+      if constexpr (std::is_arithmetic_v<ArgumentType>) {
+        using SumType = typename AggregateTraits<ArgumentType, AggregateFunction::Sum>::AggregateType;
+        result_segments = _compute_window_function<SumType, ArgumentType>(runs, argument_values.get(),
+                                                                           result_is_nullable);
+      } else {
+        Fail("SUM() can only be computed on numeric arguments");
+      }
+    });
+  } else {
+    result_segments = _compute_window_function<int64_t, int64_t>(runs, nullptr, false);
+  }
+
+  step_performance_data.set_step_runtime(OperatorSteps::ComputeWindowFunction, timer.lap());
+
+  // Phase 3: Append the results to the input chunks. As for the Projection, the results of a reference table's chunks
+  // are stored in a separate data table, which the output's ReferenceSegments point to.
+  const auto result_column_definition = TableColumnDefinition{_window_function_expression->as_column_name(),
+                                                              _window_function_expression->data_type(),
+                                                              result_is_nullable};
+
+  auto output_column_definitions = input_table->column_definitions();
+  output_column_definitions.emplace_back(result_column_definition);
+
+  auto window_result_table = std::shared_ptr<Table>{};
+  if (input_table->type() == TableType::References) {
+    window_result_table = std::make_shared<Table>(TableColumnDefinitions{result_column_definition}, TableType::Data,
+                                                  std::nullopt, input_table->uses_mvcc());
+  }
+
+  const auto column_count = input_table->column_count();
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto input_chunk = input_table->get_chunk(chunk_id);
+
+    auto output_segments = Segments{};
+    output_segments.reserve(column_count + 1);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      output_segments.emplace_back(input_chunk->get_segment(column_id));
+    }
+
+    auto output_chunk = std::shared_ptr<Chunk>{};
+    if (!window_result_table) {
+      output_segments.emplace_back(std::move(result_segments[chunk_id]));
+      output_chunk = std::make_shared<Chunk>(std::move(output_segments), input_chunk->mvcc_data());
+      output_chunk->increase_invalid_row_count(input_chunk->invalid_row_count());
+    } else {
+      window_result_table->append_chunk(Segments{std::move(result_segments[chunk_id])}, input_chunk->mvcc_data());
+      output_segments.emplace_back(std::make_shared<ReferenceSegment>(
+          window_result_table, ColumnID{0}, std::make_shared<EntireChunkPosList>(chunk_id, input_chunk->size())));
+      output_chunk = std::make_shared<Chunk>(std::move(output_segments));
+    }
+    output_chunk->finalize();
+
+    // The input columns keep their ColumnIDs
+    const auto& sorted_by = input_chunk->individually_sorted_by();
+    if (!sorted_by.empty()) output_chunk->set_individually_sorted_by(sorted_by);
+
+    output_chunks[chunk_id] = output_chunk;
+  }
+
+  step_performance_data.set_step_runtime(OperatorSteps::WriteOutput, timer.lap());
+
+  return std::make_shared<Table>(output_column_definitions, input_table->type(), std::move(output_chunks),
+                                 input_table->uses_mvcc());
+}
+
+template <typename ResultType, typename ArgumentType>
+std::vector<std::shared_ptr<AbstractSegment>> Window::_compute_window_function(
+    std::vector<std::vector<RowIDPosList>>& runs, const BaseSortColumnValues* argument_values,
+    const bool result_is_nullable) const {
+  const auto& input_table = left_input_table();
+  const auto chunk_count = input_table->chunk_count();
+
+  // The jobs write to disjoint positions of the result vectors. NULLs are stored as bytes, as concurrent writes to
+  // different elements of a vector<bool> are not thread-safe.
+  auto results = std::vector<pmr_vector<ResultType>>(chunk_count);
+  auto result_nulls = std::vector<std::vector<uint8_t>>(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk_size = input_table->get_chunk(chunk_id)->size();
+    results[chunk_id].resize(chunk_size);
+    if (argument_values) result_nulls[chunk_id].resize(chunk_size);
+  }
+
+  const auto comes_before = [&](const RowID& lhs, const RowID& rhs) { return _comes_before(lhs, rhs); };
+  const auto partition_count = runs.size();
+
+  // A single hash partition is merged by parallel jobs, so that there is some parallelism without PARTITION BY
+  auto sorted_partitions = std::vector<RowIDPosList>(partition_count);
+  if (partition_count == 1) sorted_partitions[0] = merge_sorted_runs(std::move(runs[0]), comes_before);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(partition_count);
+  for (auto partition_idx = size_t{0}; partition_idx < partition_count; ++partition_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_idx]() {
+      auto& rows = sorted_partitions[partition_idx];
+      if (partition_count > 1) rows = merge_runs_sequentially(runs[partition_idx], comes_before);
+
+      _compute_hash_partition<ResultType, ArgumentType>(rows, argument_values, results, result_nulls);
+      rows = RowIDPosList{};
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  auto result_segments = std::vector<std::shared_ptr<AbstractSegment>>(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (result_is_nullable) {
+      auto null_values = pmr_vector<bool>(result_nulls[chunk_id].begin(), result_nulls[chunk_id].end());
+      result_segments[chunk_id] =
+          std::make_shared<ValueSegment<ResultType>>(std::move(results[chunk_id]), std::move(null_values));
+    } else {
+      result_segments[chunk_id] = std::make_shared<ValueSegment<ResultType>>(std::move(results[chunk_id]));
+    }
+  }
+  return result_segments;
+}
+
+template <typename ResultType, typename ArgumentType>
+void Window::_compute_hash_partition(const RowIDPosList& rows, const BaseSortColumnValues* argument_values,
+                                     std::vector<pmr_vector<ResultType>>& results,
+                                     std::vector<std::vector<uint8_t>>& result_nulls) const {
+  const auto& frame = _window_function_expression->frame;
+  const auto row_count = rows.size();
+
+  const auto write_result = [&](const RowID& row_id, const std::optional<ResultType>& result) {
+    if (result) {
+      results[row_id.chunk_id][row_id.chunk_offset] = *result;
+    } else {
+      result_nulls[row_id.chunk_id][row_id.chunk_offset] = 1;
+    }
+  };
+
+  // As the rows are sorted by their PARTITION BY values first, each SQL partition is a range of the sorted rows
+  auto partition_begin = size_t{0};
+  while (partition_begin < row_count) {
+    auto partition_end = partition_begin + 1;
+    while (partition_end < row_count && _in_same_partition(rows[partition_begin], rows[partition_end])) {
+      ++partition_end;
+    }
+
+    switch (_window_function_expression->window_function) {
+      case WindowFunction::RowNumber:
+        for (auto row_idx = partition_begin; row_idx < partition_end; ++row_idx) {
+          write_result(rows[row_idx], static_cast<ResultType>(row_idx - partition_begin + 1));
+        }
+        break;
+
+      case WindowFunction::Rank: {
+        auto rank = ResultType{1};
+        for (auto row_idx = partition_begin; row_idx < partition_end; ++row_idx) {
+          if (row_idx > partition_begin && !_are_peers(rows[row_idx - 1], rows[row_idx])) {
+            rank = static_cast<ResultType>(row_idx - partition_begin + 1);
+          }
+          write_result(rows[row_idx], rank);
+        }
+      } break;
+
+      case WindowFunction::Sum: {
+        const auto partition_size = partition_end - partition_begin;
+        const auto& typed_argument_values = static_cast<const SortColumnValues<ArgumentType>&>(*argument_values);
+
+        auto values = std::vector<std::optional<ResultType>>(partition_size);
+        for (auto value_idx = size_t{0}; value_idx < partition_size; ++value_idx) {
+          const auto value = typed_argument_values.value(rows[partition_begin + value_idx]);
+          if (value) values[value_idx] = static_cast<ResultType>(*value);
+        }
+
+        // Subtracting prefix sums is only exact for integers. Frames starting at the partition's beginning are prefix
+        // sums themselves.
+        const auto use_segment_tree = std::is_floating_point_v<ResultType> && frame.preceding;
+        const auto frame_sums = FrameSums<ResultType>{values, use_segment_tree};
+
+        // Peers of the current row (only needed for RANGE frames), relative to the partition's beginning
+        auto peer_group_begin = size_t{0};
+        auto peer_group_end = size_t{0};
+
+        for (auto value_idx = size_t{0}; value_idx < partition_size; ++value_idx) {
+          auto frame_begin = size_t{0};
+          auto frame_end = partition_size;
+          if (frame.type == WindowFrameType::Rows) {
+            if (frame.preceding) frame_begin = value_idx - std::min(static_cast<size_t>(*frame.preceding), value_idx);
+            if (frame.following) {
+              const auto following_row_count = partition_size - value_idx - 1;
+              frame_end = value_idx + 1 + std::min(static_cast<size_t>(*frame.following), following_row_count);
+            }
+          } else {
+            if (value_idx == peer_group_end) {
+              peer_group_begin = value_idx;
+              peer_group_end = value_idx + 1;
+              while (peer_group_end < partition_size &&
+                     _are_peers(rows[partition_begin + value_idx], rows[partition_begin + peer_group_end])) {
+                ++peer_group_end;
+              }
+            }
+            if (frame.preceding) frame_begin = peer_group_begin;
+            if (frame.following) frame_end = peer_group_end;
+          }
+
+          write_result(rows[partition_begin + value_idx], frame_sums.sum(frame_begin, frame_end));
+        }
+      } break;
+    }
+
+    partition_begin = partition_end;
+  }
+}
+
+bool Window::_comes_before(const RowID& lhs, const RowID& rhs) const {
+  auto result = compare_rows(_partition_by_values, lhs, rhs);
+  if (result == 0) result = compare_rows(_order_by_values, lhs, rhs);
+  if (result != 0) return result < 0;
+  return lhs < rhs;
+}
+
+bool Window::_in_same_partition(const RowID& lhs, const RowID& rhs) const {
+  return compare_rows(_partition_by_values, lhs, rhs) == 0;
+}
+
+bool Window::_are_peers(const RowID& lhs, const RowID& rhs) const {
+  return compare_rows(_order_by_values, lhs, rhs) == 0;
+}
+
+}  // namespace opossum
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "expression/window_function_expression.hpp"
+#include "operators/sort/sort_utils.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Computes a window function (ROW_NUMBER(), RANK(), or SUM() over a window frame, see WindowFunctionExpression) for
+ * each input row and appends it as a new column. All other columns are forwarded, and rows keep their input order.
+ *
+ * The rows are processed in three phases:
+ *  1. Each input chunk is processed by a job of its own, which hash-partitions the chunk's rows by their PARTITION BY
+ *     values and sorts each hash partition's rows by the PARTITION BY and the ORDER BY values. As rows of the same SQL
+ *     partition share a hash partition, the hash partitions can be processed independently.
+ *  2. Each hash partition is processed by a job of its own, which merges the partition's sorted runs of all chunks
+ *     and computes the window function while scanning the sorted rows. ROW_NUMBER() and RANK() only need the
+ *     positions of the partition and peer boundaries. SUM() uses prefix sums for integer arguments, so that each
+ *     frame's sum is the difference of two prefix sums. For floating-point arguments, such a difference is not
+ *     exact, so that frames that do not start at the partition's beginning are summed with a segment tree instead.
+ *  3. The results are written into a ValueSegment per chunk (see Projection for how these are added to a table of
+ *     ReferenceSegments).
+ *
+ * Without PARTITION BY, there is only a single hash partition. Its runs are then merged pairwise in parallel (see
+ * merge_sorted_runs), but the window function is computed by a single job.
+ */
+class Window : public AbstractReadOnlyOperator {
+ public:
+  Window(const std::shared_ptr<const AbstractOperator>& in,
+         const std::shared_ptr<WindowFunctionExpression>& window_function_expression);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  std::shared_ptr<WindowFunctionExpression> window_function_expression() const;
+
+  enum class OperatorSteps : uint8_t { PartitionAndSortChunks, ComputeWindowFunction, WriteOutput };
+
+  // Upper bound for the number of hash partitions, i.e., for the number of jobs that compute the window function
+  static constexpr auto MAX_PARTITION_COUNT = size_t{64};
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+  void _on_cleanup() override;
+
+  // Merges the sorted runs of each hash partition (indexed by hash partition and chunk) and computes the window
+  // function. Returns the results as a ValueSegment per input chunk. ResultType is the window function's data type,
+  // ArgumentType the type of SUM()'s argument.
+  template <typename ResultType, typename ArgumentType>
+  std::vector<std::shared_ptr<AbstractSegment>> _compute_window_function(
+      std::vector<std::vector<RowIDPosList>>& runs, const BaseSortColumnValues* argument_values,
+      const bool result_is_nullable) const;
+
+  // Computes the window function for the sorted rows of a hash partition
+  template <typename ResultType, typename ArgumentType>
+  void _compute_hash_partition(const RowIDPosList& rows, const BaseSortColumnValues* argument_values,
+                               std::vector<pmr_vector<ResultType>>& results,
+                               std::vector<std::vector<uint8_t>>& result_nulls) const;
+
+  // Order in which the rows are sorted: By the PARTITION BY values, then by the ORDER BY values, then by the RowIDs
+  bool _comes_before(const RowID& lhs, const RowID& rhs) const;
+
+  // Whether two rows share their PARTITION BY values, or their ORDER BY values (i.e., whether they are peers)
+  bool _in_same_partition(const RowID& lhs, const RowID& rhs) const;
+  bool _are_peers(const RowID& lhs, const RowID& rhs) const;
+
+ private:
+  const std::shared_ptr<WindowFunctionExpression> _window_function_expression;
+
+  const std::vector<ColumnID> _partition_by_column_ids;
+  const std::vector<ColumnID> _order_by_column_ids;
+
+  // Materialized PARTITION BY and ORDER BY values, used to compare rows. Only set during execution.
+  std::vector<std::unique_ptr<BaseSortColumnValues>> _partition_by_values;
+  std::vector<std::unique_ptr<BaseSortColumnValues>> _order_by_values;
+};
+
+}  // namespace opossum
@@ -12,6 +12,7 @@
 #include "strategy/column_pruning_rule.hpp"
 #include "strategy/dependent_group_by_reduction_rule.hpp"
 #include "strategy/expression_reduction_rule.hpp"
+#include "strategy/group_join_rule.hpp"
 #include "strategy/in_expression_rewrite_rule.hpp"
 #include "strategy/index_scan_rule.hpp"
 #include "strategy/join_ordering_rule.hpp"
@@ -20,9 +21,12 @@
 #include "strategy/predicate_placement_rule.hpp"
 #include "strategy/predicate_reordering_rule.hpp"
 #include "strategy/predicate_split_up_rule.hpp"
+#include "strategy/runtime_join_filter_rule.hpp"
 #include "strategy/semi_join_reduction_rule.hpp"
 #include "strategy/stored_table_column_alignment_rule.hpp"
 #include "strategy/subquery_to_join_rule.hpp"
+#include "strategy/top_k_rule.hpp"
+#include "strategy/unique_index_scan_rule.hpp"
 #include "utils/timer.hpp"
 
 /**
@@ -154,6 +158,19 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
 
   optimizer->add_rule(std::make_unique<PredicateMergeRule>());
 
+  // Run after all rules that move or merge predicates, as it pins the key predicates to the StoredTableNode
+  optimizer->add_rule(std::make_unique<UniqueIndexScanRule>());
+
+  // Only marks AggregateNodes, but requires that no other rule places nodes between the aggregate and its join.
+  optimizer->add_rule(std::make_unique<GroupJoinRule>());
+
+  // Like the GroupJoinRule, this only marks LimitNodes and requires that no other rule separates them from their sort.
+  optimizer->add_rule(std::make_unique<TopKRule>());
+
+  // Runtime join filters are not exact semi joins and must not be moved or removed by other rules. Also, they are
+  // placed directly on top of StoredTableNodes, so all predicates have to be in their final position.
+  optimizer->add_rule(std::make_unique<RuntimeJoinFilterRule>());
+
   return optimizer;
 }
 
@@ -287,6 +304,7 @@ void Optimizer::validate_lqp(const std::shared_ptr<AbstractLQPNode>& root_node)
         case LQPNodeType::Root:
         case LQPNodeType::Sort:
         case LQPNodeType::Validate:
+        case LQPNodeType::Window:
           num_expected_inputs = 1;
           break;
 
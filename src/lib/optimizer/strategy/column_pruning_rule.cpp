@@ -18,6 +18,7 @@
 #include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
 #include "logical_query_plan/update_node.hpp"
+#include "logical_query_plan/window_node.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
 
@@ -40,9 +41,10 @@ void gather_expressions_not_computed_by_expression_evaluator(
     return;
   }
 
-  if (expression->type == ExpressionType::Aggregate || expression->type == ExpressionType::LQPColumn) {
-    // Aggregates and LQPColumns are not calculated by the ExpressionEvaluator and are thus required to be part of the
-    // input.
+  if (expression->type == ExpressionType::Aggregate || expression->type == ExpressionType::WindowFunction ||
+      expression->type == ExpressionType::LQPColumn) {
+    // Aggregates, window functions, and LQPColumns are not calculated by the ExpressionEvaluator and are thus required
+    // to be part of the input.
     required_expressions.emplace(expression);
     return;
   }
@@ -115,6 +117,16 @@ ExpressionUnorderedSet gather_locally_required_expressions(
       }
     } break;
 
+    // For window nodes, we need the argument of the window function as well as its PARTITION BY and ORDER BY
+    // expressions, which are all arguments of the WindowFunctionExpression
+    case LQPNodeType::Window: {
+      const auto& window_function_expression = *node->node_expressions.front();
+      DebugAssert(window_function_expression.type == ExpressionType::WindowFunction,
+                  "Expected WindowFunctionExpression");
+      locally_required_expressions.insert(window_function_expression.arguments.begin(),
+                                          window_function_expression.arguments.end());
+    } break;
+
     // For ProjectionNodes, collect all expressions that
     //   (1) were already computed and are re-used as arguments in this projection
     //   (2) cannot be computed (i.e., Aggregate and LQPColumn inputs)
@@ -163,16 +175,22 @@ ExpressionUnorderedSet gather_locally_required_expressions(
         } break;
 
         case SetOperationMode::Unique: {
-          // This probably needs all expressions, as all of them are used to establish uniqueness
-          Fail("SetOperationMode::Unique is not supported yet");
-        }
+          // All expressions are used to establish uniqueness
+          const auto& left_input_expressions = node->left_input()->output_expressions();
+          locally_required_expressions.insert(left_input_expressions.begin(), left_input_expressions.end());
+          const auto& right_input_expressions = node->right_input()->output_expressions();
+          locally_required_expressions.insert(right_input_expressions.begin(), right_input_expressions.end());
+        } break;
       }
     } break;
 
     case LQPNodeType::Intersect:
     case LQPNodeType::Except: {
-      Fail("Intersect and Except are not supported yet");
-      // Not sure what needs to happen here. That partially depends on how intersect and except are finally implemented.
+      // Rows of both inputs are compared by all of their columns
+      const auto& left_input_expressions = node->left_input()->output_expressions();
+      locally_required_expressions.insert(left_input_expressions.begin(), left_input_expressions.end());
+      const auto& right_input_expressions = node->right_input()->output_expressions();
+      locally_required_expressions.insert(right_input_expressions.begin(), right_input_expressions.end());
     } break;
 
     // No pruning of the input columns for these nodes as they need them all.
@@ -0,0 +1,105 @@
+#include "group_join_rule.hpp"
+
+#include <memory>
+
+#include "expression/aggregate_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void GroupJoinRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const {
+  visit_lqp(root, [&](const auto& node) {
+    if (node->type == LQPNodeType::Aggregate) {
+      const auto aggregate_node = std::static_pointer_cast<AggregateNode>(node);
+      if (is_group_join_candidate(*aggregate_node)) aggregate_node->is_group_join = true;
+    }
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+bool GroupJoinRule::is_group_join_candidate(const AggregateNode& aggregate_node) {
+  const auto& input_node = aggregate_node.left_input();
+  if (input_node->type != LQPNodeType::Join || input_node->output_count() > 1) return false;
+
+  // The GroupJoin reads the inputs of the join. For a join flagged as a multi-way join, its left input would be
+  // translated into a JoinLeapfrogTriejoin over only some of the relations (see JoinOrderingRule).
+  const auto& join_node = static_cast<const JoinNode&>(*input_node);
+  if (join_node.is_multiway_join) return false;
+
+  const auto join_mode = join_node.join_mode;
+  if (join_mode != JoinMode::Inner && join_mode != JoinMode::Left && join_mode != JoinMode::Right) return false;
+  if (join_node.join_predicates().size() != 1) return false;
+
+  const auto predicate_expression =
+      std::dynamic_pointer_cast<BinaryPredicateExpression>(join_node.join_predicates().front());
+  if (!predicate_expression || predicate_expression->predicate_condition != PredicateCondition::Equals) return false;
+
+  const auto aggregate_expressions_begin_idx = aggregate_node.aggregate_expressions_begin_idx;
+  if (aggregate_expressions_begin_idx == 0) return false;
+
+  // The group side is the input of the group by columns. For outer joins, it has to be the side whose rows are kept.
+  const auto& first_group_by_expression = aggregate_node.node_expressions.front();
+  auto group_side = LQPInputSide::Left;
+  if (!join_node.left_input()->find_column_id(*first_group_by_expression)) {
+    group_side = LQPInputSide::Right;
+  }
+  if ((join_mode == JoinMode::Left && group_side != LQPInputSide::Left) ||
+      (join_mode == JoinMode::Right && group_side != LQPInputSide::Right)) {
+    return false;
+  }
+
+  const auto& group_node = join_node.input(group_side);
+  const auto& probe_node = join_node.input(group_side == LQPInputSide::Left ? LQPInputSide::Right : LQPInputSide::Left);
+
+  const auto& group_key = expression_evaluable_on_lqp(predicate_expression->left_operand(), *group_node)
+                              ? predicate_expression->left_operand()
+                              : predicate_expression->right_operand();
+  const auto group_key_column_id = group_node->find_column_id(*group_key);
+  if (!group_key_column_id) return false;
+
+  // All group by expressions have to be columns of the group side, and the join key has to be one of them.
+  auto groups_by_key = false;
+  for (auto expression_idx = size_t{0}; expression_idx < aggregate_expressions_begin_idx; ++expression_idx) {
+    const auto& group_by_expression = *aggregate_node.node_expressions[expression_idx];
+    if (!group_node->find_column_id(group_by_expression)) return false;
+    if (group_by_expression == *group_key) groups_by_key = true;
+  }
+  if (!groups_by_key) return false;
+
+  // Each row of the group side has to form a group of its own. For outer joins, the GroupJoin would treat rows with a
+  // NULL key as separate groups, while the aggregation would merge them.
+  if (!group_node->has_matching_unique_constraint({group_key})) return false;
+  if (join_mode != JoinMode::Inner && group_node->is_column_nullable(*group_key_column_id)) return false;
+
+  for (auto expression_idx = aggregate_expressions_begin_idx; expression_idx < aggregate_node.node_expressions.size();
+       ++expression_idx) {
+    const auto& aggregate_expression =
+        static_cast<const AggregateExpression&>(*aggregate_node.node_expressions[expression_idx]);
+    if (AggregateExpression::is_count_star(aggregate_expression)) continue;
+
+    const auto& argument = *aggregate_expression.argument();
+    switch (aggregate_expression.aggregate_function) {
+      case AggregateFunction::Any:
+        if (!group_node->find_column_id(argument)) return false;
+        break;
+      case AggregateFunction::Count:
+      case AggregateFunction::Sum:
+      case AggregateFunction::Avg:
+      case AggregateFunction::Min:
+      case AggregateFunction::Max:
+        if (!probe_node->find_column_id(argument)) return false;
+        break;
+      default:
+        return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace opossum
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AggregateNode;
+
+/**
+ * Marks AggregateNodes that can be executed together with the JoinNode below them as a GroupJoin (see group_join.hpp).
+ * This is the case if the aggregate groups by the join column of one join input (the group side) and this column is
+ * unique in that input, so that the join does not duplicate the group side's rows:
+ *
+ *   [ Stored customer ] -----------------------> [ Left Join c_custkey = o_custkey ] -> [ Aggregate ]
+ *                                               /                                  GroupBy: [c_custkey]
+ *   [ Stored orders ] -> [ Predicate ... ] ----                                    Aggregates: [COUNT(o_orderkey)]
+ *
+ * Instead of materializing the join result and building a second hash table for the aggregation, the GroupJoin
+ * aggregates the orders directly into the hash table entries of the customers.
+ *
+ * The rule requires
+ *  - an Inner, Left, or Right join with a single equals predicate that has no other consumers than the aggregate,
+ *  - group by columns that are all columns of the group side (the left input for Left joins, the right input for
+ *    Right joins), including its join column,
+ *  - a unique constraint on the group side's join column (which may not be nullable for outer joins), and
+ *  - aggregates that are either ANY() on columns of the group side (see DependentGroupByReductionRule) or COUNT(*),
+ *    COUNT, SUM, AVG, MIN, or MAX on columns of the other input.
+ *
+ * The rule does not change the structure of the LQP but only sets AggregateNode::is_group_join. It runs after all
+ * rules that might move nodes between the aggregate and the join.
+ */
+class GroupJoinRule : public AbstractRule {
+ public:
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override;
+
+  static bool is_group_join_candidate(const AggregateNode& aggregate_node);
+};
+
+}  // namespace opossum
@@ -1,7 +1,16 @@
 #include "join_ordering_rule.hpp"
 
+#include <memory>
+#include <numeric>
+#include <queue>
+#include <vector>
+
 #include "cost_estimation/abstract_cost_estimator.hpp"
+#include "expression/binary_predicate_expression.hpp"
 #include "expression/expression_utils.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/projection_node.hpp"
 #include "optimizer/join_ordering/dp_ccp.hpp"
 #include "optimizer/join_ordering/greedy_operator_ordering.hpp"
@@ -11,6 +20,120 @@
 #include "statistics/table_statistics.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Returns whether all edges connect two vertices with equality predicates and form a connected graph with a cycle
+bool is_cyclic_equi_join_graph(const JoinGraph& join_graph) {
+  const auto vertex_count = join_graph.vertices.size();
+  auto components = std::vector<size_t>(vertex_count);
+  std::iota(components.begin(), components.end(), size_t{0});
+  const auto find_component = [&](auto vertex_idx) {
+    while (components[vertex_idx] != vertex_idx) vertex_idx = components[vertex_idx];
+    return vertex_idx;
+  };
+
+  auto is_cyclic = false;
+  auto component_count = vertex_count;
+  for (const auto& edge : join_graph.edges) {
+    const auto edge_vertex_count = edge.vertex_set.count();
+    if (edge_vertex_count == 1) continue;  // Local predicates
+    if (edge_vertex_count != 2) return false;
+
+    for (const auto& predicate : edge.predicates) {
+      const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate);
+      if (!binary_predicate || binary_predicate->predicate_condition != PredicateCondition::Equals ||
+          binary_predicate->left_operand()->data_type() != binary_predicate->right_operand()->data_type()) {
+        return false;
+      }
+    }
+
+    const auto first_component = find_component(edge.vertex_set.find_first());
+    const auto second_component = find_component(edge.vertex_set.find_next(edge.vertex_set.find_first()));
+    if (first_component == second_component) {
+      is_cyclic = true;
+    } else {
+      components[first_component] = second_component;
+      --component_count;
+    }
+  }
+
+  return is_cyclic && component_count == 1;
+}
+
+// Returns whether the largest intermediate result of the binary join plan is estimated to be larger than the vertices
+// and the result of the plan combined
+bool has_large_intermediates(const JoinGraph& join_graph, const std::shared_ptr<AbstractLQPNode>& binary_join_plan,
+                             const AbstractCardinalityEstimator& cardinality_estimator) {
+  auto vertex_and_result_cardinality = cardinality_estimator.estimate_cardinality(binary_join_plan);
+  for (const auto& vertex : join_graph.vertices) {
+    vertex_and_result_cardinality += cardinality_estimator.estimate_cardinality(vertex);
+  }
+
+  auto max_intermediate_cardinality = Cardinality{0};
+  visit_lqp(binary_join_plan, [&](const auto& node) {
+    if (std::find(join_graph.vertices.cbegin(), join_graph.vertices.cend(), node) != join_graph.vertices.cend()) {
+      return LQPVisitation::DoNotVisitInputs;
+    }
+    if (node != binary_join_plan) {
+      max_intermediate_cardinality =
+          std::max(max_intermediate_cardinality, cardinality_estimator.estimate_cardinality(node));
+    }
+    return LQPVisitation::VisitInputs;
+  });
+
+  return max_intermediate_cardinality > vertex_and_result_cardinality;
+}
+
+// Builds a left-deep tree of multi-way JoinNodes that adds the vertices in breadth-first order, so that each join has
+// at least one predicate. Local predicates are placed directly on top of their vertices.
+std::shared_ptr<AbstractLQPNode> build_multiway_join_plan(const JoinGraph& join_graph) {
+  const auto vertex_count = join_graph.vertices.size();
+
+  const auto vertex_with_local_predicates = [&](const size_t vertex_idx) {
+    auto node = join_graph.vertices[vertex_idx];
+    for (const auto& predicate : join_graph.find_local_predicates(vertex_idx)) {
+      node = PredicateNode::make(predicate, node);
+    }
+    return node;
+  };
+
+  auto joined_vertices = JoinGraphVertexSet(vertex_count);
+  joined_vertices.set(0);
+  auto plan = vertex_with_local_predicates(0);
+
+  auto vertex_queue = std::queue<size_t>{};
+  vertex_queue.push(0);
+  while (!vertex_queue.empty()) {
+    const auto vertex_idx = vertex_queue.front();
+    vertex_queue.pop();
+
+    for (const auto& edge : join_graph.edges) {
+      if (edge.vertex_set.count() != 2 || !edge.vertex_set.test(vertex_idx)) continue;
+
+      auto new_vertex = edge.vertex_set;
+      new_vertex.reset(vertex_idx);
+      const auto new_vertex_idx = new_vertex.find_first();
+      if (joined_vertices.test(new_vertex_idx)) continue;
+
+      const auto join_predicates = join_graph.find_join_predicates(joined_vertices, new_vertex);
+      const auto join_node =
+          JoinNode::make(JoinMode::Inner, join_predicates, plan, vertex_with_local_predicates(new_vertex_idx));
+      join_node->is_multiway_join = true;
+      plan = join_node;
+
+      joined_vertices.set(new_vertex_idx);
+      vertex_queue.push(new_vertex_idx);
+    }
+  }
+
+  DebugAssert(joined_vertices.all(), "Join graph should be connected");
+  return plan;
+}
+
+}  // namespace
+
 namespace opossum {
 
 void JoinOrderingRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const {
@@ -79,6 +202,16 @@ std::shared_ptr<AbstractLQPNode> JoinOrderingRule::_perform_join_ordering_recurs
     result_lqp = GreedyOperatorOrdering{}(*join_graph, caching_cost_estimator);  // NOLINT - doesn't like `{}()`
   }
 
+  /**
+   * For cyclic join graphs, binary join plans can have intermediate results that are far larger than the result (e.g.,
+   * when joining two edges of a triangle). If the chosen plan is estimated to produce such intermediate results, we
+   * let a multi-way join evaluate all joins at once.
+   */
+  if (join_graph->vertices.size() >= 3 && is_cyclic_equi_join_graph(*join_graph) &&
+      has_large_intermediates(*join_graph, result_lqp, *caching_cost_estimator->cardinality_estimator)) {
+    result_lqp = build_multiway_join_plan(*join_graph);
+  }
+
   for (const auto& vertex : join_graph->vertices) {
     _recurse_to_inputs(vertex);
   }
@@ -11,6 +11,12 @@ class AbstractCostEstimator;
 /**
  * A rule that brings join operations into a (supposedly) efficient order.
  * Currently only the order of inner joins is modified using a single underlying algorithm, DpCcp.
+ *
+ * If the join graph is cyclic (e.g., a triangle query) and the best binary join plan produces intermediate results
+ * that are estimated to be larger than its inputs and its result combined, the joins are replaced by a left-deep tree
+ * of JoinNodes flagged as multi-way joins (see JoinNode::is_multiway_join). The LQPTranslator translates such a tree
+ * into a single worst-case optimal JoinLeapfrogTriejoin, which does not materialize intermediate results. This is only
+ * done if all join predicates are equalities between two vertices.
  */
 class JoinOrderingRule : public AbstractRule {
  public:
@@ -0,0 +1,117 @@
+#include "runtime_join_filter_rule.hpp"
+
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "cost_estimation/abstract_cost_estimator.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "statistics/abstract_cardinality_estimator.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void RuntimeJoinFilterRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const {
+  Assert(root->type == LQPNodeType::Root, "RuntimeJoinFilterRule needs root to hold onto");
+
+  // As in the SemiJoinReductionRule, modifying the LQP inside visit_lqp might lead to endless recursions. Thus, we
+  // first collect the filters (with the node above which they are inserted) and insert them afterwards.
+  std::vector<std::tuple<std::shared_ptr<AbstractLQPNode>, LQPInputSide, std::shared_ptr<JoinNode>>> filters;
+
+  const auto estimator = cost_estimator->cardinality_estimator->new_instance();
+  estimator->guarantee_bottom_up_construction();
+
+  visit_lqp(root, [&](const auto& node) {
+    if (node->type != LQPNodeType::Join) return LQPVisitation::VisitInputs;
+    const auto join_node = std::static_pointer_cast<JoinNode>(node);
+
+    // For outer and anti joins, rows without a join partner are part of the result and must not be filtered. Joins
+    // flagged as multi-way joins are skipped, as the filter would split their tree into separate JoinLeapfrogTriejoins
+    // (see JoinOrderingRule).
+    if (join_node->is_runtime_join_filter || join_node->is_multiway_join ||
+        (join_node->join_mode != JoinMode::Inner && join_node->join_mode != JoinMode::Semi)) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    // Only the primary predicate is used by JoinHash to build its hash table, so we only look at that one.
+    const auto predicate_expression =
+        std::dynamic_pointer_cast<BinaryPredicateExpression>(join_node->join_predicates().front());
+    DebugAssert(predicate_expression, "Expected BinaryPredicateExpression");
+    if (predicate_expression->predicate_condition != PredicateCondition::Equals) return LQPVisitation::VisitInputs;
+
+    // Semi joins always build on the right input. For inner joins, JoinHash builds on the smaller input.
+    auto producer_side = LQPInputSide::Right;
+    if (join_node->join_mode == JoinMode::Inner &&
+        estimator->estimate_cardinality(join_node->left_input()) <
+            estimator->estimate_cardinality(join_node->right_input())) {
+      producer_side = LQPInputSide::Left;
+    }
+    const auto consumer_side = producer_side == LQPInputSide::Left ? LQPInputSide::Right : LQPInputSide::Left;
+    const auto& producer_node = join_node->input(producer_side);
+
+    // Walk down the consumer side to the StoredTableNode. The filter is inserted below the last passed node.
+    auto parent_node = std::static_pointer_cast<AbstractLQPNode>(join_node);
+    auto parent_input_side = consumer_side;
+    auto consumer_node = join_node->input(consumer_side);
+    while (consumer_node->output_count() == 1) {
+      if (consumer_node->type == LQPNodeType::Validate) {
+        // Continue below
+      } else if (consumer_node->type == LQPNodeType::Predicate &&
+                 std::static_pointer_cast<PredicateNode>(consumer_node)->scan_type == ScanType::TableScan) {
+        // Continue below
+      } else {
+        break;
+      }
+
+      parent_node = consumer_node;
+      parent_input_side = LQPInputSide::Left;
+      consumer_node = consumer_node->left_input();
+    }
+
+    if (consumer_node->type != LQPNodeType::StoredTable) return LQPVisitation::VisitInputs;
+    if (!expression_evaluable_on_lqp(predicate_expression->left_operand(), *consumer_node) &&
+        !expression_evaluable_on_lqp(predicate_expression->right_operand(), *consumer_node)) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    // If the producer reads from the consumer's StoredTableNode (e.g., in self joins), the filter would depend on
+    // itself.
+    auto producer_uses_consumer = false;
+    visit_lqp(producer_node, [&](const auto& producer_subplan_node) {
+      if (producer_subplan_node == consumer_node) {
+        producer_uses_consumer = true;
+        return LQPVisitation::DoNotVisitInputs;
+      }
+      return LQPVisitation::VisitInputs;
+    });
+    if (producer_uses_consumer) return LQPVisitation::VisitInputs;
+
+    const auto consumer_cardinality = estimator->estimate_cardinality(consumer_node);
+    const auto producer_cardinality = estimator->estimate_cardinality(producer_node);
+    if (consumer_cardinality == 0 || producer_cardinality > consumer_cardinality) return LQPVisitation::VisitInputs;
+
+    const auto filter_node = JoinNode::make(JoinMode::Semi, predicate_expression, consumer_node, producer_node);
+    filter_node->is_runtime_join_filter = true;
+    filter_node->comment = "Runtime Filter";
+    const auto filtered_cardinality = estimator->estimate_cardinality(filter_node);
+    filter_node->set_left_input(nullptr);
+
+    if (filtered_cardinality / consumer_cardinality > MINIMUM_SELECTIVITY) {
+      filter_node->set_right_input(nullptr);
+      return LQPVisitation::VisitInputs;
+    }
+
+    filters.emplace_back(parent_node, parent_input_side, filter_node);
+    return LQPVisitation::VisitInputs;
+  });
+
+  for (const auto& [parent_node, parent_input_side, filter_node] : filters) {
+    lqp_insert_node(parent_node, parent_input_side, filter_node, AllowRightInput::Yes);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+/**
+ * Adds runtime join filters (see RuntimeJoinFilter) for equi joins. The filter is created from the input of the join
+ * that becomes the build side of the JoinHash (the PRODUCER) and placed directly above the StoredTableNode of the
+ * other input (the CONSUMER), so that the rows of the consumer's table are reduced before the table scans on top of
+ * it are executed:
+ *
+ *   [ Stored a ] -> [ Predicate a.x > 5 ] --------------------------------> [ Join a.y = b.y ]
+ *                                                                          /
+ *   [ Stored b ] -> [ Predicate b.z = 'foo' ] ----------------------------
+ *
+ * becomes
+ *
+ *   [ Stored a ] -> [ Semi Join a.y = b.y (Runtime Filter) ] -> [ Predicate a.x > 5 ] -> [ Join a.y = b.y ]
+ *                  /                                                                    /
+ *   [ Stored b ] -> [ Predicate b.z = 'foo' ] -----------------------------------------
+ *
+ * The producer node is shared between the join and the filter, so that it is executed only once. In the LQP, the
+ * filter is represented as a Semi JoinNode with is_runtime_join_filter set. As the RuntimeJoinFilter is not exact, this
+ * rule has to run after all rules that might move or remove semi joins.
+ *
+ * Different from the SemiJoinReductionRule, the filter is only placed on top of StoredTableNodes, where it can prune
+ * chunks based on their statistics and where the bloom filter can be probed before any other operator looks at the
+ * data. The consumer side is only followed through PredicateNodes that are executed as TableScans and through
+ * ValidateNodes. Nodes with multiple outputs are not passed, as the filter would also affect the other consumers.
+ */
+class RuntimeJoinFilterRule : public AbstractRule {
+ public:
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override;
+
+  // Defines the minimum selectivity for a runtime join filter to be added. For a StoredTableNode with a cardinality
+  // `i`, the estimated output cardinality of the filter has to be lower than `i * MINIMUM_SELECTIVITY`. As the
+  // filter is cheaper than a semi join reduction, this is less restrictive than SemiJoinReductionRule's threshold.
+  constexpr static auto MINIMUM_SELECTIVITY = .75;
+};
+
+}  // namespace opossum
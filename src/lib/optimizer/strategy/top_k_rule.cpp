@@ -0,0 +1,25 @@
+#include "top_k_rule.hpp"
+
+#include <memory>
+
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+
+namespace opossum {
+
+void TopKRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const {
+  visit_lqp(root, [&](const auto& node) {
+    if (node->type == LQPNodeType::Limit) {
+      const auto limit_node = std::static_pointer_cast<LimitNode>(node);
+      if (is_top_k_candidate(*limit_node)) limit_node->is_top_k = true;
+    }
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+bool TopKRule::is_top_k_candidate(const LimitNode& limit_node) {
+  const auto& input_node = limit_node.left_input();
+  return input_node->type == LQPNodeType::Sort && input_node->output_count() == 1;
+}
+
+}  // namespace opossum
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class LimitNode;
+
+/**
+ * Marks LimitNodes that can be executed together with the SortNode below them as a TopK (see top_k.hpp):
+ *
+ *   [ Stored orders ] -> [ Sort o_totalprice DESC ] -> [ Limit 10 ]
+ *
+ * Instead of sorting the entire input and then discarding all but the first k rows, the TopK only keeps the best k
+ * rows of each chunk and merges them. The SortNode may not have other consumers than the LimitNode, as those would
+ * need the entire sorted input.
+ *
+ * The rule does not change the structure of the LQP but only sets LimitNode::is_top_k. It runs after all rules that
+ * might move nodes between the limit and the sort.
+ */
+class TopKRule : public AbstractRule {
+ public:
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override;
+
+  static bool is_top_k_candidate(const LimitNode& limit_node);
+};
+
+}  // namespace opossum
@@ -0,0 +1,103 @@
+#include "unique_index_scan_rule.hpp"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "expression/value_expression.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "storage/index/unique_key_index.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+using namespace opossum::expression_functional;  // NOLINT
+
+void UniqueIndexScanRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const {
+  Assert(root->type == LQPNodeType::Root, "UniqueIndexScanRule needs root to hold onto");
+
+  auto stored_table_nodes = std::vector<std::shared_ptr<StoredTableNode>>{};
+  visit_lqp(root, [&](const auto& node) {
+    if (node->type == LQPNodeType::StoredTable) {
+      stored_table_nodes.emplace_back(std::static_pointer_cast<StoredTableNode>(node));
+    }
+    return LQPVisitation::VisitInputs;
+  });
+
+  for (const auto& stored_table_node : stored_table_nodes) {
+    _apply_to_stored_table_node(stored_table_node);
+  }
+}
+
+void UniqueIndexScanRule::_apply_to_stored_table_node(const std::shared_ptr<StoredTableNode>& stored_table_node) {
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
+  if (table->unique_key_indexes().empty()) return;
+
+  // Walk up the chain of PredicateNodes on top of the StoredTableNode and collect the `column = value` predicates by
+  // the ColumnID of the column in the stored table. We stop at nodes that are shared with other parts of the LQP, as
+  // moving predicates below them would change their result for the other consumers.
+  struct KeyPredicate {
+    std::shared_ptr<PredicateNode> predicate_node;
+    std::shared_ptr<AbstractExpression> column_expression;
+    std::shared_ptr<AbstractExpression> value_expression;
+  };
+  auto key_predicates = std::map<ColumnID, KeyPredicate>{};
+
+  auto node = std::static_pointer_cast<AbstractLQPNode>(stored_table_node);
+  while (node->outputs().size() == 1) {
+    const auto output = node->outputs().front();
+    if (output->type != LQPNodeType::Predicate || output->left_input() != node) break;
+
+    const auto predicate_node = std::static_pointer_cast<PredicateNode>(output);
+    if (predicate_node->scan_type != ScanType::TableScan) break;
+    node = predicate_node;
+
+    const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate_node->predicate());
+    if (!binary_predicate || binary_predicate->predicate_condition != PredicateCondition::Equals) continue;
+
+    auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(binary_predicate->left_operand());
+    auto value_expression = std::dynamic_pointer_cast<ValueExpression>(binary_predicate->right_operand());
+    if (!column_expression || !value_expression) {
+      column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(binary_predicate->right_operand());
+      value_expression = std::dynamic_pointer_cast<ValueExpression>(binary_predicate->left_operand());
+    }
+    if (!column_expression || !value_expression || variant_is_null(value_expression->value)) continue;
+    if (column_expression->original_node.lock() != stored_table_node) continue;
+
+    key_predicates.emplace(column_expression->original_column_id,
+                           KeyPredicate{predicate_node, column_expression, value_expression});
+  }
+
+  // Use the first enforced key constraint whose columns are all compared with values
+  for (const auto& unique_key_index : table->unique_key_indexes()) {
+    const auto& column_ids = unique_key_index->column_ids();
+    const auto is_covered = std::all_of(column_ids.cbegin(), column_ids.cend(), [&](const auto column_id) {
+      return key_predicates.contains(column_id);
+    });
+    if (!is_covered) continue;
+
+    auto predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+    for (const auto column_id : column_ids) {
+      const auto& key_predicate = key_predicates.at(column_id);
+      predicates.emplace_back(equals_(key_predicate.column_expression, key_predicate.value_expression));
+      lqp_remove_node(key_predicate.predicate_node);
+    }
+
+    const auto unique_index_scan_node =
+        PredicateNode::make(inflate_logical_expressions(predicates, LogicalOperator::And));
+    unique_index_scan_node->scan_type = ScanType::UniqueIndexScan;
+    const auto output = stored_table_node->outputs().front();
+    lqp_insert_node(output, stored_table_node->get_input_side(output), unique_index_scan_node);
+    return;
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class StoredTableNode;
+
+/**
+ * This optimizer rule finds chains of PredicateNodes on top of StoredTableNodes that compare all columns of an enforced
+ * key constraint (see Table::enforce_key_constraint) with values, e.g., `a = 1 AND b = 'x'` for a PRIMARY KEY (a, b).
+ * As at most one row version per key can be visible, a lookup in the table's UniqueKeyIndex is always cheaper than
+ * scanning the table. The rule replaces these predicates with a single conjunctive PredicateNode of ScanType
+ * UniqueIndexScan directly on top of the StoredTableNode. The remaining predicates of the chain stay in place and
+ * operate on the (tiny) result of the lookup.
+ *
+ * Note:
+ * Only comparisons with values are supported, comparisons with placeholders or other columns are not. Predicates are
+ * only moved as long as they are not shared with other parts of the LQP.
+ */
+class UniqueIndexScanRule : public AbstractRule {
+ public:
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override;
+
+ protected:
+  static void _apply_to_stored_table_node(const std::shared_ptr<StoredTableNode>& stored_table_node);
+};
+
+}  // namespace opossum
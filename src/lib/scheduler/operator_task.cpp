@@ -46,6 +46,11 @@ std::shared_ptr<AbstractTask> OperatorTask::_add_tasks_from_operator(
     subtree_root->set_as_predecessor_of(task);
   }
 
+  for (const auto& additional_input : op->mutable_additional_inputs()) {
+    auto subtree_root = _add_tasks_from_operator(additional_input, tasks, task_by_op);
+    subtree_root->set_as_predecessor_of(task);
+  }
+
   // Add AFTER the inputs to establish a task order where predecessor get executed before successors
   tasks.push_back(task);
 
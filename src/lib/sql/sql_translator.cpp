@@ -298,8 +298,6 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_select_statement(cons
 
   if (select.setOperations) {
     for (const auto* const set_operator : *select.setOperations) {
-      // Currently, only the SQL translation of intersect and except is implemented.
-      AssertInput(set_operator->setType != hsql::kSetUnion, "Union Operations are currently not supported");
       _translate_set_operation(*set_operator);
 
       // In addition to local ORDER BY and LIMIT clauses, the result of the set operation(s) may have final clauses too.
@@ -1188,6 +1186,10 @@ void SQLTranslator::_translate_set_operation(const hsql::SetOperation& set_opera
       lqp = IntersectNode::make(set_operation_mode, left_input_lqp, right_input_lqp);
       break;
     case hsql::kSetUnion:
+      // The UnionNode forwards the output expressions of its inputs, so these have to match. This is the case if both
+      // sides select the same columns of the same table.
+      AssertInput(expressions_equal(left_output_expressions, right_output_expressions),
+                  "UNION is currently only supported for inputs with the same output expressions");
       lqp = UnionNode::make(set_operation_mode, left_input_lqp, right_input_lqp);
       break;
   }
@@ -1545,7 +1547,10 @@ std::shared_ptr<AbstractExpression> SQLTranslator::_translate_hsql_expr(
           aggregate_function = AggregateFunction::CountDistinct;
         }
 
-        AssertInput(expr.exprList && expr.exprList->size() == 1,
+        // The precision of APPROX_COUNT_DISTINCT can be passed as an optional second argument
+        const auto argument_count = expr.exprList->size();
+        AssertInput(argument_count == 1 || (aggregate_function == AggregateFunction::ApproxCountDistinct &&
+                                            argument_count == 2),
                     "Expected exactly one argument for this AggregateFunction");
 
         auto aggregate_expression = std::shared_ptr<AggregateExpression>{};
@@ -1559,6 +1564,22 @@ std::shared_ptr<AbstractExpression> SQLTranslator::_translate_hsql_expr(
             aggregate_expression = std::make_shared<AggregateExpression>(
                 aggregate_function, _translate_hsql_expr(*expr.exprList->front(), sql_identifier_resolver));
           } break;
+          case AggregateFunction::ApproxCountDistinct: {
+            auto sketch_precision = HyperLogLog::DEFAULT_PRECISION;
+            if (argument_count == 2) {
+              const auto& precision_expr = *expr.exprList->back();
+              AssertInput(precision_expr.type == hsql::kExprLiteralInt &&
+                              precision_expr.ival >= HyperLogLog::MIN_PRECISION &&
+                              precision_expr.ival <= HyperLogLog::MAX_PRECISION,
+                          "Expected the precision of APPROX_COUNT_DISTINCT to be an integer between " +
+                              std::to_string(HyperLogLog::MIN_PRECISION) + " and " +
+                              std::to_string(HyperLogLog::MAX_PRECISION));
+              sketch_precision = static_cast<uint8_t>(precision_expr.ival);
+            }
+            aggregate_expression = std::make_shared<AggregateExpression>(
+                aggregate_function, _translate_hsql_expr(*expr.exprList->front(), sql_identifier_resolver),
+                sketch_precision);
+          } break;
           case AggregateFunction::Any:
             Fail("ANY() is an internal aggregation function.");
           case AggregateFunction::Count:
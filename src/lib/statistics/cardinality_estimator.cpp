@@ -10,6 +10,7 @@
 #include "expression/logical_expression.hpp"
 #include "expression/lqp_subquery_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "expression/window_function_expression.hpp"
 #include "hyrise.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/aggregate_node.hpp"
@@ -24,6 +25,7 @@
 #include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
 #include "logical_query_plan/validate_node.hpp"
+#include "logical_query_plan/window_node.hpp"
 #include "lossy_cast.hpp"
 #include "operators/operator_join_predicate.hpp"
 #include "operators/operator_scan_predicate.hpp"
@@ -198,6 +200,11 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_statistics(
           estimate_union_node(*union_node, left_input_table_statistics, right_input_table_statistics);
     } break;
 
+    case LQPNodeType::Window: {
+      const auto window_node = std::dynamic_pointer_cast<const WindowNode>(lqp);
+      output_table_statistics = estimate_window_node(*window_node, left_input_table_statistics);
+    } break;
+
     // Currently there is no actual estimation being done and we always apply the worst case
     case LQPNodeType::Intersect:
     case LQPNodeType::Except: {
@@ -541,6 +548,19 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_limit_node(
   }
 }
 
+std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_window_node(
+    const WindowNode& window_node, const std::shared_ptr<TableStatistics>& input_table_statistics) {
+  // WindowNodes forward all input rows and columns. As for the aggregate columns of an AggregateNode, dummy statistics
+  // are created for the window function's column.
+  auto column_statistics = input_table_statistics->column_statistics;
+  resolve_data_type(window_node.window_function_expression()->data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    column_statistics.emplace_back(std::make_shared<AttributeStatistics<ColumnDataType>>());
+  });
+
+  return std::make_shared<TableStatistics>(std::move(column_statistics), input_table_statistics->row_count);
+}
+
 std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_operator_scan_predicate(
     const std::shared_ptr<TableStatistics>& input_table_statistics, const OperatorScanPredicate& predicate) {
   /**
@@ -229,6 +229,10 @@ void Chunk::set_individually_sorted_by(const std::vector<SortColumnDefinition>&
   // As such, there should be no existing sorting and the new sorting should contain at least one column.
   // Feel free to remove this assertion if necessary.
   Assert(!sorted_by.empty() && _sorted_by.empty(), "Sorting information cannot be empty or reset.");
+  // Scans on sorted segments expect NULLs to come first (see sorted_segment_search.hpp)
+  Assert(std::all_of(sorted_by.cbegin(), sorted_by.cend(),
+                     [](const auto& sorted_by_column) { return is_nulls_first_sort_mode(sorted_by_column.sort_mode); }),
+         "Chunks can only be sorted with NULLs first.");
 
   if constexpr (HYRISE_DEBUG) {
     for (const auto& sorted_by_column : sorted_by) {
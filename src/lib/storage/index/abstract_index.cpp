@@ -1,6 +1,7 @@
 #include "abstract_index.hpp"
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
@@ -56,6 +57,22 @@ AbstractIndex::Iterator AbstractIndex::upper_bound(const std::vector<AllTypeVari
   return _upper_bound(values);
 }
 
+void AbstractIndex::equal_ranges(const std::vector<AllTypeVariant>& values,
+                                 std::vector<std::pair<Iterator, Iterator>>& ranges) const {
+  ranges.resize(values.size());
+  _equal_ranges(values, ranges);
+}
+
+void AbstractIndex::_equal_ranges(const std::vector<AllTypeVariant>& values,
+                                  std::vector<std::pair<Iterator, Iterator>>& ranges) const {
+  for (auto value_idx = size_t{0}; value_idx < values.size(); ++value_idx) {
+    // the caller is responsible for not passing a NULL value
+    DebugAssert(!variant_is_null(values[value_idx]), "Null was passed to equal_ranges().");
+
+    ranges[value_idx] = {_lower_bound({values[value_idx]}), _upper_bound({values[value_idx]})};
+  }
+}
+
 AbstractIndex::Iterator AbstractIndex::cbegin() const { return _cbegin(); }
 
 AbstractIndex::Iterator AbstractIndex::cend() const { return _cend(); }
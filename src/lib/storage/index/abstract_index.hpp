@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
@@ -102,6 +103,19 @@ class AbstractIndex : private Noncopyable {
    */
   Iterator upper_bound(const std::vector<AllTypeVariant>& values) const;
 
+  /**
+   * Batched equality lookup on the first indexed segment: For each of the given values, the range from lower_bound() to
+   * upper_bound() is written to the same position in `ranges`, which is resized accordingly. The values must not be
+   * NULL.
+   *
+   * Calls _equal_ranges() of the most derived class. Indexes whose lookups are dominated by cache misses (e.g., the
+   * AdaptiveRadixTreeIndex) interleave the lookups of a batch so that the misses of one lookup overlap with the work on
+   * the others. Callers should therefore pass several values at once (e.g., a few dozen) instead of calling
+   * lower_bound() and upper_bound() for each value.
+   */
+  void equal_ranges(const std::vector<AllTypeVariant>& values,
+                    std::vector<std::pair<Iterator, Iterator>>& ranges) const;
+
   /**
    * Returns an Iterator to the position of the smallest indexed non-NULL element. This is useful for range queries
    * with no specified begin.
@@ -154,6 +168,9 @@ class AbstractIndex : private Noncopyable {
    */
   virtual Iterator _lower_bound(const std::vector<AllTypeVariant>&) const = 0;
   virtual Iterator _upper_bound(const std::vector<AllTypeVariant>&) const = 0;
+  // Looks up each value with _lower_bound() and _upper_bound(), to be overridden by indexes that can do better
+  virtual void _equal_ranges(const std::vector<AllTypeVariant>& values,
+                             std::vector<std::pair<Iterator, Iterator>>& ranges) const;
   virtual Iterator _cbegin() const = 0;
   virtual Iterator _cend() const = 0;
   virtual std::vector<std::shared_ptr<const AbstractSegment>> _get_indexed_segments() const = 0;
@@ -84,6 +84,50 @@ AbstractIndex::Iterator AdaptiveRadixTreeIndex::_upper_bound(const std::vector<A
   }
 }
 
+void AdaptiveRadixTreeIndex::_equal_ranges(const std::vector<AllTypeVariant>& values,
+                                           std::vector<std::pair<Iterator, Iterator>>& ranges) const {
+  struct Lookup {
+    size_t value_idx;
+    ValueID value_id;
+    const ARTNode* node;
+  };
+
+  // Values that are not part of the dictionary have no matches and are not looked up in the tree.
+  auto lookups = std::vector<Lookup>{};
+  lookups.reserve(values.size());
+  for (auto value_idx = size_t{0}; value_idx < values.size(); ++value_idx) {
+    // the caller is responsible for not passing a NULL value
+    DebugAssert(!variant_is_null(values[value_idx]), "Null was passed to equal_ranges().");
+
+    ranges[value_idx] = {_cend(), _cend()};
+    if (!_root) continue;  // _root is nullptr if the index contains NULL positions only
+
+    const auto value_id = _indexed_segment->lower_bound(values[value_idx]);
+    if (value_id == INVALID_VALUE_ID || _indexed_segment->upper_bound(values[value_idx]) == value_id) continue;
+
+    lookups.emplace_back(Lookup{value_idx, value_id, _root.get()});
+  }
+
+  // On level n, the n-th byte of the ValueID is compared (see BinaryComparable)
+  for (auto depth = size_t{0}; !lookups.empty(); ++depth) {
+    auto active_lookup_count = size_t{0};
+    for (const auto& lookup : lookups) {
+      if (lookup.node->is_leaf()) {
+        ranges[lookup.value_idx] = {lookup.node->begin(), lookup.node->end()};
+        continue;
+      }
+
+      const auto partial_key = static_cast<uint8_t>(lookup.value_id >> (8u * (sizeof(ValueID) - 1 - depth)));
+      const auto* const child = lookup.node->child(partial_key);
+      if (!child) continue;
+
+      __builtin_prefetch(child);
+      lookups[active_lookup_count++] = Lookup{lookup.value_idx, lookup.value_id, child};
+    }
+    lookups.resize(active_lookup_count);
+  }
+}
+
 AbstractIndex::Iterator AdaptiveRadixTreeIndex::_cbegin() const { return _chunk_offsets.cbegin(); }
 
 AbstractIndex::Iterator AdaptiveRadixTreeIndex::_cend() const { return _chunk_offsets.cend(); }
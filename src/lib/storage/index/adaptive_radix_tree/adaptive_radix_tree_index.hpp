@@ -72,6 +72,14 @@ class AdaptiveRadixTreeIndex : public AbstractIndex {
 
   Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const final;
 
+  /**
+   * Interleaved lookups: After resolving the ValueIDs of all values, the lookups descend the tree in lockstep, one
+   * level per round. The child node that a lookup visits in the next round is prefetched, so that its cache miss
+   * overlaps with the work on the other lookups of the batch (group prefetching).
+   */
+  void _equal_ranges(const std::vector<AllTypeVariant>& values,
+                     std::vector<std::pair<Iterator, Iterator>>& ranges) const final;
+
   Iterator _cbegin() const final;
 
   Iterator _cend() const final;
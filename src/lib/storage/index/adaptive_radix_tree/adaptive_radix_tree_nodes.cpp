@@ -92,6 +92,13 @@ AbstractIndex::Iterator ARTNode4::end() const {
   Fail("Empty _children array in ARTNode4 should never happen");
 }
 
+const ARTNode* ARTNode4::child(uint8_t partial_key) const {
+  for (uint8_t partial_key_id = 0; partial_key_id < 4; ++partial_key_id) {
+    if (_partial_keys[partial_key_id] == partial_key) return _children[partial_key_id].get();
+  }
+  return nullptr;
+}
+
 /**
  *
  * ARTNode16 has two arrays of length 16, very similar to ARTNode4:
@@ -193,6 +200,12 @@ AbstractIndex::Iterator ARTNode16::end() const {
   }
 }
 
+const ARTNode* ARTNode16::child(uint8_t partial_key) const {
+  const auto partial_key_iter = std::find(_partial_keys.begin(), _partial_keys.end(), partial_key);
+  if (partial_key_iter == _partial_keys.end()) return nullptr;
+  return _children[std::distance(_partial_keys.begin(), partial_key_iter)].get();
+}
+
 /**
  *
  * ARTNode48 has two arrays:
@@ -291,6 +304,12 @@ AbstractIndex::Iterator ARTNode48::end() const {
   Fail("Empty _index_to_child array in ARTNode48 should never happen");
 }
 
+const ARTNode* ARTNode48::child(uint8_t partial_key) const {
+  const auto child_index = _index_to_child[partial_key];
+  if (child_index == INVALID_INDEX) return nullptr;
+  return _children[child_index].get();
+}
+
 /**
  *
  * ARTNode256 has only one array: _children; which stores pointers to the children and can be directly addressed.
@@ -376,6 +395,8 @@ AbstractIndex::Iterator ARTNode256::end() const {
   Fail("Empty _children array in ARTNode256 should never happen");
 }
 
+const ARTNode* ARTNode256::child(uint8_t partial_key) const { return _children[partial_key].get(); }
+
 Leaf::Leaf(AbstractIndex::Iterator& lower, AbstractIndex::Iterator& upper) : _begin(lower), _end(upper) {}
 
 AbstractIndex::Iterator Leaf::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable&, size_t) const {
@@ -390,4 +411,8 @@ AbstractIndex::Iterator Leaf::begin() const { return _begin; }
 
 AbstractIndex::Iterator Leaf::end() const { return _end; }
 
+const ARTNode* Leaf::child(uint8_t /*partial_key*/) const { return nullptr; }
+
+bool Leaf::is_leaf() const { return true; }
+
 }  // namespace opossum
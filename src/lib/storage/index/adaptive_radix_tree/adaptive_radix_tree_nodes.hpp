@@ -34,6 +34,14 @@ class ARTNode : private Noncopyable {
   virtual Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const = 0;
   virtual Iterator begin() const = 0;
   virtual Iterator end() const = 0;
+
+  /**
+   * Returns the child for the given partial key, or nullptr if there is none. Unlike lower_bound(), this does not
+   * resolve keys that are not contained in the tree. It allows the batched lookups of AdaptiveRadixTreeIndex to
+   * descend the tree one level at a time for multiple keys.
+   */
+  virtual const ARTNode* child(uint8_t partial_key) const = 0;
+  virtual bool is_leaf() const { return false; }
 };
 
 /**
@@ -56,6 +64,7 @@ class ARTNode4 final : public ARTNode {
   Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
   Iterator begin() const override;
   Iterator end() const override;
+  const ARTNode* child(uint8_t partial_key) const override;
 
  private:
   /**
@@ -89,6 +98,7 @@ class ARTNode16 final : public ARTNode {
   Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
   Iterator begin() const override;
   Iterator end() const override;
+  const ARTNode* child(uint8_t partial_key) const override;
 
  private:
   Iterator _delegate_to_child(
@@ -120,6 +130,7 @@ class ARTNode48 final : public ARTNode {
   Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
   Iterator begin() const override;
   Iterator end() const override;
+  const ARTNode* child(uint8_t partial_key) const override;
 
  private:
   Iterator _delegate_to_child(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
@@ -142,6 +153,7 @@ class ARTNode256 final : public ARTNode {
   Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
   Iterator begin() const override;
   Iterator end() const override;
+  const ARTNode* child(uint8_t partial_key) const override;
 
  private:
   Iterator _delegate_to_child(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
@@ -186,6 +198,8 @@ class Leaf final : public ARTNode {
   Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable&, size_t) const override;
   Iterator begin() const override;
   Iterator end() const override;
+  const ARTNode* child(uint8_t partial_key) const override;
+  bool is_leaf() const override;
 
  private:
   Iterator _begin;
@@ -1,5 +1,9 @@
 #include "b_tree_index.hpp"
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #include "resolve_type.hpp"
 #include "storage/index/segment_index_type.hpp"
 
@@ -40,6 +44,15 @@ BTreeIndex::Iterator BTreeIndex::_upper_bound(const std::vector<AllTypeVariant>&
   return _impl->upper_bound(values);
 }
 
+void BTreeIndex::_equal_ranges(const std::vector<AllTypeVariant>& values,
+                               std::vector<std::pair<Iterator, Iterator>>& ranges) const {
+  // the caller is responsible for not passing NULL values
+  DebugAssert(std::none_of(values.begin(), values.end(), [](const auto& value) { return variant_is_null(value); }),
+              "Null was passed to equal_ranges().");
+
+  _impl->equal_ranges(values, ranges);
+}
+
 BTreeIndex::Iterator BTreeIndex::_cbegin() const { return _impl->cbegin(); }
 
 BTreeIndex::Iterator BTreeIndex::_cend() const { return _impl->cend(); }
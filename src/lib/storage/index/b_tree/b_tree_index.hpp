@@ -30,6 +30,8 @@ class BTreeIndex : public AbstractIndex {
  protected:
   Iterator _lower_bound(const std::vector<AllTypeVariant>&) const override;
   Iterator _upper_bound(const std::vector<AllTypeVariant>&) const override;
+  void _equal_ranges(const std::vector<AllTypeVariant>& values,
+                     std::vector<std::pair<Iterator, Iterator>>& ranges) const override;
   Iterator _cbegin() const override;
   Iterator _cend() const override;
   std::vector<std::shared_ptr<const AbstractSegment>> _get_indexed_segments() const override;
@@ -1,5 +1,10 @@
 #include "b_tree_index_impl.hpp"
 
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
 #include "storage/index/abstract_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "types.hpp"
@@ -25,6 +30,36 @@ BaseBTreeIndexImpl::Iterator BTreeIndexImpl<DataType>::upper_bound(const std::ve
   return upper_bound(boost::get<DataType>(values[0]));
 }
 
+template <typename DataType>
+void BTreeIndexImpl<DataType>::equal_ranges(const std::vector<AllTypeVariant>& values,
+                                            std::vector<std::pair<Iterator, Iterator>>& ranges) const {
+  auto lookup_order = std::vector<size_t>(values.size());
+  std::iota(lookup_order.begin(), lookup_order.end(), size_t{0});
+  std::sort(lookup_order.begin(), lookup_order.end(), [&](const auto left, const auto right) {
+    return boost::get<DataType>(values[left]) < boost::get<DataType>(values[right]);
+  });
+
+  const DataType* previous_value = nullptr;
+  auto previous_range = std::pair<Iterator, Iterator>{_chunk_offsets.end(), _chunk_offsets.end()};
+  for (const auto value_idx : lookup_order) {
+    const auto& value = boost::get<DataType>(values[value_idx]);
+    if (!previous_value || *previous_value != value) {
+      const auto tree_iter = _btree.lower_bound(value);
+      const auto range_begin =
+          tree_iter == _btree.end() ? _chunk_offsets.end() : _chunk_offsets.begin() + tree_iter->second;
+      auto range_end = range_begin;
+      if (tree_iter != _btree.end() && tree_iter->first == value) {
+        const auto next_tree_iter = std::next(tree_iter);
+        range_end =
+            next_tree_iter == _btree.end() ? _chunk_offsets.end() : _chunk_offsets.begin() + next_tree_iter->second;
+      }
+      previous_range = {range_begin, range_end};
+      previous_value = &value;
+    }
+    ranges[value_idx] = previous_range;
+  }
+}
+
 template <typename DataType>
 BaseBTreeIndexImpl::Iterator BTreeIndexImpl<DataType>::cbegin() const {
   return _chunk_offsets.begin();
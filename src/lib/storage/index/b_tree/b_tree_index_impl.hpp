@@ -9,6 +9,9 @@
 #include <btree_map.h>
 #endif
 
+#include <utility>
+#include <vector>
+
 #include "all_type_variant.hpp"
 #include "storage/abstract_segment.hpp"
 #include "types.hpp"
@@ -27,6 +30,8 @@ class BaseBTreeIndexImpl : public Noncopyable {
   virtual size_t memory_consumption() const = 0;
   virtual Iterator lower_bound(const std::vector<AllTypeVariant>&) const = 0;
   virtual Iterator upper_bound(const std::vector<AllTypeVariant>&) const = 0;
+  virtual void equal_ranges(const std::vector<AllTypeVariant>& values,
+                            std::vector<std::pair<Iterator, Iterator>>& ranges) const = 0;
   virtual Iterator cbegin() const = 0;
   virtual Iterator cend() const = 0;
 
@@ -53,6 +58,14 @@ class BTreeIndexImpl : public BaseBTreeIndexImpl {
 
   Iterator lower_bound(const std::vector<AllTypeVariant>&) const override;
   Iterator upper_bound(const std::vector<AllTypeVariant>&) const override;
+
+  /**
+   * The lookups of a batch are performed in the order of their values, so that consecutive lookups share the upper
+   * levels of the tree in the cache, and each distinct value is looked up only once. Both ends of a range are found
+   * with a single descent, as the upper bound of a contained value is the position of the next value in the tree.
+   */
+  void equal_ranges(const std::vector<AllTypeVariant>& values,
+                    std::vector<std::pair<Iterator, Iterator>>& ranges) const override;
   Iterator cbegin() const override;
   Iterator cend() const override;
 
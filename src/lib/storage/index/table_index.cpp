@@ -0,0 +1,146 @@
+#include "table_index.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/size_estimation_utils.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The index covers the immutable chunks at the beginning of the table, as rows could still be appended to the others.
+ChunkID immutable_chunk_count(const Table& table) {
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (chunk && chunk->is_mutable()) return chunk_id;
+  }
+  return chunk_count;
+}
+
+}  // namespace
+
+namespace opossum {
+
+BaseTableIndex::BaseTableIndex(const ColumnID column_id, const ChunkID indexed_chunk_count)
+    : _column_id(column_id), _indexed_chunk_count(indexed_chunk_count) {}
+
+ColumnID BaseTableIndex::column_id() const { return _column_id; }
+
+ChunkID BaseTableIndex::indexed_chunk_count() const { return _indexed_chunk_count; }
+
+BaseTableIndex::Iterator BaseTableIndex::cbegin() const { return _row_ids.cbegin(); }
+
+BaseTableIndex::Iterator BaseTableIndex::cend() const { return _row_ids.cend(); }
+
+BaseTableIndex::Iterator BaseTableIndex::null_cbegin() const { return _null_row_ids.cbegin(); }
+
+BaseTableIndex::Iterator BaseTableIndex::null_cend() const { return _null_row_ids.cend(); }
+
+template <typename T>
+TableIndex<T>::TableIndex(const Table& table, const ColumnID column_id)
+    : BaseTableIndex(column_id, immutable_chunk_count(table)) {
+  Assert(table.type() == TableType::Data, "TableIndex can only be created on data tables");
+
+  auto values = std::vector<std::pair<T, RowID>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < _indexed_chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    values.reserve(values.size() + chunk->size());
+    segment_iterate<T>(*chunk->get_segment(column_id), [&](const auto& position) {
+      const auto row_id = RowID{chunk_id, position.chunk_offset()};
+      if (position.is_null()) {
+        _null_row_ids.emplace_back(row_id);
+      } else {
+        values.emplace_back(position.value(), row_id);
+      }
+    });
+  }
+
+  // Sorting by value and RowID keeps the rows of each value in the order of the table
+  std::sort(values.begin(), values.end());
+
+  _row_ids.reserve(values.size());
+  for (auto& [value, row_id] : values) {
+    if (_values.empty() || _values.back() != value) {
+      _values.emplace_back(std::move(value));
+      _value_offsets.emplace_back(_row_ids.size());
+    }
+    _row_ids.emplace_back(row_id);
+  }
+  _value_offsets.emplace_back(_row_ids.size());
+
+  _values.shrink_to_fit();
+  _value_offsets.shrink_to_fit();
+  _null_row_ids.shrink_to_fit();
+}
+
+template <typename T>
+BaseTableIndex::Iterator TableIndex<T>::lower_bound(const T& value) const {
+  const auto value_iter = std::lower_bound(_values.cbegin(), _values.cend(), value);
+  return _row_ids.cbegin() + _value_offsets[std::distance(_values.cbegin(), value_iter)];
+}
+
+template <typename T>
+BaseTableIndex::Iterator TableIndex<T>::upper_bound(const T& value) const {
+  const auto value_iter = std::upper_bound(_values.cbegin(), _values.cend(), value);
+  return _row_ids.cbegin() + _value_offsets[std::distance(_values.cbegin(), value_iter)];
+}
+
+template <typename T>
+void TableIndex<T>::equal_ranges(const std::vector<T>& values,
+                                 std::vector<std::pair<Iterator, Iterator>>& ranges) const {
+  const auto lookup_count = values.size();
+  ranges.assign(lookup_count, {_row_ids.cend(), _row_ids.cend()});
+  if (_values.empty()) return;
+
+  // Branch-free binary search (lower bound) for all values at once. As all searches start on the full range, they
+  // share the length of their remaining range and can be advanced in lockstep.
+  auto search_positions = std::vector<const T*>(lookup_count, _values.data());
+  auto remaining_length = _values.size();
+  while (remaining_length > 1) {
+    const auto half = remaining_length / 2;
+    remaining_length -= half;
+    for (auto lookup_idx = size_t{0}; lookup_idx < lookup_count; ++lookup_idx) {
+      auto& search_position = search_positions[lookup_idx];
+      search_position += search_position[half] < values[lookup_idx] ? half : 0;
+      __builtin_prefetch(search_position + remaining_length / 2);
+    }
+  }
+
+  for (auto lookup_idx = size_t{0}; lookup_idx < lookup_count; ++lookup_idx) {
+    const auto* const search_position = search_positions[lookup_idx];
+    const auto value_id = std::distance(_values.data(), search_position) + (*search_position < values[lookup_idx]);
+    if (value_id == static_cast<std::ptrdiff_t>(_values.size()) || _values[value_id] != values[lookup_idx]) continue;
+
+    const auto row_ids_begin = _row_ids.cbegin();
+    ranges[lookup_idx] = {row_ids_begin + _value_offsets[value_id], row_ids_begin + _value_offsets[value_id + 1]};
+  }
+}
+
+template <typename T>
+size_t TableIndex<T>::memory_usage() const {
+  auto bytes = sizeof(*this);
+  bytes += _values.capacity() * sizeof(T);
+  bytes += _value_offsets.capacity() * sizeof(size_t);
+  bytes += (_row_ids.capacity() + _null_row_ids.capacity()) * sizeof(RowID);
+
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    for (const auto& value : _values) {
+      bytes += string_heap_size(value);
+    }
+  }
+
+  return bytes;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(TableIndex);
+
+}  // namespace opossum
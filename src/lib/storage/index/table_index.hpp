@@ -0,0 +1,82 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Single-column index over all chunks of a table (see Table::create_table_index()). Each chunk index (see
+ * AbstractIndex) covers a single chunk, so that looking up a value in a table requires probing the indexes of all
+ * chunks. A lookup in the TableIndex returns the RowIDs of the matching rows of all indexed chunks at once. This makes
+ * it the index of choice for the JoinIndex, which looks up every value of its probe side.
+ *
+ * The index covers the chunks that were immutable when it was created, i.e., the chunks [0, indexed_chunk_count()).
+ * Rows of chunks that are appended later are not indexed.
+ *
+ * The distinct values are stored in a sorted vector and the RowIDs are grouped by their values in the same order, so
+ * that the rows of a value (or of a range of values) are stored contiguously. The RowIDs of NULL values are stored
+ * separately.
+ */
+class BaseTableIndex : private Noncopyable {
+ public:
+  using Iterator = std::vector<RowID>::const_iterator;
+
+  BaseTableIndex(const ColumnID column_id, const ChunkID indexed_chunk_count);
+  virtual ~BaseTableIndex() = default;
+
+  ColumnID column_id() const;
+  ChunkID indexed_chunk_count() const;
+
+  // Range of the rows with non-NULL values, ordered by their values
+  Iterator cbegin() const;
+  Iterator cend() const;
+
+  // Range of the rows with NULL values
+  Iterator null_cbegin() const;
+  Iterator null_cend() const;
+
+  virtual size_t memory_usage() const = 0;
+
+ protected:
+  const ColumnID _column_id;
+  const ChunkID _indexed_chunk_count;
+
+  std::vector<RowID> _row_ids;
+  std::vector<RowID> _null_row_ids;
+};
+
+template <typename T>
+class TableIndex : public BaseTableIndex {
+ public:
+  TableIndex(const Table& table, const ColumnID column_id);
+
+  // Return the position of the first row whose value is not less than (lower_bound) or greater than (upper_bound) the
+  // given value.
+  Iterator lower_bound(const T& value) const;
+  Iterator upper_bound(const T& value) const;
+
+  /**
+   * Batched equality lookup: For each of the given values, the range of the rows with that value is written to the
+   * same position in `ranges`, which is resized accordingly.
+   *
+   * The binary searches of all values are interleaved: They are advanced in lockstep, one step per round, and each
+   * search prefetches the value it compares with in the next round. The cache misses of one search thus overlap with
+   * the comparisons of the others (group prefetching). Callers should pass a few dozen values at once.
+   */
+  void equal_ranges(const std::vector<T>& values, std::vector<std::pair<Iterator, Iterator>>& ranges) const;
+
+  size_t memory_usage() const override;
+
+ protected:
+  // Distinct values in ascending order. The RowIDs of _values[i] are stored in _row_ids from _value_offsets[i] to
+  // _value_offsets[i + 1].
+  std::vector<T> _values;
+  std::vector<size_t> _value_offsets;
+};
+
+}  // namespace opossum
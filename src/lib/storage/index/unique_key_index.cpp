@@ -0,0 +1,222 @@
+#include "unique_key_index.hpp"
+
+#include <algorithm>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "resolve_type.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Returns true if the row is visible or might become visible for transactions other than the given one. See
+// UniqueKeyIndex::try_insert() for details. The MVCC fields are read in the reverse order of how Insert writes them on
+// commit (begin CID, then TID) and rollback (end CID, begin CID, then TID), so that we never mistake a row that is
+// being committed for one that was deleted by its own transaction or a row that is being rolled back for a committed
+// one.
+bool might_be_visible(const MvccData& mvcc_data, const ChunkOffset chunk_offset, const TransactionID transaction_id) {
+  const auto row_tid = mvcc_data.get_tid(chunk_offset);
+  const auto begin_cid = mvcc_data.get_begin_cid(chunk_offset);
+  const auto end_cid = mvcc_data.get_end_cid(chunk_offset);
+
+  // The row was deleted by a committed transaction or its insert was rolled back (end CID 0)
+  if (end_cid != MvccData::MAX_COMMIT_ID) return false;
+
+  // An uncommitted row without a TID was inserted and deleted again by the same, still running transaction
+  if (begin_cid == MvccData::MAX_COMMIT_ID) return row_tid != INVALID_TRANSACTION_ID;
+
+  // A committed row that is neither locked nor being deleted by the given transaction
+  return row_tid != transaction_id || transaction_id == INVALID_TRANSACTION_ID;
+}
+
+std::vector<ColumnID> sorted_column_ids(const TableKeyConstraint& table_key_constraint) {
+  const auto& columns = table_key_constraint.columns();
+  auto column_ids = std::vector<ColumnID>(columns.cbegin(), columns.cend());
+  std::sort(column_ids.begin(), column_ids.end());
+  return column_ids;
+}
+
+}  // namespace
+
+namespace opossum {
+
+UniqueKeyIndex::UniqueKeyIndex(const Table& table, const TableKeyConstraint& table_key_constraint)
+    : _table(table),
+      _table_key_constraint(table_key_constraint),
+      _column_ids(sorted_column_ids(table_key_constraint)) {
+  Assert(_table.type() == TableType::Data && _table.uses_mvcc() == UseMvcc::Yes,
+         "Key constraints can only be enforced for data tables with MVCC");
+
+  // Register the rows that are already stored in the table. Materializing the keys chunk by chunk is much cheaper than
+  // accessing the (potentially encoded) segments row by row.
+  const auto chunk_count = _table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = _table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto chunk_size = chunk->size();
+    auto keys = std::vector<Key>(chunk_size, Key(_column_ids.size()));
+    for (auto key_column_index = size_t{0}; key_column_index < _column_ids.size(); ++key_column_index) {
+      segment_iterate(*chunk->get_segment(_column_ids[key_column_index]), [&](const auto& position) {
+        if (position.is_null()) return;
+        keys[position.chunk_offset()][key_column_index] = position.value();
+      });
+    }
+
+    const auto& mvcc_data = *chunk->mvcc_data();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      const auto& key = keys[chunk_offset];
+      const auto is_visible = might_be_visible(mvcc_data, chunk_offset, INVALID_TRANSACTION_ID);
+
+      if (std::any_of(key.cbegin(), key.cend(), [](const auto& value) { return variant_is_null(value); })) {
+        Assert(!is_visible || _table_key_constraint.key_type() != KeyConstraintType::PRIMARY_KEY,
+               "Cannot enforce primary key, table contains NULL values");
+        continue;
+      }
+
+      // Deleted rows are registered as well, as they might still be visible for older transactions
+      auto& shard = _shard(key);
+      auto& row_ids = shard.row_ids[key];
+      if (is_visible) {
+        for (const auto& row_id : row_ids) {
+          Assert(!might_be_visible(*_table.get_chunk(row_id.chunk_id)->mvcc_data(), row_id.chunk_offset,
+                                   INVALID_TRANSACTION_ID),
+                 "Cannot enforce key constraint, table contains duplicates or uncommitted rows");
+        }
+      }
+      row_ids.emplace_back(RowID{chunk_id, chunk_offset});
+    }
+  }
+}
+
+const TableKeyConstraint& UniqueKeyIndex::table_key_constraint() const { return _table_key_constraint; }
+
+const std::vector<ColumnID>& UniqueKeyIndex::column_ids() const { return _column_ids; }
+
+bool UniqueKeyIndex::try_insert(const RowID row_id, const TransactionID transaction_id) {
+  const auto key = _key(row_id);
+  if (!key) return _table_key_constraint.key_type() != KeyConstraintType::PRIMARY_KEY;
+
+  auto& shard = _shard(*key);
+  const auto lock = std::lock_guard<std::mutex>{shard.mutex};
+  auto& row_ids = shard.row_ids[*key];
+
+  // Remove the versions of the key that were moved out of physically deleted chunks (see MvccDeletePlugin).
+  const auto is_physically_deleted = [&](const auto& existing_row_id) {
+    return !_table.get_chunk(existing_row_id.chunk_id);
+  };
+  row_ids.erase(std::remove_if(row_ids.begin(), row_ids.end(), is_physically_deleted), row_ids.end());
+
+  for (const auto& existing_row_id : row_ids) {
+    const auto& mvcc_data = *_table.get_chunk(existing_row_id.chunk_id)->mvcc_data();
+    if (might_be_visible(mvcc_data, existing_row_id.chunk_offset, transaction_id)) return false;
+  }
+
+  row_ids.emplace_back(row_id);
+  return true;
+}
+
+void UniqueKeyIndex::erase(const RowID row_id) {
+  const auto key = _key(row_id);
+  if (!key) return;
+
+  auto& shard = _shard(*key);
+  const auto lock = std::lock_guard<std::mutex>{shard.mutex};
+  const auto iter = shard.row_ids.find(*key);
+  if (iter == shard.row_ids.end()) return;
+
+  auto& row_ids = iter->second;
+  row_ids.erase(std::remove(row_ids.begin(), row_ids.end(), row_id), row_ids.end());
+  if (row_ids.empty()) shard.row_ids.erase(iter);
+}
+
+std::vector<RowID> UniqueKeyIndex::lookup(const Key& key) const {
+  DebugAssert(key.size() == _column_ids.size(), "Expected one value per key column");
+
+  const auto& shard = _shard(key);
+  const auto lock = std::lock_guard<std::mutex>{shard.mutex};
+  const auto iter = shard.row_ids.find(key);
+  if (iter == shard.row_ids.end()) return {};
+
+  return iter->second;
+}
+
+size_t UniqueKeyIndex::size() const {
+  auto size = size_t{0};
+  for (const auto& shard : _shards) {
+    const auto lock = std::lock_guard<std::mutex>{shard.mutex};
+    for (const auto& [key, row_ids] : shard.row_ids) {
+      size += row_ids.size();
+    }
+  }
+  return size;
+}
+
+size_t UniqueKeyIndex::memory_usage() const {
+  auto bytes = sizeof(*this) + _column_ids.capacity() * sizeof(ColumnID);
+  for (const auto& shard : _shards) {
+    const auto lock = std::lock_guard<std::mutex>{shard.mutex};
+    // Rough estimation of a node (entry plus next pointer) and its bucket pointer in the hash map
+    bytes += shard.row_ids.size() * (sizeof(decltype(shard.row_ids)::value_type) + 2 * sizeof(void*));
+    for (const auto& [key, row_ids] : shard.row_ids) {
+      bytes += key.capacity() * sizeof(AllTypeVariant) + row_ids.capacity() * sizeof(RowID);
+    }
+  }
+  return bytes;
+}
+
+size_t UniqueKeyIndex::KeyHash::operator()(const Key& key) const {
+  auto hash = size_t{0};
+  for (const auto& value : key) {
+    boost::hash_combine(hash, std::hash<AllTypeVariant>{}(value));
+  }
+  return hash;
+}
+
+std::optional<UniqueKeyIndex::Key> UniqueKeyIndex::_key(const RowID row_id) const {
+  const auto chunk = _table.get_chunk(row_id.chunk_id);
+  DebugAssert(chunk, "Cannot access key of a physically deleted chunk");
+
+  auto key = Key{};
+  key.reserve(_column_ids.size());
+  for (const auto column_id : _column_ids) {
+    auto is_null = false;
+    const auto segment = chunk->get_segment(column_id);
+    resolve_data_type(_table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      // Inserted rows are always stored in ValueSegments, which we access directly rather than through the slower
+      // AbstractSegment::operator[].
+      auto value = std::optional<ColumnDataType>{};
+      if (const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(segment)) {
+        value = value_segment->get_typed_value(row_id.chunk_offset);
+      } else {
+        value = create_segment_accessor<ColumnDataType>(segment)->access(row_id.chunk_offset);
+      }
+
+      if (!value) {
+        is_null = true;
+        return;
+      }
+      key.emplace_back(std::move(*value));
+    });
+
+    if (is_null) return std::nullopt;
+  }
+
+  return key;
+}
+
+UniqueKeyIndex::Shard& UniqueKeyIndex::_shard(const Key& key) { return _shards[KeyHash{}(key) % SHARD_COUNT]; }
+
+const UniqueKeyIndex::Shard& UniqueKeyIndex::_shard(const Key& key) const {
+  return _shards[KeyHash{}(key) % SHARD_COUNT];
+}
+
+}  // namespace opossum
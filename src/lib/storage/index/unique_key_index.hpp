@@ -0,0 +1,94 @@
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/table_key_constraint.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Table-level hash index that enforces a PRIMARY KEY or UNIQUE constraint (see Table::enforce_key_constraint()). It
+ * maps the values of the key columns to the RowIDs of all row versions with that key. As Hyrise is insert-only, an
+ * update of a row leaves the old version in place and adds a new one, so that a key might map to multiple RowIDs.
+ * Which of them is visible for a given transaction is decided by the Validate operator, the index only guarantees that
+ * at most one of them can ever be visible.
+ *
+ * The index is split into shards that are protected by separate mutexes. The check for conflicting rows and the
+ * registration of a new row are done under the lock of the key's shard, so that concurrent inserts of the same key
+ * cannot both succeed.
+ *
+ * Entries of rolled-back inserts are removed by the Insert operator. Entries of deleted rows are kept for older
+ * transactions that might still see them. They are removed lazily once their chunk has been physically deleted.
+ */
+class UniqueKeyIndex : private Noncopyable {
+ public:
+  // Values of the key columns, ordered by their ColumnID and of the columns' data types
+  using Key = std::vector<AllTypeVariant>;
+
+  // The table has to outlive the index, which is usually guaranteed by the table owning it.
+  UniqueKeyIndex(const Table& table, const TableKeyConstraint& table_key_constraint);
+
+  const TableKeyConstraint& table_key_constraint() const;
+
+  // Sorted ColumnIDs of the key columns
+  const std::vector<ColumnID>& column_ids() const;
+
+  /**
+   * Registers the row (which has to be written to the table already) under its key. If another row with that key is
+   * visible or might become visible, the row is not registered and false is returned. This is the case for rows that
+   * are
+   *   - committed and not deleted (except for rows that are being deleted by the transaction itself, e.g., in an
+   *     Update),
+   *   - inserted by the transaction itself and not deleted again, or
+   *   - inserted or being deleted by another transaction that has not finished yet. As that transaction might still be
+   *     rolled back, we cannot decide whether there is a violation and report a conflict instead.
+   *
+   * NULL values violate PRIMARY KEYs. For UNIQUE constraints, rows with NULL values are not registered, as NULL is not
+   * equal to any other value (including other NULLs).
+   */
+  bool try_insert(const RowID row_id, const TransactionID transaction_id);
+
+  // Removes a row registered by try_insert(), e.g., when the inserting transaction is rolled back.
+  void erase(const RowID row_id);
+
+  // Returns the RowIDs of all row versions with the given key, regardless of their visibility.
+  std::vector<RowID> lookup(const Key& key) const;
+
+  // Number of registered row versions
+  size_t size() const;
+
+  size_t memory_usage() const;
+
+ protected:
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  struct Shard {
+    mutable std::mutex mutex;
+    std::unordered_map<Key, std::vector<RowID>, KeyHash> row_ids;
+  };
+
+  static constexpr auto SHARD_COUNT = size_t{64};
+
+  // Returns std::nullopt if one of the key values is NULL
+  std::optional<Key> _key(const RowID row_id) const;
+  Shard& _shard(const Key& key);
+  const Shard& _shard(const Key& key) const;
+
+  const Table& _table;
+  const TableKeyConstraint _table_key_constraint;
+  const std::vector<ColumnID> _column_ids;
+
+  std::array<Shard, SHARD_COUNT> _shards;
+};
+
+}  // namespace opossum
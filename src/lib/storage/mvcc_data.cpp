@@ -1,10 +1,13 @@
 #include "mvcc_data.hpp"
 
+#include <climits>
+#include <thread>
+
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-MvccData::MvccData(const size_t size, CommitID begin_commit_id) {
+MvccData::MvccData(const size_t size, CommitID begin_commit_id) : _size(size) {
   DebugAssert(size > 0, "No point in having empty MVCC data, as it cannot grow");
 
   _begin_cids.resize(size, begin_commit_id);
@@ -14,6 +17,16 @@ MvccData::MvccData(const size_t size, CommitID begin_commit_id) {
 }
 
 std::ostream& operator<<(std::ostream& stream, const MvccData& mvcc_data) {
+  if (mvcc_data.is_compact()) {
+    stream << "BeginCID (all rows): " << mvcc_data._compact_begin_cid << std::endl;
+    stream << "Sparse rows (offset: TID/EndCID): ";
+    mvcc_data.for_each_sparse_row([&](const auto chunk_offset, const auto tid, const auto end_cid) {
+      stream << chunk_offset << ": " << tid << "/" << end_cid << ", ";
+    });
+    stream << std::endl;
+    return stream;
+  }
+
   stream << "TIDs: ";
   for (const auto& tid : mvcc_data._tids) stream << tid.load() << ", ";
   stream << std::endl;
@@ -30,50 +43,163 @@ std::ostream& operator<<(std::ostream& stream, const MvccData& mvcc_data) {
 }
 
 CommitID MvccData::get_begin_cid(const ChunkOffset offset) const {
-  DebugAssert(offset < _begin_cids.size(), "offset out of bounds; MvccData insufficently preallocated?");
+  DebugAssert(offset < _size, "offset out of bounds; MvccData insufficently preallocated?");
+  if (_representation.load(std::memory_order_acquire) == Representation::Compact) return _compact_begin_cid;
+
   return _begin_cids[offset];
 }
 
 void MvccData::set_begin_cid(const ChunkOffset offset, const CommitID commit_id) {
-  DebugAssert(offset < _begin_cids.size(), "offset out of bounds; MvccData insufficently preallocated?");
+  DebugAssert(offset < _size, "offset out of bounds; MvccData insufficently preallocated?");
+  Assert(_representation.load() == Representation::Full, "Cannot set the begin CID of compact MvccData");
   _begin_cids[offset] = commit_id;
 }
 
 CommitID MvccData::get_end_cid(const ChunkOffset offset) const {
-  DebugAssert(offset < _end_cids.size(), "offset out of bounds; MvccData insufficently preallocated?");
+  DebugAssert(offset < _size, "offset out of bounds; MvccData insufficently preallocated?");
+  if (_representation.load(std::memory_order_acquire) == Representation::Compact) {
+    const auto sparse_row_iter = _sparse_rows.find(offset);
+    return sparse_row_iter != _sparse_rows.end() ? sparse_row_iter->second.end_cid.load() : MAX_COMMIT_ID;
+  }
+
   return _end_cids[offset];
 }
 
 void MvccData::set_end_cid(const ChunkOffset offset, const CommitID commit_id) {
-  DebugAssert(offset < _end_cids.size(), "offset out of bounds; MvccData insufficently preallocated?");
-  _end_cids[offset] = commit_id;
+  DebugAssert(offset < _size, "offset out of bounds; MvccData insufficently preallocated?");
+  if (_representation.load() == Representation::Full) {
+    _end_cids[offset] = commit_id;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_representation.load() == Representation::Full) return;
+
+    // A compaction has started concurrently and might have missed our write. Repeat it on the sparse rows.
+  }
+
+  _wait_for_compaction();
+  _sparse_row(offset).end_cid.store(commit_id);
 }
 
 TransactionID MvccData::get_tid(const ChunkOffset offset) const {
-  DebugAssert(offset < _tids.size(), "offset out of bounds; MvccData insufficently preallocated?");
+  DebugAssert(offset < _size, "offset out of bounds; MvccData insufficently preallocated?");
+  if (_representation.load(std::memory_order_acquire) == Representation::Compact) {
+    const auto sparse_row_iter = _sparse_rows.find(offset);
+    return sparse_row_iter != _sparse_rows.end() ? sparse_row_iter->second.tid.load() : INVALID_TRANSACTION_ID;
+  }
+
   return _tids[offset];
 }
 
 void MvccData::set_tid(const ChunkOffset offset, const TransactionID new_transaction_id,
                        const std::memory_order memory_order) {
-  DebugAssert(offset < _tids.size(), "offset out of bounds; MvccData insufficently preallocated?");
-
-  _tids[offset].store(new_transaction_id, memory_order);
+  DebugAssert(offset < _size, "offset out of bounds; MvccData insufficently preallocated?");
+  if (_representation.load() == Representation::Full) {
+    _tids[offset].store(new_transaction_id, memory_order);
+    // Insert stores with std::memory_order_relaxed, which does not keep the following load from being reordered
+    // before the store. Without the fence, compact() might copy the old TID, and we would not repeat our write.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_representation.load() == Representation::Full) return;
+
+    // A compaction has started concurrently and might have missed our write. Repeat it on the sparse rows.
+  }
+
+  _wait_for_compaction();
+  _sparse_row(offset).tid.store(new_transaction_id, memory_order);
 }
 
 bool MvccData::compare_exchange_tid(const ChunkOffset offset, TransactionID expected_transaction_id,
                                     TransactionID new_transaction_id) {
-  DebugAssert(offset < _tids.size(), "offset out of bounds; MvccData insufficently preallocated?");
+  DebugAssert(offset < _size, "offset out of bounds; MvccData insufficently preallocated?");
+
+  auto changed_full_vectors = false;
+  if (_representation.load() == Representation::Full) {
+    if (!_tids[offset].compare_exchange_strong(expected_transaction_id, new_transaction_id)) return false;
+    if (_representation.load() == Representation::Full) return true;
+
+    // Both this and the following load of _representation are sequentially consistent. Thus, if we still observed
+    // Representation::Full above, compact() is guaranteed to see our exchange. Otherwise, it may or may not have
+    // copied it, so we repeat the exchange on the sparse rows.
+    changed_full_vectors = true;
+  }
+
+  _wait_for_compaction();
+  auto& sparse_row = _sparse_row(offset);
+  if (sparse_row.tid.compare_exchange_strong(expected_transaction_id, new_transaction_id)) return true;
+
+  // If compact() has already copied our exchange, the exchange on the sparse rows fails but the row carries our TID.
+  return changed_full_vectors && expected_transaction_id == new_transaction_id;
+}
+
+void MvccData::compact() {
+  Assert(max_begin_cid, "Only MvccData of finalized chunks can be compacted");
+  Assert(*max_begin_cid != MAX_COMMIT_ID, "Cannot compact MvccData with uncommitted rows");
+
+  auto expected_representation = Representation::Full;
+  Assert(_representation.compare_exchange_strong(expected_representation, Representation::Compacting),
+         "MvccData has already been compacted");
+
+  _compact_begin_cid = *max_begin_cid;
+
+  // Writers wait for Representation::Compact before they touch the sparse rows. Hence, we are the only writer here
+  // and can simply copy all rows that are locked or invalidated.
+  for (auto offset = ChunkOffset{0}; offset < _size; ++offset) {
+    const auto tid = _tids[offset].load();
+    const auto end_cid = _end_cids[offset];
+    if (tid == INVALID_TRANSACTION_ID && end_cid == MAX_COMMIT_ID) continue;
+
+    auto& sparse_row = _sparse_row(offset);
+    sparse_row.tid.store(tid);
+    sparse_row.end_cid.store(end_cid);
+  }
+
+  _representation.store(Representation::Compact);
+}
+
+bool MvccData::is_compact() const { return _representation.load(std::memory_order_acquire) == Representation::Compact; }
+
+void MvccData::free_uncompacted_data() {
+  Assert(is_compact(), "Only the full-length vectors of compact MvccData can be freed");
+
+  pmr_vector<CommitID>{}.swap(_begin_cids);
+  pmr_vector<CommitID>{}.swap(_end_cids);
+  pmr_vector<copyable_atomic<TransactionID>>{}.swap(_tids);
+}
+
+void MvccData::_wait_for_compaction() const {
+  while (_representation.load() != Representation::Compact) {
+    std::this_thread::yield();
+  }
+}
+
+MvccData::SparseRow& MvccData::_sparse_row(const ChunkOffset offset) {
+  // Inserting into a tbb::concurrent_unordered_map is thread-safe. If the row already exists, it is not overwritten.
+  return _sparse_rows.insert({offset, SparseRow{}}).first->second;
+}
+
+std::shared_ptr<const MvccData::CachedVisibility> MvccData::cached_visibility(const CommitID snapshot_commit_id) const {
+  const auto cached_visibility = std::atomic_load(&_cached_visibility);
+  if (!cached_visibility || snapshot_commit_id < cached_visibility->begin_snapshot_commit_id ||
+      snapshot_commit_id >= cached_visibility->end_snapshot_commit_id) {
+    return nullptr;
+  }
+
+  return cached_visibility;
+}
 
-  return _tids[offset].compare_exchange_strong(expected_transaction_id, new_transaction_id);
+void MvccData::set_cached_visibility(const std::shared_ptr<const CachedVisibility>& cached_visibility) {
+  std::atomic_store(&_cached_visibility, cached_visibility);
 }
 
 size_t MvccData::memory_usage() const {
   auto bytes = size_t{0};
-  bytes += sizeof(_tids) + sizeof(_begin_cids) + sizeof(_end_cids);  // NOLINT
+  bytes += sizeof(_tids) + sizeof(_begin_cids) + sizeof(_end_cids) + sizeof(_sparse_rows);  // NOLINT
   bytes += _tids.size() * sizeof(decltype(_tids)::value_type);
   bytes += _begin_cids.size() * sizeof(decltype(_begin_cids)::value_type);
   bytes += _end_cids.size() * sizeof(decltype(_end_cids)::value_type);
+  // Rough estimation of a sparse row (node plus bucket pointer) in the concurrent map
+  bytes += _sparse_rows.size() * (sizeof(decltype(_sparse_rows)::value_type) + 2 * sizeof(void*));
+  if (const auto cached_visibility = std::atomic_load(&_cached_visibility)) {
+    bytes += sizeof(CachedVisibility) + cached_visibility->visible_rows.capacity() / CHAR_BIT;
+  }
   return bytes;
 }
 
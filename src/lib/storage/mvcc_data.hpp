@@ -1,7 +1,11 @@
 #pragma once
 
+#include <tbb/concurrent_unordered_map.h>
+
 #include <atomic>
+#include <memory>
 #include <shared_mutex>  // NOLINT lint thinks this is a C header or something
+#include <vector>
 
 #include "types.hpp"
 #include "utils/copyable_atomic.hpp"
@@ -10,9 +14,17 @@ namespace opossum {
 
 /**
  * Stores visibility information for multiversion concurrency control.
+ *
+ * By default, the MvccData holds one begin CID, end CID, and TID per row. Once a chunk is immutable and all of its
+ * rows have been committed before the lowest active snapshot, most of this information is redundant: every active
+ * (and future) transaction sees all rows as inserted and only the few deleted or locked rows differ. For such chunks,
+ * compact() switches to a compact representation that stores a single begin CID for all rows and keeps TIDs and end
+ * CIDs only for rows that are locked or invalidated (sparse rows). The interface is the same for both representations.
  */
 struct MvccData {
   friend class Chunk;
+  friend class OperatorsValidateTest;
+  friend class Validate;
   friend std::ostream& operator<<(std::ostream& stream, const MvccData& mvcc_data);
 
  public:
@@ -45,13 +57,72 @@ struct MvccData {
   bool compare_exchange_tid(const ChunkOffset offset, TransactionID expected_transaction_id,
                             TransactionID new_transaction_id);
 
+  /**
+   * Switches to the compact representation. The caller has to guarantee that the chunk is immutable, that
+   * max_begin_cid is set, and that no active transaction has a snapshot commit id below max_begin_cid (i.e., all rows
+   * are visible as inserted for everyone). All begin CIDs are collapsed to max_begin_cid.
+   *
+   * Concurrent readers and writers are allowed. The full-length vectors are not freed here, as transactions that
+   * started before the compaction might still read them. Call free_uncompacted_data() once no such transaction is
+   * active anymore.
+   */
+  void compact();
+  bool is_compact() const;
+  void free_uncompacted_data();
+
+  // Calls `functor(chunk_offset, tid, end_cid)` for every row of compact MvccData that is locked or invalidated. All
+  // other rows have no TID and an end CID of MAX_COMMIT_ID.
+  template <typename Functor>
+  void for_each_sparse_row(const Functor& functor) const {
+    DebugAssert(is_compact(), "Only compact MvccData has sparse rows");
+    for (const auto& [chunk_offset, sparse_row] : _sparse_rows) {
+      functor(chunk_offset, sparse_row.tid.load(), sparse_row.end_cid.load());
+    }
+  }
+
+  /**
+   * For read-only transactions, the visibility of a row only depends on the snapshot commit id. Validate caches the
+   * visibility of all rows as a bitmap that is valid for all snapshot commit ids in
+   * [begin_snapshot_commit_id, end_snapshot_commit_id). Rows beyond the end of the bitmap are invisible for these
+   * snapshots. Only the most recent bitmap is kept.
+   */
+  struct CachedVisibility {
+    CommitID begin_snapshot_commit_id;
+    CommitID end_snapshot_commit_id;
+    std::vector<bool> visible_rows;
+  };
+
+  // Returns nullptr if no cached bitmap is valid for the snapshot
+  std::shared_ptr<const CachedVisibility> cached_visibility(const CommitID snapshot_commit_id) const;
+  void set_cached_visibility(const std::shared_ptr<const CachedVisibility>& cached_visibility);
+
   size_t memory_usage() const;
 
  private:
+  enum class Representation : uint8_t { Full, Compacting, Compact };
+
+  struct SparseRow {
+    copyable_atomic<TransactionID> tid{INVALID_TRANSACTION_ID};
+    copyable_atomic<CommitID> end_cid{MAX_COMMIT_ID};
+  };
+
+  // Writers that encounter an ongoing compaction wait until the sparse rows have been built, see compact().
+  void _wait_for_compaction() const;
+  SparseRow& _sparse_row(const ChunkOffset offset);
+
+  size_t _size;
+
   // These vectors are pre-allocated. Do not resize them as someone might be reading them concurrently.
   pmr_vector<CommitID> _begin_cids;                  // < commit id when record was added
   pmr_vector<CommitID> _end_cids;                    // < commit id when record was deleted
   pmr_vector<copyable_atomic<TransactionID>> _tids;  // < 0 unless locked by a transaction
+
+  std::atomic<Representation> _representation{Representation::Full};
+  CommitID _compact_begin_cid{MAX_COMMIT_ID};
+  tbb::concurrent_unordered_map<ChunkOffset, SparseRow> _sparse_rows;
+
+  // Accessed using std::atomic_load/std::atomic_store
+  std::shared_ptr<const CachedVisibility> _cached_visibility;
 };
 
 std::ostream& operator<<(std::ostream& stream, const MvccData& mvcc_data);
@@ -12,6 +12,8 @@
 #include "resolve_type.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/index/unique_key_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -354,6 +356,40 @@ void Table::add_soft_key_constraint(const TableKeyConstraint& table_key_constrai
   }
 }
 
+void Table::create_table_index(const ColumnID column_id) {
+  Assert(!table_index(column_id), "Column is already indexed by a TableIndex");
+
+  resolve_data_type(column_data_type(column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    _table_indexes.emplace_back(std::make_shared<TableIndex<ColumnDataType>>(*this, column_id));
+  });
+}
+
+std::shared_ptr<const BaseTableIndex> Table::table_index(const ColumnID column_id) const {
+  for (const auto& table_index : _table_indexes) {
+    if (table_index->column_id() == column_id) return table_index;
+  }
+  return nullptr;
+}
+
+void Table::enforce_key_constraint(const TableKeyConstraint& table_key_constraint) {
+  Assert(_use_mvcc == UseMvcc::Yes, "Key constraints can only be enforced for tables with MVCC");
+
+  for (const auto& unique_key_index : _unique_key_indexes) {
+    Assert(unique_key_index->table_key_constraint().columns() != table_key_constraint.columns(),
+           "Key constraint is already enforced");
+  }
+
+  if (std::find(_table_key_constraints.cbegin(), _table_key_constraints.cend(), table_key_constraint) ==
+      _table_key_constraints.cend()) {
+    add_soft_key_constraint(table_key_constraint);
+  }
+
+  _unique_key_indexes.emplace_back(std::make_shared<UniqueKeyIndex>(*this, table_key_constraint));
+}
+
+const std::vector<std::shared_ptr<UniqueKeyIndex>>& Table::unique_key_indexes() const { return _unique_key_indexes; }
+
 const std::vector<ColumnID>& Table::value_clustered_by() const { return _value_clustered_by; }
 
 void Table::set_value_clustered_by(const std::vector<ColumnID>& value_clustered_by) {
@@ -395,6 +431,23 @@ void Table::set_value_clustered_by(const std::vector<ColumnID>& value_clustered_
   _value_clustered_by = value_clustered_by;
 }
 
+const std::optional<ChunkEncodingSpec>& Table::main_encoding_spec() const { return _main_encoding_spec; }
+
+void Table::set_main_encoding_spec(const std::optional<ChunkEncodingSpec>& main_encoding_spec) {
+  Assert(_type == TableType::Data && _use_mvcc == UseMvcc::Yes, "Only data tables with MVCC have a delta and a main");
+
+  if (main_encoding_spec) {
+    Assert(main_encoding_spec->size() == _column_definitions.size(), "Main encoding spec does not match column count");
+    for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+      Assert(encoding_supports_data_type((*main_encoding_spec)[column_id].encoding_type,
+                                         _column_definitions[column_id].data_type),
+             "Main encoding does not support the column's data type");
+    }
+  }
+
+  _main_encoding_spec = main_encoding_spec;
+}
+
 size_t Table::memory_usage(const MemoryUsageCalculationMode mode) const {
   auto bytes = size_t{sizeof(*this)};
 
@@ -410,6 +463,14 @@ size_t Table::memory_usage(const MemoryUsageCalculationMode mode) const {
     bytes += column_definition.name.size();
   }
 
+  for (const auto& unique_key_index : _unique_key_indexes) {
+    bytes += unique_key_index->memory_usage();
+  }
+
+  for (const auto& table_index : _table_indexes) {
+    bytes += table_index->memory_usage();
+  }
+
   // TODO(anybody) Statistics and Indexes missing from Memory Usage Estimation
   // TODO(anybody) TableLayout missing
 
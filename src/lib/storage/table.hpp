@@ -9,6 +9,7 @@
 #include "abstract_segment.hpp"
 #include "boost/variant.hpp"
 #include "chunk.hpp"
+#include "storage/encoding_type.hpp"
 #include "storage/index/index_statistics.hpp"
 #include "storage/table_column_definition.hpp"
 #include "table_key_constraint.hpp"
@@ -19,6 +20,8 @@
 namespace opossum {
 
 class TableStatistics;
+class BaseTableIndex;
+class UniqueKeyIndex;
 
 /**
  * A Table is partitioned horizontally into a number of chunks.
@@ -196,6 +199,15 @@ class Table : private Noncopyable {
     _indexes.emplace_back(index_statistics);
   }
 
+  /**
+   * Creates a TableIndex (see table_index.hpp) on the given column, which covers all immutable chunks at the beginning
+   * of the table. Like create_index(), this must not be called concurrently to modifications of the table.
+   */
+  void create_table_index(const ColumnID column_id);
+
+  // Returns the TableIndex on the given column or nullptr if there is none
+  std::shared_ptr<const BaseTableIndex> table_index(const ColumnID column_id) const;
+
   /**
    * NOTE: Key constraints are currently NOT ENFORCED and are only used to develop optimization rules.
    * We call them "soft" key constraints to draw attention to that.
@@ -203,6 +215,16 @@ class Table : private Noncopyable {
   void add_soft_key_constraint(const TableKeyConstraint& table_key_constraint);
   const TableKeyConstraints& soft_key_constraints() const;
 
+  /**
+   * Enforces a key constraint by maintaining a UniqueKeyIndex for it. The constraint is added as a soft key constraint
+   * if it has not been added before. Afterwards, Insert (and thus Update) fails for rows that would violate the
+   * constraint, and equality predicates on all key columns can be answered by the UniqueIndexScan.
+   * Fails if the stored rows already violate the constraint. Like create_index(), this must not be called concurrently
+   * to modifications of the table.
+   */
+  void enforce_key_constraint(const TableKeyConstraint& table_key_constraint);
+  const std::vector<std::shared_ptr<UniqueKeyIndex>>& unique_key_indexes() const;
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this Table (including Chunk and Segments)
    */
@@ -221,6 +243,15 @@ class Table : private Noncopyable {
   const std::vector<ColumnID>& value_clustered_by() const;
   void set_value_clustered_by(const std::vector<ColumnID>& value_clustered_by);
 
+  /**
+   * Update-heavy tables can be organized in a delta-main fashion. As Hyrise is insert-only, inserted and updated rows
+   * are appended to the mutable, unencoded chunks at the end of the table, which form the write-optimized delta. Once
+   * such a chunk is full and committed, the DeltaMergePlugin merges it into the read-optimized main by finalizing it
+   * and encoding it with the main encoding spec. Tables without a main encoding spec are not touched by the plugin.
+   */
+  const std::optional<ChunkEncodingSpec>& main_encoding_spec() const;
+  void set_main_encoding_spec(const std::optional<ChunkEncodingSpec>& main_encoding_spec);
+
  protected:
   const TableColumnDefinitions _column_definitions;
   const TableType _type;
@@ -239,8 +270,11 @@ class Table : private Noncopyable {
   tbb::concurrent_vector<std::shared_ptr<Chunk>, tbb::zero_allocator<std::shared_ptr<Chunk>>> _chunks;
 
   TableKeyConstraints _table_key_constraints;
+  std::vector<std::shared_ptr<UniqueKeyIndex>> _unique_key_indexes;
+  std::vector<std::shared_ptr<BaseTableIndex>> _table_indexes;
 
   std::vector<ColumnID> _value_clustered_by;
+  std::optional<ChunkEncodingSpec> _main_encoding_spec;
   std::shared_ptr<TableStatistics> _table_statistics;
   std::unique_ptr<std::mutex> _append_mutex;
   std::vector<IndexStatistics> _indexes;
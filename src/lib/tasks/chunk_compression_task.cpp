@@ -32,19 +32,23 @@ void ChunkCompressionTask::_on_execute() {
     // TODO(anyone): It is unclear if this restriction is really necessary. If it becomes a problem and we decide to
     // get rid of it, we should make sure that a new mutable chunk is created first so that inserts do not end up in
     // the chunk being compressed.
-    DebugAssert(_chunk_is_completed(chunk, table->target_chunk_size()),
+    DebugAssert(chunk_is_completed(chunk, table->target_chunk_size()),
                 "Chunk is not completed and thus can’t be compressed.");
 
     ChunkEncoder::encode_chunk(chunk, table->column_data_types());
   }
 }
 
-bool ChunkCompressionTask::_chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t target_chunk_size) {
-  if (chunk->size() != target_chunk_size) return false;
+bool ChunkCompressionTask::chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t target_chunk_size) {
+  // The Insert operator does not add rows to full chunks, but it might append rows to all other mutable chunks
+  if (chunk->is_mutable() && chunk->size() < target_chunk_size) return false;
 
+  // Compact MvccData has no uncommitted rows
   const auto& mvcc_data = chunk->mvcc_data();
+  if (mvcc_data->is_compact()) return true;
 
-  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < target_chunk_size; ++chunk_offset) {
+  const auto chunk_size = chunk->size();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
     // TODO(anybody) Reading the non-atomic begin_cid (which is written to in Insert without a write lock) is likely UB
     //               When activating the ChunkCompressionTask, please look for a different means of determining whether
     //               all Inserts to a Chunk finished.
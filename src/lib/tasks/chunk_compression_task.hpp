@@ -24,8 +24,8 @@ class Chunk;
  * it does not touch the segments. However, inserting records while simultaneously
  * compressing the chunk leads to inconsistent state. Therefore only chunks where
  * all insertion has been completed may be compressed. In other words, they need to be
- * full and all of their end-cids must be smaller than infinity. This task calls
- * those chunks “completed”.
+ * full (or immutable) and all of their begin-cids must be smaller than infinity. This
+ * task calls those chunks “completed”.
  *
  * Note: Reference segments are not invalidated by this task because the order in which
  *       records are stored does not change.
@@ -35,16 +35,15 @@ class ChunkCompressionTask : public AbstractTask {
   explicit ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id);
   explicit ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids);
 
- protected:
-  void _on_execute() override;
-
- private:
   /**
-   * @brief Checks if a chunks is completed
+   * @brief Checks if a chunk is completed
    *
-   * See class comment for further explanation
+   * See class comment for further explanation. Also used by the DeltaMergePlugin.
    */
-  static bool _chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t target_chunk_size);
+  static bool chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t target_chunk_size);
+
+ protected:
+  void _on_execute() override;
 
  private:
   const std::string _table_name;
@@ -133,6 +133,14 @@ PredicateCondition conditions_to_between(const PredicateCondition lower, const P
   Fail("Unexpected PredicateCondition");
 }
 
+bool is_ascending_sort_mode(const SortMode sort_mode) {
+  return sort_mode == SortMode::Ascending || sort_mode == SortMode::AscendingNullsLast;
+}
+
+bool is_nulls_first_sort_mode(const SortMode sort_mode) {
+  return sort_mode == SortMode::Ascending || sort_mode == SortMode::Descending;
+}
+
 const boost::bimap<PredicateCondition, std::string> predicate_condition_to_string =
     make_bimap<PredicateCondition, std::string>({
         {PredicateCondition::Equals, "="},
@@ -156,6 +164,8 @@ const boost::bimap<PredicateCondition, std::string> predicate_condition_to_strin
 const boost::bimap<SortMode, std::string> sort_mode_to_string = make_bimap<SortMode, std::string>({
     {SortMode::Ascending, "Ascending"},
     {SortMode::Descending, "Descending"},
+    {SortMode::AscendingNullsLast, "AscendingNullsLast"},
+    {SortMode::DescendingNullsLast, "DescendingNullsLast"},
 });
 
 const boost::bimap<JoinMode, std::string> join_mode_to_string = make_bimap<JoinMode, std::string>({
@@ -218,9 +218,15 @@ enum class JoinMode { Inner, Left, Right, FullOuter, Cross, Semi, AntiNullAsTrue
 // see union_positions.hpp for details.
 enum class SetOperationMode { Unique, All, Positions };
 
-// According to the SQL standard, the position of NULLs is implementation-defined. In Hyrise, NULLs come before all
-// values, both for ascending and descending sorts. See sort.cpp for details.
-enum class SortMode { Ascending, Descending };
+// According to the SQL standard, the position of NULLs is implementation-defined, and different databases behave
+// differently (https://docs.mendix.com/refguide/null-ordering-behavior). By default, NULLs come before all values in
+// Hyrise, both for ascending and descending sorts, as this requires the least amount of code for scans on sorted
+// segments. The NullsLast modes are only supported by the Sort and TopK operators. Chunks are only marked as sorted
+// with NULLs first (see Chunk::set_individually_sorted_by).
+enum class SortMode { Ascending, Descending, AscendingNullsLast, DescendingNullsLast };
+
+bool is_ascending_sort_mode(const SortMode sort_mode);
+bool is_nulls_first_sort_mode(const SortMode sort_mode);
 
 enum class TableType { References, Data };
 
@@ -89,6 +89,19 @@ void MetaTableManager::update(const std::string& table_name, const std::shared_p
   }
 }
 
+void MetaTableManager::add_table(const std::shared_ptr<AbstractMetaTable>& table) {
+  Assert(!_meta_tables.contains(table->name()), "A meta table named " + table->name() + " already exists.");
+  _add(table);
+}
+
+void MetaTableManager::remove_table(const std::string& table_name) {
+  const auto trimmed_table_name = _trim_table_name(table_name);
+  Assert(_meta_tables.contains(trimmed_table_name), "No meta table named " + trimmed_table_name + " found.");
+
+  _meta_tables.erase(trimmed_table_name);
+  _table_names.erase(std::find(_table_names.begin(), _table_names.end(), trimmed_table_name));
+}
+
 void MetaTableManager::_add(const std::shared_ptr<AbstractMetaTable>& table) {
   _meta_tables[table->name()] = table;
   _table_names.push_back(table->name());
@@ -33,6 +33,11 @@ class MetaTableManager : public Noncopyable {
   void update(const std::string& table_name, const std::shared_ptr<const Table>& selected_values,
               const std::shared_ptr<const Table>& update_values);
 
+  // Components that are not part of the core, such as plugins, can provide their own meta tables. They have to remove
+  // them before they are unloaded.
+  void add_table(const std::shared_ptr<AbstractMetaTable>& table);
+  void remove_table(const std::string& table_name);
+
  protected:
   friend class Hyrise;
   friend class MetaTableManagerTest;
@@ -0,0 +1,39 @@
+#include "operator_memory_budget_setting.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+OperatorMemoryBudgetSetting::OperatorMemoryBudgetSetting() : AbstractSetting(NAME) {}
+
+const std::string& OperatorMemoryBudgetSetting::description() const {
+  static const auto description =
+      std::string{"Memory budget in bytes of spilling operators (JoinHash, AggregateHash, Sort), 0 for no limit"};
+  return description;
+}
+
+std::string OperatorMemoryBudgetSetting::get() { return std::to_string(_budget.load()); }
+
+void OperatorMemoryBudgetSetting::set(const std::string& value) {
+  // lexical_cast would wrap negative values around
+  AssertInput(value.find('-') == std::string::npos, "Memory budget must not be negative");
+
+  auto budget = size_t{0};
+  try {
+    budget = boost::lexical_cast<size_t>(value);
+  } catch (const boost::bad_lexical_cast&) {
+    AssertInput(false, "Cannot convert '" + value + "' for setting " + name);
+  }
+
+  _budget = budget;
+}
+
+std::optional<size_t> OperatorMemoryBudgetSetting::budget() const {
+  const auto budget = _budget.load();
+  if (budget == 0) return std::nullopt;
+  return budget;
+}
+
+}  // namespace opossum
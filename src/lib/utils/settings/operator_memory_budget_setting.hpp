@@ -0,0 +1,37 @@
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <string>
+
+#include "abstract_setting.hpp"
+
+namespace opossum {
+
+/**
+ * Memory budget (in bytes) for the intermediate results of a single operator. The LQPTranslator passes it to the
+ * operators that spill to disk once they exceed it (JoinHash, AggregateHash, and Sort). The default of 0 means that
+ * operators are not limited. The setting is registered by Hyrise and can be changed through the settings meta table:
+ *   UPDATE meta_settings SET value = '100000000' WHERE name = 'Operators.memory_budget_bytes'
+ */
+class OperatorMemoryBudgetSetting : public AbstractSetting {
+ public:
+  inline static const auto NAME = std::string{"Operators.memory_budget_bytes"};
+
+  OperatorMemoryBudgetSetting();
+
+  const std::string& description() const final;
+
+  std::string get() final;
+
+  void set(const std::string& value) final;
+
+  // The budget or std::nullopt if operators are not limited
+  std::optional<size_t> budget() const;
+
+ private:
+  // Read by concurrently translated queries while being changed through the meta table
+  std::atomic<size_t> _budget{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,31 @@
+#include "spill_file.hpp"
+
+#include <unistd.h>
+
+#include <cstdlib>
+#include <filesystem>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+SpillFile::SpillFile(const std::string& name_prefix) {
+  auto path = (std::filesystem::temp_directory_path() / (name_prefix + "_XXXXXX")).string();
+  const auto file_descriptor = mkstemp(path.data());
+  Assert(file_descriptor >= 0, "Could not create spill file in " + std::filesystem::temp_directory_path().string());
+
+  // mkstemp returns a file descriptor, but we access the file through fstreams.
+  close(file_descriptor);
+  _path = std::move(path);
+}
+
+SpillFile::~SpillFile() {
+  // Do not throw from the destructor if the file has already been removed.
+  auto error_code = std::error_code{};
+  std::filesystem::remove(_path, error_code);
+}
+
+const std::string& SpillFile::path() const { return _path; }
+
+}  // namespace opossum
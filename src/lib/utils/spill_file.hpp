@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Temporary file to which operators write intermediate data when they exceed their memory budget (e.g., the spilled
+ * partitions of the JoinHash). The file is created in the system's temporary directory with a unique name that starts
+ * with the given prefix and is removed when the SpillFile is destroyed.
+ */
+class SpillFile : private Noncopyable {
+ public:
+  explicit SpillFile(const std::string& name_prefix);
+  ~SpillFile();
+
+  const std::string& path() const;
+
+ private:
+  std::string _path;
+};
+
+}  // namespace opossum
@@ -94,6 +94,12 @@ void PQPVisualizer::_build_subtree(const std::shared_ptr<const AbstractOperator>
     _build_dataflow(right, op, InputSide::Right);
   }
 
+  // Inputs of multi-way operators beyond the left and right input are drawn like right inputs
+  for (const auto& additional_input : op->additional_inputs()) {
+    _build_subtree(additional_input, visualized_ops);
+    _build_dataflow(additional_input, op, InputSide::Right);
+  }
+
   switch (op->type()) {
     case OperatorType::Projection: {
       const auto projection = std::dynamic_pointer_cast<const Projection>(op);
@@ -0,0 +1,76 @@
+#include "delta_merge_plugin.hpp"
+
+#include "storage/chunk_encoder.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+#include "tasks/chunk_compression_task.hpp"
+
+namespace opossum {
+
+std::string DeltaMergePlugin::description() const { return "Delta merge plugin"; }
+
+void DeltaMergePlugin::start() {
+  _loop_thread_merge = std::make_unique<PausableLoopThread>(IDLE_DELAY_MERGE, [&](size_t) { _merge_loop(); });
+}
+
+void DeltaMergePlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread
+  _loop_thread_merge.reset();
+}
+
+void DeltaMergePlugin::_merge_loop() {
+  const auto tables = Hyrise::get().storage_manager.tables();
+
+  for (const auto& [table_name, table] : tables) {
+    if (!table->main_encoding_spec()) continue;
+
+    auto merged_chunk_count = size_t{0};
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      if (_try_merge_chunk(table, chunk_id)) ++merged_chunk_count;
+    }
+
+    if (merged_chunk_count > 0) {
+      const auto message = "Merged " + std::to_string(merged_chunk_count) + " delta chunk(s) of " + table_name;
+      Hyrise::get().log_manager.add_message("DeltaMergePlugin", message, LogLevel::Info);
+    }
+  }
+}
+
+bool DeltaMergePlugin::_try_merge_chunk(const std::shared_ptr<Table>& table, const ChunkID chunk_id) {
+  const auto& main_encoding_spec = table->main_encoding_spec();
+  Assert(main_encoding_spec, "Table has no main encoding spec");
+
+  const auto chunk = table->get_chunk(chunk_id);
+  if (!chunk) return false;
+
+  // Chunks that are already encoded as requested belong to the main. As in ChunkEncoder::encode_segment, the vector
+  // compression is only compared if the spec defines it.
+  auto is_main_chunk = true;
+  const auto column_count = chunk->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto& requested_spec = (*main_encoding_spec)[column_id];
+    const auto current_spec = get_segment_encoding_spec(chunk->get_segment(column_id));
+    if (current_spec.encoding_type != requested_spec.encoding_type ||
+        (requested_spec.vector_compression_type &&
+         current_spec.vector_compression_type != requested_spec.vector_compression_type)) {
+      is_main_chunk = false;
+      break;
+    }
+  }
+  if (is_main_chunk) return false;
+
+  // Rows might still be appended to the chunk or written by an Insert that has not been committed yet. The Insert
+  // operator does not finalize chunks, so that complete chunks might still be mutable.
+  if (!ChunkCompressionTask::chunk_is_completed(chunk, table->target_chunk_size())) return false;
+  if (chunk->is_mutable()) chunk->finalize();
+
+  // Segments are replaced atomically (see Chunk::replace_segment), so concurrent readers either see the delta or the
+  // main version of a segment.
+  ChunkEncoder::encode_chunk(chunk, table->column_data_types(), *main_encoding_spec);
+  return true;
+}
+
+EXPORT_PLUGIN(DeltaMergePlugin)
+
+}  // namespace opossum
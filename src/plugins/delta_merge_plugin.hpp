@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+
+#include "hyrise.hpp"
+#include "storage/chunk.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace opossum {
+
+class Table;
+
+/*
+ * Point updates are cheap in Hyrise as they only invalidate the old version of a row and append the new one to the
+ * mutable chunks at the end of the table. These chunks consist of unencoded ValueSegments and thus form a
+ * write-optimized delta. Scans over them, however, are slower than scans over encoded segments. For tables that have
+ * a main encoding spec (see Table::set_main_encoding_spec()), this plugin periodically merges complete delta chunks
+ * into the read-optimized main by finalizing and encoding them. A chunk is complete once it is full (or immutable) and
+ * none of its rows is still being inserted by an uncommitted transaction.
+ * Invalidated rows are not removed from the main here, this is left to the MvccDeletePlugin, which reinserts the
+ * remaining rows into the delta.
+ *
+ * There is no separate row-oriented delta store or delta-specific key index. Point updates locate their rows using the
+ * UniqueKeyIndex of the table's primary key (see Table::enforce_key_constraint() and UniqueIndexScan), which covers
+ * both main and delta. As merging encodes the segments of a chunk in place, the RowIDs stored in that index stay valid.
+ */
+class DeltaMergePlugin : public AbstractPlugin {
+  friend class DeltaMergePluginTest;
+
+ public:
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  constexpr static std::chrono::milliseconds IDLE_DELAY_MERGE = std::chrono::milliseconds(1000);
+
+ private:
+  void _merge_loop();
+
+  // Returns true if the chunk was part of the delta and has been merged into the main
+  static bool _try_merge_chunk(const std::shared_ptr<Table>& table, const ChunkID chunk_id);
+
+  std::unique_ptr<PausableLoopThread> _loop_thread_merge;
+};
+
+}  // namespace opossum
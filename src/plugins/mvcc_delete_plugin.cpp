@@ -4,126 +4,254 @@
 #include "operators/table_wrapper.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
 
+MvccDeletePlugin::MvccDeletePlugin()
+    : _delete_threshold_invalidated_rows(std::make_shared<Setting<double>>(
+          "MvccDeletePlugin.delete_threshold_invalidated_rows",
+          "Share of invalidated rows in a chunk from which on the chunk is cleaned up",
+          DELETE_THRESHOLD_PERCENTAGE_INVALIDATED_ROWS, 0.0)),
+      _delete_threshold_last_commit(std::make_shared<Setting<CommitID>>(
+          "MvccDeletePlugin.delete_threshold_last_commit",
+          "Number of commits that must have passed since a chunk was last modified before it is cleaned up",
+          DELETE_THRESHOLD_LAST_COMMIT, CommitID{0})),
+      _idle_delay_logical_delete(std::make_shared<Setting<uint64_t>>(
+          "MvccDeletePlugin.idle_delay_logical_delete_ms", "Sleep time (in ms) between two runs of the logical delete",
+          IDLE_DELAY_LOGICAL_DELETE.count(), uint64_t{0},
+          [&](const auto idle_delay) {
+            if (_loop_thread_logical_delete) {
+              _loop_thread_logical_delete->set_loop_sleep_time(std::chrono::milliseconds(idle_delay));
+            }
+          })),
+      _idle_delay_physical_delete(std::make_shared<Setting<uint64_t>>(
+          "MvccDeletePlugin.idle_delay_physical_delete_ms",
+          "Sleep time (in ms) between two runs of the physical delete", IDLE_DELAY_PHYSICAL_DELETE.count(), uint64_t{0},
+          [&](const auto idle_delay) {
+            if (_loop_thread_physical_delete) {
+              _loop_thread_physical_delete->set_loop_sleep_time(std::chrono::milliseconds(idle_delay));
+            }
+          })),
+      _statistics_table(std::make_shared<StatisticsTable>(*this)) {}
+
 std::string MvccDeletePlugin::description() const { return "Physical MVCC delete plugin"; }
 
 void MvccDeletePlugin::start() {
   _loop_thread_logical_delete =
-      std::make_unique<PausableLoopThread>(IDLE_DELAY_LOGICAL_DELETE, [&](size_t) { _logical_delete_loop(); });
+      std::make_unique<PausableLoopThread>(std::chrono::milliseconds(_idle_delay_logical_delete->value()),
+                                           [&](size_t) { _logical_delete_loop(); });
 
   _loop_thread_physical_delete =
-      std::make_unique<PausableLoopThread>(IDLE_DELAY_PHYSICAL_DELETE, [&](size_t) { _physical_delete_loop(); });
+      std::make_unique<PausableLoopThread>(std::chrono::milliseconds(_idle_delay_physical_delete->value()),
+                                           [&](size_t) { _physical_delete_loop(); });
+
+  _delete_threshold_invalidated_rows->register_at_settings_manager();
+  _delete_threshold_last_commit->register_at_settings_manager();
+  _idle_delay_logical_delete->register_at_settings_manager();
+  _idle_delay_physical_delete->register_at_settings_manager();
+  Hyrise::get().meta_table_manager.add_table(_statistics_table);
 }
 
 void MvccDeletePlugin::stop() {
+  Hyrise::get().meta_table_manager.remove_table(_statistics_table->name());
+  _delete_threshold_invalidated_rows->unregister_at_settings_manager();
+  _delete_threshold_last_commit->unregister_at_settings_manager();
+  _idle_delay_logical_delete->unregister_at_settings_manager();
+  _idle_delay_physical_delete->unregister_at_settings_manager();
+
   // Call destructor of PausableLoopThread to terminate its thread
   _loop_thread_logical_delete.reset();
   _loop_thread_physical_delete.reset();
-  std::queue<TableAndChunkID> empty;
+  std::queue<PhysicalDeleteCandidate> empty;
   std::swap(_physical_delete_queue, empty);
+  std::queue<MvccDataAndCommitID> empty_compacted;
+  std::swap(_compacted_mvcc_data_queue, empty_compacted);
+}
+
+std::map<std::string, MvccDeletePlugin::CleanupStatistics> MvccDeletePlugin::cleanup_statistics() const {
+  std::lock_guard<std::mutex> lock(_mutex_cleanup_statistics);
+  return _cleanup_statistics;
 }
 
 /**
  * This function analyzes each chunk of every table and triggers a chunk-cleanup-procedure if a certain threshold of
- * invalidated rows is exceeded.
+ * invalidated rows is exceeded. Each table with chunks to clean up is handled by a separate JobTask. The tables with
+ * the highest validation cost are scheduled first.
  */
 void MvccDeletePlugin::_logical_delete_loop() {
   const auto tables = Hyrise::get().storage_manager.tables();
+  const auto delete_threshold_invalidated_rows = _delete_threshold_invalidated_rows->value();
+
+  auto jobs_and_costs = std::vector<std::pair<std::shared_ptr<AbstractTask>, double>>{};
 
   // Check all tables
   for (auto& [table_name, table] : tables) {
     if (table->empty() || table->uses_mvcc() != UseMvcc::Yes) continue;
-    size_t saved_memory = 0;
-    size_t num_chunks = 0;
+
+    auto chunk_ids_and_costs = std::vector<std::pair<ChunkID, double>>{};
+    auto compacted_mvcc_data = size_t{0};
 
     // Check all chunks, except for the last one, which is currently used for insertions
     const auto max_chunk_id = static_cast<ChunkID>(table->chunk_count() - 1);
     for (auto chunk_id = ChunkID{0}; chunk_id < max_chunk_id; chunk_id++) {
       const auto& chunk = table->get_chunk(chunk_id);
-      if (chunk && !chunk->get_cleanup_commit_id()) {
-        const auto chunk_memory = chunk->memory_usage(MemoryUsageCalculationMode::Sampled);
+      if (!chunk || chunk->get_cleanup_commit_id()) continue;
+
+      // Calculate metric 1 – Chunk invalidation level
+      const double invalidated_rows_ratio = static_cast<double>(chunk->invalid_row_count()) / chunk->size();
+      const bool criterion1 = (delete_threshold_invalidated_rows <= invalidated_rows_ratio);
+
+      if (!criterion1) {
+        // The chunk is not going to be cleaned up. Instead, try to reduce the footprint of its MVCC data.
+        if (_try_compact_mvcc_data(chunk)) {
+          std::unique_lock<std::mutex> lock(_mutex_compacted_mvcc_data_queue);
+          _compacted_mvcc_data_queue.emplace(chunk->mvcc_data(), Hyrise::get().transaction_manager.last_commit_id());
+          ++compacted_mvcc_data;
+        }
+        continue;
+      }
 
-        // Calculate metric 1 – Chunk invalidation level
-        const double invalidated_rows_ratio = static_cast<double>(chunk->invalid_row_count()) / chunk->size();
-        const bool criterion1 = (DELETE_THRESHOLD_PERCENTAGE_INVALIDATED_ROWS <= invalidated_rows_ratio);
+      chunk_ids_and_costs.emplace_back(chunk_id, _validation_cost(*chunk));
+    }
 
-        if (!criterion1) {
-          continue;
-        }
+    if (compacted_mvcc_data > 0) {
+      std::lock_guard<std::mutex> lock(_mutex_cleanup_statistics);
+      _cleanup_statistics[table_name].compacted_mvcc_data += compacted_mvcc_data;
+    }
 
-        // Calculate metric 2 – Chunk Hotness
-        auto highest_end_commit_id = CommitID{0};
-        const auto chunk_size = chunk->size();
-        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
-          const auto commit_id = chunk->mvcc_data()->get_end_cid(chunk_offset);
-          if (commit_id != MvccData::MAX_COMMIT_ID && commit_id > highest_end_commit_id) {
-            highest_end_commit_id = commit_id;
-          }
-        }
+    if (chunk_ids_and_costs.empty()) continue;
 
-        const bool criterion2 =
-            highest_end_commit_id + DELETE_THRESHOLD_LAST_COMMIT <= Hyrise::get().transaction_manager.last_commit_id();
+    std::sort(chunk_ids_and_costs.begin(), chunk_ids_and_costs.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.second > rhs.second; });
 
-        if (!criterion2) {
-          continue;
-        }
+    auto chunk_ids = std::vector<ChunkID>{};
+    chunk_ids.reserve(chunk_ids_and_costs.size());
+    auto table_cost = 0.0;
+    for (const auto& [chunk_id, cost] : chunk_ids_and_costs) {
+      chunk_ids.emplace_back(chunk_id);
+      table_cost += cost;
+    }
 
-        auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
-        const bool success = _try_logical_delete(table_name, chunk_id, transaction_context);
+    jobs_and_costs.emplace_back(
+        std::make_shared<JobTask>([&, chunk_ids = std::move(chunk_ids), table_name = table_name, table = table]() {
+          _clean_up_table(table_name, table, chunk_ids);
+        }),
+        table_cost);
+  }
 
-        if (success) {
-          DebugAssert(table->get_chunk(chunk_id)->get_cleanup_commit_id(),
-                      "Chunk needs to be deleted logically before deleting it physically.");
+  std::sort(jobs_and_costs.begin(), jobs_and_costs.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.second > rhs.second; });
 
-          std::unique_lock<std::mutex> lock(_mutex_physical_delete_queue);
-          _physical_delete_queue.emplace(table, chunk_id);
-          saved_memory += chunk_memory;
-          num_chunks++;
-        }
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(jobs_and_costs.size());
+  for (const auto& [job, cost] : jobs_and_costs) {
+    jobs.emplace_back(job);
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
+
+void MvccDeletePlugin::_clean_up_table(const std::string& table_name, const std::shared_ptr<Table>& table,
+                                       const std::vector<ChunkID>& chunk_ids) {
+  const auto delete_threshold_last_commit = _delete_threshold_last_commit->value();
+  auto statistics = CleanupStatistics{};
+
+  for (const auto chunk_id : chunk_ids) {
+    const auto& chunk = table->get_chunk(chunk_id);
+
+    // Calculate metric 2 – Chunk Hotness
+    auto highest_end_commit_id = CommitID{0};
+    const auto chunk_size = chunk->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      const auto commit_id = chunk->mvcc_data()->get_end_cid(chunk_offset);
+      if (commit_id != MvccData::MAX_COMMIT_ID && commit_id > highest_end_commit_id) {
+        highest_end_commit_id = commit_id;
       }
     }
-    if (saved_memory > 0) {
-      std::ostringstream message;
-      double saved_mb = static_cast<float>(saved_memory) / (1000.0 * 1000.0);
-      message << "Consolidated " << num_chunks << " chunk(s) of " << table_name << ", saved approx. "
-              << std::setprecision(2) << saved_mb << " MB";
-      Hyrise::get().log_manager.add_message("MvccDeletePlugin", message.str(), LogLevel::Info);
+
+    const bool criterion2 =
+        highest_end_commit_id + delete_threshold_last_commit <= Hyrise::get().transaction_manager.last_commit_id();
+
+    if (!criterion2) {
+      continue;
+    }
+
+    const auto invalid_row_count = chunk->invalid_row_count();
+    auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const bool success = _try_logical_delete(table_name, chunk_id, transaction_context);
+
+    if (success) {
+      DebugAssert(table->get_chunk(chunk_id)->get_cleanup_commit_id(),
+                  "Chunk needs to be deleted logically before deleting it physically.");
+
+      std::unique_lock<std::mutex> lock(_mutex_physical_delete_queue);
+      _physical_delete_queue.push({table_name, table, chunk_id});
+      ++statistics.logically_deleted_chunks;
+      statistics.removed_invalid_rows += invalid_row_count;
+    } else {
+      ++statistics.failed_logical_deletes;
     }
   }
+
+  if (statistics.logically_deleted_chunks > 0) {
+    const auto message = "Consolidated " + std::to_string(statistics.logically_deleted_chunks) + " chunk(s) of " +
+                         table_name + ", removed " + std::to_string(statistics.removed_invalid_rows) +
+                         " invalidated row(s)";
+    Hyrise::get().log_manager.add_message("MvccDeletePlugin", message, LogLevel::Info);
+  }
+
+  std::lock_guard<std::mutex> lock(_mutex_cleanup_statistics);
+  auto& table_statistics = _cleanup_statistics[table_name];
+  table_statistics.logically_deleted_chunks += statistics.logically_deleted_chunks;
+  table_statistics.failed_logical_deletes += statistics.failed_logical_deletes;
+  table_statistics.removed_invalid_rows += statistics.removed_invalid_rows;
 }
 
 /**
- * This function processes the physical-delete-queue until its empty.
+ * This function processes the physical-delete-queue until it reaches a chunk that might still be used.
  */
 void MvccDeletePlugin::_physical_delete_loop() {
+  {
+    // Free the full-length vectors of compacted MvccData once all transactions that might still read them are done.
+    std::unique_lock<std::mutex> lock(_mutex_compacted_mvcc_data_queue);
+    const auto lowest_snapshot_commit_id = Hyrise::get().transaction_manager.get_lowest_active_snapshot_commit_id();
+    while (!_compacted_mvcc_data_queue.empty()) {
+      const auto& [mvcc_data, compaction_commit_id] = _compacted_mvcc_data_queue.front();
+      if (lowest_snapshot_commit_id && *lowest_snapshot_commit_id <= compaction_commit_id) break;
+
+      mvcc_data->free_uncompacted_data();
+      _compacted_mvcc_data_queue.pop();
+    }
+  }
+
   std::unique_lock<std::mutex> lock(_mutex_physical_delete_queue);
 
-  if (!_physical_delete_queue.empty()) {
-    TableAndChunkID table_and_chunk_id = _physical_delete_queue.front();
-    const auto& table = table_and_chunk_id.first;
-    const auto& chunk = table->get_chunk(table_and_chunk_id.second);
+  while (!_physical_delete_queue.empty()) {
+    const auto& [table_name, table, chunk_id] = _physical_delete_queue.front();
+    const auto& chunk = table->get_chunk(chunk_id);
 
     DebugAssert(chunk != nullptr, "Chunk does not exist. Physical Delete can not be applied.");
+    DebugAssert(chunk->get_cleanup_commit_id(), "Chunk needs to be deleted logically before deleting it physically.");
 
-    if (chunk->get_cleanup_commit_id().has_value()) {
-      // Check whether there are still active transactions that might use the chunk
-      bool conflicting_transactions = false;
-      auto lowest_snapshot_commit_id = Hyrise::get().transaction_manager.get_lowest_active_snapshot_commit_id();
+    // Check whether there are still active transactions that might use the chunk. As chunks are queued (roughly) in
+    // the order of their cleanup commit ids, the following chunks are most likely still in use as well.
+    const auto lowest_snapshot_commit_id = Hyrise::get().transaction_manager.get_lowest_active_snapshot_commit_id();
+    if (lowest_snapshot_commit_id && *chunk->get_cleanup_commit_id() > *lowest_snapshot_commit_id) break;
 
-      if (lowest_snapshot_commit_id.has_value()) {
-        conflicting_transactions = chunk->get_cleanup_commit_id().value() > lowest_snapshot_commit_id.value();
-      }
+    const auto chunk_memory = chunk->memory_usage(MemoryUsageCalculationMode::Sampled);
+    _delete_chunk_physically(table, chunk_id);
 
-      if (!conflicting_transactions) {
-        _delete_chunk_physically(table, table_and_chunk_id.second);
-        _physical_delete_queue.pop();
-      }
+    {
+      std::lock_guard<std::mutex> statistics_lock(_mutex_cleanup_statistics);
+      auto& table_statistics = _cleanup_statistics[table_name];
+      ++table_statistics.physically_deleted_chunks;
+      table_statistics.saved_memory_bytes += chunk_memory;
     }
+
+    _physical_delete_queue.pop();
   }
 }
 
@@ -181,6 +309,72 @@ void MvccDeletePlugin::_delete_chunk_physically(const std::shared_ptr<Table>& ta
   table->remove_chunk(chunk_id);
 }
 
+bool MvccDeletePlugin::_try_compact_mvcc_data(const std::shared_ptr<Chunk>& chunk) {
+  const auto& mvcc_data = chunk->mvcc_data();
+  if (chunk->is_mutable() || !mvcc_data->max_begin_cid || mvcc_data->is_compact()) return false;
+
+  // All rows must be visible as inserted to every active transaction. Transactions that start later have a snapshot
+  // commit id of at least the current last commit id.
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+  const auto lowest_snapshot_commit_id = transaction_manager.get_lowest_active_snapshot_commit_id();
+  const auto snapshot_commit_id_bound = lowest_snapshot_commit_id.value_or(transaction_manager.last_commit_id());
+  if (*mvcc_data->max_begin_cid > snapshot_commit_id_bound) return false;
+
+  mvcc_data->compact();
+  return true;
+}
+
+double MvccDeletePlugin::_validation_cost(const Chunk& chunk) {
+  const auto chunk_size = chunk.size();
+  if (chunk_size == 0) return 0.0;
+
+  auto max_segment_access_count = uint64_t{0};
+  const auto column_count = chunk.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto& access_counter = chunk.get_segment(column_id)->access_counter;
+    const auto segment_access_count =
+        access_counter[SegmentAccessCounter::AccessType::Point] +
+        access_counter[SegmentAccessCounter::AccessType::Sequential] +
+        access_counter[SegmentAccessCounter::AccessType::Monotonic] +
+        access_counter[SegmentAccessCounter::AccessType::Random];
+    max_segment_access_count = std::max(max_segment_access_count, segment_access_count);
+  }
+
+  // Chunks that have never been scanned are still ordered by their number of invalidated rows
+  const auto scan_count = 1.0 + static_cast<double>(max_segment_access_count) / static_cast<double>(chunk_size);
+  return static_cast<double>(chunk.invalid_row_count()) * scan_count;
+}
+
+MvccDeletePlugin::StatisticsTable::StatisticsTable(const MvccDeletePlugin& plugin)
+    : AbstractMetaTable(TableColumnDefinitions{{"table_name", DataType::String, false},
+                                               {"logically_deleted_chunks", DataType::Long, false},
+                                               {"failed_logical_deletes", DataType::Long, false},
+                                               {"physically_deleted_chunks", DataType::Long, false},
+                                               {"compacted_mvcc_data", DataType::Long, false},
+                                               {"removed_invalid_rows", DataType::Long, false},
+                                               {"saved_memory_bytes", DataType::Long, false}}),
+      _plugin(plugin) {}
+
+const std::string& MvccDeletePlugin::StatisticsTable::name() const {
+  static const auto name = std::string{"mvcc_delete_plugin"};
+  return name;
+}
+
+std::shared_ptr<Table> MvccDeletePlugin::StatisticsTable::_on_generate() const {
+  auto output_table = std::make_shared<Table>(_column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  for (const auto& [table_name, statistics] : _plugin.cleanup_statistics()) {
+    output_table->append({pmr_string{table_name}, static_cast<int64_t>(statistics.logically_deleted_chunks),
+                          static_cast<int64_t>(statistics.failed_logical_deletes),
+                          static_cast<int64_t>(statistics.physically_deleted_chunks),
+                          static_cast<int64_t>(statistics.compacted_mvcc_data),
+                          static_cast<int64_t>(statistics.removed_invalid_rows),
+                          static_cast<int64_t>(statistics.saved_memory_bytes)});
+  }
+
+  return output_table;
+}
+
 EXPORT_PLUGIN(MvccDeletePlugin)
 
 }  // namespace opossum
@@ -1,16 +1,24 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
+#include <functional>
+#include <map>
 #include <mutex>
 #include <numeric>
 #include <queue>
+#include <sstream>
 #include <thread>
 
+#include <boost/lexical_cast.hpp>
+
 #include "gtest/gtest_prod.h"
 #include "hyrise.hpp"
 #include "storage/chunk.hpp"
 #include "utils/abstract_plugin.hpp"
+#include "utils/meta_tables/abstract_meta_table.hpp"
 #include "utils/pausable_loop_thread.hpp"
+#include "utils/settings/abstract_setting.hpp"
 #include "utils/singleton.hpp"
 
 namespace opossum {
@@ -26,12 +34,21 @@ namespace opossum {
  * recognizing chunks with high numbers of invalidated rows and fully invalidates them.
  * The physical delete checks if chunks are not visible anymore for other transactions and
  * removes the chunk from the table completely.
+ * Chunks whose invalidated rows cause the highest validation cost (i.e., invalidated rows times the number of scans
+ * that touched the chunk, see _validation_cost()) are cleaned up first. Different tables are cleaned up in parallel
+ * using the scheduler. The thresholds and delays can be changed through the settings meta table, the work done by the
+ * plugin is published in the meta table meta_mvcc_delete_plugin.
+ * Additionally, the plugin compacts the MvccData of immutable chunks whose rows are visible to all active
+ * transactions (see MvccData::compact()). The full-length MVCC vectors of these chunks are freed by the physical delete
+ * loop once no transaction that started before the compaction is active anymore.
  */
 class MvccDeletePlugin : public AbstractPlugin {
   friend class MvccDeletePluginTest;
   friend class MvccDeletePluginSystemTest;
 
  public:
+  MvccDeletePlugin();
+
   std::string description() const final;
 
   void start() final;
@@ -39,32 +56,131 @@ class MvccDeletePlugin : public AbstractPlugin {
   void stop() final;
 
   /**
-   * DELETE_THRESHOLD_PERCENTAGE_INVALIDATED_ROWS: the percentage of invalidated rows
-   * in chunk to be deleted logically by the plugin.
-   * DELETE_THRESHOLD_LAST_COMMIT: the number of commits that must have passed since
+   * Default values of the plugin's settings (named MvccDeletePlugin.<setting>):
+   * DELETE_THRESHOLD_PERCENTAGE_INVALIDATED_ROWS (delete_threshold_invalidated_rows): the percentage of invalidated
+   * rows in chunk to be deleted logically by the plugin.
+   * DELETE_THRESHOLD_LAST_COMMIT (delete_threshold_last_commit): the number of commits that must have passed since
    * the candidate chunk was last modified
-   * IDLE_DELAY_LOGICAL_DELETE: sleep after execution of logical delete
-   * IDLE_DELAY_PHYSICAL_DELETE: sleep after execution of physical delete
+   * IDLE_DELAY_LOGICAL_DELETE (idle_delay_logical_delete_ms): sleep after execution of logical delete
+   * IDLE_DELAY_PHYSICAL_DELETE (idle_delay_physical_delete_ms): sleep after execution of physical delete
    */
   constexpr static double DELETE_THRESHOLD_PERCENTAGE_INVALIDATED_ROWS = 0.6;
   constexpr static CommitID DELETE_THRESHOLD_LAST_COMMIT = CommitID{100};
   constexpr static std::chrono::milliseconds IDLE_DELAY_LOGICAL_DELETE = std::chrono::milliseconds(1000);
   constexpr static std::chrono::milliseconds IDLE_DELAY_PHYSICAL_DELETE = std::chrono::milliseconds(1000);
 
+  // Work done by the plugin for a single table since the plugin was loaded
+  struct CleanupStatistics {
+    size_t logically_deleted_chunks{0};
+    size_t failed_logical_deletes{0};
+    size_t physically_deleted_chunks{0};
+    size_t compacted_mvcc_data{0};
+    size_t removed_invalid_rows{0};
+    size_t saved_memory_bytes{0};
+  };
+
+  std::map<std::string, CleanupStatistics> cleanup_statistics() const;
+
  private:
-  using TableAndChunkID = std::pair<const std::shared_ptr<Table>, ChunkID>;
+  // A numeric setting whose value can be read concurrently to it being changed through the settings meta table. Only
+  // the typed value is stored (atomically), its string representation is built when it is requested.
+  template <typename T>
+  class Setting : public AbstractSetting {
+   public:
+    Setting(const std::string& init_name, const std::string& description, const T default_value, const T min_value,
+            const std::function<void(T)>& on_change = {})
+        : AbstractSetting(init_name),
+          _description(description),
+          _min_value(min_value),
+          _on_change(on_change),
+          _value(default_value) {}
+
+    const std::string& description() const final { return _description; }
+
+    std::string get() final {
+      auto stream = std::ostringstream{};
+      stream << _value.load();
+      return stream.str();
+    }
+
+    void set(const std::string& value) final {
+      auto new_value = T{};
+      try {
+        new_value = boost::lexical_cast<T>(value);
+      } catch (const boost::bad_lexical_cast&) {
+        AssertInput(false, "Cannot convert '" + value + "' for setting " + name);
+      }
+      AssertInput(new_value >= _min_value, "Value of setting " + name + " is too small");
+
+      _value = new_value;
+      if (_on_change) _on_change(new_value);
+    }
+
+    T value() const { return _value.load(); }
+
+   private:
+    const std::string _description;
+    const T _min_value;
+    const std::function<void(T)> _on_change;
+    std::atomic<T> _value;
+  };
+
+  // Publishes the cleanup statistics as meta_mvcc_delete_plugin
+  class StatisticsTable : public AbstractMetaTable {
+   public:
+    explicit StatisticsTable(const MvccDeletePlugin& plugin);
+
+    const std::string& name() const final;
+
+   protected:
+    std::shared_ptr<Table> _on_generate() const final;
+
+    const MvccDeletePlugin& _plugin;
+  };
+
+  struct PhysicalDeleteCandidate {
+    std::string table_name;
+    std::shared_ptr<Table> table;
+    ChunkID chunk_id;
+  };
+
+  using MvccDataAndCommitID = std::pair<const std::shared_ptr<MvccData>, CommitID>;
 
   void _logical_delete_loop();
   void _physical_delete_loop();
 
+  // Deletes the given chunks of a table logically, the most expensive ones first. Called from a JobTask per table.
+  void _clean_up_table(const std::string& table_name, const std::shared_ptr<Table>& table,
+                       const std::vector<ChunkID>& chunk_ids);
+
   static bool _try_logical_delete(const std::string& table_name, ChunkID chunk_id,
                                   const std::shared_ptr<TransactionContext>& transaction_context);
   static void _delete_chunk_physically(const std::shared_ptr<Table>& table, ChunkID chunk_id);
+  static bool _try_compact_mvcc_data(const std::shared_ptr<Chunk>& chunk);
+
+  // Estimates the cost that the invalidated rows of a chunk cause in Validate as the number of invalidated rows times
+  // the number of scans of the chunk. The number of scans is approximated by the accesses of the most accessed
+  // segment, divided by the chunk size.
+  static double _validation_cost(const Chunk& chunk);
+
+  std::shared_ptr<Setting<double>> _delete_threshold_invalidated_rows;
+  std::shared_ptr<Setting<CommitID>> _delete_threshold_last_commit;
+  std::shared_ptr<Setting<uint64_t>> _idle_delay_logical_delete;
+  std::shared_ptr<Setting<uint64_t>> _idle_delay_physical_delete;
+
+  std::shared_ptr<StatisticsTable> _statistics_table;
 
   std::unique_ptr<PausableLoopThread> _loop_thread_logical_delete, _loop_thread_physical_delete;
 
   std::mutex _mutex_physical_delete_queue;
-  std::queue<TableAndChunkID> _physical_delete_queue;
+  std::queue<PhysicalDeleteCandidate> _physical_delete_queue;
+
+  // Compacted MvccData together with the last commit id at the time of its compaction
+  std::mutex _mutex_compacted_mvcc_data_queue;
+  std::queue<MvccDataAndCommitID> _compacted_mvcc_data_queue;
+
+  mutable std::mutex _mutex_cleanup_statistics;
+  std::map<std::string, CleanupStatistics> _cleanup_statistics;
 };
 
 }  // namespace opossum
@@ -58,6 +58,10 @@ TEST_F(AggregateNodeTest, Description) {
   auto description = _aggregate_node->description();
 
   EXPECT_EQ(description, "[Aggregate] GroupBy: [a, c] Aggregates: [SUM(a + b), SUM(a + c)]");
+
+  _aggregate_node->is_group_join = true;
+  EXPECT_EQ(_aggregate_node->description(),
+            "[Aggregate] (GroupJoin) GroupBy: [a, c] Aggregates: [SUM(a + b), SUM(a + c)]");
 }
 
 TEST_F(AggregateNodeTest, HashingAndEqualityCheck) {
@@ -77,11 +81,15 @@ TEST_F(AggregateNodeTest, HashingAndEqualityCheck) {
       expression_vector(_a, _c), expression_vector(sum_(add_(_a, _b)), sum_(add_(_a, _c)), min_(_a)), _mock_node);
   const auto different_aggregate_node_d = AggregateNode::make(
       expression_vector(_a, _a), expression_vector(sum_(add_(_a, _b)), sum_(add_(_a, _c))), _mock_node);
+  const auto different_aggregate_node_e = AggregateNode::make(
+      expression_vector(_a, _c), expression_vector(sum_(add_(_a, _b)), sum_(add_(_a, _c))), _mock_node);
+  different_aggregate_node_e->is_group_join = true;
 
   EXPECT_NE(*_aggregate_node, *different_aggregate_node_a);
   EXPECT_NE(*_aggregate_node, *different_aggregate_node_b);
   EXPECT_NE(*_aggregate_node, *different_aggregate_node_c);
   EXPECT_NE(*_aggregate_node, *different_aggregate_node_d);
+  EXPECT_NE(*_aggregate_node, *different_aggregate_node_e);
 
   EXPECT_NE(_aggregate_node->hash(), different_aggregate_node_a->hash());
   // _aggregate_node and different_aggregate_node_b are known to conflict because we do not recurse deep enough to
@@ -89,12 +97,16 @@ TEST_F(AggregateNodeTest, HashingAndEqualityCheck) {
   // the two nodes as non-equal.
   EXPECT_NE(_aggregate_node->hash(), different_aggregate_node_c->hash());
   EXPECT_NE(_aggregate_node->hash(), different_aggregate_node_d->hash());
+  EXPECT_NE(_aggregate_node->hash(), different_aggregate_node_e->hash());
 }
 
 TEST_F(AggregateNodeTest, Copy) {
   const auto same_aggregate_node = AggregateNode::make(
       expression_vector(_a, _c), expression_vector(sum_(add_(_a, _b)), sum_(add_(_a, _c))), _mock_node);
   EXPECT_EQ(*_aggregate_node->deep_copy(), *same_aggregate_node);
+
+  _aggregate_node->is_group_join = true;
+  EXPECT_TRUE(std::static_pointer_cast<AggregateNode>(_aggregate_node->deep_copy())->is_group_join);
 }
 
 TEST_F(AggregateNodeTest, UniqueConstraintsAdd) {
@@ -17,7 +17,12 @@ class LimitNodeTest : public BaseTest {
   std::shared_ptr<LimitNode> _limit_node;
 };
 
-TEST_F(LimitNodeTest, Description) { EXPECT_EQ(_limit_node->description(), "[Limit] 10"); }
+TEST_F(LimitNodeTest, Description) {
+  EXPECT_EQ(_limit_node->description(), "[Limit] 10");
+
+  _limit_node->is_top_k = true;
+  EXPECT_EQ(_limit_node->description(), "[Limit] (TopK) 10");
+}
 
 TEST_F(LimitNodeTest, HashingAndEqualityCheck) {
   EXPECT_EQ(*_limit_node, *_limit_node);
@@ -26,9 +31,19 @@ TEST_F(LimitNodeTest, HashingAndEqualityCheck) {
 
   EXPECT_EQ(LimitNode::make(value_(10))->hash(), _limit_node->hash());
   EXPECT_NE(LimitNode::make(value_(11))->hash(), _limit_node->hash());
+
+  const auto top_k_limit_node = LimitNode::make(value_(10));
+  top_k_limit_node->is_top_k = true;
+  EXPECT_NE(*top_k_limit_node, *_limit_node);
+  EXPECT_NE(top_k_limit_node->hash(), _limit_node->hash());
 }
 
-TEST_F(LimitNodeTest, Copy) { EXPECT_EQ(*_limit_node->deep_copy(), *_limit_node); }
+TEST_F(LimitNodeTest, Copy) {
+  EXPECT_EQ(*_limit_node->deep_copy(), *_limit_node);
+
+  _limit_node->is_top_k = true;
+  EXPECT_TRUE(std::static_pointer_cast<LimitNode>(_limit_node->deep_copy())->is_top_k);
+}
 
 TEST_F(LimitNodeTest, NodeExpressions) {
   ASSERT_EQ(_limit_node->node_expressions.size(), 1u);
@@ -20,8 +20,10 @@
 #include "logical_query_plan/create_table_node.hpp"
 #include "logical_query_plan/drop_table_node.hpp"
 #include "logical_query_plan/dummy_table_node.hpp"
+#include "logical_query_plan/except_node.hpp"
 #include "logical_query_plan/export_node.hpp"
 #include "logical_query_plan/import_node.hpp"
+#include "logical_query_plan/intersect_node.hpp"
 #include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/limit_node.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
@@ -47,6 +49,7 @@
 #include "operators/maintenance/drop_table.hpp"
 #include "operators/product.hpp"
 #include "operators/projection.hpp"
+#include "operators/set_operation_hash.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
@@ -57,6 +60,7 @@
 #include "storage/prepared_plan.hpp"
 #include "storage/table.hpp"
 #include "utils/load_table.hpp"
+#include "utils/settings/operator_memory_budget_setting.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
 
@@ -340,6 +344,28 @@ TEST_F(LQPTranslatorTest, Sort) {
   ASSERT_TRUE(get_table);
 }
 
+TEST_F(LQPTranslatorTest, SortWithMemoryBudget) {
+  // Three chunks of one row each, which are sorted in separate runs by the external sort
+  const auto int_float_chunked_node = StoredTableNode::make("int_float_chunked");
+  const auto lqp = SortNode::make(expression_vector(int_float_chunked_node->get_column("a")),
+                                  std::vector<SortMode>{SortMode::Ascending}, int_float_chunked_node);
+
+  const auto in_memory_sort = std::dynamic_pointer_cast<Sort>(LQPTranslator{}.translate_node(lqp));
+  ASSERT_TRUE(in_memory_sort);
+  EXPECT_EQ(in_memory_sort->description(DescriptionMode::SingleLine), "Sort");
+
+  // The budget is taken from the OperatorMemoryBudgetSetting
+  Hyrise::get().settings_manager.get_setting(OperatorMemoryBudgetSetting::NAME)->set("16");
+  const auto external_sort = std::dynamic_pointer_cast<Sort>(LQPTranslator{}.translate_node(lqp));
+  ASSERT_TRUE(external_sort);
+  EXPECT_EQ(external_sort->description(DescriptionMode::SingleLine), "Sort Memory budget: 16 bytes");
+
+  execute_all({in_memory_sort->mutable_left_input(), in_memory_sort, external_sort->mutable_left_input(),
+               external_sort});
+  EXPECT_TABLE_EQ_ORDERED(external_sort->get_output(), in_memory_sort->get_output());
+  EXPECT_GT(static_cast<const Sort::PerformanceData&>(*external_sort->performance_data).spilled_run_count, 1u);
+}
+
 TEST_F(LQPTranslatorTest, LimitLiteral) {
   /**
    * Build LQP and translate to PQP
@@ -364,6 +390,54 @@ TEST_F(LQPTranslatorTest, LimitLiteral) {
   EXPECT_EQ(get_table->table_name(), "table_int_float");
 }
 
+TEST_F(LQPTranslatorTest, LimitGivesOutputRowBudgets) {
+  /**
+   * LQP resembles:
+   *   SELECT a + b FROM int_float WHERE a > 5 LIMIT 2
+   */
+  // clang-format off
+  const auto lqp =
+  LimitNode::make(value_(2),
+    ProjectionNode::make(expression_vector(add_(int_float_a, int_float_b)),
+      PredicateNode::make(greater_than_(int_float_a, 5),
+        int_float_node)));
+  // clang-format on
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  // The TableScan filters rows, so that its input (i.e., the GetTable) has to be scanned entirely
+  const auto projection = pqp->mutable_left_input();
+  ASSERT_EQ(projection->type(), OperatorType::Projection);
+  EXPECT_EQ(projection->output_row_budget(), 2u);
+  const auto table_scan = projection->mutable_left_input();
+  ASSERT_EQ(table_scan->type(), OperatorType::TableScan);
+  EXPECT_EQ(table_scan->output_row_budget(), 2u);
+  EXPECT_FALSE(table_scan->left_input()->output_row_budget());
+}
+
+TEST_F(LQPTranslatorTest, LimitDoesNotGiveOutputRowBudgetsToSharedOperators) {
+  /**
+   * The TableScan is consumed by both the Projection below the Limit and the UnionAll, which needs all of its rows.
+   */
+  const auto predicate_node = PredicateNode::make(greater_than_(int_float_a, 5), int_float_node);
+
+  // clang-format off
+  const auto lqp =
+  UnionNode::make(SetOperationMode::All,
+    LimitNode::make(value_(2),
+      ProjectionNode::make(expression_vector(int_float_a, int_float_b),
+        predicate_node)),
+    predicate_node);
+  // clang-format on
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  const auto projection = pqp->left_input()->left_input();
+  ASSERT_EQ(projection->type(), OperatorType::Projection);
+  EXPECT_EQ(projection->output_row_budget(), 2u);
+  const auto table_scan = projection->left_input();
+  ASSERT_EQ(table_scan, pqp->right_input());
+  EXPECT_FALSE(table_scan->output_row_budget());
+}
+
 TEST_F(LQPTranslatorTest, PredicateNodeUnaryScan) {
   /**
    * Build LQP and translate to PQP
@@ -748,6 +822,49 @@ TEST_F(LQPTranslatorTest, LimitNode) {
   EXPECT_EQ(*limit_op->row_count_expression(), *value_(2));
 }
 
+TEST_F(LQPTranslatorTest, UnionNodeUniqueToSetOperationHash) {
+  const auto lqp = UnionNode::make(SetOperationMode::Unique, int_float_node, int_float2_node);
+  const auto op = LQPTranslator{}.translate_node(lqp);
+
+  const auto set_operation_op = std::dynamic_pointer_cast<SetOperationHash>(op);
+  ASSERT_TRUE(set_operation_op);
+  EXPECT_EQ(set_operation_op->set_operation(), SetOperation::Union);
+  EXPECT_EQ(set_operation_op->left_input()->type(), OperatorType::GetTable);
+  EXPECT_EQ(set_operation_op->right_input()->type(), OperatorType::GetTable);
+}
+
+TEST_F(LQPTranslatorTest, IntersectNodeToSetOperationHash) {
+  const auto lqp = IntersectNode::make(SetOperationMode::Unique, int_float_node, int_float2_node);
+  const auto op = LQPTranslator{}.translate_node(lqp);
+
+  const auto set_operation_op = std::dynamic_pointer_cast<SetOperationHash>(op);
+  ASSERT_TRUE(set_operation_op);
+  EXPECT_EQ(set_operation_op->set_operation(), SetOperation::Intersect);
+  EXPECT_EQ(set_operation_op->left_input()->type(), OperatorType::GetTable);
+  EXPECT_EQ(set_operation_op->right_input()->type(), OperatorType::GetTable);
+
+  // INTERSECT ALL is not supported
+  EXPECT_THROW(LQPTranslator{}.translate_node(IntersectNode::make(SetOperationMode::All, int_float_node,
+                                                                  int_float2_node)),
+               InvalidInputException);
+}
+
+TEST_F(LQPTranslatorTest, ExceptNodeToSetOperationHash) {
+  const auto lqp = ExceptNode::make(SetOperationMode::Unique, int_float_node, int_float2_node);
+  const auto op = LQPTranslator{}.translate_node(lqp);
+
+  const auto set_operation_op = std::dynamic_pointer_cast<SetOperationHash>(op);
+  ASSERT_TRUE(set_operation_op);
+  EXPECT_EQ(set_operation_op->set_operation(), SetOperation::Except);
+  EXPECT_EQ(set_operation_op->left_input()->type(), OperatorType::GetTable);
+  EXPECT_EQ(set_operation_op->right_input()->type(), OperatorType::GetTable);
+
+  // EXCEPT ALL is not supported
+  EXPECT_THROW(LQPTranslator{}.translate_node(ExceptNode::make(SetOperationMode::All, int_float_node,
+                                                               int_float2_node)),
+               InvalidInputException);
+}
+
 TEST_F(LQPTranslatorTest, DiamondShapeSimple) {
   /**
    * Test that
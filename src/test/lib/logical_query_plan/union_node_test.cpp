@@ -230,4 +230,13 @@ TEST_F(UnionNodeTest, UniqueConstraintsUnionPositionsInvalidInput) {
   EXPECT_THROW(_union_node->unique_constraints(), std::logic_error);
 }
 
+TEST_F(UnionNodeTest, UniqueConstraintsUnionUnique) {
+  const auto key_constraint_b = TableKeyConstraint{{ColumnID{2}}, KeyConstraintType::UNIQUE};
+  _mock_node1->set_key_constraints({key_constraint_b});
+
+  // The rows of the right input might have the same values as those of the left input, so that no constraint remains
+  const auto union_unique_node = UnionNode::make(SetOperationMode::Unique, _mock_node1, _mock_node1);
+  EXPECT_TRUE(union_unique_node->unique_constraints()->empty());
+}
+
 }  // namespace opossum
@@ -0,0 +1,98 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "expression/window_function_expression.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/window_node.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class WindowNodeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    Hyrise::get().storage_manager.add_table("table_a", load_table("resources/test_data/tbl/window/input.tbl"));
+
+    _table_node = StoredTableNode::make("table_a");
+    _a = _table_node->get_column("a");
+    _b = _table_node->get_column("b");
+    _c = _table_node->get_column("c");
+
+    // ROW_NUMBER() OVER (PARTITION BY a ORDER BY c)
+    _row_number = std::make_shared<WindowFunctionExpression>(WindowFunction::RowNumber, nullptr, expression_vector(_a),
+                                                             expression_vector(_c),
+                                                             std::vector<SortMode>{SortMode::Ascending});
+    // SUM(b) OVER (ORDER BY c ROWS BETWEEN 1 PRECEDING AND CURRENT ROW)
+    _sum = std::make_shared<WindowFunctionExpression>(
+        WindowFunction::Sum, _b, std::vector<std::shared_ptr<AbstractExpression>>{}, expression_vector(_c),
+        std::vector<SortMode>{SortMode::Ascending}, WindowFrame{WindowFrameType::Rows, 1, 0});
+
+    _window_node = WindowNode::make(_row_number, _table_node);
+  }
+
+  std::shared_ptr<StoredTableNode> _table_node;
+  std::shared_ptr<LQPColumnExpression> _a, _b, _c;
+  std::shared_ptr<WindowFunctionExpression> _row_number, _sum;
+  std::shared_ptr<WindowNode> _window_node;
+};
+
+TEST_F(WindowNodeTest, Description) {
+  EXPECT_EQ(_window_node->description(), "[Window] ROW_NUMBER() OVER (PARTITION BY a ORDER BY c Ascending)");
+
+  const auto sum_node = WindowNode::make(_sum, _table_node);
+  EXPECT_EQ(sum_node->description(),
+            "[Window] SUM(b) OVER (ORDER BY c Ascending ROWS BETWEEN 1 PRECEDING AND CURRENT ROW)");
+}
+
+TEST_F(WindowNodeTest, OutputExpressions) {
+  const auto& output_expressions = _window_node->output_expressions();
+  ASSERT_EQ(output_expressions.size(), 4u);
+  EXPECT_EQ(*output_expressions.at(0), *_a);
+  EXPECT_EQ(*output_expressions.at(1), *_b);
+  EXPECT_EQ(*output_expressions.at(2), *_c);
+  EXPECT_EQ(*output_expressions.at(3), *_row_number);
+}
+
+TEST_F(WindowNodeTest, IsColumnNullable) {
+  EXPECT_FALSE(_window_node->is_column_nullable(ColumnID{0}));
+  EXPECT_TRUE(_window_node->is_column_nullable(ColumnID{1}));
+  EXPECT_FALSE(_window_node->is_column_nullable(ColumnID{3}));
+
+  // SUM() is NULL if its frame only contains NULLs
+  EXPECT_TRUE(WindowNode::make(_sum, _table_node)->is_column_nullable(ColumnID{3}));
+}
+
+TEST_F(WindowNodeTest, HashingAndEqualityCheck) {
+  const auto same_window_node = WindowNode::make(_row_number->deep_copy(), _table_node);
+  const auto sum_node = WindowNode::make(_sum, _table_node);
+  const auto rank_node = WindowNode::make(
+      std::make_shared<WindowFunctionExpression>(WindowFunction::Rank, nullptr, expression_vector(_a),
+                                                 expression_vector(_c), std::vector<SortMode>{SortMode::Ascending}),
+      _table_node);
+  const auto descending_node = WindowNode::make(
+      std::make_shared<WindowFunctionExpression>(WindowFunction::RowNumber, nullptr, expression_vector(_a),
+                                                 expression_vector(_c), std::vector<SortMode>{SortMode::Descending}),
+      _table_node);
+
+  EXPECT_EQ(*_window_node, *same_window_node);
+  EXPECT_NE(*_window_node, *sum_node);
+  EXPECT_NE(*_window_node, *rank_node);
+  EXPECT_NE(*_window_node, *descending_node);
+
+  EXPECT_EQ(_window_node->hash(), same_window_node->hash());
+  EXPECT_NE(_window_node->hash(), rank_node->hash());
+  EXPECT_NE(_window_node->hash(), descending_node->hash());
+}
+
+TEST_F(WindowNodeTest, Copy) { EXPECT_EQ(*_window_node->deep_copy(), *_window_node); }
+
+TEST_F(WindowNodeTest, NodeExpressions) {
+  ASSERT_EQ(_window_node->node_expressions.size(), 1u);
+  EXPECT_EQ(*_window_node->node_expressions.at(0), *_row_number);
+}
+
+}  // namespace opossum
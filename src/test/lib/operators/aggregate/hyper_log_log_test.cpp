@@ -0,0 +1,89 @@
+#include <cmath>
+#include <functional>
+#include <sstream>
+#include <tuple>
+
+#include "base_test.hpp"
+
+#include "operators/aggregate/hyper_log_log.hpp"
+
+namespace opossum {
+
+class HyperLogLogTest : public BaseTest {
+ protected:
+  static void add_values(HyperLogLog& sketch, const int64_t begin, const int64_t end) {
+    for (auto value = begin; value < end; ++value) {
+      sketch.add(std::hash<int64_t>{}(value));
+    }
+  }
+};
+
+TEST_F(HyperLogLogTest, InvalidPrecision) {
+  EXPECT_THROW(HyperLogLog{HyperLogLog::MIN_PRECISION - 1}, std::logic_error);
+  EXPECT_THROW(HyperLogLog{HyperLogLog::MAX_PRECISION + 1}, std::logic_error);
+  EXPECT_NO_THROW(HyperLogLog{HyperLogLog::MIN_PRECISION});
+}
+
+TEST_F(HyperLogLogTest, SmallCardinalities) {
+  auto sketch = HyperLogLog{};
+  EXPECT_EQ(sketch.estimate(), 0u);
+
+  // Duplicates do not change the sketch, and few distinct values are estimated exactly
+  add_values(sketch, 0, 10);
+  add_values(sketch, 0, 10);
+  EXPECT_EQ(sketch.estimate(), 10u);
+  EXPECT_FALSE(sketch.is_dense());
+
+  sketch.clear();
+  EXPECT_EQ(sketch.estimate(), 0u);
+}
+
+TEST_F(HyperLogLogTest, LargeCardinalities) {
+  for (const auto precision : {uint8_t{10}, HyperLogLog::DEFAULT_PRECISION}) {
+    auto sketch = HyperLogLog{precision};
+    add_values(sketch, 0, 200'000);
+    EXPECT_TRUE(sketch.is_dense());
+
+    // Allow four times the standard error of 1.04 / sqrt(2^precision)
+    const auto relative_error = 4 * 1.04 / std::sqrt(static_cast<double>(size_t{1} << precision));
+    EXPECT_NEAR(static_cast<double>(sketch.estimate()), 200'000.0, 200'000.0 * relative_error);
+  }
+}
+
+TEST_F(HyperLogLogTest, Merge) {
+  // Sparse into sparse, sparse into dense, and dense into sparse sketches. The value ranges overlap.
+  for (const auto& [first_end, second_begin, second_end] :
+       {std::tuple{50, 25, 100}, std::tuple{50'000, 49'990, 50'100}, std::tuple{50, 25, 50'000}}) {
+    auto single_sketch = HyperLogLog{};
+    add_values(single_sketch, 0, second_end);
+
+    auto first_sketch = HyperLogLog{};
+    auto second_sketch = HyperLogLog{};
+    add_values(first_sketch, 0, first_end);
+    add_values(second_sketch, second_begin, second_end);
+    first_sketch.merge(second_sketch);
+
+    // The merged sketch is the sketch of the union
+    EXPECT_EQ(first_sketch.estimate(), single_sketch.estimate());
+    EXPECT_EQ(first_sketch.is_dense(), single_sketch.is_dense());
+  }
+
+  EXPECT_THROW(HyperLogLog{10}.merge(HyperLogLog{12}), std::logic_error);
+}
+
+TEST_F(HyperLogLogTest, Serialization) {
+  for (const auto value_count : {0, 100, 100'000}) {
+    auto sketch = HyperLogLog{12};
+    add_values(sketch, 0, value_count);
+
+    auto stream = std::stringstream{};
+    sketch.write(stream);
+    const auto read_sketch = HyperLogLog::read(stream);
+
+    EXPECT_EQ(read_sketch.precision(), 12);
+    EXPECT_EQ(read_sketch.is_dense(), sketch.is_dense());
+    EXPECT_EQ(read_sketch.estimate(), sketch.estimate());
+  }
+}
+
+}  // namespace opossum
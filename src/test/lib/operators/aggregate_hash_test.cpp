@@ -0,0 +1,257 @@
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "operators/aggregate_hash.hpp"
+#include "operators/aggregate_sort.hpp"
+#include "operators/pqp_utils.hpp"
+#include "operators/table_wrapper.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "utils/settings/operator_memory_budget_setting.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+// The tests of both aggregate operators are in aggregate_test.cpp. The tests here cover the parallel aggregation of
+// AggregateHash, which is only used for larger inputs, its spilling under a memory budget, and the aggregation on
+// dictionary codes by comparing its results with those of AggregateSort.
+class OperatorsAggregateHashTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto table = create_table();
+    ASSERT_GE(table->row_count(), AggregateHash::PARALLEL_AGGREGATION_MIN_ROW_COUNT);
+    ASSERT_GT(table->get_chunk(ChunkID{0})->size(), AggregateHash::LOCAL_GROUP_CAPACITY);
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+
+    const auto encoded_table = create_table();
+    encoded_table->last_chunk()->finalize();
+    ChunkEncoder::encode_all_chunks(
+        encoded_table, ChunkEncodingSpec{SegmentEncodingSpec{EncodingType::Dictionary},
+                                         SegmentEncodingSpec{EncodingType::FixedStringDictionary},
+                                         SegmentEncodingSpec{EncodingType::Dictionary}});
+    _encoded_table_wrapper = std::make_shared<TableWrapper>(encoded_table);
+    _encoded_table_wrapper->execute();
+
+    _a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+    _b = pqp_column_(ColumnID{1}, DataType::String, false, "b");
+    _c = pqp_column_(ColumnID{2}, DataType::Int, true, "c");
+    _star = pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*");
+  }
+
+  // 5'000 groups in column a, whose rows are spread over all chunks. Each chunk contains more groups than a job of the
+  // parallel aggregation can pre-aggregate at once.
+  static std::shared_ptr<Table> create_table() {
+    const auto table = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, false}, {"c", DataType::Int, true}},
+        TableType::Data, ChunkOffset{2'500});
+    for (auto row_idx = int32_t{0}; row_idx < 25'000; ++row_idx) {
+      const auto c = row_idx % 13 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{row_idx % 97};
+      table->append({(row_idx * 7'919) % 5'000, pmr_string{std::to_string(row_idx % 3)}, c});
+    }
+    return table;
+  }
+
+  void test_against_aggregate_sort(const std::shared_ptr<AbstractOperator>& input,
+                                   const std::vector<std::shared_ptr<AggregateExpression>>& aggregates,
+                                   const std::vector<ColumnID>& groupby_column_ids,
+                                   const std::optional<size_t>& memory_budget = std::nullopt) {
+    const auto aggregate_hash = std::make_shared<AggregateHash>(input, aggregates, groupby_column_ids, memory_budget);
+    const auto aggregate_sort = std::make_shared<AggregateSort>(input, aggregates, groupby_column_ids);
+    aggregate_hash->execute();
+    aggregate_sort->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(aggregate_hash->get_output(), aggregate_sort->get_output());
+  }
+
+  static bool aggregated_on_dictionary_codes(const std::shared_ptr<AbstractOperator>& input,
+                                             const std::vector<ColumnID>& groupby_column_ids) {
+    const auto aggregate = std::make_shared<AggregateHash>(
+        input, std::vector<std::shared_ptr<AggregateExpression>>{}, groupby_column_ids);
+    aggregate->execute();
+    return static_cast<const AggregateHash::PerformanceData&>(*aggregate->performance_data)
+        .aggregated_on_dictionary_codes;
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper, _encoded_table_wrapper;
+  std::shared_ptr<PQPColumnExpression> _a, _b, _c, _star;
+};
+
+TEST_F(OperatorsAggregateHashTest, ParallelAggregation) {
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      min_(_c), max_(_c), sum_(_c), avg_(_c), count_(_c), count_(_star), min_(_b), max_(_b)};
+
+  test_against_aggregate_sort(_table_wrapper, aggregates, {ColumnID{0}});
+  test_against_aggregate_sort(_table_wrapper, aggregates, {ColumnID{1}, ColumnID{0}});
+  test_against_aggregate_sort(_table_wrapper, {sum_(_c)}, {ColumnID{2}, ColumnID{1}, ColumnID{0}});
+}
+
+TEST_F(OperatorsAggregateHashTest, ParallelAggregationOnReferenceSegments) {
+  const auto table_scan = create_table_scan(_table_wrapper, ColumnID{2}, PredicateCondition::GreaterThan, 10);
+  table_scan->execute();
+  ASSERT_GE(table_scan->get_output()->row_count(), AggregateHash::PARALLEL_AGGREGATION_MIN_ROW_COUNT);
+
+  test_against_aggregate_sort(table_scan, {max_(_c), count_(_star)}, {ColumnID{0}});
+}
+
+TEST_F(OperatorsAggregateHashTest, ParallelDistinct) {
+  test_against_aggregate_sort(_table_wrapper, {}, {ColumnID{0}});
+  test_against_aggregate_sort(_table_wrapper, {}, {ColumnID{1}, ColumnID{2}});
+}
+
+TEST_F(OperatorsAggregateHashTest, FunctionsWithoutParallelAggregation) {
+  // COUNT(DISTINCT) and STDDEV_SAMP are aggregated by a single thread, together with all other aggregates
+  test_against_aggregate_sort(_table_wrapper, {count_distinct_(_c), sum_(_c)}, {ColumnID{1}});
+  test_against_aggregate_sort(_table_wrapper, {standard_deviation_sample_(_c), min_(_c)}, {ColumnID{0}});
+}
+
+TEST_F(OperatorsAggregateHashTest, ApproxCountDistinct) {
+  // The sketches of the partial results are merged register-wise, which yields the same sketch (and estimate) as
+  // adding all values to a single sketch, as AggregateSort does.
+  const auto low_precision = std::make_shared<AggregateExpression>(AggregateFunction::ApproxCountDistinct, _a, 6);
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{approx_count_distinct_(_a),
+                                                                            approx_count_distinct_(_c), low_precision};
+
+  test_against_aggregate_sort(_table_wrapper, aggregates, {ColumnID{1}});
+  test_against_aggregate_sort(_table_wrapper, {approx_count_distinct_(_b), sum_(_c)}, {ColumnID{0}});
+  test_against_aggregate_sort(_table_wrapper, aggregates, {ColumnID{1}}, 200'000);
+  test_against_aggregate_sort(_encoded_table_wrapper, aggregates, {ColumnID{1}});
+
+  // 5'000 distinct values are estimated with an error of about 1%
+  const auto aggregate = std::make_shared<AggregateHash>(
+      _table_wrapper, std::vector<std::shared_ptr<AggregateExpression>>{approx_count_distinct_(_a)},
+      std::vector<ColumnID>{});
+  aggregate->execute();
+  const auto estimate = aggregate->get_output()->get_value<int64_t>(ColumnID{0}, 0);
+  ASSERT_TRUE(estimate);
+  EXPECT_NEAR(static_cast<double>(*estimate), 5'000.0, 150.0);
+}
+
+TEST_F(OperatorsAggregateHashTest, SpillingUnderMemoryBudget) {
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      min_(_c), max_(_c), sum_(_c), avg_(_c), count_(_c), count_(_star), min_(_b), max_(_b)};
+
+  test_against_aggregate_sort(_table_wrapper, aggregates, {ColumnID{0}}, 200'000);
+  test_against_aggregate_sort(_table_wrapper, aggregates, {ColumnID{1}, ColumnID{0}}, 200'000);
+  test_against_aggregate_sort(_table_wrapper, {sum_(_c)}, {ColumnID{2}, ColumnID{1}, ColumnID{0}}, 200'000);
+  test_against_aggregate_sort(_table_wrapper, {}, {ColumnID{1}, ColumnID{0}}, 200'000);
+
+  const auto aggregate = std::make_shared<AggregateHash>(_table_wrapper, aggregates,
+                                                         std::vector<ColumnID>{ColumnID{1}, ColumnID{0}}, 200'000);
+  aggregate->execute();
+  EXPECT_NE(aggregate->description(DescriptionMode::SingleLine).find("Memory budget: 200000 bytes"), std::string::npos);
+
+  const auto& performance_data = static_cast<const AggregateHash::PerformanceData&>(*aggregate->performance_data);
+  EXPECT_GT(performance_data.spill_file_count, 0u);
+  EXPECT_GT(performance_data.spilled_partial_result_count, 0u);
+  EXPECT_GT(performance_data.spilled_bytes, 0u);
+  EXPECT_GT(performance_data.merge_batch_count, 1u);
+  EXPECT_GT(performance_data.get_step_runtime(AggregateHash::OperatorSteps::Spilling).count(), 0);
+
+  auto stream = std::stringstream{};
+  stream << performance_data;
+  EXPECT_NE(stream.str().find("Spilled "), std::string::npos);
+
+  const auto copied_aggregate = aggregate->deep_copy();
+  EXPECT_EQ(copied_aggregate->description(DescriptionMode::SingleLine),
+            aggregate->description(DescriptionMode::SingleLine));
+}
+
+TEST_F(OperatorsAggregateHashTest, SpillingThroughSQL) {
+  Hyrise::get().storage_manager.add_table("aggregate_table", create_table());
+  const auto query = std::string{"SELECT b, a, SUM(c), COUNT(*) FROM aggregate_table GROUP BY b, a"};
+
+  auto in_memory_pipeline = SQLPipelineBuilder{query}.disable_mvcc().create_pipeline();
+  const auto [in_memory_status, in_memory_table] = in_memory_pipeline.get_result_table();
+  ASSERT_EQ(in_memory_status, SQLPipelineStatus::Success);
+
+  // The LQPTranslator passes the configured budget to the AggregateHash
+  Hyrise::get().settings_manager.get_setting(OperatorMemoryBudgetSetting::NAME)->set("200000");
+
+  auto spilling_pipeline = SQLPipelineBuilder{query}.disable_mvcc().create_pipeline();
+  const auto [spilling_status, spilling_table] = spilling_pipeline.get_result_table();
+  ASSERT_EQ(spilling_status, SQLPipelineStatus::Success);
+
+  auto aggregate = std::shared_ptr<const AggregateHash>{};
+  visit_pqp(spilling_pipeline.get_physical_plans().at(0), [&](const auto& op) {
+    if (op->type() == OperatorType::Aggregate) aggregate = std::dynamic_pointer_cast<const AggregateHash>(op);
+    return aggregate ? PQPVisitation::DoNotVisitInputs : PQPVisitation::VisitInputs;
+  });
+  ASSERT_TRUE(aggregate);
+  EXPECT_NE(aggregate->description(DescriptionMode::SingleLine).find("Memory budget: 200000 bytes"), std::string::npos);
+  EXPECT_GT(static_cast<const AggregateHash::PerformanceData&>(*aggregate->performance_data).spill_file_count, 0u);
+
+  EXPECT_TABLE_EQ_UNORDERED(spilling_table, in_memory_table);
+}
+
+TEST_F(OperatorsAggregateHashTest, NoSpillingWithinMemoryBudget) {
+  // Small inputs are aggregated by the parallel aggregation if a budget is given, but only spilled if they exceed it
+  const auto table_scan = create_table_scan(_table_wrapper, ColumnID{0}, PredicateCondition::LessThan, 10);
+  table_scan->execute();
+  ASSERT_LT(table_scan->get_output()->row_count(), AggregateHash::PARALLEL_AGGREGATION_MIN_ROW_COUNT);
+  test_against_aggregate_sort(table_scan, {sum_(_c), count_(_star)}, {ColumnID{0}}, 1'000'000);
+
+  const auto aggregate = std::make_shared<AggregateHash>(
+      _table_wrapper, std::vector<std::shared_ptr<AggregateExpression>>{sum_(_c)}, std::vector<ColumnID>{ColumnID{1}},
+      1'000'000'000);
+  aggregate->execute();
+
+  const auto& performance_data = static_cast<const AggregateHash::PerformanceData&>(*aggregate->performance_data);
+  EXPECT_EQ(performance_data.spill_file_count, 0u);
+  EXPECT_EQ(performance_data.merge_batch_count, 1u);
+  EXPECT_EQ(performance_data.get_step_runtime(AggregateHash::OperatorSteps::Spilling).count(), 0);
+}
+
+TEST_F(OperatorsAggregateHashTest, FunctionsWithoutSpilling) {
+  // COUNT(DISTINCT) and STDDEV_SAMP are aggregated in memory, ignoring the budget
+  test_against_aggregate_sort(_table_wrapper, {count_distinct_(_c), sum_(_c)}, {ColumnID{1}}, 200'000);
+}
+
+TEST_F(OperatorsAggregateHashTest, DictionaryCodes) {
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      min_(_c), max_(_c), sum_(_c), avg_(_c), count_(_c), count_(_star), min_(_b), max_(_b)};
+
+  // NULLs in column c form a group of their own
+  for (const auto& groupby_column_ids : std::vector<std::vector<ColumnID>>{
+           {ColumnID{1}}, {ColumnID{0}}, {ColumnID{2}, ColumnID{1}}, {ColumnID{0}, ColumnID{1}}}) {
+    EXPECT_TRUE(aggregated_on_dictionary_codes(_encoded_table_wrapper, groupby_column_ids));
+    test_against_aggregate_sort(_encoded_table_wrapper, aggregates, groupby_column_ids);
+    test_against_aggregate_sort(_encoded_table_wrapper, {}, groupby_column_ids);
+  }
+
+  // Unencoded columns and too many combinations of ValueIDs per chunk are aggregated on AggregateKeys
+  EXPECT_FALSE(aggregated_on_dictionary_codes(_table_wrapper, {ColumnID{1}}));
+  const auto too_many_codes = std::vector<ColumnID>{ColumnID{0}, ColumnID{2}, ColumnID{1}};
+  EXPECT_FALSE(aggregated_on_dictionary_codes(_encoded_table_wrapper, too_many_codes));
+  test_against_aggregate_sort(_encoded_table_wrapper, aggregates, too_many_codes);
+
+  // COUNT(DISTINCT) cannot be merged
+  test_against_aggregate_sort(_encoded_table_wrapper, {count_distinct_(_a), sum_(_c)}, {ColumnID{1}});
+}
+
+TEST_F(OperatorsAggregateHashTest, DictionaryCodesOnReferenceSegments) {
+  const auto table_scan = create_table_scan(_encoded_table_wrapper, ColumnID{2}, PredicateCondition::GreaterThan, 10);
+  table_scan->execute();
+
+  EXPECT_TRUE(aggregated_on_dictionary_codes(table_scan, {ColumnID{1}, ColumnID{2}}));
+  test_against_aggregate_sort(table_scan, {max_(_a), count_(_star)}, {ColumnID{1}, ColumnID{2}});
+  test_against_aggregate_sort(table_scan, {sum_(_c)}, {ColumnID{1}});
+
+  // After the scan, few enough values of column a remain in each chunk to group on all three columns
+  const auto small_a_scan = create_table_scan(_encoded_table_wrapper, ColumnID{0}, PredicateCondition::LessThan, 100);
+  small_a_scan->execute();
+  const auto groupby_column_ids = std::vector<ColumnID>{ColumnID{2}, ColumnID{0}, ColumnID{1}};
+  EXPECT_TRUE(aggregated_on_dictionary_codes(small_a_scan, groupby_column_ids));
+  test_against_aggregate_sort(small_a_scan, {min_(_b), avg_(_c)}, groupby_column_ids);
+}
+
+}  // namespace opossum
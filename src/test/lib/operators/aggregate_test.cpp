@@ -286,6 +286,13 @@ TYPED_TEST(OperatorsAggregateTest, SingleAggregateCountDistinct) {
                          "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/count_distinct.tbl");
 }
 
+TYPED_TEST(OperatorsAggregateTest, SingleAggregateApproxCountDistinct) {
+  // Small numbers of distinct values are estimated exactly
+  test_output<TypeParam>(this->_table_wrapper_1_1, {{ColumnID{1}, AggregateFunction::ApproxCountDistinct}},
+                         {ColumnID{0}},
+                         "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/approx_count_distinct.tbl");
+}
+
 TYPED_TEST(OperatorsAggregateTest, StringSingleAggregateMax) {
   test_output<TypeParam>(this->_table_wrapper_1_1_string, {{ColumnID{1}, AggregateFunction::Max}}, {ColumnID{0}},
                          "resources/test_data/tbl/aggregateoperator/groupby_string_1gb_1agg/max.tbl");
@@ -623,6 +630,12 @@ TYPED_TEST(OperatorsAggregateTest, SingleAggregateCountWithNull) {
                          "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/count_null.tbl", false);
 }
 
+TYPED_TEST(OperatorsAggregateTest, SingleAggregateApproxCountDistinctWithNull) {
+  test_output<TypeParam>(
+      this->_table_wrapper_1_1_null, {{ColumnID{1}, AggregateFunction::ApproxCountDistinct}}, {ColumnID{0}},
+      "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/approx_count_distinct_null.tbl", false);
+}
+
 TYPED_TEST(OperatorsAggregateTest, OneGroupbyAndNoAggregateWithNull) {
   test_output<TypeParam>(this->_table_wrapper_1_0_null, {}, {ColumnID{0}},
                          "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_0agg/result_null.tbl", false);
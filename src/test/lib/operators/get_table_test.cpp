@@ -47,6 +47,25 @@ TEST_F(OperatorsGetTableTest, OutputDoesNotChangeChunkSize) {
   EXPECT_TABLE_EQ_UNORDERED(get_table->get_output(), load_table("resources/test_data/tbl/int_int_float.tbl", 1u));
 }
 
+TEST_F(OperatorsGetTableTest, OutputRowBudget) {
+  // Each chunk holds a single row
+  const auto get_table = std::make_shared<GetTable>("int_int_float");
+  get_table->set_output_row_budget(2);
+  get_table->execute();
+  EXPECT_EQ(get_table->get_output()->chunk_count(), 2u);
+  EXPECT_EQ(get_table->get_output()->get_chunk(ChunkID{1}),
+            Hyrise::get().storage_manager.get_table("int_int_float")->get_chunk(ChunkID{1}));
+
+  // The budget is part of the operator's configuration and thus copied
+  const auto copied_get_table = get_table->deep_copy();
+  EXPECT_EQ(copied_get_table->output_row_budget(), 2u);
+
+  const auto empty_get_table = std::make_shared<GetTable>("int_int_float");
+  empty_get_table->set_output_row_budget(0);
+  empty_get_table->execute();
+  EXPECT_EQ(empty_get_table->get_output()->row_count(), 0u);
+}
+
 TEST_F(OperatorsGetTableTest, ThrowsUnknownTableName) {
   auto get_table = std::make_shared<GetTable>("anUglyTestTable");
 
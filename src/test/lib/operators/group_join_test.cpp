@@ -0,0 +1,162 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/aggregate_hash.hpp"
+#include "operators/group_join.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsGroupJoinTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Customers with unique keys, the second column is functionally dependent on the key
+    _customer_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"c_key", DataType::Int, false}, {"c_name", DataType::String, true}}, TableType::Data,
+        ChunkOffset{2}, UseMvcc::Yes);
+    _customer_table->append({1, "Alice"});
+    _customer_table->append({2, NULL_VALUE});
+    _customer_table->append({3, "Carol"});
+    _customer_table->append({4, "Dave"});
+    _customer_table->append({5, "Eve"});
+
+    // Orders of customers 1, 2, 3, and 7. The price of one order of customer 3 is unknown.
+    _order_table = std::make_shared<Table>(TableColumnDefinitions{{"o_key", DataType::Long, true},
+                                                                  {"o_price", DataType::Int, true},
+                                                                  {"o_comment", DataType::String, false}},
+                                           TableType::Data, ChunkOffset{3}, UseMvcc::Yes);
+    _order_table->append({int64_t{1}, 10, "a"});
+    _order_table->append({int64_t{3}, 15, "b"});
+    _order_table->append({int64_t{1}, 20, "c"});
+    _order_table->append({int64_t{3}, NULL_VALUE, "d"});
+    _order_table->append({NULL_VALUE, 5, "e"});
+    _order_table->append({int64_t{7}, 30, "f"});
+    _order_table->append({int64_t{2}, -2, "g"});
+    _order_table->append({int64_t{1}, 30, "h"});
+
+    _customers = std::make_shared<TableWrapper>(_customer_table);
+    _orders = std::make_shared<TableWrapper>(_order_table);
+    execute_all({_customers, _orders});
+  }
+
+  // Aggregates over the orders (and the customer name), for a join with the customers on the left or on the right
+  static std::vector<std::shared_ptr<AggregateExpression>> _aggregates(const bool customers_are_left) {
+    const auto name = pqp_column_(customers_are_left ? ColumnID{1} : ColumnID{4}, DataType::String, true, "c_name");
+    const auto price = pqp_column_(customers_are_left ? ColumnID{3} : ColumnID{1}, DataType::Int, true, "o_price");
+    const auto comment =
+        pqp_column_(customers_are_left ? ColumnID{4} : ColumnID{2}, DataType::String, false, "o_comment");
+    const auto star = pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*");
+
+    return {sum_(price), avg_(price), min_(price), max_(comment), count_(price), count_(star), any_(name)};
+  }
+
+  // Compares the result of a GroupJoin with that of an AggregateHash on top of a JoinHash
+  static void _expect_aggregate_hash_result(const std::shared_ptr<AbstractOperator>& left,
+                                            const std::shared_ptr<AbstractOperator>& right, const JoinMode mode,
+                                            const OperatorJoinPredicate& predicate,
+                                            const std::vector<ColumnID>& groupby_column_ids,
+                                            const std::vector<std::shared_ptr<AggregateExpression>>& aggregates) {
+    const auto group_join = std::make_shared<GroupJoin>(left, right, mode, predicate, groupby_column_ids, aggregates);
+    group_join->execute();
+
+    const auto join_hash = std::make_shared<JoinHash>(left, right, mode, predicate);
+    const auto aggregate_hash = std::make_shared<AggregateHash>(join_hash, aggregates, groupby_column_ids);
+    execute_all({join_hash, aggregate_hash});
+
+    EXPECT_TABLE_EQ_UNORDERED(group_join->get_output(), aggregate_hash->get_output());
+  }
+
+  std::shared_ptr<Table> _customer_table, _order_table;
+  std::shared_ptr<TableWrapper> _customers, _orders;
+};
+
+TEST_F(OperatorsGroupJoinTest, InnerJoin) {
+  const auto predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  _expect_aggregate_hash_result(_customers, _orders, JoinMode::Inner, predicate, {ColumnID{0}}, _aggregates(true));
+
+  const auto group_join =
+      std::make_shared<GroupJoin>(_customers, _orders, JoinMode::Inner, predicate, std::vector{ColumnID{0}},
+                                  std::vector<std::shared_ptr<AggregateExpression>>{});
+  group_join->execute();
+
+  // Only customers with orders are emitted
+  EXPECT_EQ(group_join->get_output()->row_count(), 3u);
+  EXPECT_EQ(group_join->get_output()->column_count(), 1u);
+  EXPECT_TRUE(static_cast<const GroupJoin::PerformanceData&>(*group_join->performance_data).group_side_is_left);
+}
+
+TEST_F(OperatorsGroupJoinTest, InnerJoinGroupSideRight) {
+  const auto predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  _expect_aggregate_hash_result(_orders, _customers, JoinMode::Inner, predicate, {ColumnID{3}, ColumnID{4}},
+                                _aggregates(false));
+}
+
+TEST_F(OperatorsGroupJoinTest, OuterJoins) {
+  const auto predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  _expect_aggregate_hash_result(_customers, _orders, JoinMode::Left, predicate, {ColumnID{0}}, _aggregates(true));
+  _expect_aggregate_hash_result(_orders, _customers, JoinMode::Right, predicate, {ColumnID{3}}, _aggregates(false));
+}
+
+TEST_F(OperatorsGroupJoinTest, ReferenceInputs) {
+  const auto customer_scan = create_table_scan(_customers, ColumnID{0}, PredicateCondition::GreaterThan, 1);
+  const auto order_scan = create_table_scan(_orders, ColumnID{1}, PredicateCondition::GreaterThan, 0);
+  execute_all({customer_scan, order_scan});
+
+  const auto predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  _expect_aggregate_hash_result(customer_scan, order_scan, JoinMode::Inner, predicate, {ColumnID{0}},
+                                _aggregates(true));
+  _expect_aggregate_hash_result(customer_scan, order_scan, JoinMode::Left, predicate, {ColumnID{0}},
+                                _aggregates(true));
+}
+
+TEST_F(OperatorsGroupJoinTest, DuplicateKeys) {
+  // The orders do not have unique keys
+  const auto predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto group_join =
+      std::make_shared<GroupJoin>(_orders, _customers, JoinMode::Left, predicate, std::vector{ColumnID{0}},
+                                  std::vector<std::shared_ptr<AggregateExpression>>{});
+  EXPECT_THROW(group_join->execute(), std::logic_error);
+}
+
+TEST_F(OperatorsGroupJoinTest, TranslatedFromLQP) {
+  Hyrise::get().storage_manager.add_table("customers", _customer_table);
+  Hyrise::get().storage_manager.add_table("orders", _order_table);
+
+  const auto customers = StoredTableNode::make("customers");
+  const auto orders = StoredTableNode::make("orders");
+  const auto c_key = customers->get_column("c_key");
+
+  // clang-format off
+  const auto aggregate_node =
+  AggregateNode::make(expression_vector(c_key), expression_vector(sum_(orders->get_column("o_price"))),
+    JoinNode::make(JoinMode::Left, equals_(c_key, orders->get_column("o_key")),
+      customers,
+      orders));
+  // clang-format on
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<AggregateHash>(LQPTranslator{}.translate_node(aggregate_node)));
+
+  aggregate_node->is_group_join = true;
+  const auto pqp = LQPTranslator{}.translate_node(aggregate_node);
+  const auto group_join = std::dynamic_pointer_cast<GroupJoin>(pqp);
+  ASSERT_TRUE(group_join);
+  EXPECT_EQ(group_join->mode(), JoinMode::Left);
+  EXPECT_EQ(group_join->groupby_column_ids(), std::vector{ColumnID{0}});
+  EXPECT_EQ(group_join->left_input()->type(), OperatorType::GetTable);
+  EXPECT_EQ(group_join->right_input()->type(), OperatorType::GetTable);
+}
+
+}  // namespace opossum
@@ -0,0 +1,176 @@
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/join_array.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsJoinArrayTest : public BaseTest {
+ protected:
+  static std::shared_ptr<Table> _create_table(const DataType data_type, const std::vector<AllTypeVariant>& values,
+                                              const UseMvcc use_mvcc = UseMvcc::No) {
+    const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", data_type, true}}, TableType::Data,
+                                               ChunkOffset{2}, use_mvcc);
+    for (const auto& value : values) {
+      table->append({value});
+    }
+    return table;
+  }
+
+  static std::shared_ptr<TableWrapper> _create_input(const DataType data_type,
+                                                     const std::vector<AllTypeVariant>& values) {
+    const auto table_wrapper = std::make_shared<TableWrapper>(_create_table(data_type, values));
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  static std::shared_ptr<JoinArray> _join(const std::shared_ptr<AbstractOperator>& probe_input,
+                                          const std::shared_ptr<AbstractOperator>& build_input, const JoinMode mode) {
+    const auto join_array = std::make_shared<JoinArray>(
+        probe_input, build_input, mode, OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals});
+    join_array->execute();
+    return join_array;
+  }
+
+  // Compares the result of an executed JoinArray with that of a JoinHash on the same inputs
+  static void _expect_join_hash_result(const JoinArray& join_array) {
+    const auto join_hash = std::make_shared<JoinHash>(join_array.left_input(), join_array.right_input(),
+                                                      join_array.mode(), join_array.primary_predicate());
+    join_hash->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(join_array.get_output(), join_hash->get_output());
+  }
+
+  static const JoinArray::PerformanceData& _performance_data(const JoinArray& join_array) {
+    return static_cast<const JoinArray::PerformanceData&>(*join_array.performance_data);
+  }
+};
+
+TEST_F(OperatorsJoinArrayTest, Supports) {
+  EXPECT_TRUE(JoinArray::supports(
+      {JoinMode::Inner, PredicateCondition::Equals, DataType::Int, DataType::Long, false}));
+  EXPECT_TRUE(JoinArray::supports({JoinMode::AntiNullAsTrue, PredicateCondition::Equals, DataType::Long, DataType::Int,
+                                   false, std::nullopt, std::nullopt}));
+
+  EXPECT_FALSE(JoinArray::supports(
+      {JoinMode::Left, PredicateCondition::Equals, DataType::Int, DataType::Int, false}));
+  EXPECT_FALSE(JoinArray::supports(
+      {JoinMode::Inner, PredicateCondition::LessThan, DataType::Int, DataType::Int, false}));
+  EXPECT_FALSE(JoinArray::supports(
+      {JoinMode::Inner, PredicateCondition::Equals, DataType::Int, DataType::Float, false}));
+  EXPECT_FALSE(JoinArray::supports(
+      {JoinMode::Semi, PredicateCondition::Equals, DataType::Int, DataType::Int, true}));
+}
+
+TEST_F(OperatorsJoinArrayTest, IsDense) {
+  // Small ranges are always accepted
+  EXPECT_TRUE(JoinArray::is_dense(1, JoinArray::MIN_SLOT_COUNT, 1));
+  EXPECT_FALSE(JoinArray::is_dense(1, JoinArray::MIN_SLOT_COUNT + 1, 1));
+
+  EXPECT_TRUE(JoinArray::is_dense(-1000, 2999, 1000));
+  EXPECT_FALSE(JoinArray::is_dense(-1000, 3000, 1000));
+
+  EXPECT_TRUE(JoinArray::is_dense(0, JoinArray::MAX_SLOT_COUNT - 1, JoinArray::MAX_SLOT_COUNT));
+  EXPECT_FALSE(JoinArray::is_dense(0, JoinArray::MAX_SLOT_COUNT, JoinArray::MAX_SLOT_COUNT));
+  EXPECT_FALSE(JoinArray::is_dense(std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max(), 1));
+}
+
+TEST_F(OperatorsJoinArrayTest, InnerJoin) {
+  const auto probe_input = _create_input(DataType::Int, {1, 2, 2, 3, NULL_VALUE, 7, -5});
+  const auto build_input =
+      _create_input(DataType::Long, {int64_t{2}, int64_t{2}, int64_t{3}, NULL_VALUE, int64_t{5}});
+
+  const auto join_array = _join(probe_input, build_input, JoinMode::Inner);
+  _expect_join_hash_result(*join_array);
+
+  // Both 2s on the probe side find two join partners
+  EXPECT_EQ(join_array->get_output()->row_count(), 5u);
+  EXPECT_EQ(join_array->get_output()->column_count(), 2u);
+  EXPECT_EQ(_performance_data(*join_array).slot_count, 4u);
+  EXPECT_FALSE(_performance_data(*join_array).fell_back_to_join_hash);
+}
+
+TEST_F(OperatorsJoinArrayTest, SemiAndAntiJoins) {
+  const auto probe_input = _create_input(DataType::Int, {1, 2, 2, 3, NULL_VALUE, 7, -5});
+  const auto build_input = _create_input(DataType::Int, {2, 3, 5});
+  const auto build_input_with_null = _create_input(DataType::Int, {2, NULL_VALUE, 5});
+  const auto empty_build_input = _create_input(DataType::Int, {});
+
+  for (const auto mode : {JoinMode::Semi, JoinMode::AntiNullAsFalse, JoinMode::AntiNullAsTrue}) {
+    SCOPED_TRACE(join_mode_to_string.left.at(mode));
+    _expect_join_hash_result(*_join(probe_input, build_input, mode));
+    _expect_join_hash_result(*_join(probe_input, build_input_with_null, mode));
+    _expect_join_hash_result(*_join(probe_input, empty_build_input, mode));
+  }
+
+  // A NULL on the build side of an AntiNullAsTrue join (NOT IN) discards all rows. An empty build side discards none.
+  EXPECT_EQ(_join(probe_input, build_input_with_null, JoinMode::AntiNullAsTrue)->get_output()->row_count(), 0u);
+  EXPECT_EQ(_join(probe_input, empty_build_input, JoinMode::AntiNullAsTrue)->get_output()->row_count(), 7u);
+}
+
+TEST_F(OperatorsJoinArrayTest, ReferenceInputs) {
+  const auto probe_input = _create_input(DataType::Int, {1, 2, 2, 3, NULL_VALUE, 7, 4, 5});
+  const auto build_input = _create_input(DataType::Int, {5, 4, 3, 2, 1, 2});
+
+  const auto probe_scan = create_table_scan(probe_input, ColumnID{0}, PredicateCondition::GreaterThan, 1);
+  const auto build_scan = create_table_scan(build_input, ColumnID{0}, PredicateCondition::LessThan, 5);
+  execute_all({probe_scan, build_scan});
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Semi, JoinMode::AntiNullAsFalse}) {
+    SCOPED_TRACE(join_mode_to_string.left.at(mode));
+    _expect_join_hash_result(*_join(probe_scan, build_scan, mode));
+  }
+}
+
+TEST_F(OperatorsJoinArrayTest, FallBackToJoinHash) {
+  const auto probe_input = _create_input(DataType::Int, {1, 2, 1'000'000});
+  const auto build_input = _create_input(DataType::Int, {1, 1'000'000});
+
+  const auto join_array = _join(probe_input, build_input, JoinMode::Inner);
+  _expect_join_hash_result(*join_array);
+  EXPECT_EQ(join_array->get_output()->row_count(), 2u);
+  EXPECT_TRUE(_performance_data(*join_array).fell_back_to_join_hash);
+}
+
+TEST_F(OperatorsJoinArrayTest, ChosenByLQPTranslator) {
+  Hyrise::get().storage_manager.add_table("probe", _create_table(DataType::Int, {1, 2, 3, 8}, UseMvcc::Yes));
+  Hyrise::get().storage_manager.add_table("dense",
+                                          _create_table(DataType::Int, {1, 2, 3, 4, 5, 6, 7, 8}, UseMvcc::Yes));
+  Hyrise::get().storage_manager.add_table("sparse", _create_table(DataType::Int, {1, 100'000}, UseMvcc::Yes));
+
+  const auto probe_node = StoredTableNode::make("probe");
+  const auto dense_node = StoredTableNode::make("dense");
+  const auto sparse_node = StoredTableNode::make("sparse");
+
+  const auto dense_join =
+      JoinNode::make(JoinMode::Inner, equals_(probe_node->get_column("a"), dense_node->get_column("a")), probe_node,
+                     dense_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinArray>(LQPTranslator{}.translate_node(dense_join)));
+
+  const auto sparse_join =
+      JoinNode::make(JoinMode::Inner, equals_(probe_node->get_column("a"), sparse_node->get_column("a")), probe_node,
+                     sparse_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(LQPTranslator{}.translate_node(sparse_join)));
+
+  // The JoinArray does not support outer joins
+  const auto left_join =
+      JoinNode::make(JoinMode::Left, equals_(probe_node->get_column("a"), dense_node->get_column("a")), probe_node,
+                     dense_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(LQPTranslator{}.translate_node(left_join)));
+}
+
+}  // namespace opossum
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <filesystem>
 
 #include "base_test.hpp"
 
@@ -157,9 +158,8 @@ TEST_F(JoinHashStepsTest, MaterializeAndBuildWithKeepNulls) {
     });
   }
 
-  // Build a BloomFilter that cannot be used to skip any entries by creating a BloomFilter with every value being false
-  // and using bitwise negation (~x).
-  auto bloom_filter = ~BloomFilter(BLOOM_FILTER_SIZE);
+  // A default-constructed BloomFilter contains every value and cannot be used to skip any entries
+  const auto bloom_filter = BloomFilter{};
 
   // Build phase: NULLs should be discarded
   auto hash_map_with_nulls = build<int, int>(materialized_with_nulls, JoinHashBuildMode::AllPositions, 0, bloom_filter);
@@ -189,16 +189,19 @@ TEST_F(JoinHashStepsTest, MaterializeOutputBloomFilter) {
     materialize_input<int, int, false>(_table_with_nulls_and_zeros->get_output(), ColumnID{0}, histograms, 1,
                                        bloom_filter);
 
-    // For all input values, their position in the bloom filter should be correctly set to true
+    // The filter is sized for the input table and contains all input values
+    EXPECT_FALSE(bloom_filter.is_disabled());
+    EXPECT_EQ(bloom_filter.block_count(), BloomFilter::MIN_BLOCK_COUNT);
     for (auto value : std::vector<int>{0, 6, 7, 9, 13, 18}) {
-      EXPECT_TRUE(bloom_filter[value]);
-
-      // Set to false for easier checking of the values that should be false
-      bloom_filter[value] = false;
+      EXPECT_TRUE(bloom_filter.contains(std::hash<int>{}(value)));
     }
 
-    // All other slots should be false
-    EXPECT_EQ(bloom_filter, BloomFilter{BLOOM_FILTER_SIZE});
+    // Only few other values pass the filter
+    auto false_positive_count = size_t{0};
+    for (auto value = 1'000; value < 2'000; ++value) {
+      if (bloom_filter.contains(std::hash<int>{}(value))) ++false_positive_count;
+    }
+    EXPECT_LT(false_positive_count, 50);
   }
 }
 
@@ -208,9 +211,9 @@ TEST_F(JoinHashStepsTest, MaterializeInputBloomFilter) {
     BloomFilter output_bloom_filter;
 
     // Fill input_bloom_filter
-    BloomFilter input_bloom_filter(BLOOM_FILTER_SIZE);
+    BloomFilter input_bloom_filter(3);
     for (auto value : std::vector<int>{6, 7, 9}) {
-      input_bloom_filter[value] = true;
+      input_bloom_filter.insert(std::hash<int>{}(value));
     }
 
     auto container = materialize_input<int, int, false>(_table_with_nulls_and_zeros->get_output(), ColumnID{0},
@@ -234,6 +237,60 @@ TEST_F(JoinHashStepsTest, MaterializeInputBloomFilter) {
   }
 }
 
+TEST_F(JoinHashStepsTest, BloomFilterSizing) {
+  // A default-constructed filter contains every value
+  const auto all_true_bloom_filter = BloomFilter{};
+  EXPECT_TRUE(all_true_bloom_filter.is_disabled());
+  EXPECT_EQ(all_true_bloom_filter.block_count(), 1);
+  EXPECT_TRUE(all_true_bloom_filter.contains(17));
+
+  // The filter uses BITS_PER_VALUE bits per estimated value, rounded up to a power of two
+  EXPECT_EQ(BloomFilter(0).block_count(), BloomFilter::MIN_BLOCK_COUNT);
+  EXPECT_EQ(BloomFilter(1'000'000).block_count(), 262'144);
+  EXPECT_EQ(BloomFilter(size_t{1} << 40).block_count(), BloomFilter::MAX_BLOCK_COUNT);
+}
+
+TEST_F(JoinHashStepsTest, BloomFilterMergeAndConcurrentInsert) {
+  auto bloom_filter_a = BloomFilter(1'000);
+  auto bloom_filter_b = BloomFilter(1'000);
+  auto concurrent_bloom_filter = BloomFilter(1'000);
+
+  for (auto value = size_t{0}; value < 1'000; ++value) {
+    (value < 500 ? bloom_filter_a : bloom_filter_b).insert(value);
+    concurrent_bloom_filter.insert_concurrently(value);
+  }
+
+  bloom_filter_a.merge(bloom_filter_b);
+  EXPECT_EQ(bloom_filter_a, concurrent_bloom_filter);
+  for (auto value = size_t{0}; value < 1'000; ++value) {
+    EXPECT_TRUE(bloom_filter_a.contains(value));
+  }
+
+  // Merging filters of different sizes is not allowed
+  if constexpr (HYRISE_DEBUG) {
+    EXPECT_THROW(bloom_filter_a.merge(BloomFilter(100'000)), std::logic_error);
+  }
+}
+
+TEST_F(JoinHashStepsTest, BloomFilterDisableIfIneffective) {
+  auto bloom_filter = BloomFilter(10'000);
+  auto undersized_bloom_filter = BloomFilter(10);
+  for (auto value = size_t{0}; value < 10'000; ++value) {
+    bloom_filter.insert(value);
+    undersized_bloom_filter.insert(value);
+  }
+
+  EXPECT_LT(bloom_filter.estimated_false_positive_rate(), 0.01);
+  EXPECT_FALSE(bloom_filter.disable_if_ineffective());
+  EXPECT_FALSE(bloom_filter.is_disabled());
+
+  // Almost all bits of the undersized filter are set, so it lets every value pass anyway
+  EXPECT_GT(undersized_bloom_filter.estimated_false_positive_rate(), BloomFilter::MAX_FALSE_POSITIVE_RATE);
+  EXPECT_TRUE(undersized_bloom_filter.disable_if_ineffective());
+  EXPECT_TRUE(undersized_bloom_filter.is_disabled());
+  EXPECT_EQ(undersized_bloom_filter.block_count(), 1);
+}
+
 TEST_F(JoinHashStepsTest, MaterializeInputHistograms) {
   {
     std::vector<std::vector<size_t>> histograms;
@@ -308,9 +365,9 @@ TEST_F(JoinHashStepsTest, BuildRespectsBloomFilter) {
   BloomFilter output_bloom_filter;              // Ignored in this test
 
   // Fill input_bloom_filter
-  BloomFilter input_bloom_filter(BLOOM_FILTER_SIZE);
+  BloomFilter input_bloom_filter(3);
   for (auto value : std::vector<int>{6, 7, 9}) {
-    input_bloom_filter[value] = true;
+    input_bloom_filter.insert(std::hash<int>{}(value));
   }
 
   auto container = materialize_input<int, int, false>(_table_with_nulls_and_zeros->get_output(), ColumnID{0},
@@ -329,6 +386,123 @@ TEST_F(JoinHashStepsTest, BuildRespectsBloomFilter) {
   EXPECT_FALSE(hash_table->contains(18));
 }
 
+TEST_F(JoinHashStepsTest, SpillAndLoadPartition) {
+  auto partition = Partition<pmr_string>{};
+  partition.elements.push_back(PartitionedElement<pmr_string>{RowID{ChunkID{0}, ChunkOffset{1}}, "short"});
+  partition.elements.push_back(
+      PartitionedElement<pmr_string>{RowID{ChunkID{2}, ChunkOffset{3}}, "a string that is too long for the SSO"});
+  partition.elements.push_back(PartitionedElement<pmr_string>{RowID{ChunkID{4}, ChunkOffset{5}}, ""});
+  partition.null_values = {false, false, true};
+  const auto expected_partition = partition;
+
+  const auto spill_file = SpillFile{"hyrise_join_hash"};
+  EXPECT_TRUE(std::filesystem::exists(spill_file.path()));
+  EXPECT_GT(spill_partition(partition, spill_file), 0u);
+  EXPECT_TRUE(partition.elements.empty());
+
+  const auto loaded_partition = load_spilled_partition<pmr_string>(spill_file);
+  ASSERT_EQ(loaded_partition.elements.size(), 3u);
+  for (auto element_idx = size_t{0}; element_idx < 3; ++element_idx) {
+    EXPECT_EQ(loaded_partition.elements[element_idx].row_id, expected_partition.elements[element_idx].row_id);
+    EXPECT_EQ(loaded_partition.elements[element_idx].value, expected_partition.elements[element_idx].value);
+  }
+  EXPECT_EQ(loaded_partition.null_values, expected_partition.null_values);
+}
+
+TEST_F(JoinHashStepsTest, SpillPartitionsExceedingBudget) {
+  std::vector<std::vector<size_t>> histograms;
+  BloomFilter bloom_filter;  // Ignored in this test
+  const auto radix_bit_count = size_t{2};
+
+  const auto materialized = materialize_input<int, int, false>(_table_zero_one, ColumnID{0}, histograms,
+                                                               radix_bit_count, bloom_filter);
+  auto build_radix_container = partition_by_radix<int, int, false>(materialized, histograms, radix_bit_count);
+  auto probe_radix_container = build_radix_container;
+
+  // Without a budget, all non-empty partitions are spilled. The table only contains zeros and ones, so that at most two
+  // partitions are not empty.
+  const auto spilled_partitions =
+      spill_partitions<int, int, int>(build_radix_container, probe_radix_container, size_t{0});
+  ASSERT_GE(spilled_partitions.size(), 1u);
+  ASSERT_LE(spilled_partitions.size(), 2u);
+
+  auto spilled_row_count = size_t{0};
+  for (const auto& spilled_partition : spilled_partitions) {
+    EXPECT_TRUE(build_radix_container[spilled_partition.partition_idx].elements.empty());
+    EXPECT_TRUE(probe_radix_container[spilled_partition.partition_idx].elements.empty());
+    EXPECT_GT(spilled_partition.spilled_bytes, 0u);
+
+    const auto loaded_partition = load_spilled_partition<int>(*spilled_partition.build_side_file);
+    spilled_row_count += loaded_partition.elements.size();
+  }
+  EXPECT_EQ(spilled_row_count, _table_size_zero_one);
+
+  // A sufficient budget keeps all partitions in memory
+  auto materialized_probe_radix_container = partition_by_radix<int, int, false>(materialized, histograms,
+                                                                                radix_bit_count);
+  auto materialized_build_radix_container = materialized_probe_radix_container;
+  EXPECT_TRUE((spill_partitions<int, int, int>(materialized_build_radix_container, materialized_probe_radix_container,
+                                               std::numeric_limits<size_t>::max()))
+                  .empty());
+}
+
+TEST_F(JoinHashStepsTest, DetectHeavyHitters) {
+  std::vector<std::vector<size_t>> histograms;
+  BloomFilter bloom_filter;  // Ignored in this test
+
+  // Zeros and ones make up half of the table each
+  const auto materialized =
+      materialize_input<int, int, false>(_table_zero_one, ColumnID{0}, histograms, size_t{2}, bloom_filter);
+
+  const auto heavy_hitters = detect_heavy_hitters<int, int>(materialized, 0.25);
+  const auto hash_function = std::hash<int>{};
+  auto expected_hashes = std::vector<Hash>{hash_function(0), hash_function(1)};
+  std::sort(expected_hashes.begin(), expected_hashes.end());
+  ASSERT_EQ(heavy_hitters.size(), 2u);
+  for (auto heavy_hitter_idx = size_t{0}; heavy_hitter_idx < 2; ++heavy_hitter_idx) {
+    EXPECT_EQ(heavy_hitters[heavy_hitter_idx].first, expected_hashes[heavy_hitter_idx]);
+    EXPECT_EQ(heavy_hitters[heavy_hitter_idx].second, _table_size_zero_one / 2);
+  }
+
+  EXPECT_TRUE((detect_heavy_hitters<int, int>(materialized, 0.6)).empty());
+  EXPECT_TRUE((detect_heavy_hitters<int, int>(RadixContainer<int>{}, 0.25)).empty());
+}
+
+TEST_F(JoinHashStepsTest, PartitionHeavyHitters) {
+  std::vector<std::vector<size_t>> histograms;
+  BloomFilter bloom_filter;  // Ignored in this test
+  const auto radix_bit_count = size_t{2};
+
+  const auto materialized =
+      materialize_input<int, int, false>(_table_zero_one, ColumnID{0}, histograms, radix_bit_count, bloom_filter);
+
+  // Only the zeros are routed to the three heavy hitter partitions, which receive the rows round-robin
+  const auto heavy_hitters = std::vector<Hash>{std::hash<int>{}(0)};
+  const auto radix_container = partition_by_radix<int, int, false>(materialized, histograms, radix_bit_count,
+                                                                   ALL_TRUE_BLOOM_FILTER, heavy_hitters, 3);
+  ASSERT_EQ(radix_container.size(), 7u);
+
+  auto radix_partition_row_count = size_t{0};
+  for (auto partition_idx = size_t{0}; partition_idx < 4; ++partition_idx) {
+    for (const auto& element : radix_container[partition_idx].elements) {
+      EXPECT_EQ(element.value, 1);
+    }
+    radix_partition_row_count += radix_container[partition_idx].elements.size();
+  }
+  EXPECT_EQ(radix_partition_row_count, _table_size_zero_one / 2);
+
+  // Each chunk holds five zeros, which are distributed to the partitions as 2, 2, 1
+  const auto chunk_count = _table_size_zero_one / _chunk_size_zero_one;
+  EXPECT_EQ(radix_container[4].elements.size(), 2 * chunk_count);
+  EXPECT_EQ(radix_container[5].elements.size(), 2 * chunk_count);
+  EXPECT_EQ(radix_container[6].elements.size(), chunk_count);
+  for (auto partition_idx = size_t{4}; partition_idx < 7; ++partition_idx) {
+    for (const auto& element : radix_container[partition_idx].elements) {
+      EXPECT_EQ(element.value, 0);
+    }
+  }
+}
+
 TEST_F(JoinHashStepsTest, ThrowWhenNoNullValuesArePassed) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
 
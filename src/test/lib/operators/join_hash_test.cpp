@@ -1,7 +1,12 @@
+#include <sstream>
+
 #include "base_test.hpp"
 
 #include "operators/join_hash.hpp"
+#include "operators/join_verification.hpp"
+#include "operators/pqp_utils.hpp"
 #include "operators/table_wrapper.hpp"
+#include "sql/sql_pipeline_builder.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -108,6 +113,124 @@ TEST_F(OperatorsJoinHashTest, DeepCopy) {
   EXPECT_NE(join_operator_copy->right_input(), nullptr);
 }
 
+TEST_F(OperatorsJoinHashTest, SpillingUnderMemoryBudget) {
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+
+  for (const auto join_mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Semi, JoinMode::AntiNullAsFalse}) {
+    SCOPED_TRACE(join_mode);
+    const auto in_memory_join =
+        std::make_shared<JoinHash>(_table_tpch_lineitems, _table_tpch_orders, join_mode, primary_predicate);
+    in_memory_join->execute();
+
+    const auto spilling_join =
+        std::make_shared<JoinHash>(_table_tpch_lineitems, _table_tpch_orders, join_mode, primary_predicate,
+                                   std::vector<OperatorJoinPredicate>{}, std::nullopt, 16'000);
+    spilling_join->execute();
+
+    const auto& performance_data = static_cast<const JoinHash::PerformanceData&>(*spilling_join->performance_data);
+    EXPECT_GT(performance_data.spilled_partition_count, 0u);
+    EXPECT_GT(performance_data.spilled_bytes, 0u);
+    EXPECT_GT(performance_data.get_step_runtime(JoinHash::OperatorSteps::Clustering).count(), 0);
+
+    auto stream = std::stringstream{};
+    stream << performance_data;
+    EXPECT_NE(stream.str().find("Spilled "), std::string::npos);
+
+    EXPECT_TABLE_EQ_UNORDERED(spilling_join->get_output(), in_memory_join->get_output());
+  }
+
+  // A sufficient budget does not lead to spilling
+  const auto join = std::make_shared<JoinHash>(_table_tpch_lineitems, _table_tpch_orders, JoinMode::Inner,
+                                               primary_predicate, std::vector<OperatorJoinPredicate>{}, std::nullopt,
+                                               1'000'000'000);
+  join->execute();
+  EXPECT_EQ(static_cast<const JoinHash::PerformanceData&>(*join->performance_data).spilled_partition_count, 0u);
+  EXPECT_EQ(join->description(DescriptionMode::SingleLine),
+            "JoinHash (Inner Join where l_orderkey = o_orderkey) Radix bits: 0 Memory budget: 1000000000 bytes");
+}
+
+TEST_F(OperatorsJoinHashTest, SpillingThroughSQL) {
+  auto& storage_manager = Hyrise::get().storage_manager;
+  storage_manager.add_table("orders", load_table("resources/test_data/tbl/tpch/sf-0.001/orders.tbl", 10));
+  storage_manager.add_table("lineitem", load_table("resources/test_data/tbl/tpch/sf-0.001/lineitem.tbl", 10));
+
+  // The JoinArray, which would be used for the dense o_orderkey values otherwise, does not support left outer joins
+  const auto query =
+      std::string{"SELECT l_orderkey, o_orderdate FROM lineitem LEFT JOIN orders ON l_orderkey = o_orderkey"};
+
+  auto in_memory_pipeline = SQLPipelineBuilder{query}.create_pipeline();
+  const auto [in_memory_status, in_memory_table] = in_memory_pipeline.get_result_table();
+  ASSERT_EQ(in_memory_status, SQLPipelineStatus::Success);
+
+  // The LQPTranslator passes the budget configured through the settings meta table to the JoinHash
+  auto settings_pipeline = SQLPipelineBuilder{
+      "UPDATE meta_settings SET value = '16000' WHERE name = 'Operators.memory_budget_bytes'"}.create_pipeline();
+  ASSERT_EQ(settings_pipeline.get_result_table().first, SQLPipelineStatus::Success);
+
+  auto spilling_pipeline = SQLPipelineBuilder{query}.create_pipeline();
+  const auto [spilling_status, spilling_table] = spilling_pipeline.get_result_table();
+  ASSERT_EQ(spilling_status, SQLPipelineStatus::Success);
+
+  auto join_hash = std::shared_ptr<const JoinHash>{};
+  visit_pqp(spilling_pipeline.get_physical_plans().at(0), [&](const auto& op) {
+    if (op->type() == OperatorType::JoinHash) join_hash = std::static_pointer_cast<const JoinHash>(op);
+    return join_hash ? PQPVisitation::DoNotVisitInputs : PQPVisitation::VisitInputs;
+  });
+  ASSERT_TRUE(join_hash);
+  EXPECT_NE(join_hash->description(DescriptionMode::SingleLine).find("Memory budget: 16000 bytes"), std::string::npos);
+  EXPECT_GT(static_cast<const JoinHash::PerformanceData&>(*join_hash->performance_data).spilled_partition_count, 0u);
+
+  EXPECT_TABLE_EQ_UNORDERED(spilling_table, in_memory_table);
+}
+
+TEST_F(OperatorsJoinHashTest, SkewedInputs) {
+  // Most rows of the larger table have the value 7, which is also frequent in the smaller table
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}};
+  const auto skewed_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{100});
+  for (auto row_idx = int32_t{0}; row_idx < 5'000; ++row_idx) {
+    if (row_idx % 50 == 0) {
+      skewed_table->append({NULL_VALUE});
+    } else {
+      skewed_table->append({row_idx % 5 == 0 ? row_idx % 300 : 7});
+    }
+  }
+  const auto small_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{100});
+  for (auto row_idx = int32_t{0}; row_idx < 200; ++row_idx) {
+    small_table->append({row_idx % 10 == 0 ? 7 : row_idx});
+  }
+
+  const auto skewed_input = std::make_shared<TableWrapper>(skewed_table);
+  const auto small_input = std::make_shared<TableWrapper>(small_table);
+  execute_all({skewed_input, small_input});
+
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  for (const auto join_mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Semi,
+                               JoinMode::AntiNullAsFalse, JoinMode::AntiNullAsTrue}) {
+    SCOPED_TRACE(join_mode);
+    const auto join = std::make_shared<JoinHash>(skewed_input, small_input, join_mode, primary_predicate,
+                                                 std::vector<OperatorJoinPredicate>{}, 3);
+    const auto join_verification =
+        std::make_shared<JoinVerification>(skewed_input, small_input, join_mode, primary_predicate);
+    execute_all({join, join_verification});
+
+    const auto& performance_data = static_cast<const JoinHash::PerformanceData&>(*join->performance_data);
+    EXPECT_EQ(performance_data.heavy_hitter_count, 1u);
+    EXPECT_EQ(performance_data.heavy_hitter_partition_count, 1u);
+
+    auto stream = std::stringstream{};
+    stream << performance_data;
+    EXPECT_NE(stream.str().find("Joined 1 heavy hitter in 1 dedicated partition."), std::string::npos);
+
+    EXPECT_TABLE_EQ_UNORDERED(join->get_output(), join_verification->get_output());
+  }
+
+  // Without radix partitioning, heavy hitters are not treated differently
+  const auto join = std::make_shared<JoinHash>(skewed_input, small_input, JoinMode::Inner, primary_predicate,
+                                               std::vector<OperatorJoinPredicate>{}, 0);
+  join->execute();
+  EXPECT_EQ(static_cast<const JoinHash::PerformanceData&>(*join->performance_data).heavy_hitter_count, 0u);
+}
+
 TEST_F(OperatorsJoinHashTest, RadixBitCalculation) {
   // Simple cases: handle minimal inputs and very large inputs
   EXPECT_EQ(JoinHash::calculate_radix_bits<int>(1, 1), 0ul);
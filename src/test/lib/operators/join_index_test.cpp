@@ -7,6 +7,8 @@
 #include "base_test.hpp"
 
 #include "all_type_variant.hpp"
+#include "hyrise.hpp"
+#include "operators/get_table.hpp"
 #include "operators/join_index.hpp"
 #include "operators/join_verification.hpp"
 #include "operators/table_scan.hpp"
@@ -219,6 +221,97 @@ TEST_F(OperatorsJoinIndexTest, PerformanceDataOutputToStream) {
               "Output: 2 rows in 1 chunk, 999 ns.\nOperator step runtimes:\n IndexJoining 17 ns\n "
               "NestedLoopJoining 0 ns\n OutputWriting 0 ns.\nIndexes used for 10 of 15 chunks.");
   }
+
+  {
+    std::stringstream stream;
+    performance_data.table_index_used = true;
+    stream << performance_data;
+    EXPECT_EQ(stream.str(),
+              "Output: 2 rows in 1 chunk, 999 ns. Operator step runtimes: IndexJoining 17 ns, "
+              "NestedLoopJoining 0 ns, OutputWriting 0 ns. Indexes used for 10 of 15 chunks (using a table index).");
+  }
+}
+
+TEST_F(OperatorsJoinIndexTest, TableIndex) {
+  // The index side has a table index on its join column, which covers the two finalized chunks. The last chunk is
+  // still mutable and is joined using its chunk index (if any) or the nested loop join.
+  const auto index_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Float, true}},
+                              TableType::Data, ChunkOffset{3}, UseMvcc::Yes);
+  for (const auto value : {12345, 123, 1234, 12345, 0, 123, 22}) {
+    index_table->append({value, 1.5f});
+  }
+  index_table->append({NULL_VALUE, 2.5f});
+  index_table->create_table_index(ColumnID{0});
+
+  const auto index_input = std::make_shared<TableWrapper>(index_table);
+  index_input->execute();
+
+  const auto equals = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto less_than = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::LessThan};
+  const auto configurations = std::vector<std::pair<JoinMode, OperatorJoinPredicate>>{
+      {JoinMode::Inner, equals},           {JoinMode::Left, equals},      {JoinMode::Semi, equals},
+      {JoinMode::AntiNullAsFalse, equals}, {JoinMode::Inner, less_than}, {JoinMode::Left, less_than}};
+
+  for (const auto& [mode, predicate] : configurations) {
+    const auto join_verification = std::make_shared<JoinVerification>(_table_wrapper_h, index_input, mode, predicate);
+    const auto join = std::make_shared<JoinIndex>(_table_wrapper_h, index_input, mode, predicate);
+    execute_all({join_verification, join});
+
+    EXPECT_TABLE_EQ_UNORDERED(join->get_output(), join_verification->get_output());
+  }
+
+  const auto join = std::make_shared<JoinIndex>(_table_wrapper_h, index_input, JoinMode::Inner, equals);
+  join->execute();
+
+  const auto& performance_data = static_cast<const JoinIndex::PerformanceData&>(*join->performance_data);
+  EXPECT_TRUE(performance_data.table_index_used);
+  EXPECT_EQ(performance_data.chunks_scanned_with_index, 2);
+  EXPECT_EQ(performance_data.chunks_scanned_without_index, 1);
+}
+
+TEST_F(OperatorsJoinIndexTest, TableIndexOfStoredTable) {
+  // GetTable outputs a new table without the table index of the stored table. JoinIndex uses the index of the stored
+  // table and only joins the rows of the chunks that GetTable outputs. Chunks of the stored table:
+  // {12345, 123, 1234}, {12345, 0, 123} (pruned), {12, 123, NULL} (physically deleted), {0, 12, 123}
+  const auto stored_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"b", DataType::Float, false}, {"a", DataType::Int, true}},
+                              TableType::Data, ChunkOffset{3}, UseMvcc::Yes);
+  for (const auto& value : std::vector<AllTypeVariant>{12345, 123, 1234, 12345, 0, 123, 12, 123, NULL_VALUE, 0, 12,
+                                                       123}) {
+    stored_table->append({1.5f, value});
+  }
+  stored_table->last_chunk()->finalize();
+  stored_table->create_table_index(ColumnID{1});
+  Hyrise::get().storage_manager.add_table("stored_table", stored_table);
+
+  const auto deleted_chunk = stored_table->get_chunk(ChunkID{2});
+  deleted_chunk->increase_invalid_row_count(deleted_chunk->size());
+  stored_table->remove_chunk(ChunkID{2});
+
+  const auto get_table =
+      std::make_shared<GetTable>("stored_table", std::vector{ChunkID{1}}, std::vector{ColumnID{0}});
+  get_table->execute();
+  ASSERT_EQ(get_table->get_output()->chunk_count(), 2);
+
+  const auto equals = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto less_than = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::LessThan};
+  const auto configurations = std::vector<std::pair<JoinMode, OperatorJoinPredicate>>{
+      {JoinMode::Inner, equals}, {JoinMode::Left, equals}, {JoinMode::Right, equals},
+      {JoinMode::Semi, equals},  {JoinMode::Inner, less_than}};
+
+  for (const auto& [mode, predicate] : configurations) {
+    const auto join_verification = std::make_shared<JoinVerification>(_table_wrapper_h, get_table, mode, predicate);
+    const auto join = std::make_shared<JoinIndex>(_table_wrapper_h, get_table, mode, predicate);
+    execute_all({join_verification, join});
+
+    EXPECT_TABLE_EQ_UNORDERED(join->get_output(), join_verification->get_output());
+
+    const auto& performance_data = static_cast<const JoinIndex::PerformanceData&>(*join->performance_data);
+    EXPECT_TRUE(performance_data.table_index_used);
+    EXPECT_EQ(performance_data.chunks_scanned_with_index, 2);
+    EXPECT_EQ(performance_data.chunks_scanned_without_index, 0);
+  }
 }
 
 TEST_F(OperatorsJoinIndexTest, InnerRefJoinNoIndex) {
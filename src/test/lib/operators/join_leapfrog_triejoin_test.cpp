@@ -0,0 +1,192 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_leapfrog_triejoin.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/operator_task.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsJoinLeapfrogTriejoinTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // The triangle query R(a, b), S(b, c), T(c, a) has five results: (1, 10, x), (1, 10, y), (1, 20, x), (2, 10, x),
+    // and (2, 10, y).
+    _r_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"r_a", DataType::Int, true}, {"r_b", DataType::Int, false}}, TableType::Data,
+        ChunkOffset{2}, UseMvcc::Yes);
+    _r_table->append({1, 10});
+    _r_table->append({1, 20});
+    _r_table->append({2, 10});
+    _r_table->append({NULL_VALUE, 10});
+    _r_table->append({3, 30});
+
+    _s_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"s_b", DataType::Int, false}, {"s_c", DataType::String, false}}, TableType::Data,
+        ChunkOffset{3}, UseMvcc::Yes);
+    _s_table->append({10, "x"});
+    _s_table->append({10, "y"});
+    _s_table->append({20, "x"});
+    _s_table->append({30, "z"});
+
+    _t_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"t_c", DataType::String, false}, {"t_a", DataType::Int, true}}, TableType::Data,
+        ChunkOffset{2}, UseMvcc::Yes);
+    _t_table->append({"x", 1});
+    _t_table->append({"y", 2});
+    _t_table->append({"x", 2});
+    _t_table->append({"z", NULL_VALUE});
+    _t_table->append({"y", 1});
+
+    _r = std::make_shared<TableWrapper>(_r_table);
+    _s = std::make_shared<TableWrapper>(_s_table);
+    _t = std::make_shared<TableWrapper>(_t_table);
+    execute_all({_r, _s, _t});
+  }
+
+  // R.b = S.b, S.c = T.c, and T.a = R.a
+  static std::vector<JoinLeapfrogTriejoin::Predicate> _triangle_predicates() {
+    return {{{0, ColumnID{1}}, {1, ColumnID{0}}},
+            {{1, ColumnID{1}}, {2, ColumnID{0}}},
+            {{2, ColumnID{1}}, {0, ColumnID{0}}}};
+  }
+
+  // Compares the result of a JoinLeapfrogTriejoin of the triangle query with that of two JoinHashes
+  static void _expect_join_hash_result(const std::shared_ptr<AbstractOperator>& r,
+                                       const std::shared_ptr<AbstractOperator>& s,
+                                       const std::shared_ptr<AbstractOperator>& t) {
+    const auto leapfrog_triejoin =
+        std::make_shared<JoinLeapfrogTriejoin>(std::vector<std::shared_ptr<const AbstractOperator>>{r, s, t},
+                                               _triangle_predicates());
+    leapfrog_triejoin->execute();
+
+    const auto r_s_join = std::make_shared<JoinHash>(
+        r, s, JoinMode::Inner, OperatorJoinPredicate{{ColumnID{1}, ColumnID{0}}, PredicateCondition::Equals});
+    const auto r_s_t_join = std::make_shared<JoinHash>(
+        r_s_join, t, JoinMode::Inner, OperatorJoinPredicate{{ColumnID{3}, ColumnID{0}}, PredicateCondition::Equals},
+        std::vector<OperatorJoinPredicate>{{{ColumnID{0}, ColumnID{1}}, PredicateCondition::Equals}});
+    execute_all({r_s_join, r_s_t_join});
+
+    EXPECT_TABLE_EQ_UNORDERED(leapfrog_triejoin->get_output(), r_s_t_join->get_output());
+  }
+
+  std::shared_ptr<Table> _r_table, _s_table, _t_table;
+  std::shared_ptr<TableWrapper> _r, _s, _t;
+};
+
+TEST_F(OperatorsJoinLeapfrogTriejoinTest, Triangle) {
+  _expect_join_hash_result(_r, _s, _t);
+
+  const auto leapfrog_triejoin = std::make_shared<JoinLeapfrogTriejoin>(
+      std::vector<std::shared_ptr<const AbstractOperator>>{_r, _s, _t}, _triangle_predicates());
+  leapfrog_triejoin->execute();
+
+  EXPECT_EQ(leapfrog_triejoin->get_output()->row_count(), 5u);
+  EXPECT_EQ(leapfrog_triejoin->get_output()->column_count(), 6u);
+  EXPECT_EQ(leapfrog_triejoin->additional_inputs().size(), 1u);
+  EXPECT_EQ(static_cast<const JoinLeapfrogTriejoin::PerformanceData&>(*leapfrog_triejoin->performance_data)
+                .variable_count,
+            3u);
+}
+
+TEST_F(OperatorsJoinLeapfrogTriejoinTest, ReferenceInputs) {
+  const auto r_scan = create_table_scan(_r, ColumnID{1}, PredicateCondition::LessThan, 30);
+  const auto t_scan = create_table_scan(_t, ColumnID{0}, PredicateCondition::NotEquals, pmr_string{"y"});
+  execute_all({r_scan, t_scan});
+
+  _expect_join_hash_result(r_scan, _s, t_scan);
+}
+
+TEST_F(OperatorsJoinLeapfrogTriejoinTest, TransitivePredicates) {
+  // R.b = S.b and S.b = R.b form a single variable. R.a = T.a is a second one, which does not occur in S.
+  const auto predicates = std::vector<JoinLeapfrogTriejoin::Predicate>{
+      {{0, ColumnID{1}}, {1, ColumnID{0}}}, {{1, ColumnID{0}}, {0, ColumnID{1}}}, {{0, ColumnID{0}}, {2, ColumnID{1}}}};
+  const auto leapfrog_triejoin = std::make_shared<JoinLeapfrogTriejoin>(
+      std::vector<std::shared_ptr<const AbstractOperator>>{_r, _s, _t}, predicates);
+  leapfrog_triejoin->execute();
+
+  const auto r_s_join = std::make_shared<JoinHash>(
+      _r, _s, JoinMode::Inner, OperatorJoinPredicate{{ColumnID{1}, ColumnID{0}}, PredicateCondition::Equals});
+  const auto r_s_t_join = std::make_shared<JoinHash>(
+      r_s_join, _t, JoinMode::Inner, OperatorJoinPredicate{{ColumnID{0}, ColumnID{1}}, PredicateCondition::Equals});
+  execute_all({r_s_join, r_s_t_join});
+
+  EXPECT_TABLE_EQ_UNORDERED(leapfrog_triejoin->get_output(), r_s_t_join->get_output());
+  EXPECT_EQ(static_cast<const JoinLeapfrogTriejoin::PerformanceData&>(*leapfrog_triejoin->performance_data)
+                .variable_count,
+            2u);
+}
+
+TEST_F(OperatorsJoinLeapfrogTriejoinTest, MismatchingDataTypes) {
+  const auto predicates = std::vector<JoinLeapfrogTriejoin::Predicate>{{{0, ColumnID{1}}, {1, ColumnID{1}}}};
+  const auto leapfrog_triejoin =
+      std::make_shared<JoinLeapfrogTriejoin>(std::vector<std::shared_ptr<const AbstractOperator>>{_r, _s}, predicates);
+  EXPECT_THROW(leapfrog_triejoin->execute(), std::logic_error);
+}
+
+TEST_F(OperatorsJoinLeapfrogTriejoinTest, DeepCopyAndScheduling) {
+  const auto leapfrog_triejoin = std::make_shared<JoinLeapfrogTriejoin>(
+      std::vector<std::shared_ptr<const AbstractOperator>>{_r, _s, _t}, _triangle_predicates());
+  leapfrog_triejoin->execute();
+
+  const auto copy = std::static_pointer_cast<JoinLeapfrogTriejoin>(leapfrog_triejoin->deep_copy());
+  ASSERT_EQ(copy->additional_inputs().size(), 1u);
+  EXPECT_NE(copy->additional_inputs()[0], _t);
+  EXPECT_EQ(copy->additional_inputs()[0]->type(), OperatorType::TableWrapper);
+  EXPECT_EQ(copy->predicates().size(), 3u);
+
+  // The additional input is scheduled as a predecessor of the join
+  const auto tasks = OperatorTask::make_tasks_from_operator(copy);
+  EXPECT_EQ(tasks.size(), 4u);
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+
+  EXPECT_TABLE_EQ_UNORDERED(copy->get_output(), leapfrog_triejoin->get_output());
+}
+
+TEST_F(OperatorsJoinLeapfrogTriejoinTest, TranslatedFromLQP) {
+  Hyrise::get().storage_manager.add_table("r", _r_table);
+  Hyrise::get().storage_manager.add_table("s", _s_table);
+  Hyrise::get().storage_manager.add_table("t", _t_table);
+
+  const auto r = StoredTableNode::make("r");
+  const auto s = StoredTableNode::make("s");
+  const auto t = StoredTableNode::make("t");
+
+  const auto r_s_join = JoinNode::make(JoinMode::Inner, equals_(r->get_column("r_b"), s->get_column("s_b")), r, s);
+  const auto r_s_t_join = JoinNode::make(
+      JoinMode::Inner,
+      expression_vector(equals_(s->get_column("s_c"), t->get_column("t_c")),
+                        equals_(t->get_column("t_a"), r->get_column("r_a"))),
+      r_s_join, t);
+
+  EXPECT_FALSE(std::dynamic_pointer_cast<JoinLeapfrogTriejoin>(LQPTranslator{}.translate_node(r_s_t_join)));
+
+  r_s_join->is_multiway_join = true;
+  r_s_t_join->is_multiway_join = true;
+  const auto pqp = LQPTranslator{}.translate_node(r_s_t_join);
+  const auto leapfrog_triejoin = std::dynamic_pointer_cast<JoinLeapfrogTriejoin>(pqp);
+  ASSERT_TRUE(leapfrog_triejoin);
+  ASSERT_EQ(leapfrog_triejoin->inputs().size(), 3u);
+  for (const auto& input : leapfrog_triejoin->inputs()) {
+    EXPECT_EQ(input->type(), OperatorType::GetTable);
+  }
+  EXPECT_EQ(leapfrog_triejoin->predicates().size(), 3u);
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(pqp);
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+  EXPECT_EQ(pqp->get_output()->row_count(), 5u);
+}
+
+}  // namespace opossum
@@ -1,8 +1,19 @@
 #include "base_test.hpp"
 
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/mvcc_data.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
 
 namespace opossum {
 
@@ -14,6 +25,54 @@ class OperatorsJoinSortMergeTest : public BaseTest {
     dummy_input = std::make_shared<TableWrapper>(dummy_table);
   }
 
+  // Creates a table with one chunk per vector of keys. If a sort mode is passed, the chunks are flagged as sorted by
+  // the key column. The second column holds the position of each row to make the rows distinguishable.
+  static std::shared_ptr<Table> create_table(const std::vector<std::vector<int32_t>>& chunk_keys,
+                                             const std::optional<SortMode> sort_mode) {
+    const auto table = std::make_shared<Table>(
+        TableColumnDefinitions{{"key", DataType::Int, false}, {"position", DataType::Int, false}}, TableType::Data,
+        ChunkOffset{8}, UseMvcc::Yes);
+
+    auto position = int32_t{0};
+    for (const auto& keys : chunk_keys) {
+      auto positions = pmr_vector<int32_t>{};
+      for (auto key_idx = size_t{0}; key_idx < keys.size(); ++key_idx) {
+        positions.emplace_back(position++);
+      }
+
+      auto key_values = pmr_vector<int32_t>(keys.begin(), keys.end());
+      table->append_chunk(Segments{std::make_shared<ValueSegment<int32_t>>(std::move(key_values)),
+                                   std::make_shared<ValueSegment<int32_t>>(std::move(positions))},
+                          std::make_shared<MvccData>(keys.size(), CommitID{0}));
+
+      const auto chunk = table->last_chunk();
+      chunk->finalize();
+      if (sort_mode) chunk->set_individually_sorted_by(SortColumnDefinition{ColumnID{0}, *sort_mode});
+    }
+
+    return table;
+  }
+
+  // Executes a JoinSortMerge and compares its result to that of the given reference join implementation
+  template <typename ReferenceJoin>
+  static void expect_reference_join_result(const std::shared_ptr<const Table>& left_table,
+                                           const std::shared_ptr<const Table>& right_table, const JoinMode mode,
+                                           const PredicateCondition predicate_condition,
+                                           const bool expect_inputs_presorted) {
+    const auto left_input = std::make_shared<TableWrapper>(left_table);
+    const auto right_input = std::make_shared<TableWrapper>(right_table);
+    execute_all({left_input, right_input});
+
+    const auto predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, predicate_condition};
+    const auto join_sort_merge = std::make_shared<JoinSortMerge>(left_input, right_input, mode, predicate);
+    const auto reference_join = std::make_shared<ReferenceJoin>(left_input, right_input, mode, predicate);
+    execute_all({join_sort_merge, reference_join});
+
+    EXPECT_TABLE_EQ_UNORDERED(join_sort_merge->get_output(), reference_join->get_output());
+    EXPECT_EQ(static_cast<const JoinSortMerge::PerformanceData&>(*join_sort_merge->performance_data).inputs_presorted,
+              expect_inputs_presorted);
+  }
+
   std::shared_ptr<AbstractOperator> dummy_input;
 };
 
@@ -117,4 +176,65 @@ TEST_F(OperatorsJoinSortMergeTest, SetSortedFlagOnJoinColumns) {
   }
 }
 
+TEST_F(OperatorsJoinSortMergeTest, PresortedInputs) {
+  // The ranges of the sorted chunks overlap, so the join has to merge them
+  const auto left_keys = std::vector<std::vector<int32_t>>{{1, 3, 3, 5, 8}, {2, 3, 4}, {0, 7, 7, 9}};
+  const auto right_keys = std::vector<std::vector<int32_t>>{{1, 2, 3, 8, 9}, {3, 4, 5, 6}, {7, 7, 8}};
+
+  auto right_descending_keys = right_keys;
+  for (auto& keys : right_descending_keys) {
+    std::reverse(keys.begin(), keys.end());
+  }
+
+  const auto left_ascending = create_table(left_keys, SortMode::Ascending);
+  const auto right_ascending = create_table(right_keys, SortMode::Ascending);
+  const auto right_descending = create_table(right_descending_keys, SortMode::Descending);
+  const auto right_unflagged = create_table(right_keys, std::nullopt);
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::FullOuter}) {
+    expect_reference_join_result<JoinHash>(left_ascending, right_ascending, mode, PredicateCondition::Equals, true);
+    expect_reference_join_result<JoinHash>(left_ascending, right_descending, mode, PredicateCondition::Equals, true);
+    expect_reference_join_result<JoinHash>(left_ascending, right_unflagged, mode, PredicateCondition::Equals, false);
+  }
+
+  for (const auto predicate_condition : {PredicateCondition::LessThan, PredicateCondition::GreaterThanEquals}) {
+    expect_reference_join_result<JoinNestedLoop>(left_ascending, right_descending, JoinMode::Inner,
+                                                 predicate_condition, true);
+  }
+}
+
+TEST_F(OperatorsJoinSortMergeTest, TranslatedForPresortedInputs) {
+  Hyrise::get().storage_manager.add_table("sorted_a", create_table({{1, 2, 4}, {3, 5}}, SortMode::Ascending));
+  Hyrise::get().storage_manager.add_table("sorted_b", create_table({{5, 3, 2}, {9}}, SortMode::Descending));
+  Hyrise::get().storage_manager.add_table("unsorted", create_table({{5, 3, 4}, {9}}, std::nullopt));
+
+  // Left joins are used as the LQPTranslator prefers a JoinArray for inner joins on dense integer keys
+  const auto sorted_a = StoredTableNode::make("sorted_a");
+  const auto sorted_b = StoredTableNode::make("sorted_b");
+  const auto unsorted = StoredTableNode::make("unsorted");
+
+  const auto sorted_join_node =
+      JoinNode::make(JoinMode::Left, equals_(sorted_b->get_column("key"), sorted_a->get_column("key")), sorted_a,
+                     sorted_b);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinSortMerge>(LQPTranslator{}.translate_node(sorted_join_node)));
+
+  // The position column is not sorted
+  const auto unsorted_column_join_node = JoinNode::make(
+      JoinMode::Left, equals_(sorted_a->get_column("position"), sorted_b->get_column("key")), sorted_a, sorted_b);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(LQPTranslator{}.translate_node(unsorted_column_join_node)));
+
+  const auto unsorted_join_node =
+      JoinNode::make(JoinMode::Left, equals_(sorted_a->get_column("key"), unsorted->get_column("key")), sorted_a,
+                     unsorted);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(LQPTranslator{}.translate_node(unsorted_join_node)));
+
+  // A Sort below the join sorts the complete input
+  const auto unsorted_key = unsorted->get_column("key");
+  const auto sort_join_node =
+      JoinNode::make(JoinMode::Left, equals_(sorted_a->get_column("key"), unsorted_key), sorted_a,
+                     SortNode::make(expression_vector(unsorted_key), std::vector<SortMode>{SortMode::Ascending},
+                                    unsorted));
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinSortMerge>(LQPTranslator{}.translate_node(sort_join_node)));
+}
+
 }  // namespace opossum
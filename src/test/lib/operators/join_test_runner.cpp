@@ -3,6 +3,7 @@
 
 #include "base_test.hpp"
 #include "nlohmann/json.hpp"
+#include "operators/join_array.hpp"
 #include "operators/join_hash.hpp"
 #include "operators/join_index.hpp"
 #include "operators/join_nested_loop.hpp"
@@ -771,5 +772,7 @@ INSTANTIATE_TEST_SUITE_P(JoinSortMerge, JoinTestRunner,
                          testing::ValuesIn(JoinTestRunner::create_configurations<JoinSortMerge>()));
 INSTANTIATE_TEST_SUITE_P(JoinIndex, JoinTestRunner,
                          testing::ValuesIn(JoinTestRunner::create_configurations<JoinIndex>()));
+INSTANTIATE_TEST_SUITE_P(JoinArray, JoinTestRunner,
+                         testing::ValuesIn(JoinTestRunner::create_configurations<JoinArray>()));
 
 }  // namespace opossum
@@ -0,0 +1,101 @@
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "operators/multi_predicate_join/multi_predicate_join_evaluator.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class MultiPredicateJoinEvaluatorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _left_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, false}}, TableType::Data,
+        ChunkOffset{2});
+    _left_table->append({1, "x"});
+    _left_table->append({2, "y"});
+    _left_table->append({NULL_VALUE, "x"});
+    _left_table->append({4, "z"});
+    _left_table->append({5, "x"});
+
+    _right_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Long, false}, {"b", DataType::String, true}}, TableType::Data,
+        ChunkOffset{3});
+    _right_table->append({int64_t{2}, "x"});
+    _right_table->append({int64_t{3}, NULL_VALUE});
+    _right_table->append({int64_t{5}, "y"});
+    _right_table->append({int64_t{6}, "x"});
+
+    // left.a < right.a AND left.b = right.b
+    _predicates = {OperatorJoinPredicate{ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::LessThan},
+                   OperatorJoinPredicate{ColumnIDPair{ColumnID{1}, ColumnID{1}}, PredicateCondition::Equals}};
+
+    // All combinations, in an order that differs from the order of the tables
+    for (auto right_chunk_id = ChunkID{0}; right_chunk_id < _right_table->chunk_count(); ++right_chunk_id) {
+      const auto right_chunk_size = _right_table->get_chunk(right_chunk_id)->size();
+      for (auto right_chunk_offset = ChunkOffset{0}; right_chunk_offset < right_chunk_size; ++right_chunk_offset) {
+        for (auto left_chunk_id = ChunkID{0}; left_chunk_id < _left_table->chunk_count(); ++left_chunk_id) {
+          const auto left_chunk_size = _left_table->get_chunk(left_chunk_id)->size();
+          for (auto left_chunk_offset = ChunkOffset{0}; left_chunk_offset < left_chunk_size; ++left_chunk_offset) {
+            _left_row_ids.emplace_back(left_chunk_id, left_chunk_offset);
+            _right_row_ids.emplace_back(right_chunk_id, right_chunk_offset);
+          }
+        }
+      }
+    }
+  }
+
+  std::vector<bool> evaluate_individually(MultiPredicateJoinEvaluator& evaluator) {
+    auto matches = std::vector<bool>{};
+    for (auto candidate_idx = size_t{0}; candidate_idx < _left_row_ids.size(); ++candidate_idx) {
+      matches.emplace_back(evaluator.satisfies_all_predicates(_left_row_ids[candidate_idx],
+                                                              _right_row_ids[candidate_idx]));
+    }
+    return matches;
+  }
+
+  std::shared_ptr<Table> _left_table, _right_table;
+  std::vector<OperatorJoinPredicate> _predicates;
+  std::vector<RowID> _left_row_ids, _right_row_ids;
+};
+
+TEST_F(MultiPredicateJoinEvaluatorTest, BatchMatchesIndividualEvaluation) {
+  auto evaluator = MultiPredicateJoinEvaluator{*_left_table, *_right_table, JoinMode::Inner, _predicates};
+  EXPECT_TRUE(evaluator.has_predicates());
+
+  auto matches = std::vector<bool>{};
+  evaluator.satisfies_all_predicates(_left_row_ids, _right_row_ids, matches);
+  EXPECT_EQ(matches, evaluate_individually(evaluator));
+
+  // (1, x) matches (2, x) and (6, x), (2, y) matches (5, y), and (5, x) matches (6, x)
+  EXPECT_EQ(std::count(matches.cbegin(), matches.cend(), true), 4);
+}
+
+TEST_F(MultiPredicateJoinEvaluatorTest, NullsInAntiNullAsTrue) {
+  auto evaluator = MultiPredicateJoinEvaluator{*_left_table, *_right_table, JoinMode::AntiNullAsTrue, _predicates};
+
+  auto matches = std::vector<bool>{};
+  evaluator.satisfies_all_predicates(_left_row_ids, _right_row_ids, matches);
+  EXPECT_EQ(matches, evaluate_individually(evaluator));
+
+  // In addition to the four pairs above, NULLs satisfy the predicates: the left NULL with (2, x), (6, x), and
+  // (3, NULL), and (1, x), (2, y) with (3, NULL)
+  EXPECT_EQ(std::count(matches.cbegin(), matches.cend(), true), 9);
+}
+
+TEST_F(MultiPredicateJoinEvaluatorTest, EmptyBatchAndNoPredicates) {
+  auto evaluator = MultiPredicateJoinEvaluator{*_left_table, *_right_table, JoinMode::Inner, _predicates};
+  auto matches = std::vector<bool>{true, false};
+  evaluator.satisfies_all_predicates(std::vector<RowID>{}, std::vector<RowID>{}, matches);
+  EXPECT_TRUE(matches.empty());
+
+  auto evaluator_without_predicates = MultiPredicateJoinEvaluator{*_left_table, *_right_table, JoinMode::Inner, {}};
+  EXPECT_FALSE(evaluator_without_predicates.has_predicates());
+  evaluator_without_predicates.satisfies_all_predicates(_left_row_ids, _right_row_ids, matches);
+  EXPECT_EQ(matches, std::vector<bool>(_left_row_ids.size(), true));
+}
+
+}  // namespace opossum
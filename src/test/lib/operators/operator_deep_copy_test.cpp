@@ -5,13 +5,13 @@
 
 #include "expression/expression_functional.hpp"
 #include "hyrise.hpp"
-#include "operators/difference.hpp"
 #include "operators/get_table.hpp"
 #include "operators/join_hash.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
 #include "operators/print.hpp"
+#include "operators/set_operation_hash.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
@@ -81,23 +81,24 @@ TYPED_TEST(DeepCopyTestJoin, DeepCopyJoin) {
   EXPECT_TABLE_EQ_UNORDERED(copied_join->get_output(), expected_result);
 }
 
-TEST_F(OperatorDeepCopyTest, DeepCopyDifference) {
+TEST_F(OperatorDeepCopyTest, DeepCopySetOperationHash) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_filtered2.tbl", 2);
 
-  // build and execute difference
-  auto difference = std::make_shared<Difference>(_table_wrapper_a, _table_wrapper_c);
-  difference->execute();
-  EXPECT_TABLE_EQ_UNORDERED(difference->get_output(), expected_result);
+  // build and execute set operation
+  auto set_operation_hash =
+      std::make_shared<SetOperationHash>(_table_wrapper_a, _table_wrapper_c, SetOperation::Except);
+  set_operation_hash->execute();
+  EXPECT_TABLE_EQ_UNORDERED(set_operation_hash->get_output(), expected_result);
 
-  // Copy and execute copies difference
-  auto copied_difference = difference->deep_copy();
-  EXPECT_NE(copied_difference, nullptr) << "Could not copy Difference";
+  // Copy and execute copies set operation
+  auto copied_set_operation_hash = set_operation_hash->deep_copy();
+  EXPECT_NE(copied_set_operation_hash, nullptr) << "Could not copy SetOperationHash";
 
   // table wrapper needs to be executed manually
-  copied_difference->mutable_left_input()->execute();
-  copied_difference->mutable_right_input()->execute();
-  copied_difference->execute();
-  EXPECT_TABLE_EQ_UNORDERED(copied_difference->get_output(), expected_result);
+  copied_set_operation_hash->mutable_left_input()->execute();
+  copied_set_operation_hash->mutable_right_input()->execute();
+  copied_set_operation_hash->execute();
+  EXPECT_TABLE_EQ_UNORDERED(copied_set_operation_hash->get_output(), expected_result);
 }
 
 TEST_F(OperatorDeepCopyTest, DeepCopyPrint) {
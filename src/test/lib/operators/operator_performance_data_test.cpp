@@ -214,6 +214,11 @@ TEST_F(OperatorPerformanceDataTest, AggregateHashStepRuntimes) {
       static_cast<const OperatorPerformanceData<AggregateHash::OperatorSteps>&>(*aggregate->performance_data);
 
   for (const auto step : magic_enum::enum_values<AggregateHash::OperatorSteps>()) {
+    if (step == AggregateHash::OperatorSteps::Spilling) {
+      // Spilling only happens if a memory budget is given and exceeded.
+      EXPECT_EQ(performance_data.get_step_runtime(step).count(), 0);
+      continue;
+    }
     EXPECT_GT(performance_data.get_step_runtime(step).count(), 0);
   }
 }
@@ -54,6 +54,15 @@ TEST_F(OperatorsProjectionTest, ExecutedOnAllChunks) {
                             load_table("resources/test_data/tbl/projection/int_float_add.tbl"));
 }
 
+TEST_F(OperatorsProjectionTest, OutputRowBudget) {
+  // The first chunk holds two rows, so that the expression is not evaluated for the second chunk
+  const auto projection = std::make_shared<opossum::Projection>(table_wrapper_a, expression_vector(add_(a_a, a_b)));
+  projection->set_output_row_budget(1);
+  projection->execute();
+  EXPECT_EQ(projection->get_output()->chunk_count(), 1u);
+  EXPECT_EQ(projection->get_output()->row_count(), 2u);
+}
+
 TEST_F(OperatorsProjectionTest, PassThroughInvalidRowCount) {
   auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
 
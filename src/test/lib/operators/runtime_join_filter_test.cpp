@@ -0,0 +1,180 @@
+#include <memory>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/get_table.hpp"
+#include "operators/runtime_join_filter.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsRuntimeJoinFilterTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Chunks of a: {0, 2, 10, 0}, {4, 12, 10, 4}, {6, 2, 8, 12}, {8, 6}
+    _table = load_table("resources/test_data/tbl/int_int_shuffled.tbl", 4);
+    Hyrise::get().storage_manager.add_table("table_a", _table);
+  }
+
+  std::shared_ptr<TableWrapper> _build_side(const DataType data_type, const std::vector<AllTypeVariant>& values) {
+    const auto table = std::make_shared<Table>(TableColumnDefinitions{{"x", data_type, true}}, TableType::Data);
+    for (const auto& value : values) {
+      table->append({value});
+    }
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  std::shared_ptr<Table> _expected_table(const std::vector<int32_t>& values) {
+    auto expected_table = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+    for (const auto value : values) {
+      expected_table->append({value, value + 100});
+    }
+    return expected_table;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsRuntimeJoinFilterTest, FilterStoredTable) {
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->execute();
+
+  const auto filter = std::make_shared<RuntimeJoinFilter>(
+      get_table, _build_side(DataType::Int, {12, NULL_VALUE, 13}), ColumnIDPair{ColumnID{0}, ColumnID{0}});
+  filter->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(filter->get_output(), _expected_table({12, 12}));
+  EXPECT_EQ(filter->get_output()->type(), TableType::References);
+
+  // Chunk 0 contains values from 0 to 10 only, chunk 3 from 6 to 8
+  const auto& performance_data = static_cast<const RuntimeJoinFilter::PerformanceData&>(*filter->performance_data);
+  EXPECT_EQ(performance_data.chunks_pruned, 2u);
+  EXPECT_EQ(performance_data.rows_filtered, 6u);
+}
+
+TEST_F(OperatorsRuntimeJoinFilterTest, PruneChunks) {
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->execute();
+
+  const auto filter = std::make_shared<RuntimeJoinFilter>(get_table, _build_side(DataType::Int, {0}),
+                                                          ColumnIDPair{ColumnID{0}, ColumnID{0}});
+  filter->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(filter->get_output(), _expected_table({0, 0}));
+  EXPECT_EQ(filter->get_output()->chunk_count(), 1u);
+
+  const auto& performance_data = static_cast<const RuntimeJoinFilter::PerformanceData&>(*filter->performance_data);
+  EXPECT_EQ(performance_data.chunks_pruned, 3u);
+  EXPECT_EQ(performance_data.rows_filtered, 2u);
+}
+
+TEST_F(OperatorsRuntimeJoinFilterTest, PruneChunksWithPrunedColumns) {
+  // With pruned columns, GetTable creates new chunks. They still have to carry the pruning statistics of the
+  // remaining columns (now at shifted ColumnIDs) so that chunks can be skipped.
+  const auto get_table = std::make_shared<GetTable>("table_a", std::vector<ChunkID>{}, std::vector{ColumnID{0}});
+  get_table->execute();
+  ASSERT_NE(get_table->get_output()->get_chunk(ChunkID{0}), _table->get_chunk(ChunkID{0}));
+
+  const auto filter = std::make_shared<RuntimeJoinFilter>(get_table, _build_side(DataType::Int, {100}),
+                                                          ColumnIDPair{ColumnID{0}, ColumnID{0}});
+  filter->execute();
+
+  EXPECT_EQ(filter->get_output()->column_count(), 1u);
+  EXPECT_EQ(filter->get_output()->row_count(), 2u);
+  EXPECT_EQ(filter->get_output()->get_value<int32_t>(ColumnID{0}, 0u), 100);
+  EXPECT_EQ(filter->get_output()->get_value<int32_t>(ColumnID{0}, 1u), 100);
+
+  const auto& performance_data = static_cast<const RuntimeJoinFilter::PerformanceData&>(*filter->performance_data);
+  EXPECT_EQ(performance_data.chunks_pruned, 3u);
+  EXPECT_EQ(performance_data.rows_filtered, 2u);
+}
+
+TEST_F(OperatorsRuntimeJoinFilterTest, NoBuildSideValues) {
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->execute();
+
+  // NULL values do not find a join partner, so the entire probe side is filtered
+  const auto filter = std::make_shared<RuntimeJoinFilter>(get_table, _build_side(DataType::Int, {NULL_VALUE}),
+                                                          ColumnIDPair{ColumnID{0}, ColumnID{0}});
+  filter->execute();
+
+  EXPECT_EQ(filter->get_output()->row_count(), 0u);
+  EXPECT_EQ(filter->get_output()->column_count(), 2u);
+  EXPECT_EQ(static_cast<const RuntimeJoinFilter::PerformanceData&>(*filter->performance_data).chunks_pruned, 4u);
+}
+
+TEST_F(OperatorsRuntimeJoinFilterTest, DifferentDataTypes) {
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->execute();
+
+  // Values are compared after casting them to the type that JoinHash uses for hashing
+  const auto long_filter = std::make_shared<RuntimeJoinFilter>(
+      get_table, _build_side(DataType::Long, {int64_t{6}, int64_t{8}}), ColumnIDPair{ColumnID{0}, ColumnID{0}});
+  long_filter->execute();
+  EXPECT_TABLE_EQ_UNORDERED(long_filter->get_output(), _expected_table({6, 6, 8, 8}));
+
+  const auto float_filter = std::make_shared<RuntimeJoinFilter>(
+      get_table, _build_side(DataType::Float, {2.0f, 2.5f}), ColumnIDPair{ColumnID{0}, ColumnID{0}});
+  float_filter->execute();
+  EXPECT_TABLE_EQ_UNORDERED(float_filter->get_output(), _expected_table({2, 2}));
+
+  const auto string_filter = std::make_shared<RuntimeJoinFilter>(
+      get_table, _build_side(DataType::String, {pmr_string{"2"}}), ColumnIDPair{ColumnID{0}, ColumnID{0}});
+  EXPECT_THROW(string_filter->execute(), std::logic_error);
+}
+
+TEST_F(OperatorsRuntimeJoinFilterTest, ReferenceInput) {
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  const auto table_scan = create_table_scan(get_table, ColumnID{1}, PredicateCondition::LessThan, 111);
+  const auto filter = std::make_shared<RuntimeJoinFilter>(table_scan, _build_side(DataType::Int, {2, 4, 12}),
+                                                          ColumnIDPair{ColumnID{0}, ColumnID{0}});
+  execute_all({get_table, table_scan, filter});
+
+  EXPECT_TABLE_EQ_UNORDERED(filter->get_output(), _expected_table({2, 2, 4, 4}));
+
+  // The output references the stored table, not the output of the TableScan
+  const auto output_segment = filter->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(output_segment);
+  ASSERT_TRUE(reference_segment);
+  EXPECT_EQ(reference_segment->referenced_table(), _table);
+}
+
+TEST_F(OperatorsRuntimeJoinFilterTest, DeepCopyAndDescription) {
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  const auto filter = std::make_shared<RuntimeJoinFilter>(get_table, _build_side(DataType::Int, {2}),
+                                                          ColumnIDPair{ColumnID{0}, ColumnID{0}});
+  const auto copy = std::static_pointer_cast<RuntimeJoinFilter>(filter->deep_copy());
+  EXPECT_EQ(copy->column_ids(), filter->column_ids());
+
+  execute_all({get_table, filter});
+  EXPECT_EQ(filter->description(DescriptionMode::SingleLine), "RuntimeJoinFilter (a IN build side x)");
+}
+
+TEST_F(OperatorsRuntimeJoinFilterTest, TranslatedFromLQP) {
+  const auto stored_table_node_a = StoredTableNode::make("table_a");
+  Hyrise::get().storage_manager.add_table("table_b", load_table("resources/test_data/tbl/int_int.tbl"));
+  const auto stored_table_node_b = StoredTableNode::make("table_b");
+
+  const auto join_predicate = equals_(stored_table_node_b->get_column("a"), stored_table_node_a->get_column("a"));
+  const auto join_node = JoinNode::make(JoinMode::Semi, join_predicate, stored_table_node_a, stored_table_node_b);
+  join_node->is_runtime_join_filter = true;
+
+  const auto pqp = LQPTranslator{}.translate_node(join_node);
+  ASSERT_EQ(pqp->type(), OperatorType::RuntimeJoinFilter);
+  EXPECT_EQ(std::static_pointer_cast<RuntimeJoinFilter>(pqp)->column_ids(), ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(pqp->left_input()->type(), OperatorType::GetTable);
+}
+
+}  // namespace opossum
@@ -0,0 +1,178 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "operators/projection.hpp"
+#include "operators/set_operation_hash.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+class OperatorsSetOperationHashTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper_a = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float.tbl", 2));
+
+    _table_wrapper_b = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float3.tbl", 2));
+
+    // Both tables contain duplicates and NULLs. Small chunks spread the rows across multiple hash partitions.
+    _table_wrapper_left =
+        std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/set_operations/left.tbl", 2));
+    _table_wrapper_right =
+        std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/set_operations/right.tbl", 2));
+
+    _table_wrapper_a->execute();
+    _table_wrapper_b->execute();
+    _table_wrapper_left->execute();
+    _table_wrapper_right->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper_a;
+  std::shared_ptr<TableWrapper> _table_wrapper_b;
+  std::shared_ptr<TableWrapper> _table_wrapper_left;
+  std::shared_ptr<TableWrapper> _table_wrapper_right;
+};
+
+TEST_F(OperatorsSetOperationHashTest, Description) {
+  const auto set_operation_hash =
+      std::make_shared<SetOperationHash>(_table_wrapper_a, _table_wrapper_b, SetOperation::Intersect);
+  EXPECT_EQ(set_operation_hash->description(DescriptionMode::SingleLine), "SetOperationHash Intersect");
+  EXPECT_EQ(set_operation_hash->description(DescriptionMode::MultiLine), "SetOperationHash\nIntersect");
+}
+
+TEST_F(OperatorsSetOperationHashTest, ExceptOnValueTables) {
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_filtered2.tbl", 2);
+
+  auto set_operation_hash =
+      std::make_shared<SetOperationHash>(_table_wrapper_a, _table_wrapper_b, SetOperation::Except);
+  set_operation_hash->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(set_operation_hash->get_output(), expected_result);
+}
+
+TEST_F(OperatorsSetOperationHashTest, ExceptOnReferenceTables) {
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_filtered2.tbl", 2);
+
+  const auto a = PQPColumnExpression::from_table(*_table_wrapper_a->get_output(), "a");
+  const auto b = PQPColumnExpression::from_table(*_table_wrapper_a->get_output(), "b");
+
+  auto projection1 = std::make_shared<Projection>(_table_wrapper_a, expression_vector(a, b));
+  projection1->execute();
+
+  auto projection2 = std::make_shared<Projection>(_table_wrapper_b, expression_vector(a, b));
+  projection2->execute();
+
+  auto set_operation_hash = std::make_shared<SetOperationHash>(projection1, projection2, SetOperation::Except);
+  set_operation_hash->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(set_operation_hash->get_output(), expected_result);
+}
+
+TEST_F(OperatorsSetOperationHashTest, SetOperationsWithDuplicatesAndNulls) {
+  // NULLs are equal to each other, and each row is returned at most once
+  for (const auto& [set_operation, expected_result_file] :
+       std::vector<std::pair<SetOperation, std::string>>{{SetOperation::Except, "except.tbl"},
+                                                         {SetOperation::Intersect, "intersect.tbl"},
+                                                         {SetOperation::Union, "union.tbl"}}) {
+    const auto expected_result = load_table("resources/test_data/tbl/set_operations/" + expected_result_file);
+
+    const auto set_operation_hash =
+        std::make_shared<SetOperationHash>(_table_wrapper_left, _table_wrapper_right, set_operation);
+    set_operation_hash->execute();
+
+    EXPECT_EQ(set_operation_hash->get_output()->type(), TableType::References);
+    EXPECT_TABLE_EQ_UNORDERED(set_operation_hash->get_output(), expected_result);
+  }
+}
+
+TEST_F(OperatorsSetOperationHashTest, UnionOnReferenceTables) {
+  const auto expected_result = load_table("resources/test_data/tbl/set_operations/union.tbl");
+
+  // The scans remove no rows, but turn the inputs into reference tables
+  const auto b = PQPColumnExpression::from_table(*_table_wrapper_left->get_output(), "b");
+  const auto table_scan_left = std::make_shared<TableScan>(_table_wrapper_left, is_not_null_(b));
+  table_scan_left->execute();
+  const auto table_scan_right = std::make_shared<TableScan>(_table_wrapper_right, is_not_null_(b));
+  table_scan_right->execute();
+
+  const auto set_operation_hash =
+      std::make_shared<SetOperationHash>(table_scan_left, table_scan_right, SetOperation::Union);
+  set_operation_hash->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(set_operation_hash->get_output(), expected_result);
+}
+
+TEST_F(OperatorsSetOperationHashTest, EmptyInput) {
+  const auto empty_table = std::make_shared<Table>(_table_wrapper_right->get_output()->column_definitions(),
+                                                   TableType::Data);
+  const auto empty_table_wrapper = std::make_shared<TableWrapper>(empty_table);
+  empty_table_wrapper->execute();
+
+  const auto except =
+      std::make_shared<SetOperationHash>(_table_wrapper_left, empty_table_wrapper, SetOperation::Except);
+  except->execute();
+  EXPECT_EQ(except->get_output()->row_count(), 5u);
+
+  const auto intersect =
+      std::make_shared<SetOperationHash>(_table_wrapper_left, empty_table_wrapper, SetOperation::Intersect);
+  intersect->execute();
+  EXPECT_EQ(intersect->get_output()->row_count(), 0u);
+}
+
+TEST_F(OperatorsSetOperationHashTest, ThrowWrongColumnNumberException) {
+  auto table_wrapper_c = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int.tbl", 2));
+  table_wrapper_c->execute();
+
+  auto set_operation_hash = std::make_shared<SetOperationHash>(_table_wrapper_a, table_wrapper_c, SetOperation::Except);
+
+  EXPECT_THROW(set_operation_hash->execute(), std::exception);
+}
+
+TEST_F(OperatorsSetOperationHashTest, ThrowWrongColumnOrderException) {
+  auto table_wrapper_d = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/float_int.tbl", 2));
+  table_wrapper_d->execute();
+
+  auto set_operation_hash = std::make_shared<SetOperationHash>(_table_wrapper_a, table_wrapper_d, SetOperation::Except);
+
+  EXPECT_THROW(set_operation_hash->execute(), std::exception);
+}
+
+TEST_F(OperatorsSetOperationHashTest, ForwardSortedByFlag) {
+  // Verify that the sorted_by flag is not set when it's not present in left input.
+  const auto set_operation_hash_unsorted =
+      std::make_shared<SetOperationHash>(_table_wrapper_a, _table_wrapper_b, SetOperation::Except);
+  set_operation_hash_unsorted->execute();
+
+  const auto& result_table_unsorted = set_operation_hash_unsorted->get_output();
+  for (auto chunk_id = ChunkID{0}; chunk_id < result_table_unsorted->chunk_count(); ++chunk_id) {
+    const auto& sorted_by = result_table_unsorted->get_chunk(chunk_id)->individually_sorted_by();
+    EXPECT_TRUE(sorted_by.empty());
+  }
+
+  // Verify that the sorted_by flag is set when it's present in left input.
+  const auto sort_definition = std::vector<SortColumnDefinition>{SortColumnDefinition(ColumnID{0})};
+  const auto sort = std::make_shared<Sort>(_table_wrapper_a, sort_definition);
+  sort->execute();
+
+  const auto set_operation_hash_sorted =
+      std::make_shared<SetOperationHash>(sort, _table_wrapper_b, SetOperation::Except);
+  set_operation_hash_sorted->execute();
+
+  const auto& result_table_sorted = set_operation_hash_sorted->get_output();
+  for (auto chunk_id = ChunkID{0}; chunk_id < result_table_sorted->chunk_count(); ++chunk_id) {
+    const auto sorted_by = result_table_sorted->get_chunk(chunk_id)->individually_sorted_by();
+    EXPECT_EQ(sorted_by, sort_definition);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,148 @@
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "operators/sort/normalized_keys.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class NormalizedKeysTest : public BaseTest {
+ protected:
+  static constexpr auto CHUNK_SIZE = uint32_t{3};
+
+  static std::shared_ptr<Table> create_table(const TableColumnDefinitions& column_definitions,
+                                             const std::vector<std::vector<AllTypeVariant>>& rows) {
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{CHUNK_SIZE});
+    for (const auto& row : rows) {
+      table->append(row);
+    }
+    return table;
+  }
+
+  static std::unique_ptr<NormalizedKeys> materialize(const std::shared_ptr<Table>& table,
+                                                     const std::vector<SortColumnDefinition>& sort_definitions) {
+    auto normalized_keys = std::make_unique<NormalizedKeys>(table, sort_definitions);
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      normalized_keys->materialize(chunk_id);
+    }
+    return normalized_keys;
+  }
+
+  static RowID row(const size_t row_idx) {
+    return RowID{ChunkID{static_cast<uint32_t>(row_idx / CHUNK_SIZE)},
+                 ChunkOffset{static_cast<uint32_t>(row_idx % CHUNK_SIZE)}};
+  }
+
+  // Expects that the rows are strictly ordered as given by their indexes
+  static void expect_order(const NormalizedKeys& normalized_keys, const std::vector<size_t>& row_idxs) {
+    for (auto lhs_position = size_t{0}; lhs_position < row_idxs.size(); ++lhs_position) {
+      for (auto rhs_position = size_t{0}; rhs_position < row_idxs.size(); ++rhs_position) {
+        const auto result = normalized_keys.compare(row(row_idxs[lhs_position]), row(row_idxs[rhs_position]));
+        if (lhs_position < rhs_position) {
+          EXPECT_LT(result, 0) << "Rows " << row_idxs[lhs_position] << " and " << row_idxs[rhs_position];
+        } else if (lhs_position > rhs_position) {
+          EXPECT_GT(result, 0) << "Rows " << row_idxs[lhs_position] << " and " << row_idxs[rhs_position];
+        } else {
+          EXPECT_EQ(result, 0);
+        }
+      }
+    }
+  }
+};
+
+TEST_F(NormalizedKeysTest, NumericValues) {
+  const auto table = create_table(
+      TableColumnDefinitions{{"a", DataType::Int, false},
+                             {"b", DataType::Long, false},
+                             {"c", DataType::Float, false},
+                             {"d", DataType::Double, false}},
+      {{std::numeric_limits<int32_t>::min(), std::numeric_limits<int64_t>::min(), -std::numeric_limits<float>::max(),
+        -std::numeric_limits<double>::infinity()},
+       {int32_t{-5}, int64_t{-5'000'000'000}, -2.5f, -2.5},
+       {int32_t{-1}, int64_t{-1}, -0.5f, -0.5},
+       {int32_t{0}, int64_t{0}, 0.0f, 0.0},
+       {int32_t{1}, int64_t{1}, 0.5f, 0.5},
+       {int32_t{256}, int64_t{5'000'000'000}, 2.5f, 2.5},
+       {std::numeric_limits<int32_t>::max(), std::numeric_limits<int64_t>::max(), std::numeric_limits<float>::max(),
+        std::numeric_limits<double>::infinity()}});
+
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    const auto ascending_keys = materialize(table, {SortColumnDefinition{column_id, SortMode::Ascending}});
+    EXPECT_TRUE(ascending_keys->keys_are_complete());
+    expect_order(*ascending_keys, {0, 1, 2, 3, 4, 5, 6});
+
+    const auto descending_keys = materialize(table, {SortColumnDefinition{column_id, SortMode::Descending}});
+    expect_order(*descending_keys, {6, 5, 4, 3, 2, 1, 0});
+  }
+}
+
+TEST_F(NormalizedKeysTest, NegativeZero) {
+  const auto table = create_table(TableColumnDefinitions{{"a", DataType::Double, false}}, {{-0.0}, {0.0}});
+  const auto normalized_keys = materialize(table, {SortColumnDefinition{ColumnID{0}}});
+
+  EXPECT_EQ(normalized_keys->key_width(), sizeof(double));
+  EXPECT_EQ(normalized_keys->compare(row(0), row(1)), 0);
+}
+
+TEST_F(NormalizedKeysTest, NullsFirstAndLast) {
+  const auto table = create_table(TableColumnDefinitions{{"a", DataType::Int, true}},
+                                  {{NullValue{}}, {int32_t{-1}}, {int32_t{3}}, {NullValue{}}});
+
+  const auto ascending_keys = materialize(table, {SortColumnDefinition{ColumnID{0}, SortMode::Ascending}});
+  EXPECT_EQ(ascending_keys->key_width(), 1 + sizeof(int32_t));
+  expect_order(*ascending_keys, {0, 1, 2});
+  EXPECT_EQ(ascending_keys->compare(row(0), row(3)), 0);
+
+  // NULLs come first for descending orders, too
+  const auto descending_keys = materialize(table, {SortColumnDefinition{ColumnID{0}, SortMode::Descending}});
+  expect_order(*descending_keys, {0, 2, 1});
+
+  const auto ascending_nulls_last_keys =
+      materialize(table, {SortColumnDefinition{ColumnID{0}, SortMode::AscendingNullsLast}});
+  expect_order(*ascending_nulls_last_keys, {1, 2, 0});
+  EXPECT_EQ(ascending_nulls_last_keys->compare(row(0), row(3)), 0);
+
+  const auto descending_nulls_last_keys =
+      materialize(table, {SortColumnDefinition{ColumnID{0}, SortMode::DescendingNullsLast}});
+  expect_order(*descending_nulls_last_keys, {2, 1, 3});
+}
+
+TEST_F(NormalizedKeysTest, StringPrefixes) {
+  // The first three strings share a prefix of more than STRING_PREFIX_LENGTH characters
+  const auto table = create_table(TableColumnDefinitions{{"a", DataType::String, false}, {"b", DataType::Int, false}},
+                                  {{pmr_string{"a long common prefix, then a"}, int32_t{2}},
+                                   {pmr_string{"a long common prefix, then b"}, int32_t{1}},
+                                   {pmr_string{"a long common prefix, then b"}, int32_t{3}},
+                                   {pmr_string{"b"}, int32_t{0}}});
+
+  const auto normalized_keys = materialize(
+      table, {SortColumnDefinition{ColumnID{0}, SortMode::Ascending}, SortColumnDefinition{ColumnID{1}}});
+  EXPECT_FALSE(normalized_keys->keys_are_complete());
+
+  // The column after the string column is not encoded, but used to break ties
+  EXPECT_EQ(normalized_keys->key_width(), NormalizedKeys::STRING_PREFIX_LENGTH);
+  expect_order(*normalized_keys, {0, 1, 2, 3});
+
+  const auto descending_keys = materialize(
+      table, {SortColumnDefinition{ColumnID{0}, SortMode::Descending}, SortColumnDefinition{ColumnID{1}}});
+  expect_order(*descending_keys, {3, 1, 2, 0});
+}
+
+TEST_F(NormalizedKeysTest, MultipleColumns) {
+  const auto table =
+      create_table(TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Float, true}},
+                   {{int32_t{1}, 2.0f}, {int32_t{1}, 1.0f}, {int32_t{1}, NullValue{}}, {int32_t{2}, 3.0f}});
+
+  const auto normalized_keys = materialize(
+      table, {SortColumnDefinition{ColumnID{0}, SortMode::Ascending},
+              SortColumnDefinition{ColumnID{1}, SortMode::DescendingNullsLast}});
+  EXPECT_TRUE(normalized_keys->keys_are_complete());
+  EXPECT_EQ(normalized_keys->key_width(), sizeof(int32_t) + 1 + sizeof(float));
+  expect_order(*normalized_keys, {0, 1, 2, 3});
+}
+
+}  // namespace opossum
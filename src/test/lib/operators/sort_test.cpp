@@ -2,6 +2,7 @@
 
 #include "operators/join_hash.hpp"
 #include "operators/sort.hpp"
+#include "operators/sort/normalized_keys.hpp"
 #include "operators/table_wrapper.hpp"
 
 namespace opossum {
@@ -131,6 +132,11 @@ INSTANTIATE_TEST_SUITE_P(Variations, SortTest,
                            SortTestParam{{SortColumnDefinition{ColumnID{0}, SortMode::Descending}},                                                          false, false, Chunk::DEFAULT_SIZE, Sort::ForceMaterialization::No,  "a_desc.tbl"},            // NOLINT
                            SortTestParam{{SortColumnDefinition{ColumnID{0}, SortMode::Ascending},  SortColumnDefinition{ColumnID{1}, SortMode::Descending}}, false, false, Chunk::DEFAULT_SIZE, Sort::ForceMaterialization::No,  "a_asc_b_desc.tbl"},      // NOLINT
                            SortTestParam{{SortColumnDefinition{ColumnID{0}, SortMode::Descending}, SortColumnDefinition{ColumnID{1}, SortMode::Ascending}},  false, false, Chunk::DEFAULT_SIZE, Sort::ForceMaterialization::No,  "a_desc_b_asc.tbl"},      // NOLINT
+                           SortTestParam{{SortColumnDefinition{ColumnID{2}, SortMode::Descending}, SortColumnDefinition{ColumnID{0}, SortMode::Ascending}},  false, false, Chunk::DEFAULT_SIZE, Sort::ForceMaterialization::No,  "c_desc_a_asc.tbl"},      // NOLINT
+
+                           // NULLS LAST
+                           SortTestParam{{SortColumnDefinition{ColumnID{1}, SortMode::AscendingNullsLast}},                                                  false, false, Chunk::DEFAULT_SIZE, Sort::ForceMaterialization::No,  "b_asc_nulls_last.tbl"},  // NOLINT
+                           SortTestParam{{SortColumnDefinition{ColumnID{1}, SortMode::DescendingNullsLast}, SortColumnDefinition{ColumnID{0}, SortMode::Ascending}}, false, true,  40,                  Sort::ForceMaterialization::Yes, "b_desc_nulls_last_a_asc.tbl"},  // NOLINT
 
                            // Output chunk size
                            SortTestParam{{SortColumnDefinition{ColumnID{0}, SortMode::Ascending},  SortColumnDefinition{ColumnID{1}, SortMode::Descending}}, false, false, 40,                  Sort::ForceMaterialization::No,  "a_asc_b_desc.tbl"},      // NOLINT
@@ -153,6 +159,93 @@ INSTANTIATE_TEST_SUITE_P(Variations, SortTest,
                          sort_test_formatter);
 // clang-format on
 
+TEST_F(SortTest, OutputSortedBy) {
+  // Chunks can only be marked as sorted with NULLs first. Without NULLs, the NULLS LAST order is the same.
+  auto sort_nullable = Sort{input_table_wrapper, {SortColumnDefinition{ColumnID{1}, SortMode::AscendingNullsLast}}};
+  sort_nullable.execute();
+  EXPECT_TRUE(sort_nullable.get_output()->get_chunk(ChunkID{0})->individually_sorted_by().empty());
+
+  auto sort_not_nullable =
+      Sort{input_table_wrapper, {SortColumnDefinition{ColumnID{0}, SortMode::DescendingNullsLast}}};
+  sort_not_nullable.execute();
+  const auto expected_sorted_by = std::vector{SortColumnDefinition{ColumnID{0}, SortMode::Descending}};
+  EXPECT_EQ(sort_not_nullable.get_output()->get_chunk(ChunkID{0})->individually_sorted_by(), expected_sorted_by);
+}
+
+TEST_F(SortTest, LongStringPrefixes) {
+  // The normalized keys only contain a prefix of each string. Rows with equal prefixes are ordered by their values,
+  // rows with equal strings by the second sort column.
+  const auto table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::String, false}, {"b", DataType::Int, false}},
+                              TableType::Data, ChunkOffset{4});
+  const auto prefix = std::string(2 * NormalizedKeys::STRING_PREFIX_LENGTH, 'x');
+  for (const auto& [suffix, value] : std::vector<std::pair<std::string, int32_t>>{
+           {"c", 1}, {"a", 2}, {"", 3}, {"b", 4}, {"a", 0}, {"ab", 5}, {"c", 6}, {"", 7}, {"b", 8}, {"aa", 9}}) {
+    table->append({pmr_string{prefix + suffix}, value});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto sort = Sort{table_wrapper, {SortColumnDefinition{ColumnID{0}, SortMode::Descending},
+                                   SortColumnDefinition{ColumnID{1}, SortMode::Ascending}}};
+  sort.execute();
+
+  auto expected_table = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+  for (const auto& [suffix, value] : std::vector<std::pair<std::string, int32_t>>{
+           {"c", 1}, {"c", 6}, {"b", 4}, {"b", 8}, {"ab", 5}, {"aa", 9}, {"a", 0}, {"a", 2}, {"", 3}, {"", 7}}) {
+    expected_table->append({pmr_string{prefix + suffix}, value});
+  }
+  EXPECT_TABLE_EQ_ORDERED(sort.get_output(), expected_table);
+}
+
+TEST_F(SortTest, ExternalSort) {
+  // With a budget of 200 bytes, the keys of about ten rows fit into memory, so that two chunks form a sorted run
+  const auto table_wrapper =
+      std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/sort/input.tbl", ChunkOffset{4}));
+  table_wrapper->execute();
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, greater_than_(a, 2));
+  table_scan->execute();
+
+  const auto sort_definitions_variations = std::vector<std::vector<SortColumnDefinition>>{
+      {SortColumnDefinition{ColumnID{0}, SortMode::Ascending}},
+      {SortColumnDefinition{ColumnID{1}, SortMode::Descending}},
+      {SortColumnDefinition{ColumnID{1}, SortMode::DescendingNullsLast},
+       SortColumnDefinition{ColumnID{0}, SortMode::Ascending}},
+      {SortColumnDefinition{ColumnID{2}, SortMode::Descending},
+       SortColumnDefinition{ColumnID{0}, SortMode::Ascending}}};
+
+  for (const auto& input : std::vector<std::shared_ptr<AbstractOperator>>{table_wrapper, table_scan}) {
+    for (const auto& sort_definitions : sort_definitions_variations) {
+      for (const auto force_materialization : {Sort::ForceMaterialization::No, Sort::ForceMaterialization::Yes}) {
+        auto in_memory_sort = Sort{input, sort_definitions, ChunkOffset{7}, force_materialization};
+        in_memory_sort.execute();
+
+        auto external_sort = Sort{input, sort_definitions, ChunkOffset{7}, force_materialization, size_t{200}};
+        external_sort.execute();
+
+        EXPECT_TABLE_EQ_ORDERED(external_sort.get_output(), in_memory_sort.get_output());
+        EXPECT_EQ(external_sort.get_output()->type(), in_memory_sort.get_output()->type());
+        EXPECT_EQ(external_sort.get_output()->chunk_count(), in_memory_sort.get_output()->chunk_count());
+
+        const auto& performance_data = static_cast<const Sort::PerformanceData&>(*external_sort.performance_data);
+        EXPECT_GT(performance_data.spilled_run_count, 1u);
+        EXPECT_GT(performance_data.spilled_bytes, 0u);
+      }
+    }
+  }
+}
+
+TEST_F(SortTest, NoSpillingWithinMemoryBudget) {
+  auto sort = Sort{input_table_wrapper, {SortColumnDefinition{ColumnID{0}}}, Chunk::DEFAULT_SIZE,
+                   Sort::ForceMaterialization::No, size_t{1'000'000}};
+  sort.execute();
+
+  const auto& performance_data = static_cast<const Sort::PerformanceData&>(*sort.performance_data);
+  EXPECT_EQ(performance_data.spilled_run_count, 0u);
+  EXPECT_EQ(sort.description(DescriptionMode::SingleLine), "Sort Memory budget: 1000000 bytes");
+}
+
 TEST_F(SortTest, JoinProducesReferences) {
   // Even though not all columns in a join result refer to the same table, the output should use references
   const auto right_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int3.tbl"));
@@ -282,6 +282,21 @@ TEST_P(OperatorsTableScanTest, SingleScan) {
   EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
 }
 
+TEST_P(OperatorsTableScanTest, OutputRowBudget) {
+  // The first chunk has four matches, the second one has six
+  const auto scan = create_table_scan(_int_int_compressed, ColumnID{0}, PredicateCondition::GreaterThanEquals, 4);
+  scan->set_output_row_budget(3);
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->chunk_count(), 1u);
+  EXPECT_EQ(scan->get_output()->row_count(), 4u);
+
+  const auto exceeding_scan =
+      create_table_scan(_int_int_compressed, ColumnID{0}, PredicateCondition::GreaterThanEquals, 4);
+  exceeding_scan->set_output_row_budget(5);
+  exceeding_scan->execute();
+  EXPECT_EQ(exceeding_scan->get_output()->row_count(), 10u);
+}
+
 TEST_P(OperatorsTableScanTest, SingleScanWithSortedSegmentEquals) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_sorted_filtered.tbl", 1);
 
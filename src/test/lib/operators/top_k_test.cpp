@@ -0,0 +1,210 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/get_table.hpp"
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
+#include "storage/reference_segment.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsTopKTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/sort/input.tbl", 10));
+    _table_wrapper->execute();
+
+    // Chunks of a: {0, 2, 10, 0}, {4, 12, 10, 4}, {6, 2, 8, 12}, {8, 6}
+    Hyrise::get().storage_manager.add_table("table_a", load_table("resources/test_data/tbl/int_int_shuffled.tbl", 4));
+  }
+
+  // The TopK has to return the same rows in the same order as a Sort followed by a Limit
+  static void test_against_sort_and_limit(const std::shared_ptr<AbstractOperator>& input,
+                                          const std::vector<SortColumnDefinition>& sort_definitions,
+                                          const int64_t row_count) {
+    const auto top_k = std::make_shared<TopK>(input, sort_definitions, value_(row_count));
+    top_k->execute();
+
+    const auto sort = std::make_shared<Sort>(input, sort_definitions);
+    sort->execute();
+    const auto limit = std::make_shared<Limit>(sort, value_(row_count));
+    limit->execute();
+
+    EXPECT_TABLE_EQ_ORDERED(top_k->get_output(), limit->get_output());
+  }
+
+  static size_t chunks_pruned(const TopK& top_k) {
+    return static_cast<const TopK::PerformanceData&>(*top_k.performance_data).chunks_pruned;
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsTopKTest, SameResultAsSortAndLimit) {
+  // Column a is not nullable, column b contains NULLs, and column c contains distinct strings
+  const auto sort_definitions_variations = std::vector<std::vector<SortColumnDefinition>>{
+      {SortColumnDefinition{ColumnID{0}, SortMode::Ascending}},
+      {SortColumnDefinition{ColumnID{0}, SortMode::Descending}},
+      {SortColumnDefinition{ColumnID{1}, SortMode::Ascending}},
+      {SortColumnDefinition{ColumnID{1}, SortMode::Descending}},
+      {SortColumnDefinition{ColumnID{0}, SortMode::Ascending}, SortColumnDefinition{ColumnID{1}, SortMode::Descending}},
+      {SortColumnDefinition{ColumnID{1}, SortMode::Descending}, SortColumnDefinition{ColumnID{2}, SortMode::Ascending}},
+      {SortColumnDefinition{ColumnID{1}, SortMode::AscendingNullsLast}},
+      {SortColumnDefinition{ColumnID{1}, SortMode::DescendingNullsLast},
+       SortColumnDefinition{ColumnID{0}, SortMode::AscendingNullsLast}},
+      {SortColumnDefinition{ColumnID{2}, SortMode::Descending}}};
+
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_(a, 2));
+  table_scan->execute();
+
+  for (const auto& sort_definitions : sort_definitions_variations) {
+    for (const auto row_count : {int64_t{0}, int64_t{1}, int64_t{7}, int64_t{15}, int64_t{100}}) {
+      SCOPED_TRACE(std::string{"k = "} + std::to_string(row_count));
+      test_against_sort_and_limit(_table_wrapper, sort_definitions, row_count);
+      test_against_sort_and_limit(table_scan, sort_definitions, row_count);
+    }
+  }
+}
+
+TEST_F(OperatorsTopKTest, EmptyInput) {
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper, equals_(1, 2));
+  table_scan->execute();
+
+  const auto top_k =
+      std::make_shared<TopK>(table_scan, std::vector{SortColumnDefinition{ColumnID{0}}}, value_(int64_t{5}));
+  top_k->execute();
+
+  EXPECT_EQ(top_k->get_output()->row_count(), 0u);
+  EXPECT_EQ(top_k->get_output()->column_definitions(), table_scan->get_output()->column_definitions());
+}
+
+TEST_F(OperatorsTopKTest, OutputIsSorted) {
+  const auto sort_definition = SortColumnDefinition{ColumnID{1}, SortMode::Descending};
+  const auto top_k = std::make_shared<TopK>(_table_wrapper, std::vector{sort_definition}, value_(int64_t{12}));
+  top_k->execute();
+
+  const auto& output_table = top_k->get_output();
+  EXPECT_EQ(output_table->type(), TableType::References);
+  ASSERT_EQ(output_table->chunk_count(), 1u);
+  EXPECT_EQ(output_table->get_chunk(ChunkID{0})->individually_sorted_by(), std::vector{sort_definition});
+}
+
+TEST_F(OperatorsTopKTest, PruneChunksAscending) {
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->execute();
+
+  // The chunk with the smallest minimum of a is processed first. It contains 0, 0, and 2, so that the chunks with the
+  // minima 4 and 6 are pruned. The chunk with the minimum 2 has to be processed.
+  const auto sort_definitions = std::vector{SortColumnDefinition{ColumnID{0}, SortMode::Ascending}};
+  const auto top_k = std::make_shared<TopK>(get_table, sort_definitions, value_(int64_t{3}));
+  top_k->execute();
+
+  test_against_sort_and_limit(get_table, sort_definitions, 3);
+  EXPECT_EQ(chunks_pruned(*top_k), 2u);
+}
+
+TEST_F(OperatorsTopKTest, PruneChunksDescending) {
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->execute();
+
+  // The k-th value after the first chunk is 10, which prunes the chunk with the maximum 8 only
+  const auto sort_definitions = std::vector{SortColumnDefinition{ColumnID{0}, SortMode::Descending}};
+  const auto top_k = std::make_shared<TopK>(get_table, sort_definitions, value_(int64_t{2}));
+  top_k->execute();
+
+  test_against_sort_and_limit(get_table, sort_definitions, 2);
+  EXPECT_EQ(chunks_pruned(*top_k), 1u);
+}
+
+TEST_F(OperatorsTopKTest, PruneChunksOfReferenceInput) {
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->execute();
+
+  // Each output segment of the TableScan references a single chunk, whose pruning statistics can be used
+  const auto b = pqp_column_(ColumnID{1}, DataType::Int, false, "b");
+  const auto table_scan = std::make_shared<TableScan>(get_table, greater_than_equals_(b, 100));
+  table_scan->execute();
+
+  const auto sort_definitions = std::vector{SortColumnDefinition{ColumnID{0}, SortMode::Ascending}};
+  const auto top_k = std::make_shared<TopK>(table_scan, sort_definitions, value_(int64_t{3}));
+  top_k->execute();
+
+  test_against_sort_and_limit(table_scan, sort_definitions, 3);
+  EXPECT_EQ(chunks_pruned(*top_k), 2u);
+}
+
+TEST_F(OperatorsTopKTest, InputReferencesDifferentTables) {
+  // As for the Sort, the output is materialized if a column references multiple tables (e.g., after a union)
+  const auto second_table = load_table("resources/test_data/tbl/sort/a_asc.tbl", 10);
+
+  const auto union_table = std::make_shared<Table>(
+      TableColumnDefinitions{TableColumnDefinition{"a", DataType::Int, true}}, TableType::References);
+
+  auto pos_list = std::make_shared<RowIDPosList>();
+  pos_list->emplace_back(RowID{ChunkID{0}, ChunkOffset{0}});
+  pos_list->emplace_back(RowID{ChunkID{0}, ChunkOffset{1}});
+  pos_list->emplace_back(RowID{ChunkID{1}, ChunkOffset{0}});
+
+  union_table->append_chunk(
+      Segments{std::make_shared<ReferenceSegment>(_table_wrapper->get_output(), ColumnID{0}, pos_list)});
+  union_table->append_chunk(Segments{std::make_shared<ReferenceSegment>(second_table, ColumnID{0}, pos_list)});
+
+  const auto union_table_wrapper = std::make_shared<TableWrapper>(union_table);
+  union_table_wrapper->execute();
+
+  const auto sort_definitions = std::vector{SortColumnDefinition{ColumnID{0}, SortMode::Descending}};
+  const auto top_k = std::make_shared<TopK>(union_table_wrapper, sort_definitions, value_(int64_t{4}));
+  top_k->execute();
+
+  EXPECT_EQ(top_k->get_output()->type(), TableType::Data);
+  test_against_sort_and_limit(union_table_wrapper, sort_definitions, 4);
+}
+
+TEST_F(OperatorsTopKTest, TranslatedFromLQP) {
+  const auto stored_table_node = StoredTableNode::make("table_a");
+  const auto b = stored_table_node->get_column("b");
+
+  // clang-format off
+  const auto limit_node =
+  LimitNode::make(value_(int64_t{3}),
+    SortNode::make(expression_vector(b), std::vector<SortMode>{SortMode::Descending},
+      stored_table_node));
+  // clang-format on
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<Limit>(LQPTranslator{}.translate_node(limit_node)));
+
+  limit_node->is_top_k = true;
+  const auto pqp = LQPTranslator{}.translate_node(limit_node);
+  const auto top_k = std::dynamic_pointer_cast<TopK>(pqp);
+  ASSERT_TRUE(top_k);
+  const auto expected_sort_definitions = std::vector{SortColumnDefinition{ColumnID{1}, SortMode::Descending}};
+  EXPECT_EQ(top_k->sort_definitions(), expected_sort_definitions);
+  EXPECT_EQ(*top_k->row_count_expression(), *value_(int64_t{3}));
+  EXPECT_EQ(top_k->left_input()->type(), OperatorType::GetTable);
+}
+
+TEST_F(OperatorsTopKTest, Description) {
+  const auto top_k = std::make_shared<TopK>(
+      _table_wrapper,
+      std::vector{SortColumnDefinition{ColumnID{0}, SortMode::Ascending},
+                  SortColumnDefinition{ColumnID{2}, SortMode::Descending}},
+      value_(int64_t{5}));
+  EXPECT_EQ(top_k->description(DescriptionMode::SingleLine), "TopK (k: 5L) [a Ascending, c Descending]");
+  EXPECT_EQ(top_k->description(DescriptionMode::MultiLine), "TopK\n(k: 5L)\n[a Ascending, c Descending]");
+}
+
+}  // namespace opossum
@@ -0,0 +1,103 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/get_table.hpp"
+#include "operators/unique_index_scan.hpp"
+#include "operators/validate.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/encoding_type.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsUniqueIndexScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("resources/test_data/tbl/int_int_int.tbl", 2);
+    ChunkEncoder::encode_chunks(_table, {ChunkID{0}}, SegmentEncodingSpec{EncodingType::Dictionary});
+    Hyrise::get().storage_manager.add_table("table_a", _table);
+    _table->enforce_key_constraint({{ColumnID{0}, ColumnID{2}}, KeyConstraintType::PRIMARY_KEY});
+  }
+
+  std::shared_ptr<const Table> _scan(const std::shared_ptr<GetTable>& get_table,
+                                     const std::vector<AllTypeVariant>& values) {
+    get_table->execute();
+    const auto unique_index_scan =
+        std::make_shared<UniqueIndexScan>(get_table, std::vector<ColumnID>{ColumnID{2}, ColumnID{0}}, values);
+    unique_index_scan->execute();
+    return unique_index_scan->get_output();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsUniqueIndexScanTest, Lookup) {
+  auto expected_table = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+  expected_table->append({9, 10, 11});
+
+  EXPECT_TABLE_EQ_UNORDERED(_scan(std::make_shared<GetTable>("table_a"), {11, 9}), expected_table);
+
+  // Values are converted to the column's data type if possible
+  EXPECT_TABLE_EQ_UNORDERED(_scan(std::make_shared<GetTable>("table_a"), {int64_t{11}, 9.0}), expected_table);
+  EXPECT_EQ(_scan(std::make_shared<GetTable>("table_a"), {11, 9.5})->row_count(), 0u);
+  EXPECT_EQ(_scan(std::make_shared<GetTable>("table_a"), {11, NULL_VALUE})->row_count(), 0u);
+
+  // Keys in the unencoded chunk
+  EXPECT_EQ(_scan(std::make_shared<GetTable>("table_a"), {9, 9})->row_count(), 1u);
+  EXPECT_EQ(_scan(std::make_shared<GetTable>("table_a"), {10, 9})->row_count(), 0u);
+}
+
+TEST_F(OperatorsUniqueIndexScanTest, PrunedChunksAndColumns) {
+  const auto get_table =
+      std::make_shared<GetTable>("table_a", std::vector<ChunkID>{}, std::vector<ColumnID>{ColumnID{1}});
+  const auto result = _scan(get_table, {11, 9});
+  EXPECT_EQ(result->column_count(), 2u);
+  EXPECT_EQ(result->column_name(ColumnID{1}), "c");
+  ASSERT_EQ(result->row_count(), 1u);
+  EXPECT_EQ(result->get_value<int32_t>(ColumnID{1}, 0), 11);
+
+  const auto pruned_get_table =
+      std::make_shared<GetTable>("table_a", std::vector<ChunkID>{ChunkID{0}}, std::vector<ColumnID>{});
+  EXPECT_EQ(_scan(pruned_get_table, {11, 9})->row_count(), 0u);
+}
+
+TEST_F(OperatorsUniqueIndexScanTest, OutputNeedsValidation) {
+  const auto sql = "UPDATE table_a SET b = 20 WHERE a = 9 AND c = 11";
+  EXPECT_EQ(SQLPipelineBuilder{sql}.create_pipeline().get_result_table().first, SQLPipelineStatus::Success);
+
+  // Both versions of the row are returned, Validate removes the outdated one
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  const auto unique_index_scan = std::make_shared<UniqueIndexScan>(
+      get_table, std::vector<ColumnID>{ColumnID{0}, ColumnID{2}}, std::vector<AllTypeVariant>{9, 11});
+  const auto validate = std::make_shared<Validate>(unique_index_scan);
+  validate->set_transaction_context(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No));
+  execute_all({get_table, unique_index_scan, validate});
+
+  EXPECT_EQ(unique_index_scan->get_output()->row_count(), 2u);
+  ASSERT_EQ(validate->get_output()->row_count(), 1u);
+  EXPECT_EQ(validate->get_output()->get_value<int32_t>(ColumnID{1}, 0), 20);
+}
+
+TEST_F(OperatorsUniqueIndexScanTest, TranslatedFromLQP) {
+  const auto stored_table_node = StoredTableNode::make("table_a");
+  const auto predicate_node = PredicateNode::make(
+      and_(equals_(stored_table_node->get_column("a"), 9), equals_(stored_table_node->get_column("c"), 11)),
+      stored_table_node);
+  predicate_node->scan_type = ScanType::UniqueIndexScan;
+
+  const auto pqp = LQPTranslator{}.translate_node(predicate_node);
+  ASSERT_EQ(pqp->type(), OperatorType::UniqueIndexScan);
+  EXPECT_EQ(pqp->left_input()->type(), OperatorType::GetTable);
+}
+
+}  // namespace opossum
@@ -56,6 +56,11 @@ class OperatorsValidateTest : public BaseTest {
                                               const CommitID snapshot_commit_id) {
     return validate->_is_entire_chunk_visible(chunk, snapshot_commit_id);
   }
+
+  // Puts the MvccData into the state that compact() is in while it copies the sparse rows
+  static void begin_compaction(MvccData& mvcc_data) {
+    mvcc_data._representation.store(MvccData::Representation::Compacting);
+  }
 };
 
 void OperatorsValidateTest::set_all_records_visible(Table& table) {
@@ -89,6 +94,19 @@ TEST_F(OperatorsValidateTest, SimpleValidate) {
   EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
 }
 
+TEST_F(OperatorsValidateTest, OutputRowBudget) {
+  auto context = std::make_shared<TransactionContext>(1u, 3u, AutoCommit::No);
+
+  // Both rows of the first chunk are visible, so that the second chunk is not validated
+  auto validate = std::make_shared<Validate>(_table_wrapper);
+  validate->set_output_row_budget(2);
+  validate->set_transaction_context(context);
+  validate->execute();
+
+  EXPECT_EQ(validate->get_output()->chunk_count(), 1u);
+  EXPECT_EQ(validate->get_output()->row_count(), 2u);
+}
+
 TEST_F(OperatorsValidateTest, ScanValidate) {
   auto context = std::make_shared<TransactionContext>(1u, 3u, AutoCommit::No);
 
@@ -136,6 +154,126 @@ TEST_F(OperatorsValidateTest, ValidateAfterDelete) {
   t2_context->commit();
 }
 
+TEST_F(OperatorsValidateTest, ValidateCompactMvccData) {
+  for (auto chunk_id = ChunkID{0}; chunk_id < _test_table->chunk_count(); ++chunk_id) {
+    _test_table->get_chunk(chunk_id)->mvcc_data()->compact();
+  }
+
+  auto context = std::make_shared<TransactionContext>(1u, 3u, AutoCommit::No);
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/validate_output_validated.tbl", 2u);
+
+  auto validate = std::make_shared<Validate>(_table_wrapper);
+  validate->set_transaction_context(context);
+  validate->execute();
+  EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
+
+  // Validating a reference table takes the same path
+  auto a = PQPColumnExpression::from_table(*_test_table, "a");
+  auto table_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_equals_(a, 2));
+  table_scan->execute();
+
+  auto scan_validate = std::make_shared<Validate>(table_scan);
+  scan_validate->set_transaction_context(context);
+  scan_validate->execute();
+  EXPECT_TABLE_EQ_UNORDERED(scan_validate->get_output(),
+                            load_table("resources/test_data/tbl/validate_output_validated_scanned.tbl", 2u));
+}
+
+TEST_F(OperatorsValidateTest, ValidateWhileCompactingMvccData) {
+  // The sparse rows are incomplete during the compaction, so that the read-only path has to look at each row
+  for (auto chunk_id = ChunkID{0}; chunk_id < _test_table->chunk_count(); ++chunk_id) {
+    begin_compaction(*_test_table->get_chunk(chunk_id)->mvcc_data());
+  }
+
+  auto context = std::make_shared<TransactionContext>(1u, 3u, AutoCommit::No);
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/validate_output_validated.tbl", 2u);
+
+  auto validate = std::make_shared<Validate>(_table_wrapper);
+  validate->set_transaction_context(context);
+  validate->execute();
+  EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
+
+  // No visibility bitmap is cached while the compaction is in progress
+  for (auto chunk_id = ChunkID{0}; chunk_id < _test_table->chunk_count(); ++chunk_id) {
+    EXPECT_FALSE(_test_table->get_chunk(chunk_id)->mvcc_data()->cached_visibility(3u));
+  }
+}
+
+TEST_F(OperatorsValidateTest, ValidateAfterDeleteOnCompactMvccData) {
+  const auto stored_table = Hyrise::get().storage_manager.get_table(_table2_name);
+  for (auto chunk_id = ChunkID{0}; chunk_id < stored_table->chunk_count(); ++chunk_id) {
+    stored_table->get_chunk(chunk_id)->mvcc_data()->compact();
+  }
+
+  auto t1_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+
+  auto table_scan = create_table_scan(_gt, ColumnID{0}, PredicateCondition::Equals, "13");
+  table_scan->execute();
+
+  auto delete_op = std::make_shared<Delete>(table_scan);
+  delete_op->set_transaction_context(t1_context);
+  delete_op->execute();
+  EXPECT_FALSE(delete_op->execute_failed());
+
+  auto validate1 = std::make_shared<Validate>(_gt);
+  validate1->set_transaction_context(t1_context);
+  validate1->execute();
+  EXPECT_EQ(validate1->get_output()->row_count(), 7);
+  t1_context->commit();
+
+  auto t2_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  auto validate2 = std::make_shared<Validate>(_gt);
+  validate2->set_transaction_context(t2_context);
+  validate2->execute();
+  EXPECT_EQ(validate2->get_output()->row_count(), 7);
+  t2_context->commit();
+}
+
+TEST_F(OperatorsValidateTest, CachedVisibility) {
+  // The last commit id is TransactionManager::INITIAL_COMMIT_ID (1), so only bitmaps for snapshots <= 1 are cached
+  auto context = std::make_shared<TransactionContext>(1u, 1u, AutoCommit::No);
+
+  auto validate = std::make_shared<Validate>(_table_wrapper);
+  validate->set_transaction_context(context);
+  validate->execute();
+  EXPECT_EQ(validate->get_output()->row_count(), 4);
+
+  // Row 0 of chunk 1 is invalidated with CommitID 2
+  const auto mvcc_data = _test_table->get_chunk(ChunkID{1})->mvcc_data();
+  const auto cached_visibility = mvcc_data->cached_visibility(CommitID{1});
+  ASSERT_TRUE(cached_visibility);
+  EXPECT_EQ(cached_visibility->begin_snapshot_commit_id, CommitID{0});
+  EXPECT_EQ(cached_visibility->end_snapshot_commit_id, CommitID{2});
+  EXPECT_EQ(cached_visibility->visible_rows, std::vector<bool>({true, true}));
+  EXPECT_FALSE(mvcc_data->cached_visibility(CommitID{2}));
+
+  // Bitmaps are not cached for snapshots that might see commits which had not been published
+  auto late_context = std::make_shared<TransactionContext>(1u, 3u, AutoCommit::No);
+  auto late_validate = std::make_shared<Validate>(_table_wrapper);
+  late_validate->set_transaction_context(late_context);
+  late_validate->execute();
+  EXPECT_EQ(late_validate->get_output()->row_count(), 3);
+  EXPECT_FALSE(mvcc_data->cached_visibility(CommitID{3}));
+
+  // Make sure that the cached bitmap is used by both the data and the reference path
+  auto manipulated_visibility = std::make_shared<MvccData::CachedVisibility>(*cached_visibility);
+  manipulated_visibility->visible_rows = {false, true};
+  mvcc_data->set_cached_visibility(manipulated_visibility);
+
+  auto cached_validate = std::make_shared<Validate>(_table_wrapper);
+  cached_validate->set_transaction_context(context);
+  cached_validate->execute();
+  EXPECT_EQ(cached_validate->get_output()->row_count(), 3);
+
+  auto a = PQPColumnExpression::from_table(*_test_table, "a");
+  auto table_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_equals_(a, 7));
+  table_scan->execute();
+  auto scan_validate = std::make_shared<Validate>(table_scan);
+  scan_validate->set_transaction_context(context);
+  scan_validate->execute();
+  EXPECT_EQ(scan_validate->get_output()->row_count(), 1);
+}
+
 TEST_F(OperatorsValidateTest, ChunkEntirelyVisibleThrowsOnRefChunk) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
 
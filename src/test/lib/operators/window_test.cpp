@@ -0,0 +1,168 @@
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "expression/window_function_expression.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/window.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsWindowTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Three chunks, so that the rows are spread across multiple hash partitions
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/window/input.tbl", 3));
+    _table_wrapper->execute();
+
+    _a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+    _b = pqp_column_(ColumnID{1}, DataType::Int, true, "b");
+    _c = pqp_column_(ColumnID{2}, DataType::Float, false, "c");
+  }
+
+  using Expressions = std::vector<std::shared_ptr<AbstractExpression>>;
+
+  static std::shared_ptr<WindowFunctionExpression> window_function_(
+      const WindowFunction window_function, const std::shared_ptr<AbstractExpression>& argument,
+      const Expressions& partition_by_expressions, const Expressions& order_by_expressions,
+      const std::vector<SortMode>& sort_modes, const WindowFrame& frame = {}) {
+    return std::make_shared<WindowFunctionExpression>(window_function, argument, partition_by_expressions,
+                                                      order_by_expressions, sort_modes, frame);
+  }
+
+  // Executes the Window operator and compares the window function's results, which are expected in the input order
+  template <typename T>
+  static void test_window_function(const std::shared_ptr<AbstractOperator>& input,
+                                   const std::shared_ptr<WindowFunctionExpression>& window_function_expression,
+                                   const std::vector<std::optional<T>>& expected_results) {
+    const auto window = std::make_shared<Window>(input, window_function_expression);
+    window->execute();
+
+    const auto& output_table = window->get_output();
+    const auto result_column_id = ColumnID{static_cast<ColumnID::base_type>(output_table->column_count() - 1)};
+    ASSERT_EQ(output_table->row_count(), expected_results.size());
+    for (auto row_idx = size_t{0}; row_idx < expected_results.size(); ++row_idx) {
+      EXPECT_EQ(output_table->get_value<T>(result_column_id, row_idx), expected_results[row_idx]) << "Row " << row_idx;
+    }
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  std::shared_ptr<PQPColumnExpression> _a, _b, _c;
+};
+
+TEST_F(OperatorsWindowTest, Description) {
+  const auto window = std::make_shared<Window>(
+      _table_wrapper,
+      window_function_(WindowFunction::RowNumber, nullptr, expression_vector(_a), expression_vector(_c),
+                       std::vector<SortMode>{SortMode::Ascending}));
+  EXPECT_EQ(window->description(DescriptionMode::SingleLine),
+            "Window ROW_NUMBER() OVER (PARTITION BY a ORDER BY c Ascending)");
+  EXPECT_EQ(window->description(DescriptionMode::MultiLine),
+            "Window\nROW_NUMBER() OVER (PARTITION BY a ORDER BY c Ascending)");
+}
+
+TEST_F(OperatorsWindowTest, OutputColumns) {
+  const auto window = std::make_shared<Window>(
+      _table_wrapper, window_function_(WindowFunction::Sum, _b, expression_vector(_a), expression_vector(_c),
+                                       std::vector<SortMode>{SortMode::Ascending}));
+  window->execute();
+
+  const auto& output_table = window->get_output();
+  EXPECT_EQ(output_table->type(), TableType::Data);
+  ASSERT_EQ(output_table->column_count(), 4u);
+  EXPECT_EQ(output_table->chunk_count(), 3u);
+  EXPECT_EQ(output_table->column_name(ColumnID{3}), "SUM(b) OVER (PARTITION BY a ORDER BY c Ascending)");
+  EXPECT_EQ(output_table->column_data_type(ColumnID{3}), DataType::Long);
+  EXPECT_TRUE(output_table->column_is_nullable(ColumnID{3}));
+
+  // The input columns are forwarded
+  EXPECT_EQ(output_table->get_chunk(ChunkID{1})->get_segment(ColumnID{2}),
+            _table_wrapper->get_output()->get_chunk(ChunkID{1})->get_segment(ColumnID{2}));
+}
+
+TEST_F(OperatorsWindowTest, RowNumber) {
+  test_window_function<int64_t>(_table_wrapper,
+                                window_function_(WindowFunction::RowNumber, nullptr, expression_vector(_a),
+                                                 expression_vector(_c), std::vector<SortMode>{SortMode::Ascending}),
+                                {2, 2, 1, 1, 4, 1, 3, 3});
+}
+
+TEST_F(OperatorsWindowTest, RowNumberWithoutPartitionBy) {
+  // The rows 1 and 7 are peers, which are numbered in the input order
+  test_window_function<int64_t>(_table_wrapper,
+                                window_function_(WindowFunction::RowNumber, nullptr, Expressions{},
+                                                 expression_vector(_c), std::vector<SortMode>{SortMode::Descending}),
+                                {6, 3, 8, 7, 2, 5, 1, 4});
+}
+
+TEST_F(OperatorsWindowTest, Rank) {
+  // NULLs come first for SortMode::Ascending, and peers share their rank
+  test_window_function<int64_t>(_table_wrapper,
+                                window_function_(WindowFunction::Rank, nullptr, expression_vector(_a),
+                                                 expression_vector(_b), std::vector<SortMode>{SortMode::Ascending}),
+                                {2, 2, 4, 1, 2, 1, 2, 1});
+}
+
+TEST_F(OperatorsWindowTest, RunningSum) {
+  // The default frame is RANGE BETWEEN UNBOUNDED PRECEDING AND CURRENT ROW. NULLs are skipped, so that the sum is
+  // NULL if all rows up to the current one are NULL.
+  test_window_function<int64_t>(_table_wrapper,
+                                window_function_(WindowFunction::Sum, _b, expression_vector(_a), expression_vector(_c),
+                                                 std::vector<SortMode>{SortMode::Ascending}),
+                                {40, 20, 30, std::nullopt, 50, 5, 40, 40});
+}
+
+TEST_F(OperatorsWindowTest, RunningSumIncludesPeers) {
+  test_window_function<int64_t>(_table_wrapper,
+                                window_function_(WindowFunction::Sum, _b, expression_vector(_a), expression_vector(_b),
+                                                 std::vector<SortMode>{SortMode::Ascending}),
+                                {20, 40, 50, std::nullopt, 20, 5, 40, std::nullopt});
+}
+
+TEST_F(OperatorsWindowTest, SumWithoutOrderBy) {
+  // Without ORDER BY, all rows are peers, so that each row gets the sum of the entire partition
+  test_window_function<int64_t>(
+      _table_wrapper,
+      window_function_(WindowFunction::Sum, _b, Expressions{}, Expressions{}, std::vector<SortMode>{}),
+      {95, 95, 95, 95, 95, 95, 95, 95});
+}
+
+TEST_F(OperatorsWindowTest, SumOverRowsFrames) {
+  // ROWS BETWEEN CURRENT ROW AND UNBOUNDED FOLLOWING
+  test_window_function<int64_t>(_table_wrapper,
+                                window_function_(WindowFunction::Sum, _b, expression_vector(_a), expression_vector(_c),
+                                                 std::vector<SortMode>{SortMode::Ascending},
+                                                 WindowFrame{WindowFrameType::Rows, 0, std::nullopt}),
+                                {20, 40, 50, 40, 10, 5, 20, 10});
+
+  // ROWS BETWEEN 1 PRECEDING AND 1 FOLLOWING on a floating-point column, which is summed with a segment tree
+  test_window_function<double>(_table_wrapper,
+                               window_function_(WindowFunction::Sum, _c, expression_vector(_a), expression_vector(_c),
+                                                std::vector<SortMode>{SortMode::Ascending},
+                                                WindowFrame{WindowFrameType::Rows, 1, 1}),
+                               {4.5, 7.5, 2.0, 3.5, 5.5, 2.0, 6.5, 7.0});
+}
+
+TEST_F(OperatorsWindowTest, ReferenceInput) {
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper, less_than_(_a, 3));
+  table_scan->execute();
+
+  test_window_function<int64_t>(table_scan,
+                                window_function_(WindowFunction::RowNumber, nullptr, expression_vector(_a),
+                                                 expression_vector(_c), std::vector<SortMode>{SortMode::Ascending}),
+                                {2, 2, 1, 1, 4, 3, 3});
+
+  const auto window = std::make_shared<Window>(
+      table_scan, window_function_(WindowFunction::Rank, nullptr, expression_vector(_a), expression_vector(_c),
+                                   std::vector<SortMode>{SortMode::Ascending}));
+  window->execute();
+  EXPECT_EQ(window->get_output()->type(), TableType::References);
+}
+
+}  // namespace opossum
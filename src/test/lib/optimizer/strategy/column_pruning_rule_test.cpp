@@ -3,8 +3,10 @@
 #include "expression/expression_functional.hpp"
 #include "logical_query_plan/change_meta_table_node.hpp"
 #include "logical_query_plan/delete_node.hpp"
+#include "logical_query_plan/except_node.hpp"
 #include "logical_query_plan/export_node.hpp"
 #include "logical_query_plan/insert_node.hpp"
+#include "logical_query_plan/intersect_node.hpp"
 #include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/mock_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
@@ -121,6 +123,48 @@ TEST_F(ColumnPruningRuleTest, WithUnion) {
   }
 }
 
+TEST_F(ColumnPruningRuleTest, WithUniqueUnion) {
+  // All columns are used to establish uniqueness, so none of them can be pruned below the union
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(a),
+    UnionNode::make(SetOperationMode::Unique,
+      PredicateNode::make(greater_than_(a, 5),
+        node_a),
+      PredicateNode::make(greater_than_(b, 5),
+        node_a)));
+  // clang-format on
+
+  const auto expected_lqp = lqp->deep_copy();
+  const auto actual_lqp = apply_rule(rule, lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(ColumnPruningRuleTest, WithIntersectAndExcept) {
+  // Rows of both inputs are compared by all of their columns, so none of them can be pruned
+  // clang-format off
+  const auto intersect_lqp =
+  ProjectionNode::make(expression_vector(a),
+    IntersectNode::make(SetOperationMode::Unique,
+      node_a,
+      node_b));
+
+  const auto except_lqp =
+  ProjectionNode::make(expression_vector(a),
+    ExceptNode::make(SetOperationMode::Unique,
+      node_a,
+      node_b));
+  // clang-format on
+
+  for (const auto& lqp : {intersect_lqp, except_lqp}) {
+    const auto expected_lqp = lqp->deep_copy();
+    const auto actual_lqp = apply_rule(rule, lqp);
+
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+}
+
 TEST_F(ColumnPruningRuleTest, WithMultipleProjections) {
   auto lqp = std::shared_ptr<AbstractLQPNode>{};
 
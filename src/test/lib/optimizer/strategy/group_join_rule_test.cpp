@@ -0,0 +1,167 @@
+#include "strategy_base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "optimizer/strategy/group_join_rule.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class GroupJoinRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    auto& storage_manager = Hyrise::get().storage_manager;
+
+    const auto column_definitions =
+        TableColumnDefinitions{{"key", DataType::Int, false}, {"value", DataType::Float, true}};
+
+    const auto table_a = std::make_shared<Table>(column_definitions, TableType::Data, 2, UseMvcc::Yes);
+    table_a->add_soft_key_constraint({{ColumnID{0}}, KeyConstraintType::PRIMARY_KEY});
+    storage_manager.add_table("table_a", table_a);
+
+    storage_manager.add_table("table_b", std::make_shared<Table>(column_definitions, TableType::Data, 2, UseMvcc::Yes));
+
+    node_a = StoredTableNode::make("table_a");
+    a_key = node_a->get_column("key");
+    a_value = node_a->get_column("value");
+
+    node_b = StoredTableNode::make("table_b");
+    b_key = node_b->get_column("key");
+    b_value = node_b->get_column("value");
+
+    rule = std::make_shared<GroupJoinRule>();
+  }
+
+  bool is_group_join(const std::shared_ptr<AbstractLQPNode>& lqp) {
+    const auto actual_lqp = apply_rule(rule, lqp);
+    return std::static_pointer_cast<AggregateNode>(actual_lqp)->is_group_join;
+  }
+
+  std::shared_ptr<GroupJoinRule> rule;
+  std::shared_ptr<StoredTableNode> node_a, node_b;
+  std::shared_ptr<LQPColumnExpression> a_key, a_value, b_key, b_value;
+};
+
+TEST_F(GroupJoinRuleTest, InnerJoinGroupedByUniqueKey) {
+  // clang-format off
+  const auto lqp =
+  AggregateNode::make(expression_vector(a_key), expression_vector(sum_(b_value), count_star_(node_b), any_(a_value)),
+    JoinNode::make(JoinMode::Inner, equals_(b_key, a_key),
+      node_b,
+      node_a));
+  // clang-format on
+
+  EXPECT_TRUE(is_group_join(lqp));
+}
+
+TEST_F(GroupJoinRuleTest, MultiwayJoin) {
+  // The GroupJoin would translate the inputs of a join that is part of a JoinLeapfrogTriejoin separately
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(b_key, a_key), node_b, node_a);
+  join_node->is_multiway_join = true;
+
+  const auto lqp = AggregateNode::make(expression_vector(a_key), expression_vector(sum_(b_value)), join_node);
+
+  EXPECT_FALSE(is_group_join(lqp));
+}
+
+TEST_F(GroupJoinRuleTest, OuterJoins) {
+  // clang-format off
+  const auto left_join_lqp =
+  AggregateNode::make(expression_vector(a_key, a_value), expression_vector(count_(b_key), max_(b_value)),
+    JoinNode::make(JoinMode::Left, equals_(a_key, b_key),
+      node_a,
+      PredicateNode::make(greater_than_(b_value, 5),
+        node_b)));
+
+  // The rows of the group side have to be kept by the outer join
+  const auto right_join_lqp =
+  AggregateNode::make(expression_vector(a_key), expression_vector(count_(b_key)),
+    JoinNode::make(JoinMode::Right, equals_(a_key, b_key),
+      node_a,
+      node_b));
+  // clang-format on
+
+  EXPECT_TRUE(is_group_join(left_join_lqp));
+  EXPECT_FALSE(is_group_join(right_join_lqp));
+}
+
+TEST_F(GroupJoinRuleTest, KeyNotUnique) {
+  // clang-format off
+  const auto lqp =
+  AggregateNode::make(expression_vector(b_key), expression_vector(sum_(a_value)),
+    JoinNode::make(JoinMode::Inner, equals_(a_key, b_key),
+      node_a,
+      node_b));
+  // clang-format on
+
+  EXPECT_FALSE(is_group_join(lqp));
+}
+
+TEST_F(GroupJoinRuleTest, GroupByNotOnKey) {
+  // clang-format off
+  const auto lqp_without_key =
+  AggregateNode::make(expression_vector(a_value), expression_vector(sum_(b_value)),
+    JoinNode::make(JoinMode::Inner, equals_(a_key, b_key),
+      node_a,
+      node_b));
+
+  const auto lqp_with_probe_side_column =
+  AggregateNode::make(expression_vector(a_key, b_value), expression_vector(count_star_(node_b)),
+    JoinNode::make(JoinMode::Inner, equals_(a_key, b_key),
+      node_a,
+      node_b));
+  // clang-format on
+
+  EXPECT_FALSE(is_group_join(lqp_without_key));
+  EXPECT_FALSE(is_group_join(lqp_with_probe_side_column));
+}
+
+TEST_F(GroupJoinRuleTest, UnsupportedAggregates) {
+  // clang-format off
+  const auto lqp_with_group_side_aggregate =
+  AggregateNode::make(expression_vector(a_key), expression_vector(sum_(a_value)),
+    JoinNode::make(JoinMode::Inner, equals_(a_key, b_key),
+      node_a,
+      node_b));
+
+  const auto lqp_with_count_distinct =
+  AggregateNode::make(expression_vector(a_key), expression_vector(count_distinct_(b_value)),
+    JoinNode::make(JoinMode::Inner, equals_(a_key, b_key),
+      node_a,
+      node_b));
+  // clang-format on
+
+  EXPECT_FALSE(is_group_join(lqp_with_group_side_aggregate));
+  EXPECT_FALSE(is_group_join(lqp_with_count_distinct));
+}
+
+TEST_F(GroupJoinRuleTest, UnsupportedJoins) {
+  // clang-format off
+  const auto lqp_with_non_equi_join =
+  AggregateNode::make(expression_vector(a_key), expression_vector(sum_(b_value)),
+    JoinNode::make(JoinMode::Inner, greater_than_(a_key, b_key),
+      node_a,
+      node_b));
+
+  const auto lqp_with_multiple_predicates =
+  AggregateNode::make(expression_vector(a_key), expression_vector(sum_(b_value)),
+    JoinNode::make(JoinMode::Inner, expression_vector(equals_(a_key, b_key), equals_(a_value, b_value)),
+      node_a,
+      node_b));
+  // clang-format on
+
+  EXPECT_FALSE(is_group_join(lqp_with_non_equi_join));
+  EXPECT_FALSE(is_group_join(lqp_with_multiple_predicates));
+
+  // The join result is needed by another node
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(a_key, b_key), node_a, node_b);
+  const auto lqp = AggregateNode::make(expression_vector(a_key), expression_vector(sum_(b_value)), join_node);
+  const auto other_consumer = PredicateNode::make(greater_than_(b_value, 5), join_node);
+  EXPECT_FALSE(is_group_join(lqp));
+}
+
+}  // namespace opossum
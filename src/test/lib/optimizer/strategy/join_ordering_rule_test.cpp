@@ -4,6 +4,7 @@
 #include "expression/expression_functional.hpp"
 #include "logical_query_plan/aggregate_node.hpp"
 #include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/mock_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "optimizer/strategy/join_ordering_rule.hpp"
@@ -78,4 +79,72 @@ TEST_F(JoinOrderingRuleTest, MultipleJoinGraphs) {
   EXPECT_LQP_EQ(actual_lqp, expected_lqp);
 }
 
+TEST_F(JoinOrderingRuleTest, CyclicJoinGraphWithLargeIntermediates) {
+  // Triangle query x(a, b), y(b, c), z(c, a) on columns with few distinct values. Every binary join of two of the
+  // inputs is estimated to produce 10,000 rows, joining the third input on one of the two remaining predicates yields
+  // 100,000 rows, of which the other predicate keeps only 1,000.
+  const auto histogram = GenericHistogram<int32_t>::with_single_bin(1, 100, 1'000, 100);
+  const auto node_x = create_mock_node_with_statistics({{DataType::Int, "a"}, {DataType::Int, "b"}}, 1'000,
+                                                       {histogram, histogram});
+  const auto node_y = create_mock_node_with_statistics({{DataType::Int, "b"}, {DataType::Int, "c"}}, 1'000,
+                                                       {histogram, histogram});
+  const auto node_z = create_mock_node_with_statistics({{DataType::Int, "c"}, {DataType::Int, "a"}}, 1'000,
+                                                       {histogram, histogram});
+  const auto x_a = node_x->get_column("a");
+  const auto x_b = node_x->get_column("b");
+  const auto y_b = node_y->get_column("b");
+  const auto y_c = node_y->get_column("c");
+  const auto z_c = node_z->get_column("c");
+  const auto z_a = node_z->get_column("a");
+
+  const auto count_multiway_joins = [](const auto& lqp) {
+    auto multiway_join_count = size_t{0};
+    visit_lqp(lqp, [&](const auto& node) {
+      const auto join_node = std::dynamic_pointer_cast<JoinNode>(node);
+      if (join_node && join_node->is_multiway_join) ++multiway_join_count;
+      return LQPVisitation::VisitInputs;
+    });
+    return multiway_join_count;
+  };
+
+  // clang-format off
+  const auto cyclic_lqp =
+  PredicateNode::make(equals_(z_a, x_a),
+    JoinNode::make(JoinMode::Inner, equals_(y_c, z_c),
+      JoinNode::make(JoinMode::Inner, equals_(x_b, y_b),
+        node_x,
+        node_y),
+      node_z));
+  // clang-format on
+
+  const auto actual_cyclic_lqp = apply_rule(rule, cyclic_lqp);
+  EXPECT_EQ(count_multiway_joins(actual_cyclic_lqp), 2u);
+  EXPECT_EQ(actual_cyclic_lqp->output_expressions().size(), 6u);
+
+  // Without the third predicate, the join graph is a chain and the binary joins do not produce large intermediates
+  // clang-format off
+  const auto acyclic_lqp =
+  JoinNode::make(JoinMode::Inner, equals_(y_c, z_c),
+    JoinNode::make(JoinMode::Inner, equals_(x_b, y_b),
+      node_x,
+      node_y),
+    node_z);
+  // clang-format on
+
+  EXPECT_EQ(count_multiway_joins(apply_rule(rule, acyclic_lqp)), 0u);
+
+  // Only equality predicates can be evaluated by the multi-way join
+  // clang-format off
+  const auto non_equi_lqp =
+  PredicateNode::make(less_than_(z_a, x_a),
+    JoinNode::make(JoinMode::Inner, equals_(y_c, z_c),
+      JoinNode::make(JoinMode::Inner, equals_(x_b, y_b),
+        node_x,
+        node_y),
+      node_z));
+  // clang-format on
+
+  EXPECT_EQ(count_multiway_joins(apply_rule(rule, non_equi_lqp)), 0u);
+}
+
 }  // namespace opossum
@@ -0,0 +1,173 @@
+#include "lib/optimizer/strategy/strategy_base_test.hpp"
+
+#include "hyrise.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "optimizer/strategy/runtime_join_filter_rule.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class RuntimeJoinFilterRuleTest : public StrategyBaseTest {
+ protected:
+  void SetUp() override {
+    // 180 rows, column `full` has the values 0 to 5 with 30 rows each
+    const auto table = load_table("resources/test_data/tbl/int_equal_distribution.tbl");
+    Hyrise::get().storage_manager.add_table("table_a", table);
+    _stored_table_node = StoredTableNode::make("table_a");
+    _a_full = _stored_table_node->get_column("full");
+    _a_lower = _stored_table_node->get_column("lower");
+
+    {
+      const auto histogram = GenericHistogram<int32_t>::with_single_bin(5, 5, 10, 1);
+      _selective_node = create_mock_node_with_statistics({{DataType::Int, "x"}}, 10, {histogram});
+      _selective_x = _selective_node->get_column("x");
+    }
+
+    {
+      const auto histogram = GenericHistogram<int32_t>::with_single_bin(0, 5, 10, 6);
+      _unselective_node = create_mock_node_with_statistics({{DataType::Int, "x"}}, 10, {histogram});
+      _unselective_x = _unselective_node->get_column("x");
+    }
+  }
+
+  std::shared_ptr<JoinNode> _runtime_join_filter(const std::shared_ptr<AbstractExpression>& predicate,
+                                                 const std::shared_ptr<AbstractLQPNode>& consumer_node,
+                                                 const std::shared_ptr<AbstractLQPNode>& producer_node) {
+    const auto join_node = JoinNode::make(JoinMode::Semi, predicate, consumer_node, producer_node);
+    join_node->is_runtime_join_filter = true;
+    return join_node;
+  }
+
+  std::shared_ptr<StoredTableNode> _stored_table_node;
+  std::shared_ptr<MockNode> _selective_node, _unselective_node;
+  std::shared_ptr<LQPColumnExpression> _a_full, _a_lower, _selective_x, _unselective_x;
+  std::shared_ptr<RuntimeJoinFilterRule> _rule{std::make_shared<RuntimeJoinFilterRule>()};
+};
+
+TEST_F(RuntimeJoinFilterRuleTest, InsertBelowPredicatesAndValidate) {
+  // clang-format off
+  const auto input_lqp =
+  JoinNode::make(JoinMode::Inner, equals_(_a_full, _selective_x),
+    PredicateNode::make(greater_than_(_a_lower, 0),
+      ValidateNode::make(
+        _stored_table_node)),
+    _selective_node);
+
+  const auto expected_lqp =
+  JoinNode::make(JoinMode::Inner, equals_(_a_full, _selective_x),
+    PredicateNode::make(greater_than_(_a_lower, 0),
+      ValidateNode::make(
+        _runtime_join_filter(equals_(_a_full, _selective_x),
+          _stored_table_node,
+          _selective_node))),
+    _selective_node);
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(_rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(RuntimeJoinFilterRuleTest, ProducerOnLeftSide) {
+  // For inner joins, the smaller input becomes the build side of the JoinHash. For semi joins, it is always the right
+  // input.
+
+  // clang-format off
+  const auto input_lqp =
+  JoinNode::make(JoinMode::Semi, equals_(_selective_x, _a_full),
+    JoinNode::make(JoinMode::Inner, equals_(_selective_x, _a_full),
+      _selective_node,
+      _stored_table_node),
+    _stored_table_node);
+
+  const auto expected_lqp =
+  JoinNode::make(JoinMode::Semi, equals_(_selective_x, _a_full),
+    JoinNode::make(JoinMode::Inner, equals_(_selective_x, _a_full),
+      _selective_node,
+      _runtime_join_filter(equals_(_selective_x, _a_full),
+        _stored_table_node,
+        _selective_node)),
+    _stored_table_node);
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(_rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(RuntimeJoinFilterRuleTest, NotSelective) {
+  const auto input_lqp = JoinNode::make(JoinMode::Inner, equals_(_a_full, _unselective_x), _stored_table_node,
+                                        _unselective_node);
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = apply_rule(_rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(RuntimeJoinFilterRuleTest, UnsupportedJoins) {
+  // Rows without a join partner are part of the output of outer and anti joins
+  for (const auto join_mode : {JoinMode::Left, JoinMode::AntiNullAsFalse}) {
+    const auto input_lqp =
+        JoinNode::make(join_mode, equals_(_a_full, _selective_x), _stored_table_node, _selective_node);
+
+    const auto expected_lqp = input_lqp->deep_copy();
+    const auto actual_lqp = apply_rule(_rule, input_lqp);
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+
+  // Non-equi joins cannot use a bloom filter
+  {
+    const auto input_lqp =
+        JoinNode::make(JoinMode::Inner, less_than_(_a_full, _selective_x), _stored_table_node, _selective_node);
+
+    const auto expected_lqp = input_lqp->deep_copy();
+    const auto actual_lqp = apply_rule(_rule, input_lqp);
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+}
+
+TEST_F(RuntimeJoinFilterRuleTest, MultiwayJoins) {
+  // A filter would split the tree of joins that is translated into a single JoinLeapfrogTriejoin
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(_a_full, _selective_x), _stored_table_node,
+                                        _selective_node);
+  join_node->is_multiway_join = true;
+
+  const auto input_lqp = std::static_pointer_cast<AbstractLQPNode>(join_node);
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = apply_rule(_rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(RuntimeJoinFilterRuleTest, DoNotPassSharedNodes) {
+  // The predicate is also used by the right input of the outer join. A filter below it would change that input, too.
+  const auto shared_predicate_node = PredicateNode::make(greater_than_(_a_lower, 0), _stored_table_node);
+
+  // clang-format off
+  const auto input_lqp =
+  JoinNode::make(JoinMode::Cross,
+    JoinNode::make(JoinMode::Inner, equals_(_a_full, _selective_x),
+      shared_predicate_node,
+      _selective_node),
+    shared_predicate_node);
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = apply_rule(_rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(RuntimeJoinFilterRuleTest, ProducerReadsConsumerTable) {
+  // clang-format off
+  const auto input_lqp =
+  JoinNode::make(JoinMode::Semi, equals_(_a_full, _a_lower),
+    _stored_table_node,
+    PredicateNode::make(equals_(_a_full, 5),
+      _stored_table_node));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = apply_rule(_rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
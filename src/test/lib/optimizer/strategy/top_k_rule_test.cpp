@@ -0,0 +1,70 @@
+#include "strategy_base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "optimizer/strategy/top_k_rule.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class TopKRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    node_a = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Float, "b"}});
+    a = node_a->get_column("a");
+    b = node_a->get_column("b");
+
+    rule = std::make_shared<TopKRule>();
+  }
+
+  bool is_top_k(const std::shared_ptr<AbstractLQPNode>& lqp) {
+    const auto actual_lqp = apply_rule(rule, lqp);
+    return std::static_pointer_cast<LimitNode>(actual_lqp)->is_top_k;
+  }
+
+  std::shared_ptr<TopKRule> rule;
+  std::shared_ptr<MockNode> node_a;
+  std::shared_ptr<LQPColumnExpression> a, b;
+};
+
+TEST_F(TopKRuleTest, LimitOnSort) {
+  // clang-format off
+  const auto lqp =
+  LimitNode::make(value_(10),
+    SortNode::make(expression_vector(a, b), std::vector<SortMode>{SortMode::Descending, SortMode::Ascending},
+      node_a));
+  // clang-format on
+
+  EXPECT_TRUE(is_top_k(lqp));
+}
+
+TEST_F(TopKRuleTest, NoSortBelowLimit) {
+  // clang-format off
+  const auto lqp_without_sort =
+  LimitNode::make(value_(10),
+    node_a);
+
+  const auto lqp_with_predicate_between =
+  LimitNode::make(value_(10),
+    PredicateNode::make(greater_than_(b, 5),
+      SortNode::make(expression_vector(a), std::vector<SortMode>{SortMode::Ascending},
+        node_a)));
+  // clang-format on
+
+  EXPECT_FALSE(is_top_k(lqp_without_sort));
+  EXPECT_FALSE(is_top_k(lqp_with_predicate_between));
+}
+
+TEST_F(TopKRuleTest, SortNeededByOtherNode) {
+  const auto sort_node = SortNode::make(expression_vector(a), std::vector<SortMode>{SortMode::Ascending}, node_a);
+  const auto lqp = LimitNode::make(value_(10), sort_node);
+  const auto other_consumer = PredicateNode::make(greater_than_(b, 5), sort_node);
+
+  EXPECT_FALSE(is_top_k(lqp));
+}
+
+}  // namespace opossum
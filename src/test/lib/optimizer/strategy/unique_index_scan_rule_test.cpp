@@ -0,0 +1,115 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "lib/optimizer/strategy/strategy_base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "optimizer/strategy/unique_index_scan_rule.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class UniqueIndexScanRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    const auto table = load_table("resources/test_data/tbl/int_int_int.tbl");
+    Hyrise::get().storage_manager.add_table("a", table);
+    table->enforce_key_constraint({{ColumnID{0}, ColumnID{2}}, KeyConstraintType::PRIMARY_KEY});
+
+    Hyrise::get().storage_manager.add_table("b", load_table("resources/test_data/tbl/int_int_int.tbl"));
+
+    rule = std::make_shared<UniqueIndexScanRule>();
+
+    stored_table_node = StoredTableNode::make("a");
+    a = stored_table_node->get_column("a");
+    b = stored_table_node->get_column("b");
+    c = stored_table_node->get_column("c");
+  }
+
+  std::shared_ptr<UniqueIndexScanRule> rule;
+  std::shared_ptr<StoredTableNode> stored_table_node;
+  std::shared_ptr<LQPColumnExpression> a, b, c;
+};
+
+TEST_F(UniqueIndexScanRuleTest, PullsKeyPredicatesDown) {
+  // clang-format off
+  const auto input_lqp =
+  PredicateNode::make(equals_(a, 9),
+    PredicateNode::make(greater_than_(b, 5),
+      PredicateNode::make(equals_(11, c),
+        stored_table_node)));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+
+  // clang-format off
+  const auto expected_lqp =
+  PredicateNode::make(greater_than_(b, 5),
+    PredicateNode::make(and_(equals_(a, 9), equals_(c, 11)),
+      stored_table_node));
+  // clang-format on
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  const auto unique_index_scan_node = std::dynamic_pointer_cast<PredicateNode>(actual_lqp->left_input());
+  ASSERT_TRUE(unique_index_scan_node);
+  EXPECT_EQ(unique_index_scan_node->scan_type, ScanType::UniqueIndexScan);
+}
+
+TEST_F(UniqueIndexScanRuleTest, NotAllKeyColumnsCompared) {
+  // clang-format off
+  const auto input_lqp =
+  PredicateNode::make(equals_(a, 9),
+    PredicateNode::make(greater_than_(c, 11),
+      stored_table_node));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  EXPECT_EQ(std::static_pointer_cast<PredicateNode>(actual_lqp)->scan_type, ScanType::TableScan);
+}
+
+TEST_F(UniqueIndexScanRuleTest, NoEnforcedKeyConstraint) {
+  const auto stored_table_node_b = StoredTableNode::make("b");
+  const auto b_a = stored_table_node_b->get_column("a");
+  const auto b_c = stored_table_node_b->get_column("c");
+
+  // clang-format off
+  const auto input_lqp =
+  PredicateNode::make(equals_(b_a, 9),
+    PredicateNode::make(equals_(b_c, 11),
+      stored_table_node_b));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(UniqueIndexScanRuleTest, DoNotMoveBelowSharedNodes) {
+  // The lower predicate is used by both sides of the join. Moving the upper key predicate below it would change the
+  // result of the right side.
+  const auto shared_predicate_node = PredicateNode::make(equals_(c, 11), stored_table_node);
+
+  // clang-format off
+  const auto input_lqp =
+  JoinNode::make(JoinMode::Cross,
+    PredicateNode::make(equals_(a, 9),
+      shared_predicate_node),
+    shared_predicate_node);
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
@@ -708,4 +708,35 @@ TEST_F(SQLPipelineTest, GetResultTableNoReexecuteOnConflict) {
   EXPECT_EQ(_table_a->row_count(), 5);
 }
 
+
+TEST_F(SQLPipelineTest, SetOperations) {
+  const auto left_table = load_table("resources/test_data/tbl/set_operations/left.tbl", 3);
+  Hyrise::get().storage_manager.add_table("set_left", left_table);
+  Hyrise::get().storage_manager.add_table("set_right",
+                                          load_table("resources/test_data/tbl/set_operations/right.tbl", 3));
+
+  // UNION requires both inputs to have the same output expressions, so it is tested with the same table on both sides
+  auto expected_union = std::make_shared<Table>(left_table->column_definitions(), TableType::Data);
+  for (const auto& [a, b] : std::vector<std::pair<int32_t, pmr_string>>{{1, "x"}, {2, "y"}, {3, "w"}, {4, "v"}}) {
+    expected_union->append({a, b});
+  }
+
+  const auto queries = std::vector<std::pair<std::string, std::shared_ptr<const Table>>>{
+      {"SELECT a, b FROM set_left WHERE a < 3 UNION SELECT a, b FROM set_left WHERE a > 1", expected_union},
+      {"SELECT a, b FROM set_left INTERSECT SELECT a, b FROM set_right",
+       load_table("resources/test_data/tbl/set_operations/intersect.tbl")},
+      {"SELECT a, b FROM set_left EXCEPT SELECT a, b FROM set_right",
+       load_table("resources/test_data/tbl/set_operations/except.tbl")}};
+
+  for (const auto& [query, expected_table] : queries) {
+    SCOPED_TRACE(query);
+
+    auto sql_pipeline = SQLPipelineBuilder{query}.create_pipeline();
+    const auto [pipeline_status, table] = sql_pipeline.get_result_table();
+    EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+    EXPECT_TABLE_EQ_UNORDERED(table, expected_table);
+    EXPECT_EQ(sql_pipeline.get_physical_plans().at(0)->type(), OperatorType::SetOperationHash);
+  }
+}
+
 }  // namespace opossum
@@ -30,6 +30,7 @@
 #include "logical_query_plan/sort_node.hpp"
 #include "logical_query_plan/static_table_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/union_node.hpp"
 #include "logical_query_plan/update_node.hpp"
 #include "logical_query_plan/validate_node.hpp"
 #include "sql/create_sql_parser_error_message.hpp"
@@ -1066,6 +1067,28 @@ TEST_F(SQLTranslatorTest, AggregateCount) {
   EXPECT_LQP_EQ(actual_lqp_count_1, expected_lqp_count_1);
 }
 
+TEST_F(SQLTranslatorTest, AggregateApproxCountDistinct) {
+  const auto [actual_lqp, translation_info] =
+      sql_to_lqp_helper("SELECT a, APPROX_COUNT_DISTINCT(b), APPROX_COUNT_DISTINCT(b, 10) FROM int_float GROUP BY a");
+
+  const auto approx_count_distinct_b_10 =
+      std::make_shared<AggregateExpression>(AggregateFunction::ApproxCountDistinct, int_float_b, 10);
+
+  // clang-format off
+  const auto expected_lqp =
+  AggregateNode::make(expression_vector(int_float_a), expression_vector(approx_count_distinct_(int_float_b), approx_count_distinct_b_10),  // NOLINT
+    stored_table_node_int_float);
+  // clang-format on
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  EXPECT_EQ(approx_count_distinct_b_10->as_column_name(), "APPROX_COUNT_DISTINCT(b, 10)");
+
+  // The precision has to be an integer literal within the supported range
+  EXPECT_THROW(sql_to_lqp_helper("SELECT APPROX_COUNT_DISTINCT(b, 2) FROM int_float"), InvalidInputException);
+  EXPECT_THROW(sql_to_lqp_helper("SELECT APPROX_COUNT_DISTINCT(b, a) FROM int_float"), InvalidInputException);
+  EXPECT_THROW(sql_to_lqp_helper("SELECT COUNT(b, 10) FROM int_float"), InvalidInputException);
+}
+
 TEST_F(SQLTranslatorTest, GroupByOnly) {
   const auto [actual_lqp, translation_info] = sql_to_lqp_helper("SELECT * FROM int_float GROUP BY b + 3, a / b, a, b");
 
@@ -2864,6 +2887,29 @@ TEST_F(SQLTranslatorTest, SetOperationSingleIntersect) {
   EXPECT_LQP_EQ(actual_lqp, expected_lqp);
 }
 
+TEST_F(SQLTranslatorTest, SetOperationSingleUnion) {
+  const auto [actual_lqp, translation_info] = sql_to_lqp_helper(
+      "SELECT a FROM int_float WHERE a > 5 "
+      "UNION "
+      "SELECT a FROM int_float WHERE a < 3;");
+
+  // clang-format off
+  const auto expected_lqp =
+  UnionNode::make(SetOperationMode::Unique,
+    ProjectionNode::make(expression_vector(int_float_a),
+      PredicateNode::make(greater_than_(int_float_a, value_(5)),
+        stored_table_node_int_float)),
+    ProjectionNode::make(expression_vector(int_float_a),
+      PredicateNode::make(less_than_(int_float_a, value_(3)),
+        stored_table_node_int_float)));
+  // clang-format on
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+
+  // The UnionNode requires both inputs to have the same output expressions
+  EXPECT_THROW(sql_to_lqp_helper("SELECT a FROM int_float UNION SELECT a FROM int_float2"), InvalidInputException);
+}
+
 TEST_F(SQLTranslatorTest, MultiSetOperations) {
   const auto [actual_lqp, translation_info] = sql_to_lqp_helper(
       "SELECT a FROM int_int_int "
@@ -283,4 +283,36 @@ TEST_F(AdaptiveRadixTreeIndexTest, DenseVectorOfInts) {
   _search_elements(values);
 }
 
+TEST_F(AdaptiveRadixTreeIndexTest, EqualRanges) {
+  // Enough distinct values to create nodes of all sizes, some of them twice, and a NULL value
+  auto values = std::vector<std::optional<int32_t>>{std::nullopt};
+  for (auto value = int32_t{0}; value < 600; value += 2) {
+    values.emplace_back(value);
+    if (value % 3 == 0) values.emplace_back(value);
+  }
+  auto segment = create_dict_segment_by_type<int32_t>(DataType::Int, values);
+  auto index = std::make_shared<AdaptiveRadixTreeIndex>(std::vector<std::shared_ptr<const AbstractSegment>>({segment}));
+
+  // Contained and missing values, in descending order and with duplicates
+  auto lookup_values = std::vector<AllTypeVariant>{};
+  for (auto value = int32_t{605}; value >= -5; --value) {
+    lookup_values.emplace_back(value);
+  }
+  lookup_values.emplace_back(int32_t{42});
+
+  auto ranges = std::vector<std::pair<AbstractIndex::Iterator, AbstractIndex::Iterator>>{};
+  index->equal_ranges(lookup_values, ranges);
+
+  ASSERT_EQ(ranges.size(), lookup_values.size());
+  for (auto lookup_idx = size_t{0}; lookup_idx < lookup_values.size(); ++lookup_idx) {
+    const auto& [range_begin, range_end] = ranges[lookup_idx];
+    const auto expected_size = std::distance(index->lower_bound({lookup_values[lookup_idx]}),
+                                             index->upper_bound({lookup_values[lookup_idx]}));
+    ASSERT_EQ(std::distance(range_begin, range_end), expected_size);
+    if (expected_size > 0) {
+      EXPECT_EQ(range_begin, index->lower_bound({lookup_values[lookup_idx]}));
+    }
+  }
+}
+
 }  // namespace opossum
@@ -96,6 +96,21 @@ TEST_F(BTreeIndexTest, IndexProbes) {
 */
 
 // A2, B2, C1
+TEST_F(BTreeIndexTest, EqualRanges) {
+  // Unordered, duplicate, and missing values
+  const auto lookup_values = std::vector<AllTypeVariant>{pmr_string{"inbox"}, pmr_string{"charlie"},
+                                                         pmr_string{"zulu"},  pmr_string{"apple"},
+                                                         pmr_string{"charlie"}, pmr_string{"bravo"}};
+  auto ranges = std::vector<std::pair<AbstractIndex::Iterator, AbstractIndex::Iterator>>{};
+  index->equal_ranges(lookup_values, ranges);
+
+  ASSERT_EQ(ranges.size(), lookup_values.size());
+  for (auto lookup_idx = size_t{0}; lookup_idx < lookup_values.size(); ++lookup_idx) {
+    EXPECT_EQ(ranges[lookup_idx].first, index->lower_bound({lookup_values[lookup_idx]}));
+    EXPECT_EQ(ranges[lookup_idx].second, index->upper_bound({lookup_values[lookup_idx]}));
+  }
+}
+
 TEST_F(BTreeIndexTest, MemoryConsumptionVeryShortStringNoNulls) {
   auto local_values = pmr_vector<pmr_string>{"h", "d", "f", "d", "a", "c", "c", "i", "b", "z", "x"};
   segment = std::make_shared<ValueSegment<pmr_string>>(std::move(local_values));
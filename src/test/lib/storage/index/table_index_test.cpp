@@ -0,0 +1,84 @@
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/index/table_index.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class TableIndexTest : public BaseTest {
+ public:
+  void SetUp() override {
+    table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, false}},
+                                    TableType::Data, ChunkOffset{3}, UseMvcc::Yes);
+    // The first two chunks are finalized when the next rows are appended, the last chunk remains mutable
+    table->append({7, "a"});
+    table->append({3, "b"});
+    table->append({NULL_VALUE, "c"});
+    table->append({3, "d"});
+    table->append({9, "e"});
+    table->append({7, "f"});
+    table->append({5, "g"});
+    table->append({NULL_VALUE, "h"});
+
+    table->create_table_index(ColumnID{0});
+    index = std::static_pointer_cast<const TableIndex<int32_t>>(table->table_index(ColumnID{0}));
+  }
+
+  static std::vector<RowID> row_ids(const BaseTableIndex::Iterator begin, const BaseTableIndex::Iterator end) {
+    return std::vector<RowID>(begin, end);
+  }
+
+  std::shared_ptr<Table> table;
+  std::shared_ptr<const TableIndex<int32_t>> index;
+};
+
+TEST_F(TableIndexTest, CoveredChunks) {
+  ASSERT_TRUE(index);
+  EXPECT_EQ(index->column_id(), ColumnID{0});
+  EXPECT_EQ(index->indexed_chunk_count(), ChunkID{2});
+  EXPECT_EQ(table->table_index(ColumnID{1}), nullptr);
+  EXPECT_THROW(table->create_table_index(ColumnID{0}), std::logic_error);
+
+  // Rows of the mutable chunk are not indexed
+  EXPECT_EQ(std::distance(index->cbegin(), index->cend()), 5);
+  const auto expected_nulls = std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{2}}};
+  EXPECT_EQ(row_ids(index->null_cbegin(), index->null_cend()), expected_nulls);
+}
+
+TEST_F(TableIndexTest, Bounds) {
+  const auto expected_threes = std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{1}}, RowID{ChunkID{1}, ChunkOffset{0}}};
+  EXPECT_EQ(row_ids(index->lower_bound(3), index->upper_bound(3)), expected_threes);
+  EXPECT_EQ(row_ids(index->lower_bound(5), index->upper_bound(5)), std::vector<RowID>{});
+  EXPECT_EQ(index->lower_bound(1), index->cbegin());
+  EXPECT_EQ(index->upper_bound(9), index->cend());
+  EXPECT_EQ(std::distance(index->lower_bound(4), index->upper_bound(8)), 2);
+}
+
+TEST_F(TableIndexTest, EqualRanges) {
+  // Unordered, duplicate, and missing values
+  const auto values = std::vector<int32_t>{9, 3, 5, 7, 3, 1, 10};
+  auto ranges = std::vector<std::pair<BaseTableIndex::Iterator, BaseTableIndex::Iterator>>{};
+  index->equal_ranges(values, ranges);
+
+  ASSERT_EQ(ranges.size(), values.size());
+  for (auto lookup_idx = size_t{0}; lookup_idx < values.size(); ++lookup_idx) {
+    EXPECT_EQ(row_ids(ranges[lookup_idx].first, ranges[lookup_idx].second),
+              row_ids(index->lower_bound(values[lookup_idx]), index->upper_bound(values[lookup_idx])));
+  }
+  EXPECT_EQ(row_ids(ranges[3].first, ranges[3].second),
+            std::vector<RowID>({RowID{ChunkID{0}, ChunkOffset{0}}, RowID{ChunkID{1}, ChunkOffset{2}}}));
+}
+
+TEST_F(TableIndexTest, MemoryUsage) {
+  const auto table_memory_usage = table->memory_usage(MemoryUsageCalculationMode::Sampled);
+  EXPECT_GT(index->memory_usage(), 5 * sizeof(RowID));
+
+  table->create_table_index(ColumnID{1});
+  EXPECT_GT(table->memory_usage(MemoryUsageCalculationMode::Sampled), table_memory_usage);
+}
+
+}  // namespace opossum
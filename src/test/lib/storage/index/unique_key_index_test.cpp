@@ -0,0 +1,101 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/index/unique_key_index.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class UniqueKeyIndexTest : public BaseTest {
+ public:
+  void SetUp() override {
+    table = load_table("resources/test_data/tbl/int_int.tbl", 2);
+    Hyrise::get().storage_manager.add_table("table_a", table);
+    table->enforce_key_constraint({{ColumnID{0}}, KeyConstraintType::PRIMARY_KEY});
+    unique_key_index = table->unique_key_indexes().front();
+  }
+
+  static SQLPipelineStatus execute(const std::string& sql,
+                                   const std::shared_ptr<TransactionContext>& transaction_context = nullptr) {
+    auto builder = SQLPipelineBuilder{sql};
+    if (transaction_context) builder.with_transaction_context(transaction_context);
+    return builder.create_pipeline().get_result_table().first;
+  }
+
+  std::shared_ptr<Table> table;
+  std::shared_ptr<UniqueKeyIndex> unique_key_index;
+};
+
+TEST_F(UniqueKeyIndexTest, BuildAndLookup) {
+  EXPECT_EQ(table->soft_key_constraints().size(), 1u);
+  EXPECT_EQ(unique_key_index->column_ids(), std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_EQ(unique_key_index->size(), 3u);
+
+  EXPECT_EQ(unique_key_index->lookup({int32_t{123}}), std::vector<RowID>{RowID(ChunkID{0}, ChunkOffset{1})});
+  EXPECT_EQ(unique_key_index->lookup({int32_t{1234}}), std::vector<RowID>{RowID(ChunkID{1}, ChunkOffset{0})});
+  EXPECT_TRUE(unique_key_index->lookup({int32_t{42}}).empty());
+
+  // Enforcing the same constraint twice is not allowed
+  EXPECT_THROW(table->enforce_key_constraint({{ColumnID{0}}, KeyConstraintType::PRIMARY_KEY}), std::logic_error);
+}
+
+TEST_F(UniqueKeyIndexTest, CannotEnforceViolatedConstraint) {
+  const auto duplicates_table = load_table("resources/test_data/tbl/int_float2.tbl", 2);
+  EXPECT_THROW(duplicates_table->enforce_key_constraint({{ColumnID{0}}, KeyConstraintType::UNIQUE}), std::logic_error);
+
+  duplicates_table->enforce_key_constraint({{ColumnID{1}}, KeyConstraintType::UNIQUE});
+  EXPECT_EQ(duplicates_table->unique_key_indexes().size(), 1u);
+}
+
+TEST_F(UniqueKeyIndexTest, InsertViolation) {
+  EXPECT_EQ(execute("INSERT INTO table_a VALUES (123, 5)"), SQLPipelineStatus::Failure);
+  EXPECT_EQ(execute("INSERT INTO table_a VALUES (42, 5)"), SQLPipelineStatus::Success);
+  EXPECT_EQ(execute("INSERT INTO table_a VALUES (42, 6)"), SQLPipelineStatus::Failure);
+
+  // Duplicates within a single statement are detected as well
+  EXPECT_EQ(execute("INSERT INTO table_a SELECT 43, b FROM table_a"), SQLPipelineStatus::Failure);
+
+  // The rows of the failed inserts have been removed from the index
+  EXPECT_EQ(unique_key_index->size(), 4u);
+  EXPECT_EQ(unique_key_index->lookup({int32_t{42}}).size(), 1u);
+  EXPECT_TRUE(unique_key_index->lookup({int32_t{43}}).empty());
+}
+
+TEST_F(UniqueKeyIndexTest, UpdateAndDelete) {
+  // The updated row replaces the old version, which is being deleted by the same transaction
+  EXPECT_EQ(execute("UPDATE table_a SET b = 10 WHERE a = 123"), SQLPipelineStatus::Success);
+  EXPECT_EQ(unique_key_index->lookup({int32_t{123}}).size(), 2u);
+
+  // Updating a key to an existing one fails
+  EXPECT_EQ(execute("UPDATE table_a SET a = 1234 WHERE a = 123"), SQLPipelineStatus::Failure);
+
+  // Once the row is deleted, the key can be inserted again
+  EXPECT_EQ(execute("INSERT INTO table_a VALUES (123, 11)"), SQLPipelineStatus::Failure);
+  EXPECT_EQ(execute("DELETE FROM table_a WHERE a = 123"), SQLPipelineStatus::Success);
+  EXPECT_EQ(execute("INSERT INTO table_a VALUES (123, 11)"), SQLPipelineStatus::Success);
+
+  const auto [status, result] = SQLPipelineBuilder{"SELECT b FROM table_a WHERE a = 123"}
+                                    .create_pipeline()
+                                    .get_result_table();
+  EXPECT_EQ(status, SQLPipelineStatus::Success);
+  ASSERT_EQ(result->row_count(), 1u);
+  EXPECT_EQ(result->get_value<int32_t>(ColumnID{0}, 0), 11);
+}
+
+TEST_F(UniqueKeyIndexTest, ConcurrentInsert) {
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_EQ(execute("INSERT INTO table_a VALUES (42, 5)", transaction_context), SQLPipelineStatus::Success);
+
+  // The other transaction might still commit, so the insert cannot succeed
+  EXPECT_EQ(execute("INSERT INTO table_a VALUES (42, 6)"), SQLPipelineStatus::Failure);
+
+  transaction_context->rollback(RollbackReason::User);
+  EXPECT_EQ(execute("INSERT INTO table_a VALUES (42, 6)"), SQLPipelineStatus::Success);
+  EXPECT_EQ(unique_key_index->lookup({int32_t{42}}).size(), 1u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,86 @@
+#include <memory>
+
+#include "base_test.hpp"
+
+#include "storage/mvcc_data.hpp"
+
+namespace opossum {
+
+class StorageMvccDataTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    mvcc_data = std::make_shared<MvccData>(4, CommitID{1});
+    mvcc_data->set_begin_cid(ChunkOffset{1}, CommitID{2});
+    mvcc_data->set_begin_cid(ChunkOffset{2}, CommitID{3});
+    mvcc_data->max_begin_cid = CommitID{3};
+
+    // Row 1 has been deleted, row 3 is locked by an in-flight transaction
+    mvcc_data->set_tid(ChunkOffset{1}, TransactionID{5});
+    mvcc_data->set_end_cid(ChunkOffset{1}, CommitID{4});
+    mvcc_data->set_tid(ChunkOffset{3}, TransactionID{6});
+  }
+
+  std::shared_ptr<MvccData> mvcc_data;
+};
+
+TEST_F(StorageMvccDataTest, Compact) {
+  EXPECT_FALSE(mvcc_data->is_compact());
+  mvcc_data->compact();
+  EXPECT_TRUE(mvcc_data->is_compact());
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 4; ++chunk_offset) {
+    EXPECT_EQ(mvcc_data->get_begin_cid(chunk_offset), CommitID{3});
+  }
+
+  EXPECT_EQ(mvcc_data->get_tid(ChunkOffset{0}), INVALID_TRANSACTION_ID);
+  EXPECT_EQ(mvcc_data->get_tid(ChunkOffset{1}), TransactionID{5});
+  EXPECT_EQ(mvcc_data->get_tid(ChunkOffset{2}), INVALID_TRANSACTION_ID);
+  EXPECT_EQ(mvcc_data->get_tid(ChunkOffset{3}), TransactionID{6});
+
+  EXPECT_EQ(mvcc_data->get_end_cid(ChunkOffset{0}), MvccData::MAX_COMMIT_ID);
+  EXPECT_EQ(mvcc_data->get_end_cid(ChunkOffset{1}), CommitID{4});
+  EXPECT_EQ(mvcc_data->get_end_cid(ChunkOffset{3}), MvccData::MAX_COMMIT_ID);
+
+  auto sparse_row_count = size_t{0};
+  mvcc_data->for_each_sparse_row([&](const auto, const auto, const auto) { ++sparse_row_count; });
+  EXPECT_EQ(sparse_row_count, 2);
+}
+
+TEST_F(StorageMvccDataTest, ModifyCompact) {
+  mvcc_data->compact();
+  mvcc_data->free_uncompacted_data();
+
+  // Lock and delete a previously untouched row
+  EXPECT_TRUE(mvcc_data->compare_exchange_tid(ChunkOffset{0}, INVALID_TRANSACTION_ID, TransactionID{7}));
+  EXPECT_FALSE(mvcc_data->compare_exchange_tid(ChunkOffset{0}, INVALID_TRANSACTION_ID, TransactionID{8}));
+  mvcc_data->set_end_cid(ChunkOffset{0}, CommitID{5});
+  EXPECT_EQ(mvcc_data->get_tid(ChunkOffset{0}), TransactionID{7});
+  EXPECT_EQ(mvcc_data->get_end_cid(ChunkOffset{0}), CommitID{5});
+
+  // Roll back the in-flight lock
+  EXPECT_TRUE(mvcc_data->compare_exchange_tid(ChunkOffset{3}, TransactionID{6}, INVALID_TRANSACTION_ID));
+  EXPECT_EQ(mvcc_data->get_tid(ChunkOffset{3}), INVALID_TRANSACTION_ID);
+}
+
+TEST_F(StorageMvccDataTest, CompactReducesMemoryUsage) {
+  auto large_mvcc_data = std::make_shared<MvccData>(10'000, CommitID{1});
+  large_mvcc_data->max_begin_cid = CommitID{1};
+  large_mvcc_data->set_end_cid(ChunkOffset{17}, CommitID{2});
+
+  const auto full_memory_usage = large_mvcc_data->memory_usage();
+  large_mvcc_data->compact();
+  large_mvcc_data->free_uncompacted_data();
+  EXPECT_LT(large_mvcc_data->memory_usage() * 100, full_memory_usage);
+  EXPECT_EQ(large_mvcc_data->get_end_cid(ChunkOffset{17}), CommitID{2});
+}
+
+TEST_F(StorageMvccDataTest, CompactRequiresMaxBeginCid) {
+  auto unfinalized_mvcc_data = std::make_shared<MvccData>(4, CommitID{1});
+  EXPECT_THROW(unfinalized_mvcc_data->compact(), std::logic_error);
+
+  mvcc_data->compact();
+  EXPECT_THROW(mvcc_data->compact(), std::logic_error);
+  EXPECT_THROW(mvcc_data->set_begin_cid(ChunkOffset{0}, CommitID{1}), std::logic_error);
+}
+
+}  // namespace opossum
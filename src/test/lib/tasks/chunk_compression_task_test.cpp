@@ -111,4 +111,30 @@ TEST_F(ChunkCompressionTaskTest, CompressionWithAbortedInsert) {
   EXPECT_EQ(validate->get_output()->row_count(), 12u);
 }
 
+TEST_F(ChunkCompressionTaskTest, ChunkIsCompleted) {
+  auto table = load_table("resources/test_data/tbl/int3.tbl", 2u);
+  Hyrise::get().storage_manager.add_table("table_insert", table);
+
+  // Chunks created by load_table are immutable, even if they are not full
+  EXPECT_TRUE(ChunkCompressionTask::chunk_is_completed(table->get_chunk(ChunkID{0}), 2u));
+  EXPECT_TRUE(ChunkCompressionTask::chunk_is_completed(table->get_chunk(ChunkID{1}), 2u));
+
+  auto gt = std::make_shared<GetTable>("table_insert");
+  gt->execute();
+
+  auto ins = std::make_shared<Insert>("table_insert", gt);
+  auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  ins->set_transaction_context(context);
+  ins->execute();
+
+  // The inserted rows are not committed yet
+  ASSERT_EQ(table->chunk_count(), 4u);
+  EXPECT_FALSE(ChunkCompressionTask::chunk_is_completed(table->get_chunk(ChunkID{2}), 2u));
+
+  // Full mutable chunks are completed, further rows might be added to the last chunk
+  context->commit();
+  EXPECT_TRUE(ChunkCompressionTask::chunk_is_completed(table->get_chunk(ChunkID{2}), 2u));
+  EXPECT_FALSE(ChunkCompressionTask::chunk_is_completed(table->get_chunk(ChunkID{3}), 2u));
+}
+
 }  // namespace opossum
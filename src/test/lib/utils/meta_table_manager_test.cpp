@@ -105,6 +105,21 @@ TEST_F(MetaTableManagerTest, ForwardsMethodCalls) {
   EXPECT_EQ(mock_table->update_calls(), 1);
 }
 
+TEST_F(MetaTableManagerTest, AddAndRemoveTable) {
+  const auto mock_table = std::make_shared<MetaMockTable>();
+  auto& mtm = Hyrise::get().meta_table_manager;
+
+  mtm.add_table(mock_table);
+  EXPECT_TRUE(mtm.has_table("meta_mock"));
+  EXPECT_NE(std::find(mtm.table_names().cbegin(), mtm.table_names().cend(), "mock"), mtm.table_names().cend());
+  EXPECT_THROW(mtm.add_table(mock_table), std::logic_error);
+
+  mtm.remove_table("meta_mock");
+  EXPECT_FALSE(mtm.has_table("mock"));
+  EXPECT_EQ(std::find(mtm.table_names().cbegin(), mtm.table_names().cend(), "mock"), mtm.table_names().cend());
+  EXPECT_THROW(mtm.remove_table("mock"), std::logic_error);
+}
+
 TEST_P(MetaTableManagerMultiTablesTest, HasAllTables) {
   EXPECT_TRUE(Hyrise::get().meta_table_manager.has_table(GetParam()->name()));
 }
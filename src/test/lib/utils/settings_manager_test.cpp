@@ -2,6 +2,7 @@
 
 #include "./mock_setting.hpp"
 #include "hyrise.hpp"
+#include "utils/settings/operator_memory_budget_setting.hpp"
 
 namespace opossum {
 
@@ -68,4 +69,27 @@ TEST_F(SettingsManagerTest, GetNotLoadedSetting) {
   EXPECT_THROW(settings_manager.get_setting("not_existing_setting"), std::exception);
 }
 
+TEST_F(SettingsManagerTest, OperatorMemoryBudgetSetting) {
+  // Registered by Hyrise itself
+  const auto& settings_manager = Hyrise::get().settings_manager;
+  ASSERT_TRUE(settings_manager.has_setting(OperatorMemoryBudgetSetting::NAME));
+  const auto setting = std::dynamic_pointer_cast<OperatorMemoryBudgetSetting>(
+      settings_manager.get_setting(OperatorMemoryBudgetSetting::NAME));
+  ASSERT_TRUE(setting);
+
+  EXPECT_EQ(setting->get(), "0");
+  EXPECT_FALSE(setting->budget());
+
+  setting->set("16000");
+  EXPECT_EQ(setting->get(), "16000");
+  EXPECT_EQ(setting->budget(), size_t{16'000});
+
+  EXPECT_THROW(setting->set("-1"), InvalidInputException);
+  EXPECT_THROW(setting->set("much"), InvalidInputException);
+  EXPECT_EQ(setting->get(), "16000");
+
+  setting->set("0");
+  EXPECT_FALSE(setting->budget());
+}
+
 }  // namespace opossum
@@ -0,0 +1,162 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+
+#include "../../plugins/delta_merge_plugin.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/insert.hpp"
+#include "operators/pqp_utils.hpp"
+#include "operators/table_wrapper.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/unique_key_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/load_table.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace opossum {
+
+class DeltaMergePluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    _table = load_table("resources/test_data/tbl/int3.tbl", _chunk_size);
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+  }
+
+  void TearDown() override { Hyrise::reset(); }
+
+ protected:
+  static bool _try_merge_chunk(const std::shared_ptr<Table>& table, const ChunkID chunk_id) {
+    return DeltaMergePlugin::_try_merge_chunk(table, chunk_id);
+  }
+
+  std::shared_ptr<TransactionContext> _insert_values(const std::vector<int32_t>& values) {
+    const auto values_to_insert = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+    for (const auto value : values) {
+      values_to_insert->append({value});
+    }
+    const auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+    table_wrapper->execute();
+
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto insert = std::make_shared<Insert>(_table_name, table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+    return transaction_context;
+  }
+
+  const std::string _table_name{"deltaMergeTestTable"};
+  static constexpr auto _chunk_size = size_t{4};
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(DeltaMergePluginTest, LoadUnloadPlugin) {
+  auto& pm = Hyrise::get().plugin_manager;
+  pm.load_plugin(build_dylib_path("libhyriseDeltaMergePlugin"));
+  pm.unload_plugin("hyriseDeltaMergePlugin");
+}
+
+TEST_F(DeltaMergePluginTest, MainEncodingSpec) {
+  EXPECT_FALSE(_table->main_encoding_spec());
+
+  const auto main_encoding_spec = ChunkEncodingSpec{SegmentEncodingSpec{EncodingType::RunLength}};
+  _table->set_main_encoding_spec(main_encoding_spec);
+  EXPECT_EQ(_table->main_encoding_spec(), main_encoding_spec);
+
+  _table->set_main_encoding_spec(std::nullopt);
+  EXPECT_FALSE(_table->main_encoding_spec());
+
+  // Column count does not match
+  EXPECT_THROW(_table->set_main_encoding_spec(ChunkEncodingSpec{2, SegmentEncodingSpec{EncodingType::Dictionary}}),
+               std::logic_error);
+}
+
+TEST_F(DeltaMergePluginTest, MergeCompleteChunks) {
+  _table->set_main_encoding_spec(ChunkEncodingSpec{SegmentEncodingSpec{EncodingType::Dictionary}});
+
+  // Chunk 0 is immutable due to load_table(). Chunk 1 is full, but still mutable: 1, 2, 3 | 4, 5, 6, 7 | 8
+  _insert_values({4, 5, 6, 7, 8})->commit();
+  ASSERT_EQ(_table->chunk_count(), 3);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{1})->is_mutable());
+
+  EXPECT_TRUE(_try_merge_chunk(_table, ChunkID{0}));
+  EXPECT_TRUE(_try_merge_chunk(_table, ChunkID{1}));
+  EXPECT_FALSE(_try_merge_chunk(_table, ChunkID{2}));
+
+  // Merged chunks are part of the main and are not merged again
+  EXPECT_FALSE(_try_merge_chunk(_table, ChunkID{0}));
+  EXPECT_FALSE(_table->get_chunk(ChunkID{1})->is_mutable());
+
+  const auto segment_of_chunk = [&](const auto chunk_id) {
+    return _table->get_chunk(chunk_id)->get_segment(ColumnID{0});
+  };
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(segment_of_chunk(ChunkID{0})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(segment_of_chunk(ChunkID{1})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<int32_t>>(segment_of_chunk(ChunkID{2})));
+
+  EXPECT_EQ(_table->get_value<int32_t>(ColumnID{0}, 5), 6);
+  EXPECT_EQ(_table->get_value<int32_t>(ColumnID{0}, 7), 8);
+}
+
+TEST_F(DeltaMergePluginTest, DoNotMergeChunksWithUncommittedRows) {
+  _table->set_main_encoding_spec(ChunkEncodingSpec{SegmentEncodingSpec{EncodingType::Dictionary}});
+
+  // Chunk 1 is full while the insert is still in progress
+  const auto transaction_context = _insert_values({4, 5, 6, 7});
+  ASSERT_EQ(_table->get_chunk(ChunkID{1})->size(), _chunk_size);
+  EXPECT_FALSE(_try_merge_chunk(_table, ChunkID{1}));
+
+  transaction_context->commit();
+  EXPECT_TRUE(_try_merge_chunk(_table, ChunkID{1}));
+}
+
+TEST_F(DeltaMergePluginTest, PointUpdateOfMergedKey) {
+  const auto table_name = std::string{"deltaMergeKeyTable"};
+  const auto table = load_table("resources/test_data/tbl/int_int.tbl", _chunk_size);
+  table->enforce_key_constraint({{ColumnID{0}}, KeyConstraintType::PRIMARY_KEY});
+  table->set_main_encoding_spec(ChunkEncodingSpec{2, SegmentEncodingSpec{EncodingType::Dictionary}});
+  Hyrise::get().storage_manager.add_table(table_name, table);
+
+  // 12345, 123, 1234 are merged into the main
+  ASSERT_EQ(table->chunk_count(), 1);
+  EXPECT_TRUE(_try_merge_chunk(table, ChunkID{0}));
+
+  // The updated row is found using the primary key index instead of scanning the main. Its new version is appended to
+  // the delta.
+  auto update_pipeline = SQLPipelineBuilder{"UPDATE " + table_name + " SET b = 20 WHERE a = 123"}.create_pipeline();
+  auto uses_unique_index_scan = false;
+  visit_pqp(update_pipeline.get_physical_plans().at(0), [&](const auto& op) {
+    if (op->type() == OperatorType::UniqueIndexScan) uses_unique_index_scan = true;
+    return PQPVisitation::VisitInputs;
+  });
+  EXPECT_TRUE(uses_unique_index_scan);
+  EXPECT_EQ(update_pipeline.get_result_table().first, SQLPipelineStatus::Success);
+
+  ASSERT_EQ(table->chunk_count(), 2);
+  EXPECT_NE(table->get_chunk(ChunkID{0})->mvcc_data()->get_end_cid(ChunkOffset{1}), MvccData::MAX_COMMIT_ID);
+  const auto delta_segment = table->get_chunk(ChunkID{1})->get_segment(ColumnID{1});
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<int32_t>>(delta_segment));
+
+  const auto& unique_key_index = *table->unique_key_indexes().at(0);
+  const auto expected_row_ids =
+      std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{1}}, RowID{ChunkID{1}, ChunkOffset{0}}};
+  EXPECT_EQ(unique_key_index.lookup({int32_t{123}}), expected_row_ids);
+
+  // Merging the delta keeps the RowIDs in the index valid, as the segments are encoded in place
+  table->get_chunk(ChunkID{1})->finalize();
+  EXPECT_TRUE(_try_merge_chunk(table, ChunkID{1}));
+  EXPECT_EQ(unique_key_index.lookup({int32_t{123}}), expected_row_ids);
+
+  auto select_pipeline = SQLPipelineBuilder{"SELECT b FROM " + table_name + " WHERE a = 123"}.create_pipeline();
+  const auto [status, result_table] = select_pipeline.get_result_table();
+  EXPECT_EQ(status, SQLPipelineStatus::Success);
+  ASSERT_EQ(result_table->row_count(), 1);
+  EXPECT_EQ(result_table->get_value<int32_t>(ColumnID{0}, 0), 20);
+}
+
+}  // namespace opossum
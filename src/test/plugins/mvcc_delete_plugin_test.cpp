@@ -1,6 +1,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "base_test.hpp"
@@ -64,9 +65,21 @@ class MvccDeletePluginTest : public BaseTest {
                                   std::shared_ptr<TransactionContext> transaction_context) {
     return MvccDeletePlugin::_try_logical_delete(table_name, chunk_id, transaction_context);
   }
+  static bool _try_compact_mvcc_data(const std::shared_ptr<Chunk>& chunk) {
+    return MvccDeletePlugin::_try_compact_mvcc_data(chunk);
+  }
   static void _delete_chunk_physically(const std::string& table_name, ChunkID chunk_id) {
     MvccDeletePlugin::_delete_chunk_physically(Hyrise::get().storage_manager.get_table(table_name), chunk_id);
   }
+  static double _validation_cost(const Chunk& chunk) { return MvccDeletePlugin::_validation_cost(chunk); }
+  static void _set_delete_threshold_last_commit(MvccDeletePlugin& plugin, const std::string& value) {
+    plugin._delete_threshold_last_commit->set(value);
+  }
+  static void _clean_up_table(MvccDeletePlugin& plugin, const std::string& table_name,
+                              const std::vector<ChunkID>& chunk_ids) {
+    plugin._clean_up_table(table_name, Hyrise::get().storage_manager.get_table(table_name), chunk_ids);
+  }
+  static void _physical_delete_loop(MvccDeletePlugin& plugin) { plugin._physical_delete_loop(); }
 
   static int _get_int_value_from_table(const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
                                        const ColumnID column_id, const ChunkOffset chunk_offset) {
@@ -86,6 +99,109 @@ TEST_F(MvccDeletePluginTest, LoadUnloadPlugin) {
   pm.unload_plugin("hyriseMvccDeletePlugin");
 }
 
+TEST_F(MvccDeletePluginTest, SettingsAndMetaTable) {
+  auto& pm = Hyrise::get().plugin_manager;
+  const auto& settings_manager = Hyrise::get().settings_manager;
+  const auto setting_name = std::string{"MvccDeletePlugin.delete_threshold_invalidated_rows"};
+
+  pm.load_plugin(build_dylib_path("libhyriseMvccDeletePlugin"));
+  ASSERT_TRUE(settings_manager.has_setting(setting_name));
+  EXPECT_TRUE(settings_manager.has_setting("MvccDeletePlugin.delete_threshold_last_commit"));
+  EXPECT_TRUE(settings_manager.has_setting("MvccDeletePlugin.idle_delay_logical_delete_ms"));
+  EXPECT_TRUE(settings_manager.has_setting("MvccDeletePlugin.idle_delay_physical_delete_ms"));
+
+  const auto setting = settings_manager.get_setting(setting_name);
+  EXPECT_EQ(setting->get(), "0.6");
+  setting->set("0.8");
+  EXPECT_EQ(setting->get(), "0.8");
+  EXPECT_THROW(setting->set("many"), InvalidInputException);
+  EXPECT_THROW(setting->set("-0.1"), InvalidInputException);
+  EXPECT_EQ(setting->get(), "0.8");
+
+  ASSERT_TRUE(Hyrise::get().meta_table_manager.has_table("meta_mvcc_delete_plugin"));
+  const auto meta_table = Hyrise::get().meta_table_manager.generate_table("meta_mvcc_delete_plugin");
+  EXPECT_EQ(meta_table->column_count(), 7);
+
+  pm.unload_plugin("hyriseMvccDeletePlugin");
+  EXPECT_FALSE(settings_manager.has_setting(setting_name));
+  EXPECT_FALSE(Hyrise::get().meta_table_manager.has_table("meta_mvcc_delete_plugin"));
+}
+
+TEST_F(MvccDeletePluginTest, ConcurrentSettingAccess) {
+  auto& pm = Hyrise::get().plugin_manager;
+  pm.load_plugin(build_dylib_path("libhyriseMvccDeletePlugin"));
+  const auto setting =
+      Hyrise::get().settings_manager.get_setting("MvccDeletePlugin.delete_threshold_invalidated_rows");
+
+  // Reading the setting while it is changed yields either the old or the new value
+  auto writer = std::thread{[&]() {
+    for (auto iteration = 0; iteration < 1000; ++iteration) {
+      setting->set(iteration % 2 == 0 ? "0.25" : "0.75");
+    }
+  }};
+  for (auto iteration = 0; iteration < 1000; ++iteration) {
+    const auto value = setting->get();
+    EXPECT_TRUE(value == "0.6" || value == "0.25" || value == "0.75");
+  }
+  writer.join();
+  EXPECT_EQ(setting->get(), "0.75");
+
+  pm.unload_plugin("hyriseMvccDeletePlugin");
+}
+
+TEST_F(MvccDeletePluginTest, ValidationCost) {
+  const auto table = Hyrise::get().storage_manager.get_table(_table_name);
+
+  // --- Expected: _, _, _ | 2, 3, 4
+  _increment_all_values_by_one();
+  const auto chunk = table->get_chunk(ChunkID{0});
+  EXPECT_EQ(chunk->invalid_row_count(), 3);
+  const auto cost = _validation_cost(*chunk);
+  EXPECT_GE(cost, 3.0);
+
+  // Scanning the chunk twice more makes its invalidated rows twice as expensive
+  chunk->get_segment(ColumnID{0})->access_counter[SegmentAccessCounter::AccessType::Sequential] += 2 * chunk->size();
+  EXPECT_DOUBLE_EQ(_validation_cost(*chunk), cost + 2 * 3.0);
+
+  // Chunks without invalidated rows do not cause any cost
+  EXPECT_EQ(_validation_cost(*table->get_chunk(ChunkID{1})), 0.0);
+}
+
+TEST_F(MvccDeletePluginTest, CleanupStatistics) {
+  const auto table = Hyrise::get().storage_manager.get_table(_table_name);
+  auto plugin = MvccDeletePlugin{};
+
+  // --- Expected: _, _, _ | _, _, _, 3 | 4, 5
+  _increment_all_values_by_one();
+  _increment_all_values_by_one();
+  EXPECT_TRUE(plugin.cleanup_statistics().empty());
+
+  // With the default threshold, the chunks have been modified too recently
+  _clean_up_table(plugin, _table_name, {ChunkID{0}, ChunkID{1}});
+  EXPECT_FALSE(table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+  EXPECT_EQ(plugin.cleanup_statistics()[_table_name].logically_deleted_chunks, 0);
+
+  _set_delete_threshold_last_commit(plugin, "0");
+  _clean_up_table(plugin, _table_name, {ChunkID{0}, ChunkID{1}});
+  EXPECT_TRUE(table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+  EXPECT_TRUE(table->get_chunk(ChunkID{1})->get_cleanup_commit_id());
+
+  auto statistics = plugin.cleanup_statistics()[_table_name];
+  EXPECT_EQ(statistics.logically_deleted_chunks, 2);
+  EXPECT_EQ(statistics.failed_logical_deletes, 0);
+  EXPECT_EQ(statistics.removed_invalid_rows, 6);
+  EXPECT_EQ(statistics.physically_deleted_chunks, 0);
+
+  // No transaction is active, so both chunks are deleted in a single run
+  _physical_delete_loop(plugin);
+  EXPECT_FALSE(table->get_chunk(ChunkID{0}));
+  EXPECT_FALSE(table->get_chunk(ChunkID{1}));
+
+  statistics = plugin.cleanup_statistics()[_table_name];
+  EXPECT_EQ(statistics.physically_deleted_chunks, 2);
+  EXPECT_GT(statistics.saved_memory_bytes, 0);
+}
+
 /**
  * This test checks the logical delete. All values in the table are incremented to
  * generate three invalidated rows and create a second chunk. Before the logical delete
@@ -208,4 +324,38 @@ TEST_F(MvccDeletePluginTest, PhysicalDelete) {
   EXPECT_TRUE(table->get_chunk(chunk_to_delete_id) == nullptr);
 }
 
+/**
+ * This test checks the compaction of MVCC data. The immutable first chunk is fully invalidated, the second chunk is
+ * still mutable. Only the first chunk's MvccData can be compacted, and visibility is the same afterwards.
+ */
+TEST_F(MvccDeletePluginTest, CompactMvccData) {
+  const auto table = Hyrise::get().storage_manager.get_table(_table_name);
+
+  // --- Expected: _, _, _ | 2, 3, 4
+  _increment_all_values_by_one();
+  const auto compacted_chunk = table->get_chunk(ChunkID{0});
+  const auto mutable_chunk = table->get_chunk(ChunkID{1});
+
+  // Active transactions do not prevent the compaction as long as their snapshots include all rows of the chunk.
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+
+  EXPECT_TRUE(_try_compact_mvcc_data(compacted_chunk));
+  EXPECT_TRUE(compacted_chunk->mvcc_data()->is_compact());
+  EXPECT_FALSE(_try_compact_mvcc_data(compacted_chunk));
+  EXPECT_FALSE(_try_compact_mvcc_data(mutable_chunk));
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < compacted_chunk->size(); ++chunk_offset) {
+    EXPECT_NE(compacted_chunk->mvcc_data()->get_end_cid(chunk_offset), MvccData::MAX_COMMIT_ID);
+  }
+
+  auto get_table = std::make_shared<GetTable>(_table_name);
+  get_table->set_transaction_context(transaction_context);
+  get_table->execute();
+  auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(transaction_context);
+  validate->execute();
+  EXPECT_EQ(validate->get_output()->row_count(), 3);
+  EXPECT_EQ(_get_int_value_from_table(validate->get_output(), ChunkID{0}, ColumnID{0}, ChunkOffset{0}), 2);
+}
+
 }  // namespace opossum